@@ -3,11 +3,18 @@
 // ------------------------------------------------------------------------------
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
 #include <memutils/message/Message.h>
 #include "../include/msgq_id.h"
 #include "../include/msgq_pool.h"
+#include "../include/trace.h"
 
-#include "../include/mavlink/v2.0/common/mavlink.h"
+#include "../include/mavlink/v2.0/spresense/mavlink.h"
+#include "../include/gps_msgq.h"
+#include "../include/topics.h"
+#include "../include/thread_config.h"
 
 using std::string;
 using namespace std;
@@ -18,23 +25,24 @@ using namespace std;
 
 extern "C" int main(int argc, char **argv);
 
+// Time between passes of stream(), one system tick
+#define GPS_STREAM_PERIOD_US 10000
+
 class GPS_class
 {
 public:
 	void set();
+	void publish();
 	void send();
+	void stream(int rate_hz);
 	GPS_class();
 
 private:
 	mavlink_hil_gps_t gps_input;
+	gps_fix_batch_t batch;
 	MsgQueId send_id;
 	MsgQueId ret_id;
 	MSG_TYPE msg_type;
 	MsgQueBlock *que;
 	MsgPacket *msg;
 };
-
-struct message_t
-{
-	int num;
-};
\ No newline at end of file
@@ -1,14 +1,14 @@
 #include "GPS.h"
 
-uint8_t AutoGenMesgBuff[1204];
+uint8_t AutoGenMesgBuff[1048];
 
 MsgQueDef MsgqPoolDefs[NUM_MSGQ_POOLS] =
     {
         /* n_drm, n_size, n_num, h_drm, h_size, h_num */
 
         {0x00000000, 0, 0, 0x00000000, 0, 0, 0},                    /* MSGQ_NULL */
-        {(drm_t)AutoGenMesgBuff + 0xcc, 100, 5, 0xffffffff, 0, 0},  /* MSGQ_MAVLINK */
-        {(drm_t)AutoGenMesgBuff + 0x2c0, 100, 5, 0xffffffff, 0, 0}, /* MSGQ_GPS */
+        {(drm_t)AutoGenMesgBuff + 0xcc, 172, 4, (drm_t)AutoGenMesgBuff + 0x37c, 48, 2}, /* MSGQ_MAVLINK */
+        {(drm_t)AutoGenMesgBuff + 0x3dc, 12, 5, 0xffffffff, 0, 0},                      /* MSGQ_GPS */
 };
 
 GPS_class::GPS_class()
@@ -16,6 +16,7 @@ GPS_class::GPS_class()
   send_id = MSGQ_MAVLINK; // Assign ID that be sent to a variable "send_id".
   ret_id = MSGQ_GPS;      // Assign ID that will return to a variable "self_id".
   msg_type = MSG_TYPE_RESPONSE;
+  gps_batch_init(batch, 0);
 }
 
 void GPS_class::set()
@@ -41,6 +42,12 @@ void GPS_class::set()
   gps_input.satellites_visible = 1;
 }
 
+// the fix for any app in the image, see include/topics.h
+void GPS_class::publish()
+{
+  topic_gps_fix().publish(gps_input);
+}
+
 void GPS_class::send()
 {
   // receceve request message
@@ -49,43 +56,98 @@ void GPS_class::send()
   if (msg->getType() == msg_type)
   {                                                  // Check that the message type is as expected or not.
     message_t message = msg->moveParam<message_t>(); // get an instance of type Object from Message packet.
-    printf("receive_msg: %d\n", message.num);
-    err = MsgLib::send<mavlink_hil_gps_t>(send_id, MsgPriNormal, msg_type, ret_id, gps_input);
+    TRACE1(TRACE_GPS_RECEIVE, message.num);
+    err = gps_fix_send(gps_input, ret_id); // high priority lane, ahead of any batches
     if (err != ERR_OK)
     {
       printf("send error: %x\n", err);
     }
-    printf("send OK");
+    TRACE0(TRACE_GPS_SEND);
 
     err = que->pop(); // Release the message block.
   }
 }
 
-int main(int argc, FAR char *argv[])
+/*
+ * Produces rate_hz fixes a second, as a log replay would, and streams them
+ * in batches on the normal lane: what accumulated in one pass goes out in
+ * one packet, GPS_FIX_BATCH_MAX at most.  When the lane is full the batch
+ * is kept and thinned to its newest fixes rather than waiting.  Requests
+ * are still answered at once with the freshest fix on the high lane.
+ */
+void GPS_class::stream(int rate_hz)
 {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  uint64_t start_usec = (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+  uint64_t produced = 0;
 
-  // 初期化
-  err_t err = MsgLib::initFirst(NUM_MSGQ_POOLS, MSGQ_TOP_DRM);
-  if (err != ERR_OK && err != ERR_STS)
+  err_t err = MsgLib::referMsgQueBlock(ret_id, &que);
+  while (1)
   {
-    printf("MsgLib::initFirst error: %x\n", err);
-    return 1; // 初期化エラーの場合、終了する
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    uint64_t now_usec = (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+    uint64_t due = (now_usec - start_usec) * rate_hz / 1000000;
+
+    for (; produced < due; produced++)
+    {
+      set();
+      gps_input.time_usec = start_usec + produced * 1000000 / rate_hz;
+      publish();
+      gps_batch_add(batch, gps_input);
+      if (batch.count == GPS_FIX_BATCH_MAX)
+        gps_batch_send(batch, ret_id);
+    }
+    gps_batch_send(batch, ret_id);
+
+    // answer requests without waiting for them
+    while (que->recv(TIME_POLLING, &msg) == ERR_OK)
+    {
+      if (msg->getType() == msg_type)
+      {
+        message_t message = msg->moveParam<message_t>();
+        TRACE1(TRACE_GPS_RECEIVE, message.num);
+        err = gps_fix_send(gps_input, ret_id);
+        if (err != ERR_OK)
+        {
+          printf("send error: %x\n", err);
+        }
+        TRACE0(TRACE_GPS_SEND);
+      }
+      err = que->pop();
+    }
+
+    usleep(GPS_STREAM_PERIOD_US);
   }
+}
+
+int main(int argc, FAR char *argv[])
+{
+  // CPU、優先度はスレッド構成表 (include/thread_config.h) に従う
+  thread_config_apply_self(THREAD_GPS);
 
-  while (ERR_OK != MsgLib::initPerCpu())
+  // 初期化 (initPerCpu は短い間隔で再試行する)
+  err_t err = gps_msgq_init();
+  if (err != ERR_OK)
   {
-    printf("MsgLib::initPerCpu error: retrying...\n");
-    usleep(1000 * 1000); // 一定時間待ってから再試行
+    printf("MsgLib::initFirst error: %x\n", err);
+    return 1; // 初期化エラーの場合、終了する
   }
   printf("sender_init:OK\n");
-  while (ERR_OK != MsgLib::initPerCpu())
-    ;
 
   GPS_class gps;
 
+  // GPS <rate_hz> streams fixes at that rate, otherwise one per request
+  int rate_hz = argc > 1 ? atoi(argv[1]) : 0;
+  if (rate_hz > 0)
+  {
+    gps.stream(rate_hz);
+  }
+
   while (1)
   {
     gps.set();
+    gps.publish();
     gps.send();
   }
   return 0;
@@ -88,7 +88,7 @@ void set_position(float x, float y, float z, mavlink_set_position_target_local_n
 	sp.y = y;
 	sp.z = z;
 
-	printf("POSITION SETPOINT XYZ = [ %.4f , %.4f , %.4f ] \n", sp.x, sp.y, sp.z);
+	TRACE3(TRACE_SET_POSITION, sp.x, sp.y, sp.z);
 }
 
 /*
@@ -109,7 +109,7 @@ void set_velocity(float vx, float vy, float vz, mavlink_set_position_target_loca
 	sp.vy = vy;
 	sp.vz = vz;
 
-	printf("VELOCITY SETPOINT UVW = [ %.4f , %.4f , %.4f ] \n", sp.vx, sp.vy, sp.vz);
+	TRACE3(TRACE_SET_VELOCITY, sp.vx, sp.vy, sp.vz);
 }
 
 /*
@@ -153,7 +153,7 @@ void set_yaw(float yaw, mavlink_set_position_target_local_ned_t &sp)
 
 	sp.yaw = yaw;
 
-	printf("POSITION SETPOINT YAW = %.4f \n", sp.yaw);
+	TRACE1(TRACE_SET_YAW, sp.yaw);
 }
 
 /*
@@ -179,7 +179,7 @@ void set_yaw_rate(float yaw_rate, mavlink_set_position_target_local_ned_t &sp)
 //   Con/De structors
 // ------------------------------------------------------------------------------
 Autopilot_Interface::
-	Autopilot_Interface(Generic_Port *port_)
+	Autopilot_Interface(Generic_Port *port_) : message_intervals(port_)
 {
 	// initialize attributes
 	write_count = 0;
@@ -191,6 +191,7 @@ Autopilot_Interface::
 
 	read_tid = 0;  // read thread id
 	write_tid = 0; // write thread id
+	gps_tid = 0;   // GPS forward thread id
 
 	system_id = 0;	  // system id
 	autopilot_id = 0; // autopilot component id
@@ -201,26 +202,111 @@ Autopilot_Interface::
 
 	port = port_; // port management object
 
+	log_receiver = NULL; // optional autopilot log sink
+
+	frame_pool = NULL; // optional, with the sinks of received frames
+	num_frame_sinks = 0;
+
+	pthread_mutex_init(&gps_lock, NULL);
+	pthread_cond_init(&gps_cond, NULL);
+	memset(&gps_stream, 0, sizeof(gps_stream));
+	gps_next_seq = 0;
+	gps_reply_ready = false;
+
+	topics_consumer = message_intervals.add_consumer("topics");
+	topics_checked_usec = 0;
+
 	// メッセージキューの初期化
-	err_t err = MsgLib::initFirst(NUM_MSGQ_POOLS, MSGQ_TOP_DRM);
-	if (err != ERR_OK && err != ERR_STS)
+	err_t err = gps_msgq_init();
+	if (err != ERR_OK)
 	{
 		printf("MsgLib::initFirst error: %x\n", err);
 	}
-
-	while (ERR_OK != MsgLib::initPerCpu())
+	else
 	{
-		printf("MsgLib::initPerCpu error: retrying...\n");
-		usleep(1000 * 1000); // 一定時間待ってから再試行
+		printf("sender_init:OK\n");
+		startup_events().set(STARTUP_MSGLIB_READY);
 	}
-	printf("sender_init:OK\n");
-	while (ERR_OK != MsgLib::initPerCpu())
-		;
 }
 
 Autopilot_Interface::
 	~Autopilot_Interface()
 {
+	pthread_cond_destroy(&gps_cond);
+	pthread_mutex_destroy(&gps_lock);
+}
+
+// ------------------------------------------------------------------------------
+//   Log Receiver
+// ------------------------------------------------------------------------------
+void Autopilot_Interface::
+	set_log_receiver(Log_Receiver *log_receiver_)
+{
+	log_receiver = log_receiver_;
+}
+
+// ------------------------------------------------------------------------------
+//   Frame Sinks
+// ------------------------------------------------------------------------------
+/*
+ * Set before start().  With a pool and at least one sink every frame read
+ * is read into a pooled frame, and each sink gets a handle to it after
+ * read_messages() handled it.
+ */
+void Autopilot_Interface::
+	set_frame_pool(Frame_Pool *frame_pool_)
+{
+	frame_pool = frame_pool_;
+}
+
+bool Autopilot_Interface::
+	add_frame_sink(Frame_Sink *sink)
+{
+	if (num_frame_sinks == AUTOPILOT_MAX_FRAME_SINKS)
+		return false;
+	frame_sinks[num_frame_sinks++] = sink;
+	return true;
+}
+
+// ------------------------------------------------------------------------------
+//   Signing
+// ------------------------------------------------------------------------------
+/*
+ * Hands the key to the autopilot with SETUP_SIGNING, still unsigned, then
+ * signs everything after it.  The autopilot only accepts SETUP_SIGNING over
+ * a link it trusts, so call this once on the wired link before flying.
+ */
+int Autopilot_Interface::
+	enable_signing(Mavlink_Signing *signing_)
+{
+	printf("SETUP_SIGNING\n");
+
+	mavlink_setup_signing_t setup;
+	memset(&setup, 0, sizeof(setup));
+	setup.target_system = system_id;
+	setup.target_component = autopilot_id;
+	setup.initial_timestamp = signing_->get_timestamp();
+	signing_->get_key(setup.secret_key);
+
+	// Encode
+	mavlink_message_t message;
+	mavlink_msg_setup_signing_encode(system_id, companion_id, &message, &setup);
+
+	// Send the message
+	int len = port->write_message(message);
+	memset(&setup, 0, sizeof(setup));
+
+	// check the write
+	if (len <= 0)
+	{
+		fprintf(stderr, "WARNING: could not send SETUP_SIGNING \n");
+		return len;
+	}
+
+	port->set_signing(signing_);
+
+	// Done!
+	return len;
 }
 
 // ------------------------------------------------------------------------------
@@ -242,15 +328,21 @@ void Autopilot_Interface::
 	bool success;			   // receive success flag
 	bool received_all = false; // receive only one message
 	Time_Stamps this_timestamps;
-	printf("READ MESSAGE\n");
+	Frame_Handle frame;		   // pooled, for the frame sinks
 
-	// Blocking wait for new data
-	while (!received_all and !time_to_exit)
+	// Blocking wait for new data, give up once the port is gone (end of a replay)
+	while (!received_all and !time_to_exit and port->is_running())
 	{
 		// ----------------------------------------------------------------------
 		//   READ MESSAGE
 		// ----------------------------------------------------------------------
-		mavlink_message_t message;
+		// a frame a sink kept is the sink's now, read into a fresh one; when
+		// the pool is exhausted the sinks miss this frame
+		if (frame_pool && num_frame_sinks && !frame.writable())
+			frame = frame_pool->alloc();
+
+		mavlink_message_t stack_message;
+		mavlink_message_t &message = frame ? *frame.writable() : stack_message;
 		success = port->read_message(message);
 
 		// ----------------------------------------------------------------------
@@ -263,6 +355,10 @@ void Autopilot_Interface::
 			// Note this doesn't handle multiple message sources.
 			current_messages.sysid = message.sysid;
 			current_messages.compid = message.compid;
+			startup_events().set(STARTUP_FIRST_MESSAGE);
+
+			// acks, heartbeats and streams nobody asked for
+			message_intervals.handle_message(message);
 
 			// Handle Message ID
 			switch (message.msgid)
@@ -272,6 +368,8 @@ void Autopilot_Interface::
 			{
 				// printf("MAVLINK_MSG_ID_HEARTBEAT\n");
 				mavlink_msg_heartbeat_decode(&message, &(current_messages.heartbeat));
+				startup_events().set(STARTUP_FIRST_HEARTBEAT);
+				topic_vehicle_heartbeat().publish(current_messages.heartbeat);
 				current_messages.time_stamps.heartbeat = get_time_usec();
 				this_timestamps.heartbeat = current_messages.time_stamps.heartbeat;
 				break;
@@ -308,6 +406,7 @@ void Autopilot_Interface::
 			{
 				// printf("MAVLINK_MSG_ID_LOCAL_POSITION_NED\n");
 				mavlink_msg_local_position_ned_decode(&message, &(current_messages.local_position_ned));
+				topic_vehicle_local_position().publish(current_messages.local_position_ned);
 				current_messages.time_stamps.local_position_ned = get_time_usec();
 				this_timestamps.local_position_ned = current_messages.time_stamps.local_position_ned;
 				break;
@@ -317,6 +416,7 @@ void Autopilot_Interface::
 			{
 				// printf("MAVLINK_MSG_ID_GLOBAL_POSITION_INT\n");
 				mavlink_msg_global_position_int_decode(&message, &(current_messages.global_position_int));
+				topic_vehicle_global_position().publish(current_messages.global_position_int);
 				current_messages.time_stamps.global_position_int = get_time_usec();
 				this_timestamps.global_position_int = current_messages.time_stamps.global_position_int;
 				break;
@@ -353,6 +453,7 @@ void Autopilot_Interface::
 			{
 				// printf("MAVLINK_MSG_ID_ATTITUDE\n");
 				mavlink_msg_attitude_decode(&message, &(current_messages.attitude));
+				topic_vehicle_attitude().publish(current_messages.attitude);
 				current_messages.time_stamps.attitude = get_time_usec();
 				this_timestamps.attitude = current_messages.time_stamps.attitude;
 				break;
@@ -371,11 +472,24 @@ void Autopilot_Interface::
 			{
 				// printf("MAVLINK_MSG_ID_COMMAND_ACK\n");
 				mavlink_msg_command_ack_decode(&message, &(current_messages.command_ack));
+				// not the SET_MESSAGE_INTERVAL acks, they come in first
+				if (current_messages.command_ack.command == MAV_CMD_REQUEST_AUTOPILOT_CAPABILITIES)
+					startup_events().set(STARTUP_CALIBRATE_ACK);
 				current_messages.time_stamps.command_ack = get_time_usec();
 				this_timestamps.command_ack = current_messages.time_stamps.command_ack;
 				break;
 			}
 
+			case MAVLINK_MSG_ID_LOGGING_DATA:
+			case MAVLINK_MSG_ID_LOGGING_DATA_ACKED:
+			case MAVLINK_MSG_ID_REMOTE_LOG_DATA_BLOCK:
+			{
+				// only copies into the log buffer, storage is written elsewhere
+				if (log_receiver)
+					log_receiver->handle_message(message);
+				break;
+			}
+
 			default:
 			{
 				// printf("Warning, did not handle message id %i\n",message.msgid);
@@ -384,8 +498,26 @@ void Autopilot_Interface::
 
 			} // end: switch msgid
 
+			latency_histogram(LATENCY_DISPATCH).record_since(port->get_frame_stamp());
+
+			// the same frame to every sink, by reference
+			if (frame)
+			{
+				frame.set_stamp(port->get_frame_stamp());
+				for (int i = 0; i < num_frame_sinks; i++)
+					frame_sinks[i]->handle_frame(frame);
+			}
+
 		} // end: if read message
 
+		// send any log acks that have waited long enough
+		if (log_receiver)
+			log_receiver->poll();
+
+		// next stream interval command, if any
+		message_intervals.poll();
+		_update_topic_intervals();
+
 		// Check for receipt of all items
 		received_all =
 			this_timestamps.heartbeat &&
@@ -411,6 +543,40 @@ void Autopilot_Interface::
 	return;
 }
 
+// ------------------------------------------------------------------------------
+//   Topic Intervals
+// ------------------------------------------------------------------------------
+/*
+ * The vehicle topics are published from streams that only run while some
+ * task subscribes to them
+ */
+void Autopilot_Interface::
+	_update_topic_intervals()
+{
+	uint64_t now = get_time_usec();
+	if (now - topics_checked_usec < AUTOPILOT_TOPIC_CHECK_US)
+		return;
+	topics_checked_usec = now;
+
+	struct
+	{
+		int subscribers;
+		uint16_t msgid;
+	} topics[] = {
+		{topic_vehicle_attitude().get_subscribers(), MAVLINK_MSG_ID_ATTITUDE},
+		{topic_vehicle_local_position().get_subscribers(), MAVLINK_MSG_ID_LOCAL_POSITION_NED},
+		{topic_vehicle_global_position().get_subscribers(), MAVLINK_MSG_ID_GLOBAL_POSITION_INT},
+	};
+
+	for (unsigned i = 0; i < sizeof(topics) / sizeof(topics[0]); i++)
+	{
+		if (topics[i].subscribers)
+			message_intervals.subscribe(topics_consumer, topics[i].msgid, AUTOPILOT_TOPIC_RATE_HZ);
+		else
+			message_intervals.unsubscribe(topics_consumer, topics[i].msgid);
+	}
+}
+
 // ------------------------------------------------------------------------------
 //   Write Message
 // ------------------------------------------------------------------------------
@@ -427,6 +593,18 @@ int Autopilot_Interface::
 	return len;
 }
 
+// a frame from frame_encode(), the port signs it in place
+int Autopilot_Interface::
+	write_frame(uint8_t *frame, unsigned len)
+{
+	int written = port->write_frame(frame, len);
+
+	// book keep
+	write_count++;
+
+	return written;
+}
+
 // 追加
 
 // 追加
@@ -574,39 +752,51 @@ int Autopilot_Interface::
 	MsgQueId send_id = MSGQ_GPS;	// Assign ID that be sent to a variable "send_id".
 	MsgQueId ret_id = MSGQ_MAVLINK; // Assign ID that will return to a variable "self_id".
 	MSG_TYPE msg_type = MSG_TYPE_RESPONSE;
-	MsgQueBlock *que;
-	MsgPacket *msg;
 
-	mavlink_message_t message;
+	// encoded straight into what goes to the port
+	uint8_t frame[FRAME_ENCODER_BUFFER_LEN];
+	unsigned frame_len = 0;
+
+	// a reply left over from a request stop() cut short is stale
+	pthread_mutex_lock(&gps_lock);
+	gps_reply_ready = false;
+	pthread_mutex_unlock(&gps_lock);
 
 	// request GPS message
 	message_t q_msg = {0};
+	uint32_t request_stamp = latency_stamp();
 	err_t err = MsgLib::send<message_t>(send_id, MsgPriNormal, msg_type, ret_id, q_msg);
 	if (err != ERR_OK)
 	{
 		printf("request error: %x\n", err);
 	}
-	printf("GPS_request: %d\n", q_msg.num);
-	while (1)
+	TRACE1(TRACE_GPS_REQUEST, q_msg.num);
+
+	// the GPS forward thread receives the reply, and the batches before it
+	pthread_mutex_lock(&gps_lock);
+	while (!gps_reply_ready && !time_to_exit)
+		pthread_cond_wait(&gps_cond, &gps_lock);
+	if (!gps_reply_ready)
 	{
-		// receceve request message
-		err_t err = MsgLib::referMsgQueBlock(ret_id, &que);
-		err = que->recv(TIME_FOREVER, &msg);
-		if (msg->getType() == msg_type)
-		{																	   // Check that the message type is as expected or not.
-			mavlink_hil_gps_t gps_input = msg->moveParam<mavlink_hil_gps_t>(); // get an instance of type Object from Message packet.
-			gps_input.time_usec = time_usec;
-			printf("gpsinput.lat = %d, gpsinput.lon = %d\n", gps_input.lat, gps_input.lon);
-			mavlink_msg_hil_gps_encode(target_system, target_component, &message, &gps_input);
-			err = que->pop(); // Release the message block.
-			break;
-		}
+		pthread_mutex_unlock(&gps_lock);
+		return 0;
 	}
+	mavlink_hil_gps_t gps_input = gps_reply;
+	gps_reply_ready = false;
+	pthread_mutex_unlock(&gps_lock);
+
+	latency_histogram(LATENCY_MSGLIB_REPLY).record_since(request_stamp);
+	gps_input.time_usec = time_usec;
+	TRACE2(TRACE_HIL_GPS, gps_input.lat, gps_input.lon);
+	frame_len = frame_encode(frame, target_system, target_component, MAVLINK_MSG_ID_HIL_GPS, gps_input);
+
 	// Send the message
-	int len = port->write_message(message);
+	int len = port->write_frame(frame, frame_len);
 	// check the write
 	if (len <= 0)
 		fprintf(stderr, "WARNING: could not send GPS_INPUT_message \n");
+	else
+		startup_events().set(STARTUP_FIRST_HIL_GPS);
 	//	else
 	//		printf("%lu POSITION_TARGET  = [ %f , %f , %f ] \n", write_count, position_target.x, position_target.y, position_target.z);
 
@@ -614,6 +804,103 @@ int Autopilot_Interface::
 	return len;
 }
 
+// ------------------------------------------------------------------------------
+//   GPS Forward Thread
+// ------------------------------------------------------------------------------
+/*
+ * Receives everything the GPS task sends to MSGQ_MAVLINK as it comes: the
+ * fixes of each batch go on to the port at once, so the lane never fills
+ * up waiting for the next fix request, and the reply to a fix request is
+ * handed over to send_input_hil_gps_message().
+ */
+void Autopilot_Interface::
+	gps_forward_thread(void)
+{
+	MsgQueBlock *que;
+	MsgPacket *msg;
+
+	err_t err = MsgLib::referMsgQueBlock(MSGQ_MAVLINK, &que);
+	if (err != ERR_OK)
+	{
+		printf("MsgLib::referMsgQueBlock error: %x\n", err);
+		return;
+	}
+
+	while (!time_to_exit)
+	{
+		if (que->recv(AUTOPILOT_GPS_POLL_MS, &msg) != ERR_OK)
+			continue;
+
+		// GPS messages waiting behind this one, shows up as the link's queue depth
+		port->get_link_stats()->queue_depth(que->getNumMsg(MsgPriNormal));
+
+		if (msg->getType() == MSG_TYPE_GPS_BATCH)
+		{
+			gps_fix_batch_t batch = msg->moveParam<gps_fix_batch_t>();
+			que->pop();
+			_forward_gps_batch(batch);
+		}
+		else if (msg->getType() == MSG_TYPE_GPS_FIX)
+		{
+			mavlink_hil_gps_t fix = msg->moveParam<mavlink_hil_gps_t>();
+			que->pop();
+
+			pthread_mutex_lock(&gps_lock);
+			gps_reply = fix;
+			gps_reply_ready = true;
+			pthread_cond_broadcast(&gps_cond);
+			pthread_mutex_unlock(&gps_lock);
+		}
+		else
+		{
+			que->pop();
+		}
+	}
+}
+
+void Autopilot_Interface::
+	_forward_gps_batch(const gps_fix_batch_t &batch)
+{
+	pthread_mutex_lock(&gps_lock);
+	gps_stream.batches++;
+	gps_stream.thinned += batch.dropped;
+	// a sequence that goes back is the GPS task starting again, not loss
+	int32_t gap = (int32_t)(batch.seq - gps_next_seq);
+	if (gap > 0 && gps_stream.batches > 1)
+		gps_stream.lost += gap;
+	else if (gap < 0)
+		gps_stream.restarts++;
+	gps_next_seq = batch.seq + 1;
+	pthread_mutex_unlock(&gps_lock);
+
+	// each fix keeps the time the GPS task stamped it with
+	for (int i = 0; i < batch.count; i++)
+	{
+		mavlink_hil_gps_t gps_input = batch.fix[i];
+		TRACE2(TRACE_HIL_GPS, gps_input.lat, gps_input.lon);
+
+		uint8_t frame[FRAME_ENCODER_BUFFER_LEN];
+		unsigned len = frame_encode(frame, system_id, autopilot_id, MAVLINK_MSG_ID_HIL_GPS, gps_input);
+		if (port->write_frame(frame, len) > 0)
+		{
+			pthread_mutex_lock(&gps_lock);
+			gps_stream.fixes++;
+			pthread_mutex_unlock(&gps_lock);
+			startup_events().set(STARTUP_FIRST_HIL_GPS);
+		}
+	}
+}
+
+GPS_Stream_Stats
+Autopilot_Interface::
+	get_gps_stream_stats()
+{
+	pthread_mutex_lock(&gps_lock);
+	GPS_Stream_Stats copy = gps_stream;
+	pthread_mutex_unlock(&gps_lock);
+	return copy;
+}
+
 // ------------------------------------------------------------------------------
 //   Write Message MAV_CMD_REQUEST_AUTOPILOT_CAPABILITIES ( 520 )
 // ------------------------------------------------------------------------------
@@ -917,15 +1204,16 @@ void Autopilot_Interface::
 	//   ENCODE
 	// --------------------------------------------------------------------------
 
-	mavlink_message_t message;
-	mavlink_msg_set_position_target_local_ned_encode(system_id, companion_id, &message, &sp);
+	// straight into the buffer the port writes, no mavlink_message_t
+	uint8_t frame[FRAME_ENCODER_BUFFER_LEN];
+	unsigned frame_len = frame_encode(frame, system_id, companion_id, MAVLINK_MSG_ID_SET_POSITION_TARGET_LOCAL_NED, sp);
 
 	// --------------------------------------------------------------------------
 	//   WRITE
 	// --------------------------------------------------------------------------
 
 	// do the write
-	int len = write_message(message);
+	int len = write_frame(frame, frame_len);
 
 	// check the write
 	if (len <= 0)
@@ -1109,7 +1397,7 @@ void Autopilot_Interface::
 
 	printf("START READ THREAD \n");
 
-	result = pthread_create(&read_tid, NULL, &start_autopilot_interface_read_thread, this);
+	result = thread_config_create(&read_tid, THREAD_READ, &start_autopilot_interface_read_thread, this);
 	if (result)
 		throw result;
 
@@ -1122,12 +1410,9 @@ void Autopilot_Interface::
 
 	printf("CHECK FOR MESSAGES\n");
 
-	while (not current_messages.sysid)
-	{
-		if (time_to_exit)
-			return;
-		usleep(500000); // check at 2Hz
-	}
+	// woken by the first frame the read thread decodes, or by stop()
+	if (not startup_events().wait(STARTUP_FIRST_MESSAGE, -1))
+		return;
 
 	printf("Found\n");
 
@@ -1157,6 +1442,9 @@ void Autopilot_Interface::
 		printf("\n");
 	}
 
+	// stream intervals can be set from here on
+	message_intervals.start(system_id, companion_id, system_id, autopilot_id);
+
 	// --------------------------------------------------------------------------
 	//   GET INITIAL POSITION
 	// --------------------------------------------------------------------------
@@ -1191,6 +1479,17 @@ void Autopilot_Interface::
 		printf("\n");
 	}
 
+	// --------------------------------------------------------------------------
+	//   GPS FORWARD THREAD
+	// --------------------------------------------------------------------------
+
+	// the fixes go out with the ids found above
+	printf("START GPS FORWARD THREAD \n");
+
+	result = thread_config_create(&gps_tid, THREAD_GPS_FORWARD, &start_autopilot_interface_gps_thread, this);
+	if (result)
+		throw result;
+
 	// we need this before starting the write thread
 
 	// --------------------------------------------------------------------------
@@ -1198,13 +1497,13 @@ void Autopilot_Interface::
 	// --------------------------------------------------------------------------
 	printf("START WRITE THREAD \n");
 
-	result = pthread_create(&write_tid, NULL, &start_autopilot_interface_write_thread, this);
+	result = thread_config_create(&write_tid, THREAD_WRITE, &start_autopilot_interface_write_thread, this);
 	if (result)
 		throw result;
 
 	// wait for it to be started
-	while (not writing_status)
-		usleep(100000); // 10Hz
+	if (not startup_events().wait(STARTUP_WRITE_READY, -1))
+		return;
 
 	// now we're streaming setpoint commands
 	printf("\n");
@@ -1224,14 +1523,20 @@ void Autopilot_Interface::
 	// --------------------------------------------------------------------------
 	printf("CLOSE THREADS\n");
 
-	// signal exit
+	// signal exit, and wake start() and a fix request if they still wait
 	time_to_exit = true;
+	startup_events().set(STARTUP_EXIT);
+	pthread_mutex_lock(&gps_lock);
+	pthread_cond_broadcast(&gps_cond);
+	pthread_mutex_unlock(&gps_lock);
 
 	// wait for exit
-	pthread_join(read_tid, NULL);
-	pthread_join(write_tid, NULL);
+	thread_config_join(read_tid, NULL);
+	thread_config_join(write_tid, NULL);
+	if (gps_tid)
+		thread_config_join(gps_tid, NULL);
 
-	// now the read and write threads are closed
+	// now the read, write and GPS forward threads are closed
 	printf("\n");
 
 	// still need to close the port separately
@@ -1275,6 +1580,15 @@ void Autopilot_Interface::
 	}
 }
 
+// ------------------------------------------------------------------------------
+//   GPS Forward Thread
+// ------------------------------------------------------------------------------
+void Autopilot_Interface::
+	start_gps_forward_thread(void)
+{
+	gps_forward_thread();
+}
+
 // ------------------------------------------------------------------------------
 //   Quit Handler
 // ------------------------------------------------------------------------------
@@ -1301,6 +1615,7 @@ void Autopilot_Interface::
 	read_thread()
 {
 	reading_status = true;
+	startup_events().set(STARTUP_READ_READY);
 
 	while (!time_to_exit)
 	{
@@ -1345,6 +1660,7 @@ void Autopilot_Interface::
 	// write a message and signal writing
 	write_setpoint();
 	writing_status = true;
+	startup_events().set(STARTUP_WRITE_READY);
 
 	// Pixhawk needs to see off-board commands at minimum 2Hz,
 	// otherwise it will go into fail safe
@@ -1391,3 +1707,16 @@ start_autopilot_interface_write_thread(void *args)
 	// done!
 	return NULL;
 }
+
+void *
+start_autopilot_interface_gps_thread(void *args)
+{
+	// takes an autopilot object argument
+	Autopilot_Interface *autopilot_interface = (Autopilot_Interface *)args;
+
+	// run the object's GPS forward thread
+	autopilot_interface->start_gps_forward_thread();
+
+	// done!
+	return NULL;
+}
@@ -55,6 +55,8 @@
 // ------------------------------------------------------------------------------
 
 #include "generic_port.h"
+#include "log_receiver.h"
+#include "frame_pool.h"
 
 #include <signal.h>
 #include <time.h>
@@ -66,7 +68,13 @@
 #include <memutils/message/Message.h>
 #include "../include/msgq_id.h"
 #include "../include/msgq_pool.h"
-#include "../include/mavlink/v2.0/common/mavlink.h"
+#include "../include/trace.h"
+#include "../include/mavlink/v2.0/spresense/mavlink.h"
+#include "../include/gps_msgq.h"
+#include "../include/topics.h"
+#include "../include/thread_config.h"
+#include "startup_events.h"
+#include "message_intervals.h"
 
 // ------------------------------------------------------------------------------
 //   Defines
@@ -133,6 +141,7 @@ void set_yaw_rate(float yaw_rate, mavlink_set_position_target_local_ned_t &sp);
 
 void *start_autopilot_interface_read_thread(void *args);
 void *start_autopilot_interface_write_thread(void *args);
+void *start_autopilot_interface_gps_thread(void *args);
 
 // ------------------------------------------------------------------------------
 //   Data Structures
@@ -176,6 +185,29 @@ struct Time_Stamps
 	}
 };
 
+// Rate asked for the vehicle topics while something subscribes to them
+#define AUTOPILOT_TOPIC_RATE_HZ 10
+
+// How often the topic subscribers are looked at
+#define AUTOPILOT_TOPIC_CHECK_US 1000000
+
+// Forwarders and other takers of every received frame
+#define AUTOPILOT_MAX_FRAME_SINKS 4
+
+// How long the GPS forward thread waits on MSGQ_MAVLINK before it looks
+// at time_to_exit again
+#define AUTOPILOT_GPS_POLL_MS 100
+
+// Fixes streamed by the GPS task in batches, see include/gps_msgq.h
+struct GPS_Stream_Stats
+{
+	uint32_t fixes;		// forwarded from batches
+	uint32_t batches;
+	uint32_t thinned;	// dropped by the GPS task while the lane was full
+	uint32_t lost;		// batches missing from the sequence
+	uint32_t restarts;	// the sequence went back, the GPS task started again
+};
+
 // Struct containing information on the MAV we are currently connected to
 
 struct Mavlink_Messages
@@ -265,9 +297,16 @@ public:
 	Mavlink_Messages current_messages;
 	mavlink_set_position_target_local_ned_t initial_position;
 
+	void set_log_receiver(Log_Receiver *log_receiver_);
+	void set_frame_pool(Frame_Pool *frame_pool_);
+	bool add_frame_sink(Frame_Sink *sink);
+	Message_Intervals &get_message_intervals() { return message_intervals; }
+	int enable_signing(Mavlink_Signing *signing_);
+
 	void update_setpoint(mavlink_set_position_target_local_ned_t setpoint);
 	void read_messages();
 	int write_message(mavlink_message_t message);
+	int write_frame(uint8_t *frame, unsigned len);
 
 	int arm_disarm(bool flag);
 	void enable_offboard_control();
@@ -278,6 +317,7 @@ public:
 
 	void start_read_thread();
 	void start_write_thread(void);
+	void start_gps_forward_thread(void);
 
 	void handle_quit(int sig);
 	// 追加
@@ -290,17 +330,39 @@ public:
 
 	int send_input_gps_message(uint64_t time_usec);
 	int send_input_hil_gps_message(uint64_t time_usec);
+	GPS_Stream_Stats get_gps_stream_stats();
 	int send_input_gps_raw_int_message(uint64_t time_usec);
 
 	int send_input_global_position_int_message();
 
 private:
 	Generic_Port *port;
+	Log_Receiver *log_receiver;
+
+	// received frames are read into the pool when there are sinks for them
+	Frame_Pool *frame_pool;
+	Frame_Sink *frame_sinks[AUTOPILOT_MAX_FRAME_SINKS];
+	int num_frame_sinks;
+
+	// the GPS forward thread owns MSGQ_MAVLINK, it forwards the batches and
+	// hands the reply to a fix request over, the lock guards both
+	pthread_mutex_t gps_lock;
+	pthread_cond_t gps_cond;
+	GPS_Stream_Stats gps_stream;
+	uint32_t gps_next_seq;
+	bool gps_reply_ready;
+	mavlink_hil_gps_t gps_reply;
+
+	// streams asked of the autopilot, the topics are one consumer
+	Message_Intervals message_intervals;
+	int topics_consumer;
+	uint64_t topics_checked_usec;
 
 	bool time_to_exit;
 
 	pthread_t read_tid;
 	pthread_t write_tid;
+	pthread_t gps_tid;
 
 	struct
 	{
@@ -310,14 +372,12 @@ private:
 
 	void read_thread();
 	void write_thread(void);
+	void gps_forward_thread(void);
 
 	int toggle_offboard_control(bool flag);
 	void write_setpoint();
-};
-
-struct message_t
-{
-	int num;
+	void _forward_gps_batch(const gps_fix_batch_t &batch);
+	void _update_topic_intervals();
 };
 
 #endif // AUTOPILOT_INTERFACE_H_
@@ -0,0 +1,175 @@
+/**
+ * @file frame_encoder.h
+ *
+ * @brief Encodes MAVLink messages straight into a transmit buffer
+ *
+ * mavlink_msg_X_encode() packs the payload into a mavlink_message_t, which
+ * the port then copies into its send buffer with mavlink_msg_to_send_buffer().
+ * frame_encode() writes header, trimmed payload and checksum directly into
+ * the buffer that goes to the port, with no mavlink_message_t in between.
+ * The ports take the result through Generic_Port::write_frame(), which
+ * signs it in place.
+ *
+ * Header only.
+ *
+ */
+
+#ifndef FRAME_ENCODER_H_
+#define FRAME_ENCODER_H_
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <string.h>
+
+#include "../include/mavlink/v2.0/spresense/mavlink.h"
+
+// ------------------------------------------------------------------------------
+//   Defines
+// ------------------------------------------------------------------------------
+
+// A frame buffer holds the largest signed frame, the port signs in place
+#define FRAME_ENCODER_BUFFER_LEN MAVLINK_MAX_PACKET_LEN
+
+// The message structs are the payload as it goes on the wire, byte for byte,
+// only where no bytes need swapping
+#if MAVLINK_NEED_BYTE_SWAP
+#error "frame_encoder.h needs a little endian target"
+#endif
+
+// ------------------------------------------------------------------------------
+//   Encode
+// ------------------------------------------------------------------------------
+/*
+ * Serializes the message struct at payload, length bytes of it, as msgid
+ * into frame, which needs FRAME_ENCODER_BUFFER_LEN bytes.  Numbered in the
+ * sequence of chan and trimmed like mavlink_finalize_message_chan() does,
+ * so frames from here and from mavlink_msg_X_encode() mix on one link.
+ * Returns the frame length, or 0 when length does not fit the message.
+ */
+static inline unsigned
+frame_pack(uint8_t *frame, uint8_t system_id, uint8_t component_id, uint8_t chan,
+		   uint32_t msgid, const void *payload, unsigned length)
+{
+	// structs that are not MAVPACKED round up to their alignment
+	const mavlink_msg_entry_t *entry = mavlink_get_msg_entry(msgid);
+	if (entry == NULL || length < entry->max_msg_len || length >= entry->max_msg_len + 8u)
+		return 0;
+	length = entry->max_msg_len;
+
+	mavlink_status_t *status = mavlink_get_channel_status(chan);
+	bool mavlink1 = (status->flags & MAVLINK_STATUS_FLAG_OUT_MAVLINK1) != 0;
+	unsigned header_len;
+
+	if (mavlink1)
+	{
+		header_len = MAVLINK_CORE_HEADER_MAVLINK1_LEN + 1;
+		length = entry->min_msg_len;
+		memcpy(&frame[header_len], payload, length);
+
+		frame[0] = MAVLINK_STX_MAVLINK1;
+		frame[1] = (uint8_t)length;
+		frame[2] = status->current_tx_seq;
+		frame[3] = system_id;
+		frame[4] = component_id;
+		frame[5] = (uint8_t)msgid;
+	}
+	else
+	{
+		header_len = MAVLINK_NUM_HEADER_BYTES;
+		memcpy(&frame[header_len], payload, length);
+		length = _mav_trim_payload((const char *)&frame[header_len], length);
+
+		frame[0] = MAVLINK_STX;
+		frame[1] = (uint8_t)length;
+		frame[2] = 0;	// incompat_flags, the port sets SIGNED when it signs
+		frame[3] = 0;	// compat_flags
+		frame[4] = status->current_tx_seq;
+		frame[5] = system_id;
+		frame[6] = component_id;
+		frame[7] = (uint8_t)msgid;
+		frame[8] = (uint8_t)(msgid >> 8);
+		frame[9] = (uint8_t)(msgid >> 16);
+	}
+	status->current_tx_seq++;
+
+	uint16_t checksum = crc_calculate(&frame[1], header_len - 1 + length);
+	crc_accumulate(entry->crc_extra, &checksum);
+	frame[header_len + length] = (uint8_t)(checksum & 0xFF);
+	frame[header_len + length + 1] = (uint8_t)(checksum >> 8);
+
+	return header_len + length + MAVLINK_NUM_CHECKSUM_BYTES;
+}
+
+/*
+ * The typed front, e.g.
+ *
+ *   uint8_t frame[FRAME_ENCODER_BUFFER_LEN];
+ *   unsigned len = frame_encode(frame, system_id, companion_id,
+ *                               MAVLINK_MSG_ID_HIL_GPS, hil_gps);
+ *   port->write_frame(frame, len);
+ */
+template <typename T>
+inline unsigned
+frame_encode(uint8_t *frame, uint8_t system_id, uint8_t component_id,
+			 uint32_t msgid, const T &payload, uint8_t chan = MAVLINK_COMM_0)
+{
+	return frame_pack(frame, system_id, component_id, chan, msgid, &payload, sizeof(T));
+}
+
+// ------------------------------------------------------------------------------
+//   Frame Fields
+// ------------------------------------------------------------------------------
+
+static inline uint32_t
+frame_msgid(const uint8_t *frame)
+{
+	if (frame[0] == MAVLINK_STX_MAVLINK1)
+		return frame[5];
+	return frame[7] | ((uint32_t)frame[8] << 8) | ((uint32_t)frame[9] << 16);
+}
+
+/*
+ * Unpacks an unsigned frame from frame_encode() into message, for ports
+ * that only take a mavlink_message_t.  False when it is not a whole frame.
+ */
+static inline bool
+frame_to_message(const uint8_t *frame, unsigned len, mavlink_message_t &message)
+{
+	bool mavlink1 = frame[0] == MAVLINK_STX_MAVLINK1;
+	unsigned header_len = mavlink1 ? MAVLINK_CORE_HEADER_MAVLINK1_LEN + 1 : MAVLINK_NUM_HEADER_BYTES;
+	if (len < header_len || len != header_len + frame[1] + MAVLINK_NUM_CHECKSUM_BYTES)
+		return false;
+
+	message.magic = frame[0];
+	message.len = frame[1];
+	if (mavlink1)
+	{
+		message.incompat_flags = 0;
+		message.compat_flags = 0;
+		message.seq = frame[2];
+		message.sysid = frame[3];
+		message.compid = frame[4];
+	}
+	else
+	{
+		message.incompat_flags = frame[2];
+		message.compat_flags = frame[3];
+		message.seq = frame[4];
+		message.sysid = frame[5];
+		message.compid = frame[6];
+	}
+	message.msgid = frame_msgid(frame);
+	memcpy(_MAV_PAYLOAD_NON_CONST(&message), &frame[header_len], message.len);
+
+	const uint8_t *ck = &frame[header_len + message.len];
+	message.checksum = ck[0] | ((uint16_t)ck[1] << 8);
+	mavlink_ck_a(&message) = ck[0];
+	mavlink_ck_b(&message) = ck[1];
+
+	return true;
+}
+
+#endif // FRAME_ENCODER_H_
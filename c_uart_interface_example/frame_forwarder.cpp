@@ -0,0 +1,222 @@
+/**
+ * @file frame_forwarder.cpp
+ *
+ * @brief Frame forwarder functions
+ *
+ * Functions for queueing pooled frames and writing them to another port
+ *
+ */
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include "frame_forwarder.h"
+
+#include <string.h>
+#include <utility>
+
+// ----------------------------------------------------------------------------------
+//   Frame Forwarder Class
+// ----------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+//   Con/De structors
+// ------------------------------------------------------------------------------
+Frame_Forwarder::
+Frame_Forwarder(Generic_Port *port_)
+{
+	initialize_defaults(FRAME_FORWARDER_DEFAULT_DEPTH);
+	port = port_;
+}
+
+Frame_Forwarder::
+Frame_Forwarder(Generic_Port *port_, int depth_)
+{
+	initialize_defaults(depth_);
+	port = port_;
+}
+
+Frame_Forwarder::
+~Frame_Forwarder()
+{
+	stop();
+
+	// what is still queued goes back to the pool
+	delete[] queue;
+
+	// destroy mutex
+	pthread_cond_destroy(&cond);
+	pthread_mutex_destroy(&lock);
+}
+
+void
+Frame_Forwarder::
+initialize_defaults(int depth_)
+{
+	// Initialize attributes
+	port = NULL;
+	forward_tid = 0;
+	time_to_exit = false;
+
+	depth = depth_ > 0 ? depth_ : 1;
+	queue = new Frame_Handle[depth];
+	head = 0;
+	count = 0;
+
+	memset(&stats, 0, sizeof(stats));
+	latency.set_name("forward");
+
+	pthread_mutex_init(&lock, NULL);
+	pthread_cond_init(&cond, NULL);
+}
+
+// ------------------------------------------------------------------------------
+//   Frame Sink
+// ------------------------------------------------------------------------------
+
+// One more reference to the frame, no copy of it
+void
+Frame_Forwarder::
+handle_frame(const Frame_Handle &frame)
+{
+	if (!frame)
+		return;
+
+	pthread_mutex_lock(&lock);
+	if (count == depth)
+	{
+		stats.dropped++;
+	}
+	else
+	{
+		queue[(head + count) % depth] = frame;
+		count++;
+		if ((uint32_t)count > stats.peak)
+			stats.peak = count;
+		pthread_cond_signal(&cond);
+	}
+	pthread_mutex_unlock(&lock);
+}
+
+// ------------------------------------------------------------------------------
+//   Forward Thread
+// ------------------------------------------------------------------------------
+void
+Frame_Forwarder::
+forward_thread()
+{
+	pthread_mutex_lock(&lock);
+
+	while (!time_to_exit)
+	{
+		if (count == 0)
+		{
+			pthread_cond_wait(&cond, &lock);
+			continue;
+		}
+
+		// take it off the queue and write it without the lock
+		Frame_Handle frame(std::move(queue[head]));
+		head = (head + 1) % depth;
+		count--;
+		pthread_mutex_unlock(&lock);
+
+		int written = port->write_message(frame.message());
+		latency.record_since(frame.get_stamp());
+
+		// back to the pool unless someone else still holds it
+		frame.reset();
+
+		pthread_mutex_lock(&lock);
+		if (written > 0)
+			stats.forwarded++;
+		else
+			stats.write_errors++;
+	}
+
+	pthread_mutex_unlock(&lock);
+}
+
+void *
+start_frame_forwarder_thread(void *args)
+{
+	// takes a Frame_Forwarder object argument
+	Frame_Forwarder *forwarder = (Frame_Forwarder *)args;
+
+	// run the object's forward thread
+	forwarder->start_forward_thread();
+
+	// done!
+	return NULL;
+}
+
+void
+Frame_Forwarder::
+start_forward_thread()
+{
+	forward_thread();
+}
+
+// ------------------------------------------------------------------------------
+//   Start / Stop
+// ------------------------------------------------------------------------------
+
+// The port is started and stopped by its owner
+void
+Frame_Forwarder::
+start()
+{
+	pthread_mutex_lock(&lock);
+	time_to_exit = false;
+	pthread_mutex_unlock(&lock);
+
+	int result = thread_config_create(&forward_tid, THREAD_FORWARD, &start_frame_forwarder_thread, this);
+	if (result)
+		throw result;
+}
+
+void
+Frame_Forwarder::
+stop()
+{
+	if (!forward_tid)
+		return;
+
+	pthread_mutex_lock(&lock);
+	time_to_exit = true;
+	pthread_cond_broadcast(&cond);
+	pthread_mutex_unlock(&lock);
+
+	thread_config_join(forward_tid, NULL);
+	forward_tid = 0;
+}
+
+// ------------------------------------------------------------------------------
+//   Report
+// ------------------------------------------------------------------------------
+
+Frame_Forwarder_Stats
+Frame_Forwarder::
+get_stats()
+{
+	pthread_mutex_lock(&lock);
+	Frame_Forwarder_Stats copy = stats;
+	pthread_mutex_unlock(&lock);
+	return copy;
+}
+
+void
+Frame_Forwarder::
+dump(FILE *out)
+{
+	Frame_Forwarder_Stats copy = get_stats();
+	fprintf(out, "FORWARDER: %lu forwarded, %lu dropped, %lu write errors, peak %lu of %d queued\n",
+			(unsigned long)copy.forwarded, (unsigned long)copy.dropped,
+			(unsigned long)copy.write_errors, (unsigned long)copy.peak, depth);
+
+	char line[128];
+	fprintf(out, "%-24s %10s %14s %14s %14s %14s\n", "forward latency (us)", "count", "p50", "p99", "p99.9", "max");
+	latency.format(line, sizeof(line));
+	fputs(line, out);
+}
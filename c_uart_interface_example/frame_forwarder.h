@@ -0,0 +1,100 @@
+/**
+ * @file frame_forwarder.h
+ *
+ * @brief Frame forwarder definition
+ *
+ * A Frame_Sink that routes the frames it is given to another port from a
+ * thread of its own, holding the pooled frames by handle while they wait
+ *
+ */
+
+#ifndef FRAME_FORWARDER_H_
+#define FRAME_FORWARDER_H_
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pthread.h> // This uses POSIX Threads
+
+#include "../include/mavlink/v2.0/spresense/mavlink.h"
+
+#include "generic_port.h"
+#include "frame_pool.h"
+#include "latency_histogram.h"
+#include "../include/thread_config.h"
+
+// ------------------------------------------------------------------------------
+//   Defines
+// ------------------------------------------------------------------------------
+
+// Frames waiting for the port at most, each holds a pooled frame
+#define FRAME_FORWARDER_DEFAULT_DEPTH 8
+
+// ------------------------------------------------------------------------------
+//   Data Structures
+// ------------------------------------------------------------------------------
+
+struct Frame_Forwarder_Stats
+{
+	uint32_t forwarded;
+	uint32_t dropped;		// queue full, the frame went back to the pool
+	uint32_t write_errors;
+	uint32_t peak;			// deepest the queue got
+};
+
+// ----------------------------------------------------------------------------------
+//   Frame Forwarder Class
+// ----------------------------------------------------------------------------------
+/*
+ * Frame Forwarder Class
+ *
+ * handle_frame() keeps a copy of the handle in a fixed queue, or drops the
+ * frame when the queue is full; it never waits for the port.  The forward
+ * thread writes the frames unchanged, sequence and source ids as received,
+ * and lets go of them.  A histogram keeps the time from the frame being
+ * parsed to it being written on the port.
+ */
+class Frame_Forwarder : public Frame_Sink
+{
+
+public:
+	Frame_Forwarder(Generic_Port *port_);
+	Frame_Forwarder(Generic_Port *port_, int depth_);
+	~Frame_Forwarder();
+
+	void handle_frame(const Frame_Handle &frame);
+
+	void start();
+	void stop();
+
+	Frame_Forwarder_Stats get_stats();
+	void dump(FILE *out);
+
+	void start_forward_thread();
+
+private:
+	Generic_Port *port;
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	pthread_t forward_tid;
+	bool time_to_exit;
+
+	Frame_Handle *queue;
+	int depth;
+	int head;
+	int count;
+
+	Frame_Forwarder_Stats stats;
+	Latency_Histogram latency;
+
+	void initialize_defaults(int depth_);
+
+	void forward_thread();
+};
+
+void *start_frame_forwarder_thread(void *args);
+
+#endif // FRAME_FORWARDER_H_
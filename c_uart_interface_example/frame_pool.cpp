@@ -0,0 +1,197 @@
+/**
+ * @file frame_pool.cpp
+ *
+ * @brief Refcounted frame pool functions
+ *
+ * Functions for handing out pooled frames and counting references to them
+ *
+ */
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include "frame_pool.h"
+
+#include <string.h>
+
+// ----------------------------------------------------------------------------------
+//   Frame Handle Class
+// ----------------------------------------------------------------------------------
+
+Frame_Handle::
+Frame_Handle(const Frame_Handle &other)
+{
+	frame = other.frame;
+	if (frame)
+		frame->refs.fetch_add(1, std::memory_order_relaxed);
+}
+
+Frame_Handle &
+Frame_Handle::
+operator=(const Frame_Handle &other)
+{
+	if (other.frame)
+		other.frame->refs.fetch_add(1, std::memory_order_relaxed);
+	reset();
+	frame = other.frame;
+	return *this;
+}
+
+Frame_Handle &
+Frame_Handle::
+operator=(Frame_Handle &&other)
+{
+	if (this != &other)
+	{
+		reset();
+		frame = other.frame;
+		other.frame = NULL;
+	}
+	return *this;
+}
+
+// Only while this is the one reference, NULL once shared or when empty
+mavlink_message_t *
+Frame_Handle::
+writable()
+{
+	if (!frame || frame->refs.load(std::memory_order_acquire) != 1)
+		return NULL;
+	return &frame->message;
+}
+
+/*
+ * Drops this reference.  The last one returns the frame; acq_rel so what
+ * every holder read of it happens before the next alloc() reuses it.
+ */
+void
+Frame_Handle::
+reset()
+{
+	if (frame && frame->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		frame->pool->_release(frame);
+	frame = NULL;
+}
+
+// ----------------------------------------------------------------------------------
+//   Frame Pool Class
+// ----------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+//   Con/De structors
+// ------------------------------------------------------------------------------
+Frame_Pool::
+Frame_Pool()
+{
+	initialize_defaults(FRAME_POOL_DEFAULT_FRAMES);
+}
+
+Frame_Pool::
+Frame_Pool(int num_frames_)
+{
+	initialize_defaults(num_frames_);
+}
+
+Frame_Pool::
+~Frame_Pool()
+{
+	if (stats.in_use)
+		fprintf(stderr, "WARNING: frame pool destroyed with %lu frames held\n", (unsigned long)stats.in_use);
+
+	delete[] frames;
+
+	// destroy mutex
+	pthread_mutex_destroy(&lock);
+}
+
+void
+Frame_Pool::
+initialize_defaults(int num_frames_)
+{
+	// Initialize attributes
+	num_frames = num_frames_ > 0 ? num_frames_ : 1;
+	frames = new Pool_Frame[num_frames];
+
+	free_list = NULL;
+	for (int i = num_frames - 1; i >= 0; i--)
+	{
+		frames[i].refs.store(0, std::memory_order_relaxed);
+		frames[i].stamp = 0;
+		frames[i].pool = this;
+		frames[i].next = free_list;
+		free_list = &frames[i];
+	}
+
+	memset(&stats, 0, sizeof(stats));
+	stats.capacity = num_frames;
+
+	pthread_mutex_init(&lock, NULL);
+}
+
+// ------------------------------------------------------------------------------
+//   Allocate and Release
+// ------------------------------------------------------------------------------
+
+// One reference, or empty when the pool is exhausted
+Frame_Handle
+Frame_Pool::
+alloc()
+{
+	pthread_mutex_lock(&lock);
+	Pool_Frame *frame = free_list;
+	if (frame)
+	{
+		free_list = frame->next;
+		stats.allocs++;
+		if (++stats.in_use > stats.high_water)
+			stats.high_water = stats.in_use;
+	}
+	else
+	{
+		stats.exhausted++;
+	}
+	pthread_mutex_unlock(&lock);
+
+	if (!frame)
+		return Frame_Handle();
+
+	frame->refs.store(1, std::memory_order_relaxed);
+	frame->stamp = 0;
+	return Frame_Handle(frame);
+}
+
+void
+Frame_Pool::
+_release(Pool_Frame *frame)
+{
+	pthread_mutex_lock(&lock);
+	frame->next = free_list;
+	free_list = frame;
+	stats.in_use--;
+	pthread_mutex_unlock(&lock);
+}
+
+// ------------------------------------------------------------------------------
+//   Report
+// ------------------------------------------------------------------------------
+
+Frame_Pool_Stats
+Frame_Pool::
+get_stats()
+{
+	pthread_mutex_lock(&lock);
+	Frame_Pool_Stats copy = stats;
+	pthread_mutex_unlock(&lock);
+	return copy;
+}
+
+void
+Frame_Pool::
+dump(FILE *out)
+{
+	Frame_Pool_Stats copy = get_stats();
+	fprintf(out, "FRAME POOL: %lu frames of %u bytes, %lu in use, high water %lu, %lu allocs, %lu exhausted\n",
+			(unsigned long)copy.capacity, (unsigned)sizeof(Pool_Frame), (unsigned long)copy.in_use,
+			(unsigned long)copy.high_water, (unsigned long)copy.allocs, (unsigned long)copy.exhausted);
+}
@@ -0,0 +1,154 @@
+/**
+ * @file frame_pool.h
+ *
+ * @brief Refcounted frame pool definition
+ *
+ * A fixed number of mavlink_message_t allocated once at startup and handed
+ * out as refcounted handles, so one received frame can go to the
+ * dispatcher, the forwarders and whatever else keeps it, on any thread,
+ * without a copy each and without malloc on the way.
+ *
+ */
+
+#ifndef FRAME_POOL_H_
+#define FRAME_POOL_H_
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pthread.h> // This uses POSIX Threads
+#include <atomic>
+
+#include "../include/mavlink/v2.0/spresense/mavlink.h"
+
+// ------------------------------------------------------------------------------
+//   Defines
+// ------------------------------------------------------------------------------
+
+// One read in progress, a forwarder queue and some slack, 300 bytes each
+#define FRAME_POOL_DEFAULT_FRAMES 24
+
+// ------------------------------------------------------------------------------
+//   Data Structures
+// ------------------------------------------------------------------------------
+
+class Frame_Pool;
+
+struct Pool_Frame
+{
+	mavlink_message_t message;
+	std::atomic<uint32_t> refs;
+	uint32_t stamp;		// latency_stamp() the frame was parsed at
+	Frame_Pool *pool;
+	Pool_Frame *next;	// free list
+};
+
+struct Frame_Pool_Stats
+{
+	uint32_t capacity;
+	uint32_t in_use;
+	uint32_t high_water;	// most in use at once
+	uint32_t allocs;
+	uint32_t exhausted;		// alloc() found nothing free
+};
+
+// ----------------------------------------------------------------------------------
+//   Frame Handle Class
+// ----------------------------------------------------------------------------------
+/*
+ * Frame Handle Class
+ *
+ * One reference to a pooled frame.  Copies share the frame, the last one
+ * to go returns it to the pool; copy a handle to keep the frame, on any
+ * thread.  Empty when the pool was exhausted.  The frame is read-only once
+ * shared, writable() is for the one that filled it.
+ */
+class Frame_Handle
+{
+
+public:
+	Frame_Handle() : frame(NULL) {};
+	Frame_Handle(const Frame_Handle &other);
+	Frame_Handle(Frame_Handle &&other) : frame(other.frame) { other.frame = NULL; };
+	~Frame_Handle() { reset(); };
+
+	Frame_Handle &operator=(const Frame_Handle &other);
+	Frame_Handle &operator=(Frame_Handle &&other);
+
+	explicit operator bool() const { return frame != NULL; };
+
+	const mavlink_message_t &message() const { return frame->message; };
+	mavlink_message_t *writable();
+
+	uint32_t get_stamp() const { return frame->stamp; };
+	void set_stamp(uint32_t stamp) { frame->stamp = stamp; };
+
+	uint32_t refs() const { return frame ? frame->refs.load(std::memory_order_relaxed) : 0; };
+	void reset();
+
+private:
+	friend class Frame_Pool;
+	explicit Frame_Handle(Pool_Frame *frame_) : frame(frame_) {};
+
+	Pool_Frame *frame;
+};
+
+// ----------------------------------------------------------------------------------
+//   Frame Sink Class
+// ----------------------------------------------------------------------------------
+/*
+ * Frame Sink Class
+ *
+ * Takes every frame Autopilot_Interface reads, on its read thread, after it
+ * was handled there.  Must not block; copy the handle to keep the frame.
+ */
+class Frame_Sink
+{
+
+public:
+	virtual ~Frame_Sink(){};
+	virtual void handle_frame(const Frame_Handle &frame) = 0;
+};
+
+// ----------------------------------------------------------------------------------
+//   Frame Pool Class
+// ----------------------------------------------------------------------------------
+/*
+ * Frame Pool Class
+ *
+ * All frames are allocated by the constructor.  alloc() takes one off a
+ * free list under a mutex held for a few instructions, and returns an
+ * empty handle when none is left, counted as exhausted; it never waits.
+ * The pool must outlive every handle.
+ */
+class Frame_Pool
+{
+
+public:
+	Frame_Pool();
+	Frame_Pool(int num_frames_);
+	~Frame_Pool();
+
+	Frame_Handle alloc();
+
+	Frame_Pool_Stats get_stats();
+	void dump(FILE *out);
+
+private:
+	friend class Frame_Handle;
+
+	Pool_Frame *frames;
+	int num_frames;
+
+	pthread_mutex_t lock;
+	Pool_Frame *free_list;
+	Frame_Pool_Stats stats;
+
+	void initialize_defaults(int num_frames_);
+	void _release(Pool_Frame *frame);
+};
+
+#endif // FRAME_POOL_H_
@@ -56,7 +56,15 @@
 //   Includes
 // ------------------------------------------------------------------------------
 
-#include "../include/mavlink/v2.0/common/mavlink.h"
+#include <atomic>
+
+#include "../include/mavlink/v2.0/spresense/mavlink.h"
+
+#include "tlog_recorder.h"
+#include "mavlink_signing.h"
+#include "link_stats.h"
+#include "latency_histogram.h"
+#include "frame_encoder.h"
 
 // ------------------------------------------------------------------------------
 //   Defines
@@ -77,13 +85,49 @@
 class Generic_Port
 {
 public:
-	Generic_Port(){};
+	Generic_Port() : recorder(NULL), signing(NULL), rx_start_stamp(0), rx_frame_stamp(0) {};
 	virtual ~Generic_Port(){};
 	virtual int read_message(mavlink_message_t &message) = 0;
 	virtual int write_message(const mavlink_message_t &message) = 0;
+
+	// a frame from frame_encode(), in a FRAME_ENCODER_BUFFER_LEN buffer the
+	// port may sign in place; ports that do not take frames get it unpacked
+	virtual int write_frame(uint8_t *frame, unsigned len)
+	{
+		mavlink_message_t message;
+		if (!frame_to_message(frame, len, message))
+			return -1;
+		return write_message(message);
+	};
 	virtual bool is_running() = 0;
 	virtual void start() = 0;
 	virtual void stop() = 0;
+
+	// every frame read or written is also handed to the recorder
+	virtual void set_recorder(Tlog_Recorder *recorder_) { recorder = recorder_; };
+
+	// frames written are signed, frames read must pass verify(); may be
+	// called while the port's readers and writers run
+	virtual void set_signing(Mavlink_Signing *signing_) { signing = signing_; };
+
+	// traffic and error counters, also in /proc/mavlink while running
+	virtual Link_Stats *get_link_stats() { return &link_stats; };
+
+	// a port over several links counts for each of them as well
+	virtual int get_num_link_stats() { return 1; };
+	virtual Link_Stats *get_link_stats_at(int) { return get_link_stats(); };
+
+	// latency_stamp() of the last frame read, when its last byte was parsed
+	virtual uint32_t get_frame_stamp() { return rx_frame_stamp; };
+
+protected:
+	Tlog_Recorder *recorder;
+	std::atomic<Mavlink_Signing *> signing; // load once per frame
+	Link_Stats link_stats;
+
+	// first byte of the frame being parsed, and the last complete frame
+	uint32_t rx_start_stamp;
+	uint32_t rx_frame_stamp;
 };
 
 #endif // GENERIC_PORT_H_
@@ -0,0 +1,668 @@
+/**
+ * @file indexed_log.cpp
+ *
+ * @brief Indexed telemetry log functions
+ *
+ * Functions for writing, recovering and seeking indexed telemetry logs
+ *
+ */
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include "indexed_log.h"
+
+#include <string.h>
+#include <unistd.h>	// UNIX standard function definitions
+#include <fcntl.h>	// File control definitions
+#include <sys/stat.h>
+
+static_assert(sizeof(Indexed_Log_Footer) == INDEXED_LOG_FOOTER_LEN, "footer must fill its slot exactly");
+
+// ------------------------------------------------------------------------------
+//   Helpers
+// ------------------------------------------------------------------------------
+
+static uint16_t
+_block_crc(const uint8_t *block)
+{
+	// the crc field is the last two bytes of the block
+	return crc_calculate(block, INDEXED_LOG_BLOCK - 2);
+}
+
+static void
+_bitmap_set(Indexed_Log_Footer &f, uint32_t msgid)
+{
+	uint32_t bit = msgid % INDEXED_LOG_BITMAP_BITS;
+	f.msgid_bitmap[bit / 8] |= (uint8_t)(1 << (bit % 8));
+}
+
+static bool
+_bitmap_test(const Indexed_Log_Footer &f, uint32_t msgid)
+{
+	uint32_t bit = msgid % INDEXED_LOG_BITMAP_BITS;
+	return (f.msgid_bitmap[bit / 8] & (1 << (bit % 8))) != 0;
+}
+
+static bool
+_footer_valid(const uint8_t *block, const Indexed_Log_Footer &f, uint32_t index)
+{
+	return f.magic == INDEXED_LOG_MAGIC && f.block_index == index &&
+		   f.block_size == INDEXED_LOG_BLOCK && f.used <= INDEXED_LOG_DATA_LEN &&
+		   (block == NULL || f.crc == _block_crc(block));
+}
+
+uint32_t
+indexed_log_frame_msgid(const uint8_t *frame)
+{
+	if (frame[0] == MAVLINK_STX)
+		return frame[7] | (frame[8] << 8) | ((uint32_t)frame[9] << 16);
+	return frame[5];
+}
+
+/*
+ * Walks the records at the start of a block and returns how many bytes of
+ * them look intact.  Stops at the padding, at a record that runs past the
+ * limit or at anything that is not a MAVLink frame.  When footer is given,
+ * it is filled in with what was found.
+ */
+int
+indexed_log_scan_records(const uint8_t *data, int limit, Indexed_Log_Footer *footer)
+{
+	if (footer)
+		memset(footer, 0, sizeof(*footer));
+
+	int off = 0;
+	while (off + INDEXED_LOG_RECORD_HEADER <= limit)
+	{
+		uint16_t len;
+		uint64_t usec;
+		memcpy(&len, &data[off], sizeof(len));
+		memcpy(&usec, &data[off + 2], sizeof(usec));
+
+		const uint8_t *frame = &data[off + INDEXED_LOG_RECORD_HEADER];
+		if (len < MAVLINK_CORE_HEADER_MAVLINK1_LEN + 1 || len > MAVLINK_MAX_PACKET_LEN ||
+			off + INDEXED_LOG_RECORD_HEADER + len > limit ||
+			(frame[0] != MAVLINK_STX && frame[0] != MAVLINK_STX_MAVLINK1))
+			break;
+
+		if (footer)
+		{
+			if (footer->num_frames == 0)
+				footer->first_usec = usec;
+			footer->last_usec = usec;
+			footer->num_frames++;
+			_bitmap_set(*footer, indexed_log_frame_msgid(frame));
+		}
+
+		off += INDEXED_LOG_RECORD_HEADER + len;
+	}
+
+	if (footer)
+		footer->used = off;
+	return off;
+}
+
+// ----------------------------------------------------------------------------------
+//   Indexed Log Writer Class
+// ----------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+//   Con/De structors
+// ------------------------------------------------------------------------------
+Indexed_Log_Writer::
+Indexed_Log_Writer()
+{
+	fd = -1;
+	block_index = 0;
+	_reset_block();
+}
+
+Indexed_Log_Writer::
+~Indexed_Log_Writer()
+{
+	close();
+}
+
+void
+Indexed_Log_Writer::
+_reset_block()
+{
+	memset(block, 0, sizeof(block));
+	memset(&footer, 0, sizeof(footer));
+	fill = 0;
+	synced = 0;
+}
+
+// ------------------------------------------------------------------------------
+//   Open
+// ------------------------------------------------------------------------------
+/*
+ * Opens a log for appending, creating it if needed.  A partial or damaged
+ * last block left behind by a power loss is taken over and completed.
+ */
+int
+Indexed_Log_Writer::
+open(const char *path)
+{
+	fd = ::open(path, O_RDWR | O_CREAT, 0666);
+	if (fd < 0)
+	{
+		fprintf(stderr, "ERROR: could not open indexed log %s\n", path);
+		return -1;
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) < 0)
+	{
+		::close(fd);
+		fd = -1;
+		return -1;
+	}
+
+	uint32_t complete = st.st_size / INDEXED_LOG_BLOCK;
+	int tail_len = st.st_size % INDEXED_LOG_BLOCK;
+
+	// a full sized last block may still be garbage if the card was pulled
+	// while the cluster was allocated but not yet written
+	if (tail_len == 0 && complete > 0)
+	{
+		uint8_t *last = block;
+		if (pread(fd, last, INDEXED_LOG_BLOCK, (off_t)(complete - 1) * INDEXED_LOG_BLOCK) == INDEXED_LOG_BLOCK)
+		{
+			Indexed_Log_Footer f;
+			memcpy(&f, &last[INDEXED_LOG_DATA_LEN], sizeof(f));
+			if (!_footer_valid(last, f, complete - 1))
+			{
+				complete--;
+				tail_len = INDEXED_LOG_BLOCK;
+			}
+		}
+	}
+
+	return _recover_tail(complete, tail_len);
+}
+
+int
+Indexed_Log_Writer::
+_recover_tail(uint32_t complete_blocks, int tail_len)
+{
+	_reset_block();
+	block_index = complete_blocks;
+
+	if (tail_len > 0)
+	{
+		int limit = tail_len < INDEXED_LOG_DATA_LEN ? tail_len : INDEXED_LOG_DATA_LEN;
+		if (pread(fd, block, limit, (off_t)block_index * INDEXED_LOG_BLOCK) != limit)
+			limit = 0;
+
+		fill = indexed_log_scan_records(block, limit, &footer);
+		synced = fill;
+
+		// anything after the intact records is overwritten from here on
+		memset(&block[fill], 0, INDEXED_LOG_BLOCK - fill);
+		if (tail_len != fill)
+			printf("Indexed log: recovered %d frames from a %d byte partial block\n", footer.num_frames, tail_len);
+	}
+
+	if (lseek(fd, (off_t)block_index * INDEXED_LOG_BLOCK + synced, SEEK_SET) < 0)
+		return -1;
+
+	return 0;
+}
+
+// ------------------------------------------------------------------------------
+//   Append Frame
+// ------------------------------------------------------------------------------
+int
+Indexed_Log_Writer::
+append(uint64_t usec, const uint8_t *frame, int len)
+{
+	if (fd < 0 || len <= 0 || len > MAVLINK_MAX_PACKET_LEN)
+		return -1;
+
+	int written = 0;
+	if (fill + INDEXED_LOG_RECORD_HEADER + len > INDEXED_LOG_DATA_LEN)
+	{
+		written = _finish_block();
+		if (written < 0)
+			return -1;
+	}
+
+	uint16_t len16 = (uint16_t)len;
+	memcpy(&block[fill], &len16, sizeof(len16));
+	memcpy(&block[fill + 2], &usec, sizeof(usec));
+	memcpy(&block[fill + INDEXED_LOG_RECORD_HEADER], frame, len);
+	fill += INDEXED_LOG_RECORD_HEADER + len;
+
+	_index_frame(usec, frame);
+
+	return written;
+}
+
+void
+Indexed_Log_Writer::
+_index_frame(uint64_t usec, const uint8_t *frame)
+{
+	if (footer.num_frames == 0)
+		footer.first_usec = usec;
+	footer.last_usec = usec;
+	footer.num_frames++;
+	_bitmap_set(footer, indexed_log_frame_msgid(frame));
+}
+
+// ------------------------------------------------------------------------------
+//   Flush
+// ------------------------------------------------------------------------------
+/*
+ * Writes the records of the current block that are not on storage yet.  The
+ * block stays open; it gets its footer when it fills up.
+ */
+int
+Indexed_Log_Writer::
+flush()
+{
+	if (fd < 0)
+		return -1;
+
+	return _write_block_tail(fill);
+}
+
+int
+Indexed_Log_Writer::
+_write_block_tail(int end)
+{
+	int written = 0;
+	while (synced < end)
+	{
+		int result = write(fd, &block[synced], end - synced);
+		if (result <= 0)
+			return -1;
+		synced += result;
+		written += result;
+	}
+
+	return written;
+}
+
+int
+Indexed_Log_Writer::
+_finish_block()
+{
+	footer.magic = INDEXED_LOG_MAGIC;
+	footer.block_index = block_index;
+	footer.used = fill;
+	footer.block_size = INDEXED_LOG_BLOCK;
+
+	// padding is already zero, the crc covers it along with the footer
+	memcpy(&block[INDEXED_LOG_DATA_LEN], &footer, sizeof(footer));
+	footer.crc = _block_crc(block);
+	memcpy(&block[INDEXED_LOG_BLOCK - 2], &footer.crc, sizeof(footer.crc));
+
+	int written = _write_block_tail(INDEXED_LOG_BLOCK);
+	if (written < 0)
+		return -1;
+
+	block_index++;
+	_reset_block();
+
+	return written;
+}
+
+// ------------------------------------------------------------------------------
+//   Close
+// ------------------------------------------------------------------------------
+/*
+ * The last block is left partial, a later open() continues filling it.
+ */
+void
+Indexed_Log_Writer::
+close()
+{
+	if (fd < 0)
+		return;
+
+	flush();
+	fsync(fd);
+	::close(fd);
+	fd = -1;
+}
+
+// ----------------------------------------------------------------------------------
+//   Indexed Log Reader Class
+// ----------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+//   Con/De structors
+// ------------------------------------------------------------------------------
+Indexed_Log_Reader::
+Indexed_Log_Reader()
+{
+	fd = -1;
+	num_blocks = 0;
+	file_size = 0;
+	order_checked = false;
+	ordered = false;
+	cur_block = 0;
+	cur_off = 0;
+	loaded_block = 0;
+	have_block = false;
+	loaded_used = 0;
+	memset(&loaded_footer, 0, sizeof(loaded_footer));
+}
+
+Indexed_Log_Reader::
+~Indexed_Log_Reader()
+{
+	close();
+}
+
+// ------------------------------------------------------------------------------
+//   Open / Close
+// ------------------------------------------------------------------------------
+int
+Indexed_Log_Reader::
+open(const char *path)
+{
+	fd = ::open(path, O_RDONLY);
+	if (fd < 0)
+	{
+		fprintf(stderr, "ERROR: could not open indexed log %s\n", path);
+		return -1;
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) < 0)
+	{
+		close();
+		return -1;
+	}
+
+	file_size = st.st_size;
+	num_blocks = (file_size + INDEXED_LOG_BLOCK - 1) / INDEXED_LOG_BLOCK;
+	order_checked = false;
+	cur_block = 0;
+	cur_off = 0;
+	have_block = false;
+
+	return 0;
+}
+
+void
+Indexed_Log_Reader::
+close()
+{
+	if (fd >= 0)
+		::close(fd);
+	fd = -1;
+	num_blocks = 0;
+	have_block = false;
+}
+
+// ------------------------------------------------------------------------------
+//   Block Access
+// ------------------------------------------------------------------------------
+/*
+ * Reads only the footer of a block.  Fails for the partial last block and
+ * for footers that are not what this block should carry; the block crc is
+ * not checked here, that needs the whole block.
+ */
+bool
+Indexed_Log_Reader::
+_read_footer(uint32_t index, Indexed_Log_Footer &f)
+{
+	if ((index + 1) * (uint64_t)INDEXED_LOG_BLOCK > file_size)
+		return false;
+
+	off_t offset = (off_t)index * INDEXED_LOG_BLOCK + INDEXED_LOG_DATA_LEN;
+	if (pread(fd, &f, sizeof(f), offset) != (ssize_t)sizeof(f))
+		return false;
+
+	return _footer_valid(NULL, f, index);
+}
+
+bool
+Indexed_Log_Reader::
+_load_block(uint32_t index)
+{
+	if (have_block && loaded_block == index)
+		return true;
+	if (index >= num_blocks)
+		return false;
+
+	off_t offset = (off_t)index * INDEXED_LOG_BLOCK;
+	int len = file_size - offset < INDEXED_LOG_BLOCK ? file_size - offset : INDEXED_LOG_BLOCK;
+
+	memset(block, 0, sizeof(block));
+	if (pread(fd, block, len, offset) != len)
+		return false;
+
+	Indexed_Log_Footer f;
+	memcpy(&f, &block[INDEXED_LOG_DATA_LEN], sizeof(f));
+	if (len == INDEXED_LOG_BLOCK && _footer_valid(block, f, index))
+	{
+		loaded_footer = f;
+		loaded_used = f.used;
+	}
+	else
+	{
+		// partial or damaged, keep whatever records are intact
+		int limit = len < INDEXED_LOG_DATA_LEN ? len : INDEXED_LOG_DATA_LEN;
+		loaded_used = indexed_log_scan_records(block, limit, &loaded_footer);
+	}
+
+	loaded_block = index;
+	have_block = true;
+	return true;
+}
+
+bool
+Indexed_Log_Reader::
+_block_range(uint32_t index, uint64_t &first, uint64_t &last)
+{
+	Indexed_Log_Footer f;
+	if (_read_footer(index, f))
+	{
+		first = f.first_usec;
+		last = f.last_usec;
+		return f.num_frames > 0;
+	}
+
+	if (!_load_block(index))
+		return false;
+	first = loaded_footer.first_usec;
+	last = loaded_footer.last_usec;
+	return loaded_footer.num_frames > 0;
+}
+
+/*
+ * A writer that appends after a reboot on a board without an RTC stamps
+ * from near the epoch again, and the binary search over the footers then
+ * lands anywhere.  Checked once per open, on the footers alone for the
+ * complete blocks.
+ */
+bool
+Indexed_Log_Reader::
+_times_ordered()
+{
+	if (order_checked)
+		return ordered;
+
+	ordered = true;
+	uint64_t prev_last = 0;
+	for (uint32_t i = 0; i < num_blocks && ordered; i++)
+	{
+		uint64_t first, last;
+		if (!_block_range(i, first, last))
+			continue;
+		ordered = first >= prev_last && last >= first;
+		prev_last = last;
+	}
+
+	order_checked = true;
+	return ordered;
+}
+
+bool
+Indexed_Log_Reader::
+_block_may_contain(uint32_t index, uint32_t msgid)
+{
+	Indexed_Log_Footer f;
+	if (_read_footer(index, f))
+		return _bitmap_test(f, msgid);
+
+	if (!_load_block(index))
+		return false;
+	return _bitmap_test(loaded_footer, msgid);
+}
+
+// ------------------------------------------------------------------------------
+//   Read Frame
+// ------------------------------------------------------------------------------
+/*
+ * Copies the frame under the cursor into frame, which must hold
+ * MAVLINK_MAX_PACKET_LEN bytes, and advances.  Returns the frame length, or
+ * 0 at the end of the log.
+ */
+int
+Indexed_Log_Reader::
+read_frame(uint64_t &usec, uint8_t *frame)
+{
+	while (cur_block < num_blocks)
+	{
+		if (!_load_block(cur_block))
+			return 0;
+
+		if (cur_off + INDEXED_LOG_RECORD_HEADER <= loaded_used)
+		{
+			uint16_t len;
+			memcpy(&len, &block[cur_off], sizeof(len));
+			memcpy(&usec, &block[cur_off + 2], sizeof(usec));
+			memcpy(frame, &block[cur_off + INDEXED_LOG_RECORD_HEADER], len);
+			cur_off += INDEXED_LOG_RECORD_HEADER + len;
+			return len;
+		}
+
+		cur_block++;
+		cur_off = 0;
+	}
+
+	return 0;
+}
+
+// ------------------------------------------------------------------------------
+//   Seek by Time
+// ------------------------------------------------------------------------------
+/*
+ * Binary search for the last block starting at or before usec, then a scan
+ * inside it.  Costs O(log n) footer reads plus one or two block reads.
+ * When the times step back somewhere in the file the scan starts from the
+ * first block instead and stops where the times rise past usec, in the
+ * session that covers it, or else at the first frame at or after usec.
+ */
+bool
+Indexed_Log_Reader::
+seek_time(uint64_t usec)
+{
+	if (num_blocks == 0)
+		return false;
+
+	bool in_order = _times_ordered();
+	uint32_t lo = 0;
+	uint32_t hi = num_blocks;
+	while (in_order && hi - lo > 1)
+	{
+		uint32_t mid = lo + (hi - lo) / 2;
+		uint64_t first, last;
+
+		// an empty block sorts with whatever follows it
+		uint32_t probe = mid;
+		bool found = false;
+		while (probe < hi && !(found = _block_range(probe, first, last)))
+			probe++;
+
+		if (!found || first > usec)
+			hi = mid;
+		else
+			lo = probe;
+	}
+
+	cur_block = lo;
+	cur_off = 0;
+
+	// step over the frames before usec
+	uint64_t t;
+	uint8_t frame[MAVLINK_MAX_PACKET_LEN];
+	bool below = false; // the frame before was earlier than usec
+	uint32_t fallback_block = 0;
+	int fallback_off = -1;
+	while (true)
+	{
+		uint32_t block_before = cur_block;
+		int off_before = cur_off;
+
+		if (read_frame(t, frame) == 0)
+			break;
+
+		if (t >= usec && (in_order || below))
+		{
+			cur_block = block_before;
+			cur_off = off_before;
+			return true;
+		}
+		if (t >= usec && fallback_off < 0)
+		{
+			fallback_block = block_before;
+			fallback_off = off_before;
+		}
+		below = t < usec;
+	}
+
+	if (fallback_off < 0)
+		return false;
+
+	cur_block = fallback_block;
+	cur_off = fallback_off;
+	return true;
+}
+
+// ------------------------------------------------------------------------------
+//   Seek by Message Id
+// ------------------------------------------------------------------------------
+/*
+ * Moves the cursor forward to the next frame with msgid.  Blocks whose
+ * bitmap rules the id out are skipped on their footer alone.
+ */
+bool
+Indexed_Log_Reader::
+seek_msgid(uint32_t msgid)
+{
+	while (cur_block < num_blocks)
+	{
+		if (cur_off == 0 && !_block_may_contain(cur_block, msgid))
+		{
+			cur_block++;
+			continue;
+		}
+
+		if (!_load_block(cur_block))
+			return false;
+
+		if (cur_off + INDEXED_LOG_RECORD_HEADER > loaded_used)
+		{
+			cur_block++;
+			cur_off = 0;
+			continue;
+		}
+
+		uint16_t len;
+		memcpy(&len, &block[cur_off], sizeof(len));
+		if (indexed_log_frame_msgid(&block[cur_off + INDEXED_LOG_RECORD_HEADER]) == msgid)
+			return true;
+
+		cur_off += INDEXED_LOG_RECORD_HEADER + len;
+	}
+
+	return false;
+}
@@ -0,0 +1,182 @@
+/**
+ * @file indexed_log.h
+ *
+ * @brief Indexed telemetry log definition
+ *
+ * A seekable container for raw MAVLink frames.  The file is a sequence of
+ * fixed size blocks; each block holds timestamped frames followed by a
+ * footer with the block's time range and a bitmap of the message ids it
+ * contains.  Readers binary search the footers to seek by time and skip
+ * blocks by footer to seek by message id, without reading the frames in
+ * between.
+ *
+ * Block layout (all fields little-endian):
+ *
+ *   record*   u16 frame length, u64 microseconds, raw frame
+ *   padding   zeros up to the footer
+ *   footer    Indexed_Log_Footer, the last INDEXED_LOG_FOOTER_LEN bytes
+ *
+ * The block being filled is appended to the file as frames arrive and only
+ * gets its footer once full, so after a power loss the file ends in a
+ * partial block.  Its frames are recovered by scanning the records, and a
+ * writer opening the file again completes that block before going on.
+ *
+ */
+
+#ifndef INDEXED_LOG_H_
+#define INDEXED_LOG_H_
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "../include/mavlink/v2.0/spresense/mavlink.h"
+
+// ------------------------------------------------------------------------------
+//   Defines
+// ------------------------------------------------------------------------------
+
+// One FAT cluster on the Spresense SD card
+#define INDEXED_LOG_BLOCK 4096
+
+#define INDEXED_LOG_FOOTER_LEN 64
+#define INDEXED_LOG_DATA_LEN (INDEXED_LOG_BLOCK - INDEXED_LOG_FOOTER_LEN)
+
+// u16 length + u64 timestamp in front of every frame
+#define INDEXED_LOG_RECORD_HEADER 10
+
+#define INDEXED_LOG_MAGIC 0x474f4c4d // "MLOG"
+
+// Message ids are folded into this many bits per block
+#define INDEXED_LOG_BITMAP_BITS 256
+
+// ------------------------------------------------------------------------------
+//   Data Structures
+// ------------------------------------------------------------------------------
+
+struct Indexed_Log_Footer
+{
+	uint32_t magic;
+	uint32_t block_index;
+	uint64_t first_usec;
+	uint64_t last_usec;
+	uint8_t msgid_bitmap[INDEXED_LOG_BITMAP_BITS / 8];
+	uint16_t num_frames;
+	uint16_t used;		 // bytes of records in front of the padding
+	uint16_t block_size;
+	uint16_t crc;		 // CRC-16/X.25 over the whole block except this field
+};
+
+// ----------------------------------------------------------------------------------
+//   Indexed Log Writer Class
+// ----------------------------------------------------------------------------------
+/*
+ * Indexed Log Writer Class
+ *
+ * Not thread safe, meant to be driven by a single writer thread such as the
+ * Tlog_Recorder's.  append() and flush() return the number of bytes that
+ * reached storage during the call, or -1 on a write error.
+ */
+class Indexed_Log_Writer
+{
+
+public:
+	Indexed_Log_Writer();
+	~Indexed_Log_Writer();
+
+	int open(const char *path);
+	int append(uint64_t usec, const uint8_t *frame, int len);
+	int flush();
+	void close();
+
+	bool is_open()
+	{
+		return fd >= 0;
+	}
+
+private:
+	int fd;
+	uint32_t block_index;
+	uint8_t block[INDEXED_LOG_BLOCK];
+	int fill;	// bytes of records in the block
+	int synced; // bytes of the block already written
+
+	Indexed_Log_Footer footer;
+
+	void _reset_block();
+	void _index_frame(uint64_t usec, const uint8_t *frame);
+	int _finish_block();
+	int _write_block_tail(int end);
+	int _recover_tail(uint32_t complete_blocks, int tail_len);
+};
+
+// ----------------------------------------------------------------------------------
+//   Indexed Log Reader Class
+// ----------------------------------------------------------------------------------
+/*
+ * Indexed Log Reader Class
+ *
+ * Reads frames in order from a cursor.  seek_time() moves the cursor to the
+ * first frame at or after a time with a binary search over block footers,
+ * or with a scan from the start when the times step back somewhere in the
+ * file; seek_msgid() moves it forward to the next frame with a message id,
+ * only opening blocks whose bitmap may contain it.  Blocks with a missing or
+ * damaged footer are scanned instead of trusted.
+ */
+class Indexed_Log_Reader
+{
+
+public:
+	Indexed_Log_Reader();
+	~Indexed_Log_Reader();
+
+	int open(const char *path);
+	void close();
+
+	uint32_t get_num_blocks()
+	{
+		return num_blocks;
+	}
+
+	bool seek_time(uint64_t usec);
+	bool seek_msgid(uint32_t msgid);
+	int read_frame(uint64_t &usec, uint8_t *frame);
+
+private:
+	int fd;
+	uint32_t num_blocks; // including a trailing partial block
+	uint32_t file_size;
+
+	// whether block times only increase, found on the first seek_time()
+	bool order_checked;
+	bool ordered;
+
+	// cursor
+	uint32_t cur_block;
+	int cur_off;
+
+	// the block currently in memory
+	uint32_t loaded_block;
+	bool have_block;
+	int loaded_used;
+	uint8_t block[INDEXED_LOG_BLOCK];
+	Indexed_Log_Footer loaded_footer;
+
+	bool _read_footer(uint32_t index, Indexed_Log_Footer &f);
+	bool _load_block(uint32_t index);
+	bool _block_range(uint32_t index, uint64_t &first, uint64_t &last);
+	bool _times_ordered();
+	bool _block_may_contain(uint32_t index, uint32_t msgid);
+};
+
+// ------------------------------------------------------------------------------
+//   Helpers
+// ------------------------------------------------------------------------------
+
+int indexed_log_scan_records(const uint8_t *data, int limit, Indexed_Log_Footer *footer);
+uint32_t indexed_log_frame_msgid(const uint8_t *frame);
+
+#endif // INDEXED_LOG_H_
@@ -0,0 +1,353 @@
+/**
+ * @file latency_histogram.cpp
+ *
+ * @brief Pipeline latency histograms functions
+ *
+ * Functions for recording, merging and reporting latency distributions
+ *
+ */
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include "latency_histogram.h"
+#include "link_stats.h"
+
+#include <string.h>
+
+// ------------------------------------------------------------------------------
+//   Clock
+// ------------------------------------------------------------------------------
+/*
+ * Starts the DWT cycle counter; the counter keeps running once enabled, so
+ * calling this again is harmless.  Nothing to do on a host.
+ */
+void
+latency_clock_init()
+{
+#if defined(__NuttX__)
+	volatile uint32_t *demcr = (volatile uint32_t *)0xE000EDFC;
+	volatile uint32_t *dwt_ctrl = (volatile uint32_t *)0xE0001000;
+
+	*demcr |= 1 << 24;	// TRCENA, powers the DWT
+	*dwt_ctrl |= 1;		// CYCCNTENA
+#endif
+}
+
+// ----------------------------------------------------------------------------------
+//   Latency Histogram Class
+// ----------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+//   Con/De structors
+// ------------------------------------------------------------------------------
+Latency_Histogram::
+Latency_Histogram()
+{
+	initialize_defaults(1);
+}
+
+Latency_Histogram::
+Latency_Histogram(const char *name_, int shards_)
+{
+	initialize_defaults(shards_);
+	set_name(name_);
+}
+
+Latency_Histogram::
+~Latency_Histogram()
+{
+	delete[] shards;
+}
+
+void
+Latency_Histogram::
+initialize_defaults(int shards_)
+{
+	// Initialize attributes
+	name[0] = 0;
+
+	if (shards_ < 1)
+		shards_ = 1;
+	if (shards_ > LATENCY_MAX_SHARDS)
+		shards_ = LATENCY_MAX_SHARDS;
+	num_shards = shards_;
+
+	// value initialized, every counter and shard state zero
+	shards = new Shard[num_shards]();
+
+	latency_clock_init();
+}
+
+void
+Latency_Histogram::
+set_name(const char *name_)
+{
+	strncpy(name, name_, sizeof(name) - 1);
+	name[sizeof(name) - 1] = 0;
+}
+
+// ------------------------------------------------------------------------------
+//   Buckets
+// ------------------------------------------------------------------------------
+/*
+ * Values below LATENCY_SUB_BUCKETS have a bucket each.  Above, the bucket
+ * is the power of two and the next LATENCY_SUB_BITS bits below the top one.
+ */
+int
+Latency_Histogram::
+bucket_of(uint32_t ns)
+{
+	if (ns < LATENCY_SUB_BUCKETS)
+		return ns;
+
+	int e = 31 - __builtin_clz(ns);
+	return (e - LATENCY_SUB_BITS + 1) * LATENCY_SUB_BUCKETS +
+		   ((ns >> (e - LATENCY_SUB_BITS)) & (LATENCY_SUB_BUCKETS - 1));
+}
+
+// Highest value that lands in the bucket
+uint32_t
+Latency_Histogram::
+bucket_top(int bucket)
+{
+	if (bucket < LATENCY_SUB_BUCKETS)
+		return bucket;
+
+	int shift = bucket / LATENCY_SUB_BUCKETS - 1;
+	uint64_t low = (uint64_t)(LATENCY_SUB_BUCKETS + bucket % LATENCY_SUB_BUCKETS) << shift;
+	return (uint32_t)(low + ((uint64_t)1 << shift) - 1);
+}
+
+// ------------------------------------------------------------------------------
+//   Record
+// ------------------------------------------------------------------------------
+/*
+ * The calling thread's shard, claimed on its first record.  No thread local
+ * storage on this target, so the owners are scanned; there are only a few.
+ */
+Latency_Histogram::Shard *
+Latency_Histogram::
+_shard()
+{
+	pthread_t self = pthread_self();
+
+	for (int i = 0; i < num_shards; i++)
+	{
+		Shard &shard = shards[i];
+		if (shard.state.load(std::memory_order_acquire) == 2 && pthread_equal(shard.owner, self))
+			return &shard;
+	}
+
+	for (int i = 0; i < num_shards; i++)
+	{
+		Shard &shard = shards[i];
+		int expected = 0;
+		if (shard.state.compare_exchange_strong(expected, 1, std::memory_order_acquire))
+		{
+			shard.owner = self;
+			shard.state.store(2, std::memory_order_release);
+			return &shard;
+		}
+	}
+
+	// more threads than shards, share the last one
+	return &shards[num_shards - 1];
+}
+
+void
+Latency_Histogram::
+record(uint32_t ns)
+{
+	Shard *shard = _shard();
+
+	shard->counts[bucket_of(ns)].fetch_add(1, std::memory_order_relaxed);
+
+	uint32_t max = shard->max.load(std::memory_order_relaxed);
+	while (ns > max && !shard->max.compare_exchange_weak(max, ns, std::memory_order_relaxed))
+		;
+}
+
+// ------------------------------------------------------------------------------
+//   Read
+// ------------------------------------------------------------------------------
+// bucket summed over the shards
+uint32_t
+Latency_Histogram::
+_count(int bucket)
+{
+	uint32_t count = 0;
+	for (int i = 0; i < num_shards; i++)
+		count += shards[i].counts[bucket].load(std::memory_order_relaxed);
+	return count;
+}
+
+/*
+ * Merges the shards, bucket by bucket so no copy of the histogram goes on
+ * the stack.  Recording carries on meanwhile, so the result is a moment of
+ * the run, not an exact cut.
+ */
+void
+Latency_Histogram::
+snapshot(Latency_Snapshot &result)
+{
+	memset(&result, 0, sizeof(result));
+
+	for (int i = 0; i < num_shards; i++)
+	{
+		uint32_t max = shards[i].max.load(std::memory_order_relaxed);
+		if (max > result.max)
+			result.max = max;
+	}
+
+	for (int b = 0; b < LATENCY_BUCKETS; b++)
+		result.count += _count(b);
+	if (result.count == 0)
+		return;
+
+	// smallest value with at least that share of the samples at or below it
+	uint64_t rank50 = ((uint64_t)result.count * 500 + 999) / 1000;
+	uint64_t rank99 = ((uint64_t)result.count * 990 + 999) / 1000;
+	uint64_t rank999 = ((uint64_t)result.count * 999 + 999) / 1000;
+
+	uint64_t seen = 0;
+	bool have50 = false, have99 = false;
+	for (int b = 0; b < LATENCY_BUCKETS; b++)
+	{
+		uint32_t count = _count(b);
+		if (count == 0)
+			continue;
+		seen += count;
+
+		uint32_t top = bucket_top(b);
+		if (top > result.max)
+			top = result.max;
+
+		if (!have50 && seen >= rank50)
+		{
+			result.p50 = top;
+			have50 = true;
+		}
+		if (!have99 && seen >= rank99)
+		{
+			result.p99 = top;
+			have99 = true;
+		}
+		if (seen >= rank999)
+		{
+			result.p999 = top;
+			break;
+		}
+	}
+}
+
+// microseconds with three decimals
+static int
+_format_ns(char *buf, int size, uint32_t ns)
+{
+	return snprintf(buf, size, "%10lu.%03lu", (unsigned long)(ns / 1000), (unsigned long)(ns % 1000));
+}
+
+int
+Latency_Histogram::
+format(char *buf, int size)
+{
+	Latency_Snapshot s;
+	snapshot(s);
+
+	char p50[24], p99[24], p999[24], max[24];
+	_format_ns(p50, sizeof(p50), s.p50);
+	_format_ns(p99, sizeof(p99), s.p99);
+	_format_ns(p999, sizeof(p999), s.p999);
+	_format_ns(max, sizeof(max), s.max);
+
+	int len = snprintf(buf, size, "%-24s %10lu %s %s %s %s\n",
+					   name, (unsigned long)s.count, p50, p99, p999, max);
+	return len < size ? len : size - 1;
+}
+
+void
+Latency_Histogram::
+reset()
+{
+	for (int i = 0; i < num_shards; i++)
+	{
+		for (int b = 0; b < LATENCY_BUCKETS; b++)
+			shards[i].counts[b].store(0, std::memory_order_relaxed);
+		shards[i].max.store(0, std::memory_order_relaxed);
+	}
+}
+
+// ------------------------------------------------------------------------------
+//   Stage Histograms
+// ------------------------------------------------------------------------------
+/*
+ * One set for the image.  A shard for every thread that records the stage:
+ * the read thread for the receive stages, the write thread and the main
+ * thread for writes, and both port threads for the mutexes.
+ */
+static Latency_Histogram rx_frame_histogram("rx byte to frame", 1);
+static Latency_Histogram dispatch_histogram("frame to dispatch", 1);
+static Latency_Histogram msglib_histogram("msglib request to reply", 1);
+static Latency_Histogram encode_histogram("encode to write", 2);
+static Latency_Histogram lock_histogram("port lock wait", 3);
+
+static Latency_Histogram *const stage_histograms[LATENCY_NUM_STAGES] =
+{
+	&rx_frame_histogram,
+	&dispatch_histogram,
+	&msglib_histogram,
+	&encode_histogram,
+	&lock_histogram,
+};
+
+#if defined(CONFIG_FS_PROCFS_REGISTER)
+// registers /proc/mavlink_latency with the static histograms
+static struct Latency_Procfs
+{
+	Latency_Procfs() { link_stats_procfs_add("mavlink_latency", latency_format_all); }
+} latency_procfs;
+#endif
+
+Latency_Histogram &
+latency_histogram(Latency_Stage stage)
+{
+	return *stage_histograms[stage];
+}
+
+int
+latency_format_all(char *buf, int size)
+{
+	int len = snprintf(buf, size, "%-24s %10s %14s %14s %14s %14s\n",
+					   "stage (us)", "count", "p50", "p99", "p99.9", "max");
+	if (len > size - 1)
+		len = size - 1;
+
+	for (int i = 0; i < LATENCY_NUM_STAGES && len < size - 1; i++)
+		len += stage_histograms[i]->format(buf + len, size - len);
+
+	return len;
+}
+
+void
+latency_dump(FILE *out)
+{
+	char buf[128];
+
+	snprintf(buf, sizeof(buf), "%-24s %10s %14s %14s %14s %14s\n",
+			 "stage (us)", "count", "p50", "p99", "p99.9", "max");
+	fputs(buf, out);
+	for (int i = 0; i < LATENCY_NUM_STAGES; i++)
+	{
+		stage_histograms[i]->format(buf, sizeof(buf));
+		fputs(buf, out);
+	}
+}
+
+void
+latency_reset_all()
+{
+	for (int i = 0; i < LATENCY_NUM_STAGES; i++)
+		stage_histograms[i]->reset();
+}
@@ -0,0 +1,192 @@
+/**
+ * @file latency_histogram.h
+ *
+ * @brief Pipeline latency histograms definition
+ *
+ * Always-on latency distributions for the stages of the MAVLink pipeline,
+ * readable while the link runs from /proc/mavlink_latency on NuttX or
+ * through a snapshot and a text dump anywhere
+ *
+ */
+
+#ifndef LATENCY_HISTOGRAM_H_
+#define LATENCY_HISTOGRAM_H_
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h> // This uses POSIX Threads
+#include <atomic>
+
+// ------------------------------------------------------------------------------
+//   Defines
+// ------------------------------------------------------------------------------
+
+// Buckets per power of two, 2^3 keeps every value within 12.5%
+#define LATENCY_SUB_BITS 3
+#define LATENCY_SUB_BUCKETS (1 << LATENCY_SUB_BITS)
+
+// Nanoseconds from 0 to 2^32 - 1, about 4.3 s; 240 buckets, 960 bytes
+#define LATENCY_BUCKETS ((32 - LATENCY_SUB_BITS + 1) * LATENCY_SUB_BUCKETS)
+
+// Most shards a histogram is split into, one per recording thread
+#define LATENCY_MAX_SHARDS 4
+
+#define LATENCY_NAME_LEN 24
+
+// Application core clock, for the DWT cycle counter
+#ifndef LATENCY_CPU_HZ
+#define LATENCY_CPU_HZ 156000000
+#endif
+
+// ------------------------------------------------------------------------------
+//   Stages
+// ------------------------------------------------------------------------------
+
+enum Latency_Stage
+{
+	LATENCY_RX_FRAME,		// first byte of a frame read to the frame complete
+	LATENCY_DISPATCH,		// frame complete to handled by read_messages()
+	LATENCY_MSGLIB_REPLY,	// HIL_GPS request to the GPS task's reply
+	LATENCY_ENCODE_WRITE,	// write_message() or write_frame() entered to the bytes written
+	LATENCY_LOCK_WAIT,		// waiting for a port mutex
+	LATENCY_NUM_STAGES
+};
+
+// ------------------------------------------------------------------------------
+//   Clock
+// ------------------------------------------------------------------------------
+/*
+ * A free running 32 bit timestamp, differences in nanoseconds.  The NuttX
+ * clock only moves with the 10 ms tick, so on the board this is the
+ * Cortex-M4 DWT cycle counter (one load to read, wraps every 27 s), on a
+ * host CLOCK_MONOTONIC.
+ */
+#if defined(__NuttX__)
+
+#define LATENCY_DWT_CYCCNT (*(volatile uint32_t *)0xE0001004)
+
+// ns per cycle, 16.16 fixed point so the conversion is one multiply
+#define LATENCY_NS_PER_CYCLE_Q16 ((uint32_t)((1000ull << 16) / (LATENCY_CPU_HZ / 1000000)))
+
+static inline uint32_t
+latency_stamp()
+{
+	return LATENCY_DWT_CYCCNT;
+}
+
+static inline uint32_t
+latency_delta_ns(uint32_t start, uint32_t end)
+{
+	uint64_t ns = ((uint64_t)(end - start) * LATENCY_NS_PER_CYCLE_Q16) >> 16;
+	return ns > 0xFFFFFFFF ? 0xFFFFFFFF : (uint32_t)ns;
+}
+
+#else
+
+static inline uint32_t
+latency_stamp()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t)((uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec);
+}
+
+static inline uint32_t
+latency_delta_ns(uint32_t start, uint32_t end)
+{
+	return end - start;
+}
+
+#endif // __NuttX__
+
+static inline uint32_t
+latency_elapsed_ns(uint32_t since)
+{
+	return latency_delta_ns(since, latency_stamp());
+}
+
+void latency_clock_init();
+
+// ------------------------------------------------------------------------------
+//   Data Structures
+// ------------------------------------------------------------------------------
+
+// Values in nanoseconds, percentiles are the top of their bucket
+struct Latency_Snapshot
+{
+	uint32_t count;
+	uint32_t p50;
+	uint32_t p99;
+	uint32_t p999;
+	uint32_t max;
+};
+
+// ----------------------------------------------------------------------------------
+//   Latency Histogram Class
+// ----------------------------------------------------------------------------------
+/*
+ * Latency Histogram Class
+ *
+ * Log-linear buckets like HdrHistogram: exact below LATENCY_SUB_BUCKETS
+ * ns, then LATENCY_SUB_BUCKETS buckets per power of two.  A thread claims
+ * a shard of its own on its first record, so recording is a relaxed add
+ * to a counter no other thread writes; threads beyond the shards share
+ * the last one, still correctly, just no longer alone.  Readers merge the
+ * shards.
+ */
+class Latency_Histogram
+{
+
+public:
+	Latency_Histogram();
+	Latency_Histogram(const char *name_, int shards_);
+	~Latency_Histogram();
+
+	void set_name(const char *name_);
+	const char *get_name() { return name; }
+
+	void record(uint32_t ns);
+	void record_since(uint32_t stamp) { record(latency_elapsed_ns(stamp)); }
+	void record_between(uint32_t start, uint32_t end) { record(latency_delta_ns(start, end)); }
+
+	void snapshot(Latency_Snapshot &result);
+	int format(char *buf, int size);
+	void reset();
+
+	static int bucket_of(uint32_t ns);
+	static uint32_t bucket_top(int bucket);
+
+private:
+	char name[LATENCY_NAME_LEN];
+
+	struct Shard
+	{
+		std::atomic<int> state; // 0 free, 1 being claimed, 2 owned
+		pthread_t owner;
+		std::atomic<uint32_t> max;
+		std::atomic<uint32_t> counts[LATENCY_BUCKETS];
+	};
+
+	Shard *shards;
+	int num_shards;
+
+	void initialize_defaults(int shards_);
+	Shard *_shard();
+	uint32_t _count(int bucket);
+};
+
+// ------------------------------------------------------------------------------
+//   Stage Histograms
+// ------------------------------------------------------------------------------
+
+Latency_Histogram &latency_histogram(Latency_Stage stage);
+int latency_format_all(char *buf, int size);
+void latency_dump(FILE *out);
+void latency_reset_all();
+
+#endif // LATENCY_HISTOGRAM_H_
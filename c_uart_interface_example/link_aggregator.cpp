@@ -0,0 +1,432 @@
+/**
+ * @file link_aggregator.cpp
+ *
+ * @brief Link aggregator functions
+ *
+ * Functions for reading several links into one queue and routing writes
+ * to the link each system is on
+ *
+ */
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include "link_aggregator.h"
+
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <utility>
+
+// ----------------------------------------------------------------------------------
+//   Link Aggregator Class
+// ----------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+//   Con/De structors
+// ------------------------------------------------------------------------------
+Link_Aggregator::
+Link_Aggregator()
+{
+	initialize_defaults(LINK_AGGREGATOR_DEFAULT_DEPTH);
+}
+
+Link_Aggregator::
+Link_Aggregator(int depth_)
+{
+	initialize_defaults(depth_);
+}
+
+Link_Aggregator::
+~Link_Aggregator()
+{
+	stop();
+
+	// the queued handles go back to the pool before it goes
+	delete[] queue;
+	delete pool;
+
+	// destroy mutex
+	pthread_cond_destroy(&cond);
+	pthread_mutex_destroy(&lock);
+}
+
+void
+Link_Aggregator::
+initialize_defaults(int depth_)
+{
+	// Initialize attributes
+	memset(links, 0, sizeof(links));
+	num_links = 0;
+	started = false;
+	time_to_exit = false;
+
+	depth = depth_ > 0 ? depth_ : 1;
+	queue = new Link_Frame[depth];
+	head = 0;
+	count = 0;
+	last_link = -1;
+
+	// a frame being read on each link besides the queued ones
+	pool = new Frame_Pool(depth + LINK_AGGREGATOR_MAX_LINKS);
+
+	memset(routes, 0, sizeof(routes));
+
+	pthread_mutex_init(&lock, NULL);
+	pthread_cond_init(&cond, NULL);
+}
+
+int
+Link_Aggregator::
+add_link(Generic_Port *link)
+{
+	if (started || num_links == LINK_AGGREGATOR_MAX_LINKS)
+		return -1;
+
+	Link_Reader &reader = links[num_links];
+	memset(&reader, 0, sizeof(reader));
+	reader.aggregator = this;
+	reader.port = link;
+	reader.index = num_links;
+
+	// what was set on the aggregator before applies to every link
+	if (recorder)
+		link->set_recorder(recorder);
+	if (signing)
+		link->set_signing(signing);
+
+	return num_links++;
+}
+
+// ------------------------------------------------------------------------------
+//   Read
+// ------------------------------------------------------------------------------
+
+// The next frame from any link, or 0 after LINK_AGGREGATOR_READ_TIMEOUT_MS
+int
+Link_Aggregator::
+read_message(mavlink_message_t &message)
+{
+	struct timespec deadline;
+	clock_gettime(CLOCK_REALTIME, &deadline);
+	deadline.tv_nsec += LINK_AGGREGATOR_READ_TIMEOUT_MS * 1000000L;
+	if (deadline.tv_nsec >= 1000000000L)
+	{
+		deadline.tv_sec++;
+		deadline.tv_nsec -= 1000000000L;
+	}
+
+	pthread_mutex_lock(&lock);
+	while (count == 0 && !time_to_exit)
+	{
+		if (pthread_cond_timedwait(&cond, &lock, &deadline) == ETIMEDOUT)
+			break;
+	}
+	if (count == 0)
+	{
+		pthread_mutex_unlock(&lock);
+		return 0;
+	}
+
+	Frame_Handle frame(std::move(queue[head].frame));
+	last_link = queue[head].link;
+	head = (head + 1) % depth;
+	count--;
+	pthread_mutex_unlock(&lock);
+
+	message = frame.message();
+	rx_frame_stamp = frame.get_stamp();
+
+	return 1;
+}
+
+// ------------------------------------------------------------------------------
+//   Link Threads
+// ------------------------------------------------------------------------------
+void
+Link_Aggregator::
+link_thread(Link_Reader &reader)
+{
+	Frame_Handle frame;
+	mavlink_message_t scratch;
+
+	while (!time_to_exit && reader.port->is_running())
+	{
+		// the last one is still ours when it was not queued
+		if (!frame.writable())
+			frame = pool->alloc();
+
+		mavlink_message_t &message = frame ? *frame.writable() : scratch;
+		if (!reader.port->read_message(message))
+			continue;
+		uint32_t stamp = reader.port->get_frame_stamp();
+
+		pthread_mutex_lock(&lock);
+		reader.stats.frames++;
+		routes[message.sysid] = reader.index + 1;
+		if (!frame || count == depth)
+		{
+			reader.stats.dropped++;
+		}
+		else if (_accept(reader, message, stamp))
+		{
+			frame.set_stamp(stamp);
+			Link_Frame &slot = queue[(head + count) % depth];
+			slot.frame = std::move(frame);
+			slot.link = reader.index;
+			count++;
+			pthread_cond_signal(&cond);
+		}
+		pthread_mutex_unlock(&lock);
+	}
+}
+
+void *
+start_link_aggregator_thread(void *args)
+{
+	// takes a Link_Reader argument
+	Link_Reader *reader = (Link_Reader *)args;
+
+	// run the link's read thread
+	reader->aggregator->start_link_thread(reader);
+
+	// done!
+	return NULL;
+}
+
+void
+Link_Aggregator::
+start_link_thread(Link_Reader *reader)
+{
+	link_thread(*reader);
+}
+
+// ------------------------------------------------------------------------------
+//   Write
+// ------------------------------------------------------------------------------
+
+/*
+ * The link the target system of the message was last heard on, -1 for a
+ * broadcast, a message without a target_system or a system not heard yet.
+ */
+int
+Link_Aggregator::
+_route(uint32_t msgid, const uint8_t *payload, unsigned len)
+{
+	const mavlink_msg_entry_t *entry = mavlink_get_msg_entry(msgid);
+	if (!entry || !(entry->flags & MAV_MSG_ENTRY_FLAG_HAVE_TARGET_SYSTEM))
+		return -1;
+
+	// trimmed off the payload, it was zero
+	if (entry->target_system_ofs >= len)
+		return -1;
+
+	uint8_t target = payload[entry->target_system_ofs];
+	if (target == 0)
+		return -1;
+
+	pthread_mutex_lock(&lock);
+	int link = (int)routes[target] - 1;
+	pthread_mutex_unlock(&lock);
+	return link;
+}
+
+void
+Link_Aggregator::
+_count_write(int index, int written, bool routed)
+{
+	pthread_mutex_lock(&lock);
+	if (written <= 0)
+		links[index].stats.write_errors++;
+	else if (routed)
+		links[index].stats.routed++;
+	else
+		links[index].stats.broadcast++;
+	pthread_mutex_unlock(&lock);
+}
+
+int
+Link_Aggregator::
+write_message(const mavlink_message_t &message)
+{
+	int link = _route(message.msgid, (const uint8_t *)_MAV_PAYLOAD(&message), message.len);
+
+	int result = 0;
+	for (int i = 0; i < num_links; i++)
+	{
+		if (link >= 0 && i != link)
+			continue;
+
+		int written = links[i].port->write_message(message);
+		_count_write(i, written, link >= 0);
+		if (written > result)
+			result = written;
+	}
+	return result;
+}
+
+// Each link signs in place, a frame for more than one is copied for each
+int
+Link_Aggregator::
+write_frame(uint8_t *frame, unsigned len)
+{
+	unsigned header_len = frame[0] == MAVLINK_STX_MAVLINK1 ? MAVLINK_CORE_HEADER_MAVLINK1_LEN + 1 : MAVLINK_NUM_HEADER_BYTES;
+	int link = _route(frame_msgid(frame), frame + header_len, frame[1]);
+
+	int result = 0;
+	for (int i = 0; i < num_links; i++)
+	{
+		if (link >= 0 && i != link)
+			continue;
+
+		uint8_t copy[FRAME_ENCODER_BUFFER_LEN];
+		bool last = link >= 0 || i == num_links - 1;
+		if (!last)
+			memcpy(copy, frame, len);
+
+		int written = links[i].port->write_frame(last ? frame : copy, len);
+		_count_write(i, written, link >= 0);
+		if (written > result)
+			result = written;
+	}
+	return result;
+}
+
+// ------------------------------------------------------------------------------
+//   Port Settings
+// ------------------------------------------------------------------------------
+void
+Link_Aggregator::
+set_recorder(Tlog_Recorder *recorder_)
+{
+	recorder = recorder_;
+	for (int i = 0; i < num_links; i++)
+		links[i].port->set_recorder(recorder_);
+}
+
+void
+Link_Aggregator::
+set_signing(Mavlink_Signing *signing_)
+{
+	signing = signing_;
+	for (int i = 0; i < num_links; i++)
+		links[i].port->set_signing(signing_);
+}
+
+Link_Stats *
+Link_Aggregator::
+get_link_stats()
+{
+	return num_links ? links[0].port->get_link_stats() : &link_stats;
+}
+
+int
+Link_Aggregator::
+get_num_link_stats()
+{
+	return num_links ? num_links : 1;
+}
+
+Link_Stats *
+Link_Aggregator::
+get_link_stats_at(int index)
+{
+	return num_links ? links[index].port->get_link_stats() : &link_stats;
+}
+
+// ------------------------------------------------------------------------------
+//   Start / Stop
+// ------------------------------------------------------------------------------
+bool
+Link_Aggregator::
+is_running()
+{
+	if (!started)
+		return false;
+	for (int i = 0; i < num_links; i++)
+	{
+		if (links[i].port->is_running())
+			return true;
+	}
+	return false;
+}
+
+/**
+ * throws what the links throw, or the error creating a thread
+ */
+void
+Link_Aggregator::
+start()
+{
+	for (int i = 0; i < num_links; i++)
+		links[i].port->start();
+
+	pthread_mutex_lock(&lock);
+	time_to_exit = false;
+	started = true;
+	pthread_mutex_unlock(&lock);
+
+	for (int i = 0; i < num_links; i++)
+	{
+		int result = thread_config_create(&links[i].tid, THREAD_LINK, &start_link_aggregator_thread, &links[i]);
+		if (result)
+			throw result;
+	}
+}
+
+// The links are stopped first, which ends a read waiting for bytes
+void
+Link_Aggregator::
+stop()
+{
+	if (!started)
+		return;
+
+	pthread_mutex_lock(&lock);
+	time_to_exit = true;
+	pthread_cond_broadcast(&cond);
+	pthread_mutex_unlock(&lock);
+
+	for (int i = 0; i < num_links; i++)
+		links[i].port->stop();
+
+	for (int i = 0; i < num_links; i++)
+	{
+		if (links[i].tid)
+			thread_config_join(links[i].tid, NULL);
+		links[i].tid = 0;
+	}
+
+	started = false;
+}
+
+// ------------------------------------------------------------------------------
+//   Report
+// ------------------------------------------------------------------------------
+
+Link_Aggregator_Stats
+Link_Aggregator::
+get_stats(int index)
+{
+	pthread_mutex_lock(&lock);
+	Link_Aggregator_Stats copy = links[index].stats;
+	pthread_mutex_unlock(&lock);
+	return copy;
+}
+
+void
+Link_Aggregator::
+dump(FILE *out)
+{
+	fprintf(out, "LINK AGGREGATOR: %d links, %d frames queued at most\n", num_links, depth);
+	fprintf(out, "%-4s %-24s %10s %10s %10s %10s %10s\n", "link", "name", "frames", "dropped", "routed", "broadcast", "errors");
+	for (int i = 0; i < num_links; i++)
+	{
+		Link_Aggregator_Stats copy = get_stats(i);
+		fprintf(out, "%-4d %-24s %10lu %10lu %10lu %10lu %10lu\n", i, links[i].port->get_link_stats()->get_name(),
+				(unsigned long)copy.frames, (unsigned long)copy.dropped, (unsigned long)copy.routed,
+				(unsigned long)copy.broadcast, (unsigned long)copy.write_errors);
+	}
+	pool->dump(out);
+}
@@ -0,0 +1,158 @@
+/**
+ * @file link_aggregator.h
+ *
+ * @brief Link aggregator definition
+ *
+ * A Generic_Port made of several ports, so one Autopilot_Interface talks
+ * over a serial radio and UDP, or two radios, at the same time.  Each link
+ * parses on its own channel (mavlink_channel.h) in a thread of its own.
+ *
+ */
+
+#ifndef LINK_AGGREGATOR_H_
+#define LINK_AGGREGATOR_H_
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pthread.h> // This uses POSIX Threads
+
+#include "../include/mavlink/v2.0/spresense/mavlink.h"
+
+#include "generic_port.h"
+#include "frame_pool.h"
+#include "../include/thread_config.h"
+
+// ------------------------------------------------------------------------------
+//   Defines
+// ------------------------------------------------------------------------------
+
+#define LINK_AGGREGATOR_MAX_LINKS 4
+
+// Frames read from the links and not yet taken by read_message()
+#define LINK_AGGREGATOR_DEFAULT_DEPTH 16
+
+// read_message() returns 0 after this long without a frame, as a serial
+// port does after VTIME
+#define LINK_AGGREGATOR_READ_TIMEOUT_MS 100
+
+// ------------------------------------------------------------------------------
+//   Data Structures
+// ------------------------------------------------------------------------------
+
+struct Link_Aggregator_Stats
+{
+	uint32_t frames;		// read from the link
+	uint32_t dropped;		// queue full or pool exhausted
+	uint32_t routed;		// written to this link alone, the target was heard on it
+	uint32_t broadcast;		// written to this link with all the others
+	uint32_t write_errors;
+};
+
+class Link_Aggregator;
+
+struct Link_Reader
+{
+	Link_Aggregator *aggregator;
+	Generic_Port *port;
+	int index;
+	pthread_t tid;
+	Link_Aggregator_Stats stats;
+};
+
+struct Link_Frame
+{
+	Frame_Handle frame;
+	int link;
+};
+
+// ----------------------------------------------------------------------------------
+//   Link Aggregator Class
+// ----------------------------------------------------------------------------------
+/*
+ * Link Aggregator Class
+ *
+ * A thread per link reads frames into pooled frames and queues them by
+ * handle; read_message() takes them in arrival order, whichever link they
+ * came from.  The system id of each frame read is remembered with its
+ * link: a message with a target_system goes only to the link that system
+ * was last heard on, anything else to every link.  The links are started
+ * and stopped with the aggregator, and owned by the caller.
+ *
+ * get_link_stats() is the first link's, the one to the autopilot, and
+ * get_link_stats_at() each link's.
+ */
+class Link_Aggregator : public Generic_Port
+{
+
+public:
+	Link_Aggregator();
+	Link_Aggregator(int depth_);
+	virtual ~Link_Aggregator();
+
+	// before start(), returns the link index or -1 when full
+	int add_link(Generic_Port *link);
+	int get_num_links() { return num_links; };
+	Generic_Port *get_link(int index) { return links[index].port; };
+
+	int read_message(mavlink_message_t &message);
+	int write_message(const mavlink_message_t &message);
+	int write_frame(uint8_t *frame, unsigned len);
+
+	bool is_running();
+	void start();
+	void stop();
+
+	void set_recorder(Tlog_Recorder *recorder_);
+	void set_signing(Mavlink_Signing *signing_);
+	Link_Stats *get_link_stats();
+	int get_num_link_stats();
+	Link_Stats *get_link_stats_at(int index);
+
+	// the link the last frame read_message() returned came from
+	int get_last_link() { return last_link; };
+
+	Link_Aggregator_Stats get_stats(int index);
+	virtual void dump(FILE *out);
+
+	void start_link_thread(Link_Reader *reader);
+
+protected:
+	Link_Reader links[LINK_AGGREGATOR_MAX_LINKS];
+	int num_links;
+
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	bool started;
+	bool time_to_exit;
+
+	Frame_Pool *pool;
+	Link_Frame *queue;
+	int depth;
+	int head;
+	int count;
+	int last_link;
+
+	// link + 1 each system id was last heard on, 0 when never
+	uint8_t routes[256];
+
+	// with the lock held, given the reader, the message and its frame
+	// stamp; false keeps a frame read on the link out of the queue
+	virtual bool _accept(Link_Reader &, const mavlink_message_t &, uint32_t) { return true; };
+
+	// the one link a message goes to, -1 for all of them
+	virtual int _route(uint32_t msgid, const uint8_t *payload, unsigned len);
+
+private:
+	void initialize_defaults(int depth_);
+
+	void link_thread(Link_Reader &reader);
+	void _count_write(int index, int written, bool routed);
+};
+
+void *start_link_aggregator_thread(void *args);
+
+#endif // LINK_AGGREGATOR_H_
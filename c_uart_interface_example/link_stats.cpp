@@ -0,0 +1,535 @@
+/**
+ * @file link_stats.cpp
+ *
+ * @brief Link health counters functions
+ *
+ * Functions for counting link traffic and errors and publishing them
+ *
+ */
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include "link_stats.h"
+
+#include <cstdlib>
+#include <string.h>
+#include <pthread.h> // This uses POSIX Threads
+
+#if defined(CONFIG_FS_PROCFS_REGISTER)
+#include <fcntl.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include <nuttx/fs/fs.h>
+#include <nuttx/fs/procfs.h>
+#endif
+
+// ----------------------------------------------------------------------------------
+//   Link Stats Class
+// ----------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+//   Con/De structors
+// ------------------------------------------------------------------------------
+Link_Stats::
+Link_Stats()
+{
+	set_name("link");
+	reset();
+}
+
+Link_Stats::
+Link_Stats(const char *name_)
+{
+	set_name(name_);
+	reset();
+}
+
+void
+Link_Stats::
+set_name(const char *name_)
+{
+	strncpy(name, name_, LINK_STATS_NAME_LEN - 1);
+	name[LINK_STATS_NAME_LEN - 1] = 0;
+}
+
+void
+Link_Stats::
+reset()
+{
+	counters.rx_bytes.store(0);
+	counters.tx_bytes.store(0);
+	counters.rx_frames.store(0);
+	counters.tx_frames.store(0);
+	counters.crc_errors.store(0);
+	counters.unknown_msgids.store(0);
+	counters.signature_errors.store(0);
+	counters.parse_errors.store(0);
+	counters.read_errors.store(0);
+	counters.write_errors.store(0);
+	counters.overruns.store(0);
+	counters.queue_depth.store(0);
+	counters.queue_depth_max.store(0);
+
+	for (int i = 0; i <= LINK_STATS_MSGID_SLOTS; i++)
+	{
+		msgids[i].key.store(0);
+		msgids[i].rx_frames.store(0);
+		msgids[i].tx_frames.store(0);
+		msgids[i].rx_bytes.store(0);
+		msgids[i].rx_unknown.store(0);
+	}
+	msgids[LINK_STATS_MSGID_SLOTS].key.store(LINK_STATS_OTHER_MSGID);
+}
+
+// ------------------------------------------------------------------------------
+//   Counting
+// ------------------------------------------------------------------------------
+/*
+ * Finds the slot of msgid, claiming a free one on first sight.  Two threads
+ * racing for the same free slot is settled by the compare-and-swap, the
+ * loser keeps probing and finds the winner's slot if the ids are equal.
+ */
+Link_Stats::Msgid_Slot *
+Link_Stats::
+_slot(uint32_t msgid)
+{
+	uint32_t key = msgid + 1;
+	uint32_t i = (msgid * 2654435769u) >> 26; // 64 slots
+
+	for (int probes = 0; probes < LINK_STATS_MSGID_SLOTS; probes++)
+	{
+		uint32_t current = msgids[i].key.load(std::memory_order_relaxed);
+		if (current == key)
+			return &msgids[i];
+
+		if (current == 0)
+		{
+			uint32_t expected = 0;
+			if (msgids[i].key.compare_exchange_strong(expected, key, std::memory_order_relaxed))
+				return &msgids[i];
+			if (expected == key)
+				return &msgids[i];
+		}
+
+		i = (i + 1) & (LINK_STATS_MSGID_SLOTS - 1);
+	}
+
+	return &msgids[LINK_STATS_MSGID_SLOTS];
+}
+
+void
+Link_Stats::
+rx_frame(uint32_t msgid, unsigned len)
+{
+	counters.rx_frames.fetch_add(1, std::memory_order_relaxed);
+
+	Msgid_Slot *slot = _slot(msgid);
+	slot->rx_frames.fetch_add(1, std::memory_order_relaxed);
+	slot->rx_bytes.fetch_add(len, std::memory_order_relaxed);
+}
+
+/*
+ * A frame whose msgid is not in the dialect.  Counted per msgid so the
+ * streams nobody reads can still be found and switched off.
+ */
+void
+Link_Stats::
+unknown_msgid(uint32_t msgid)
+{
+	counters.unknown_msgids.fetch_add(1, std::memory_order_relaxed);
+	_slot(msgid)->rx_unknown.fetch_add(1, std::memory_order_relaxed);
+}
+
+void
+Link_Stats::
+tx_frame(uint32_t msgid, unsigned len)
+{
+	counters.tx_frames.fetch_add(1, std::memory_order_relaxed);
+	counters.tx_bytes.fetch_add(len, std::memory_order_relaxed);
+
+	_slot(msgid)->tx_frames.fetch_add(1, std::memory_order_relaxed);
+}
+
+void
+Link_Stats::
+queue_depth(unsigned depth)
+{
+	counters.queue_depth.store(depth, std::memory_order_relaxed);
+
+	uint32_t max = counters.queue_depth_max.load(std::memory_order_relaxed);
+	while (depth > max &&
+		   !counters.queue_depth_max.compare_exchange_weak(max, depth, std::memory_order_relaxed))
+		;
+}
+
+// ------------------------------------------------------------------------------
+//   Reading
+// ------------------------------------------------------------------------------
+void
+Link_Stats::
+snapshot(Link_Stats_Snapshot &result)
+{
+	result.rx_bytes = counters.rx_bytes.load(std::memory_order_relaxed);
+	result.tx_bytes = counters.tx_bytes.load(std::memory_order_relaxed);
+	result.rx_frames = counters.rx_frames.load(std::memory_order_relaxed);
+	result.tx_frames = counters.tx_frames.load(std::memory_order_relaxed);
+	result.crc_errors = counters.crc_errors.load(std::memory_order_relaxed);
+	result.unknown_msgids = counters.unknown_msgids.load(std::memory_order_relaxed);
+	result.signature_errors = counters.signature_errors.load(std::memory_order_relaxed);
+	result.parse_errors = counters.parse_errors.load(std::memory_order_relaxed);
+	result.read_errors = counters.read_errors.load(std::memory_order_relaxed);
+	result.write_errors = counters.write_errors.load(std::memory_order_relaxed);
+	result.overruns = counters.overruns.load(std::memory_order_relaxed);
+	result.queue_depth = counters.queue_depth.load(std::memory_order_relaxed);
+	result.queue_depth_max = counters.queue_depth_max.load(std::memory_order_relaxed);
+}
+
+/*
+ * Copies the message ids seen so far, the overflow bucket last if used.
+ * Returns how many were copied.
+ */
+int
+Link_Stats::
+snapshot_msgids(Link_Stats_Msgid *result, int max)
+{
+	int n = 0;
+	for (int i = 0; i <= LINK_STATS_MSGID_SLOTS && n < max; i++)
+	{
+		uint32_t key = msgids[i].key.load(std::memory_order_relaxed);
+		uint32_t rx = msgids[i].rx_frames.load(std::memory_order_relaxed);
+		uint32_t tx = msgids[i].tx_frames.load(std::memory_order_relaxed);
+		uint32_t unknown = msgids[i].rx_unknown.load(std::memory_order_relaxed);
+		if (key == 0 || (rx == 0 && tx == 0 && unknown == 0))
+			continue;
+
+		result[n].msgid = i == LINK_STATS_MSGID_SLOTS ? LINK_STATS_OTHER_MSGID : key - 1;
+		result[n].rx_frames = rx;
+		result[n].tx_frames = tx;
+		result[n].rx_bytes = msgids[i].rx_bytes.load(std::memory_order_relaxed);
+		result[n].rx_unknown = unknown;
+		n++;
+	}
+
+	return n;
+}
+
+/*
+ * Text form, as shown in /proc/mavlink.  Returns the length written, never
+ * more than size - 1.
+ */
+int
+Link_Stats::
+format(char *buf, int size)
+{
+	Link_Stats_Snapshot s;
+	snapshot(s);
+
+	int len = snprintf(buf, size,
+					   "%s\n"
+					   "  rx %lu bytes %lu frames, tx %lu bytes %lu frames\n"
+					   "  crc %lu unknown %lu signature %lu parse %lu read %lu write %lu overrun %lu\n"
+					   "  queue %lu max %lu\n",
+					   name,
+					   (unsigned long)s.rx_bytes, (unsigned long)s.rx_frames,
+					   (unsigned long)s.tx_bytes, (unsigned long)s.tx_frames,
+					   (unsigned long)s.crc_errors, (unsigned long)s.unknown_msgids,
+					   (unsigned long)s.signature_errors,
+					   (unsigned long)s.parse_errors, (unsigned long)s.read_errors,
+					   (unsigned long)s.write_errors, (unsigned long)s.overruns,
+					   (unsigned long)s.queue_depth, (unsigned long)s.queue_depth_max);
+
+	Link_Stats_Msgid ids[LINK_STATS_MSGID_SLOTS + 1];
+	int n = snapshot_msgids(ids, LINK_STATS_MSGID_SLOTS + 1);
+	for (int i = 0; i < n && len < size; i++)
+	{
+		if (ids[i].msgid == LINK_STATS_OTHER_MSGID)
+			len += snprintf(buf + len, size - len, "  msgid other");
+		else
+			len += snprintf(buf + len, size - len, "  msgid %lu", (unsigned long)ids[i].msgid);
+
+		if (len < size && ids[i].rx_unknown)
+			len += snprintf(buf + len, size - len, " unknown %lu", (unsigned long)ids[i].rx_unknown);
+
+		if (len < size)
+			len += snprintf(buf + len, size - len, " rx %lu (%lu bytes) tx %lu\n",
+							(unsigned long)ids[i].rx_frames, (unsigned long)ids[i].rx_bytes,
+							(unsigned long)ids[i].tx_frames);
+	}
+
+	return len < size ? len : size - 1;
+}
+
+// ------------------------------------------------------------------------------
+//   Registry
+// ------------------------------------------------------------------------------
+
+static pthread_mutex_t registry_lock = PTHREAD_MUTEX_INITIALIZER;
+static Link_Stats *registry[LINK_STATS_MAX_LINKS];
+
+#if defined(CONFIG_FS_PROCFS_REGISTER)
+static void _link_stats_procfs_register();
+static bool procfs_registered = false;
+#endif
+
+/*
+ * Makes the link visible in /proc/mavlink and link_stats_dump().  Returns
+ * 0, or -1 when LINK_STATS_MAX_LINKS are registered already.
+ */
+int
+link_stats_register(Link_Stats *stats)
+{
+	int result = -1;
+
+	pthread_mutex_lock(&registry_lock);
+	for (int i = 0; i < LINK_STATS_MAX_LINKS; i++)
+	{
+		if (registry[i] == stats)
+		{
+			result = 0;
+			break;
+		}
+		if (result < 0 && registry[i] == NULL)
+			result = i + 1;
+	}
+	if (result > 0)
+	{
+		registry[result - 1] = stats;
+		result = 0;
+	}
+	pthread_mutex_unlock(&registry_lock);
+
+#if defined(CONFIG_FS_PROCFS_REGISTER)
+	_link_stats_procfs_register();
+#endif
+
+	return result;
+}
+
+void
+link_stats_unregister(Link_Stats *stats)
+{
+	pthread_mutex_lock(&registry_lock);
+	for (int i = 0; i < LINK_STATS_MAX_LINKS; i++)
+	{
+		if (registry[i] == stats)
+			registry[i] = NULL;
+	}
+	pthread_mutex_unlock(&registry_lock);
+}
+
+int
+link_stats_format_all(char *buf, int size)
+{
+	int len = 0;
+	buf[0] = 0;
+
+	pthread_mutex_lock(&registry_lock);
+	for (int i = 0; i < LINK_STATS_MAX_LINKS && len < size - 1; i++)
+	{
+		if (registry[i])
+			len += registry[i]->format(buf + len, size - len);
+	}
+	pthread_mutex_unlock(&registry_lock);
+
+	return len;
+}
+
+void
+link_stats_dump(FILE *out)
+{
+	char buf[2048];
+
+	pthread_mutex_lock(&registry_lock);
+	for (int i = 0; i < LINK_STATS_MAX_LINKS; i++)
+	{
+		if (registry[i])
+		{
+			registry[i]->format(buf, sizeof(buf));
+			fputs(buf, out);
+		}
+	}
+	pthread_mutex_unlock(&registry_lock);
+}
+
+// ------------------------------------------------------------------------------
+//   /proc/mavlink
+// ------------------------------------------------------------------------------
+#if defined(CONFIG_FS_PROCFS_REGISTER)
+
+// Text of a file, formatted again on every read
+#define LINK_STATS_PROCFS_LEN 4096
+
+struct Link_Stats_File
+{
+	struct procfs_file_s base; // must come first, procfs fills it in
+	int (*format)(char *buf, int size);
+};
+
+struct Link_Stats_Procfs_File
+{
+	const char *name;
+	int (*format)(char *buf, int size);
+	struct procfs_entry_s entry;
+};
+
+// /proc/mavlink first, then what link_stats_procfs_add() asked for
+static Link_Stats_Procfs_File procfs_files[LINK_STATS_PROCFS_FILES] =
+{
+	{ "mavlink", link_stats_format_all },
+};
+
+static int
+_procfs_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode)
+{
+	// read only
+	if ((oflags & O_WRONLY) != 0 || (oflags & O_RDONLY) == 0)
+		return -EACCES;
+
+	int (*format)(char *buf, int size) = NULL;
+	for (int i = 0; i < LINK_STATS_PROCFS_FILES; i++)
+	{
+		if (procfs_files[i].name && strcmp(relpath, procfs_files[i].name) == 0)
+			format = procfs_files[i].format;
+	}
+	if (format == NULL)
+		return -ENOENT;
+
+	Link_Stats_File *priv = (Link_Stats_File *)calloc(1, sizeof(Link_Stats_File));
+	if (priv == NULL)
+		return -ENOMEM;
+
+	priv->format = format;
+	filep->f_priv = (FAR void *)priv;
+	return OK;
+}
+
+static int
+_procfs_close(FAR struct file *filep)
+{
+	free(filep->f_priv);
+	filep->f_priv = NULL;
+	return OK;
+}
+
+static ssize_t
+_procfs_read(FAR struct file *filep, FAR char *buffer, size_t buflen)
+{
+	char *text = (char *)malloc(LINK_STATS_PROCFS_LEN);
+	if (text == NULL)
+		return -ENOMEM;
+
+	Link_Stats_File *priv = (Link_Stats_File *)filep->f_priv;
+	int len = priv->format(text, LINK_STATS_PROCFS_LEN);
+
+	ssize_t result = 0;
+	if (filep->f_pos < len)
+	{
+		result = len - filep->f_pos;
+		if ((size_t)result > buflen)
+			result = buflen;
+		memcpy(buffer, text + filep->f_pos, result);
+		filep->f_pos += result;
+	}
+
+	free(text);
+	return result;
+}
+
+static int
+_procfs_dup(FAR const struct file *oldp, FAR struct file *newp)
+{
+	Link_Stats_File *priv = (Link_Stats_File *)malloc(sizeof(Link_Stats_File));
+	if (priv == NULL)
+		return -ENOMEM;
+
+	memcpy(priv, oldp->f_priv, sizeof(Link_Stats_File));
+	newp->f_priv = (FAR void *)priv;
+	return OK;
+}
+
+static int
+_procfs_stat(FAR const char *relpath, FAR struct stat *buf)
+{
+	memset(buf, 0, sizeof(struct stat));
+	buf->st_mode = S_IFREG | S_IROTH | S_IRGRP | S_IRUSR;
+	return OK;
+}
+
+static struct procfs_operations procfs_ops;
+
+// call with registry_lock held
+static void
+_procfs_register_file(Link_Stats_Procfs_File &file)
+{
+	memset(&file.entry, 0, sizeof(file.entry));
+	file.entry.pathpattern = file.name;
+	file.entry.ops = &procfs_ops;
+
+	if (procfs_register(&file.entry) < 0)
+		fprintf(stderr, "WARNING: could not register /proc/%s\n", file.name);
+}
+
+/*
+ * Registers the files once, on the first link.  The operations are filled
+ * in by name so the order of the NuttX struct does not matter.
+ */
+static void
+_link_stats_procfs_register()
+{
+	pthread_mutex_lock(&registry_lock);
+	if (!procfs_registered)
+	{
+		memset(&procfs_ops, 0, sizeof(procfs_ops));
+		procfs_ops.open = _procfs_open;
+		procfs_ops.close = _procfs_close;
+		procfs_ops.read = _procfs_read;
+		procfs_ops.dup = _procfs_dup;
+		procfs_ops.stat = _procfs_stat;
+
+		for (int i = 0; i < LINK_STATS_PROCFS_FILES; i++)
+		{
+			if (procfs_files[i].name)
+				_procfs_register_file(procfs_files[i]);
+		}
+		procfs_registered = true;
+	}
+	pthread_mutex_unlock(&registry_lock);
+}
+
+#endif // CONFIG_FS_PROCFS_REGISTER
+
+/*
+ * Another read only text file next to /proc/mavlink, formatted on every
+ * read.  Shows up with the first link, or at once if there is one already.
+ * Returns 0, or -1 when there is no room or no procfs.
+ */
+int
+link_stats_procfs_add(const char *name, int (*format)(char *buf, int size))
+{
+#if defined(CONFIG_FS_PROCFS_REGISTER)
+	int result = -1;
+
+	pthread_mutex_lock(&registry_lock);
+	for (int i = 0; i < LINK_STATS_PROCFS_FILES; i++)
+	{
+		if (procfs_files[i].name == NULL)
+		{
+			procfs_files[i].name = name;
+			procfs_files[i].format = format;
+			if (procfs_registered)
+				_procfs_register_file(procfs_files[i]);
+			result = 0;
+			break;
+		}
+	}
+	pthread_mutex_unlock(&registry_lock);
+
+	return result;
+#else
+	(void)name;
+	(void)format;
+	return -1;
+#endif
+}
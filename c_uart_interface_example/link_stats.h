@@ -0,0 +1,211 @@
+/**
+ * @file link_stats.h
+ *
+ * @brief Link health counters definition
+ *
+ * Per port and per message id counters, readable while the link runs from
+ * /proc/mavlink on NuttX or through a snapshot and a text dump anywhere
+ *
+ */
+
+#ifndef LINK_STATS_H_
+#define LINK_STATS_H_
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdint.h>
+#include <atomic>
+
+#include "../include/mavlink/v2.0/spresense/mavlink.h"
+
+// ------------------------------------------------------------------------------
+//   Defines
+// ------------------------------------------------------------------------------
+
+// Message ids counted separately per link, the rest add up in one bucket
+#define LINK_STATS_MSGID_SLOTS 64
+
+// Links that can be registered for /proc/mavlink and link_stats_dump()
+#define LINK_STATS_MAX_LINKS 8
+
+#define LINK_STATS_NAME_LEN 32
+
+// Files under /proc, /proc/mavlink included
+#define LINK_STATS_PROCFS_FILES 4
+
+// ------------------------------------------------------------------------------
+//   Data Structures
+// ------------------------------------------------------------------------------
+
+/*
+ * Counters are 32 bits, the widest the Cortex-M4 updates without a lock;
+ * the byte counters wrap after 4 GB.
+ */
+struct Link_Stats_Snapshot
+{
+	uint32_t rx_bytes;
+	uint32_t tx_bytes;
+	uint32_t rx_frames;
+	uint32_t tx_frames;
+	uint32_t crc_errors;		// frames with a bad checksum
+	uint32_t unknown_msgids;	// frames of a msgid not in the dialect
+	uint32_t signature_errors;	// frames failing the signature or replay check
+	uint32_t parse_errors;		// bytes the parser threw away
+	uint32_t read_errors;
+	uint32_t write_errors;
+	uint32_t overruns;			// frames dropped for lack of room
+	uint32_t queue_depth;		// last reported depth of the link's queue
+	uint32_t queue_depth_max;
+};
+
+struct Link_Stats_Msgid
+{
+	uint32_t msgid;
+	uint32_t rx_frames;
+	uint32_t tx_frames;
+	uint32_t rx_bytes;
+	uint32_t rx_unknown;	// frames not parsed, the msgid is not in the dialect
+};
+
+// ----------------------------------------------------------------------------------
+//   Link Stats Class
+// ----------------------------------------------------------------------------------
+/*
+ * Link Stats Class
+ *
+ * Updated from the read and write paths with relaxed atomics, so counting
+ * never takes a lock and readers only ever see slightly stale numbers.
+ * Message ids get a slot of their own on first sight in a small open
+ * addressing table claimed with compare-and-swap; when it is full the
+ * remaining ids are counted under LINK_STATS_OTHER_MSGID.
+ */
+class Link_Stats
+{
+
+public:
+	Link_Stats();
+	Link_Stats(const char *name_);
+
+	void set_name(const char *name_);
+	const char *get_name() { return name; }
+
+	void rx_frame(uint32_t msgid, unsigned len);
+	void tx_frame(uint32_t msgid, unsigned len);
+
+	void rx_bytes(unsigned n) { counters.rx_bytes.fetch_add(n, std::memory_order_relaxed); }
+	void tx_bytes(unsigned n) { counters.tx_bytes.fetch_add(n, std::memory_order_relaxed); }
+	void crc_error() { counters.crc_errors.fetch_add(1, std::memory_order_relaxed); }
+	void unknown_msgid(uint32_t msgid);
+	void signature_error() { counters.signature_errors.fetch_add(1, std::memory_order_relaxed); }
+	void parse_errors(unsigned n) { counters.parse_errors.fetch_add(n, std::memory_order_relaxed); }
+	void read_error() { counters.read_errors.fetch_add(1, std::memory_order_relaxed); }
+	void write_error() { counters.write_errors.fetch_add(1, std::memory_order_relaxed); }
+	void overrun() { counters.overruns.fetch_add(1, std::memory_order_relaxed); }
+	void queue_depth(unsigned depth);
+
+	void snapshot(Link_Stats_Snapshot &result);
+	int snapshot_msgids(Link_Stats_Msgid *result, int max);
+	int format(char *buf, int size);
+	void reset();
+
+private:
+	char name[LINK_STATS_NAME_LEN];
+
+	struct
+	{
+		std::atomic<uint32_t> rx_bytes;
+		std::atomic<uint32_t> tx_bytes;
+		std::atomic<uint32_t> rx_frames;
+		std::atomic<uint32_t> tx_frames;
+		std::atomic<uint32_t> crc_errors;
+		std::atomic<uint32_t> unknown_msgids;
+		std::atomic<uint32_t> signature_errors;
+		std::atomic<uint32_t> parse_errors;
+		std::atomic<uint32_t> read_errors;
+		std::atomic<uint32_t> write_errors;
+		std::atomic<uint32_t> overruns;
+		std::atomic<uint32_t> queue_depth;
+		std::atomic<uint32_t> queue_depth_max;
+	} counters;
+
+	struct Msgid_Slot
+	{
+		std::atomic<uint32_t> key; // msgid + 1, 0 while free
+		std::atomic<uint32_t> rx_frames;
+		std::atomic<uint32_t> tx_frames;
+		std::atomic<uint32_t> rx_bytes;
+		std::atomic<uint32_t> rx_unknown;
+	};
+
+	// the last slot is the overflow bucket
+	Msgid_Slot msgids[LINK_STATS_MSGID_SLOTS + 1];
+
+	Msgid_Slot *_slot(uint32_t msgid);
+};
+
+// Reported for the overflow bucket
+#define LINK_STATS_OTHER_MSGID 0xFFFFFFFF
+
+// ------------------------------------------------------------------------------
+//   Registry
+// ------------------------------------------------------------------------------
+
+int link_stats_register(Link_Stats *stats);
+void link_stats_unregister(Link_Stats *stats);
+int link_stats_format_all(char *buf, int size);
+void link_stats_dump(FILE *out);
+int link_stats_procfs_add(const char *name, int (*format)(char *buf, int size));
+
+// ------------------------------------------------------------------------------
+//   Counting Parser
+// ------------------------------------------------------------------------------
+/*
+ * mavlink_parse_char() with the failures counted.  chan is the port's own
+ * from mavlink_channel_alloc(), only its read path parses on it.
+ */
+static inline uint8_t
+link_stats_parse_char(Link_Stats &stats, uint8_t chan, uint8_t c,
+					  mavlink_message_t *r_message, mavlink_status_t *r_mavlink_status)
+{
+	uint8_t result = mavlink_frame_char(chan, c, r_message, r_mavlink_status);
+
+	// parse errors since the last call
+	if (r_mavlink_status->packet_rx_drop_count)
+		stats.parse_errors(r_mavlink_status->packet_rx_drop_count);
+
+	if (result == MAVLINK_FRAMING_OK)
+	{
+		stats.rx_frame(r_message->msgid, mavlink_msg_get_send_buffer_length(r_message));
+		return 1;
+	}
+	if (result == MAVLINK_FRAMING_INCOMPLETE)
+		return 0;
+
+	// the checksum of a msgid the dialect was pruned of cannot be checked,
+	// it fails without the link being at fault
+	mavlink_message_t *rxmsg = mavlink_get_channel_buffer(chan);
+	if (result == MAVLINK_FRAMING_BAD_CRC && !mavlink_get_msg_entry(rxmsg->msgid))
+		stats.unknown_msgid(rxmsg->msgid);
+	else if (result == MAVLINK_FRAMING_BAD_CRC)
+		stats.crc_error();
+	else
+		stats.signature_error();
+
+	// same recovery as mavlink_parse_char(), without counting the frame
+	// again as a parse error
+	mavlink_status_t *status = mavlink_get_channel_status(chan);
+	status->msg_received = MAVLINK_FRAMING_INCOMPLETE;
+	status->parse_state = MAVLINK_PARSE_STATE_IDLE;
+	if (c == MAVLINK_STX)
+	{
+		status->parse_state = MAVLINK_PARSE_STATE_GOT_STX;
+		rxmsg->len = 0;
+		mavlink_start_checksum(rxmsg);
+	}
+	return 0;
+}
+
+#endif // LINK_STATS_H_
@@ -0,0 +1,903 @@
+/**
+ * @file log_receiver.cpp
+ *
+ * @brief Streaming autopilot log receiver functions
+ *
+ * Functions for receiving, acknowledging and storing autopilot log streams
+ *
+ */
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include "log_receiver.h"
+
+#include <cstdlib>
+#include <string.h>
+#include <unistd.h>	// UNIX standard function definitions
+#include <fcntl.h>	// File control definitions
+#include <time.h>
+#include <sys/statfs.h>
+
+// ------------------------------------------------------------------------------
+//   Helpers
+// ------------------------------------------------------------------------------
+
+// Largest write we are willing to buffer twice in RAM
+#define LOG_RECEIVER_MAX_CHUNK (32 * 1024)
+
+// Size of the ulog file header that precedes the first message
+#define ULOG_HEADER_LEN 16
+
+static uint64_t
+_now_usec()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static const uint8_t zero_block[LOG_RECEIVER_DATAFLASH_BLOCK] = {0};
+
+// ----------------------------------------------------------------------------------
+//   Log Receiver Class
+// ----------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+//   Con/De structors
+// ------------------------------------------------------------------------------
+Log_Receiver::
+Log_Receiver(Generic_Port *port_, const char *path_)
+{
+	initialize_defaults();
+	port = port_;
+	path = path_;
+}
+
+Log_Receiver::
+Log_Receiver(Generic_Port *port_, const char *path_, int chunk_size_)
+{
+	initialize_defaults();
+	port = port_;
+	path = path_;
+	chunk_size = chunk_size_;
+}
+
+Log_Receiver::
+~Log_Receiver()
+{
+	free(buffers[0]);
+	free(buffers[1]);
+
+	// destroy mutex
+	pthread_cond_destroy(&cond);
+	pthread_mutex_destroy(&lock);
+}
+
+void
+Log_Receiver::
+initialize_defaults()
+{
+	// Initialize attributes
+	port = NULL;
+	path = "log.bin";
+	fd = -1;
+	is_open = false;
+	time_to_exit = false;
+
+	system_id = 0;
+	companion_id = 0;
+	target_system = 0;
+	target_component = 0;
+
+	format = FORMAT_UNKNOWN;
+	have_next_seq = false;
+	next_seq = 0;
+	memset(window, 0, sizeof(window));
+
+	ulog_stream_offset = 0;
+	ulog_remaining = 0;
+	ulog_header_len = 0;
+	ulog_resync = false;
+	nack_horizon = 0;
+
+	num_pending_acks = 0;
+	last_ack_flush = 0;
+
+	write_tid = 0;
+	chunk_size = 0;
+	buffers[0] = buffers[1] = NULL;
+	fill[0] = fill[1] = 0;
+	full[0] = full[1] = false;
+	active = 0;
+	write_index = 0;
+
+	memset(&stats, 0, sizeof(stats));
+
+	// Start mutex
+	int result = pthread_mutex_init(&lock, NULL);
+	if ( result != 0 )
+	{
+		printf("\n mutex init failed\n");
+		throw 1;
+	}
+	result = pthread_cond_init(&cond, NULL);
+	if ( result != 0 )
+	{
+		printf("\n condition init failed\n");
+		throw 1;
+	}
+}
+
+// ------------------------------------------------------------------------------
+//   Start Receiving
+// ------------------------------------------------------------------------------
+/**
+ * throws EXIT_FAILURE if the log file could not be opened
+ */
+void
+Log_Receiver::
+start(int system_id_, int companion_id_, int target_system_, int target_component_)
+{
+	system_id = system_id_;
+	companion_id = companion_id_;
+	target_system = target_system_;
+	target_component = target_component_;
+
+	// --------------------------------------------------------------------------
+	//   OPEN FILE
+	// --------------------------------------------------------------------------
+	fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+	if (fd < 0)
+	{
+		fprintf(stderr, "ERROR: could not open log file %s\n", path);
+		throw EXIT_FAILURE;
+	}
+
+	// --------------------------------------------------------------------------
+	//   ALLOCATE BUFFERS
+	// --------------------------------------------------------------------------
+	if (chunk_size <= 0)
+		chunk_size = _query_chunk_size();
+
+	buffers[0] = (uint8_t *)malloc(chunk_size);
+	buffers[1] = (uint8_t *)malloc(chunk_size);
+	if (buffers[0] == NULL || buffers[1] == NULL)
+	{
+		fprintf(stderr, "ERROR: could not allocate 2 x %d bytes of log buffer\n", chunk_size);
+		close(fd);
+		fd = -1;
+		throw EXIT_FAILURE;
+	}
+
+	// --------------------------------------------------------------------------
+	//   WRITE THREAD
+	// --------------------------------------------------------------------------
+	time_to_exit = false;
+	int result = thread_config_create(&write_tid, THREAD_LOG, &start_log_receiver_write_thread, this);
+	if (result)
+		throw result;
+
+	is_open = true;
+	last_ack_flush = _now_usec();
+
+	printf("Logging to %s in %d byte writes\n", path, chunk_size);
+
+	// --------------------------------------------------------------------------
+	//   REQUEST THE STREAM
+	// --------------------------------------------------------------------------
+	send_start_request(true);
+}
+
+// ------------------------------------------------------------------------------
+//   Stop Receiving
+// ------------------------------------------------------------------------------
+void
+Log_Receiver::
+stop()
+{
+	if (!is_open)
+		return;
+
+	send_start_request(false);
+	flush_acks();
+
+	// hand over whatever is in the active buffer and let the writer drain
+	pthread_mutex_lock(&lock);
+	if (fill[active] > 0 && !full[active])
+		full[active] = true;
+	time_to_exit = true;
+	pthread_cond_signal(&cond);
+	pthread_mutex_unlock(&lock);
+
+	thread_config_join(write_tid, NULL);
+
+	fsync(fd);
+	close(fd);
+	fd = -1;
+	is_open = false;
+
+	Log_Receiver_Stats copy = get_stats();
+	printf("LOG CLOSED: %lu bytes, %lu packets, %lu lost, %lu overruns\n",
+		   (unsigned long)copy.bytes_written, (unsigned long)copy.packets,
+		   (unsigned long)copy.lost, (unsigned long)copy.overruns);
+}
+
+// ------------------------------------------------------------------------------
+//   Stats
+// ------------------------------------------------------------------------------
+Log_Receiver_Stats
+Log_Receiver::
+get_stats()
+{
+	pthread_mutex_lock(&lock);
+	Log_Receiver_Stats result = stats;
+	pthread_mutex_unlock(&lock);
+
+	return result;
+}
+
+// The read thread's counters, taken with the lock get_stats() copies under
+void
+Log_Receiver::
+_count(uint32_t &counter, uint32_t n)
+{
+	pthread_mutex_lock(&lock);
+	counter += n;
+	pthread_mutex_unlock(&lock);
+}
+
+// ------------------------------------------------------------------------------
+//   Handle Log Message
+// ------------------------------------------------------------------------------
+void
+Log_Receiver::
+handle_message(const mavlink_message_t &message)
+{
+	if (!is_open)
+		return;
+
+	switch (message.msgid)
+	{
+
+	case MAVLINK_MSG_ID_LOGGING_DATA:
+	{
+		if (format == FORMAT_DATAFLASH)
+			break;
+		format = FORMAT_ULOG;
+
+		// read in place, no copy of the 249 data bytes
+		Logging_Data_View data(message);
+		handle_ulog(data.sequence(), data.length(), data.first_message_offset(), data.data(), false);
+		break;
+	}
+
+	case MAVLINK_MSG_ID_LOGGING_DATA_ACKED:
+	{
+		if (format == FORMAT_DATAFLASH)
+			break;
+		format = FORMAT_ULOG;
+
+		Logging_Data_Acked_View data(message);
+		handle_ulog(data.sequence(), data.length(), data.first_message_offset(), data.data(), true);
+		break;
+	}
+
+	case MAVLINK_MSG_ID_REMOTE_LOG_DATA_BLOCK:
+	{
+		if (format == FORMAT_ULOG)
+			break;
+		format = FORMAT_DATAFLASH;
+
+		Remote_Log_Data_Block_View data(message);
+		handle_dataflash(data.seqno(), data.data());
+		break;
+	}
+
+	default:
+		return;
+	}
+
+	poll();
+}
+
+// ------------------------------------------------------------------------------
+//   Poll
+// ------------------------------------------------------------------------------
+// acks go out in batches, but never later than LOG_RECEIVER_ACK_US
+void
+Log_Receiver::
+poll()
+{
+	if (num_pending_acks > 0 && _now_usec() - last_ack_flush >= LOG_RECEIVER_ACK_US)
+		flush_acks();
+}
+
+// ------------------------------------------------------------------------------
+//   PX4 ulog stream
+// ------------------------------------------------------------------------------
+void
+Log_Receiver::
+handle_ulog(uint16_t seq, uint8_t len, uint8_t first_message_offset, const uint8_t *data, bool acked)
+{
+	if (len > MAVLINK_MSG_LOGGING_DATA_FIELD_DATA_LEN)
+		len = MAVLINK_MSG_LOGGING_DATA_FIELD_DATA_LEN;
+
+	if (!have_next_seq)
+	{
+		next_seq = seq;
+		have_next_seq = true;
+	}
+
+	// sequence numbers wrap at 16 bits
+	int diff = (int16_t)(uint16_t)(seq - next_seq);
+
+	// retransmission of something we already have, ack it again
+	if (diff < 0)
+	{
+		_count(stats.duplicates, 1);
+		if (acked)
+			queue_ack(seq, 0);
+		return;
+	}
+
+	if (diff >= LOG_RECEIVER_WINDOW)
+	{
+		skip_gap();
+		diff = (int16_t)(uint16_t)(seq - next_seq);
+		if (diff >= LOG_RECEIVER_WINDOW)
+		{
+			// nothing held is close enough, restart the sequence here
+			_count(stats.lost, diff);
+			next_seq = seq;
+			ulog_resync = true;
+			diff = 0;
+		}
+	}
+
+	if (diff == 0)
+	{
+		if (!accept_ulog(len, first_message_offset, data))
+		{
+			// not acked, an acked packet will be retransmitted
+			_count(stats.overruns, 1);
+			return;
+		}
+		_count(stats.packets, 1);
+		next_seq = (next_seq + 1) & 0xffff;
+		if (acked)
+			queue_ack(seq, 0);
+		deliver_in_order();
+		return;
+	}
+
+	// ahead of a missing packet, hold it
+	Window_Slot &slot = window[seq % LOG_RECEIVER_WINDOW];
+	if (slot.valid && slot.seq == seq)
+	{
+		_count(stats.duplicates, 1);
+	}
+	else
+	{
+		slot.valid = true;
+		slot.seq = seq;
+		slot.len = len;
+		slot.first_message_offset = first_message_offset;
+		memcpy(slot.data, data, len);
+		_count(stats.reordered, 1);
+	}
+	if (acked)
+		queue_ack(seq, 0);
+
+	// unacked packets are never resent, so don't wait for long
+	if (!acked && diff >= LOG_RECEIVER_WINDOW / 2)
+		skip_gap();
+}
+
+/*
+ * Writes the packet, after completing the message a gap cut with zeros
+ * and a dropout record.  False when it does not fit and nothing of it was
+ * written; the padding written so far stays, the next packet goes on
+ * with it.
+ */
+bool
+Log_Receiver::
+accept_ulog(uint8_t len, uint8_t first_message_offset, const uint8_t *data)
+{
+	// ulog 'O' dropout message, duration unknown
+	static const uint8_t dropout[5] = {2, 0, 'O', 0, 0};
+
+	int extra = 0;
+	if (ulog_resync)
+	{
+		// no message starts in this packet, keep waiting
+		if (first_message_offset == UINT8_MAX || first_message_offset >= len)
+			return true;
+
+		// complete the message cut by the gap so the file stays parseable,
+		// the dropout record goes in with the data
+		if (ulog_stream_offset >= ULOG_HEADER_LEN)
+		{
+			if (!_pad_ulog())
+				return false;
+			extra = sizeof(dropout);
+		}
+
+		data += first_message_offset;
+		len -= first_message_offset;
+	}
+
+	if (!_has_space(extra + len))
+		return false;
+
+	if (extra)
+		_append(dropout, sizeof(dropout));
+	ulog_resync = false;
+
+	_append(data, len);
+	_track_ulog(data, len);
+	return true;
+}
+
+// Zeros to the end of the message a gap cut, false until all are written
+bool
+Log_Receiver::
+_pad_ulog()
+{
+	// the rest of its header first, the length is in it
+	if (ulog_header_len > 0)
+	{
+		int n = 3 - ulog_header_len;
+		if (!_has_space(n))
+			return false;
+		_append(zero_block, n);
+		while (ulog_header_len < 3)
+			ulog_header[ulog_header_len++] = 0;
+		ulog_remaining = ulog_header[0] | (ulog_header[1] << 8);
+		ulog_header_len = 0;
+	}
+
+	while (ulog_remaining > 0)
+	{
+		int n = ulog_remaining < sizeof(zero_block) ? (int)ulog_remaining : (int)sizeof(zero_block);
+		if (!_has_space(n))
+			return false;
+		_append(zero_block, n);
+		ulog_remaining -= n;
+	}
+	return true;
+}
+
+void
+Log_Receiver::
+_track_ulog(const uint8_t *data, int len)
+{
+	// skip the file header
+	if (ulog_stream_offset < ULOG_HEADER_LEN)
+	{
+		int n = ULOG_HEADER_LEN - ulog_stream_offset;
+		if (n > len)
+			n = len;
+		ulog_stream_offset += n;
+		data += n;
+		len -= n;
+	}
+
+	// walk message boundaries, touching only the 3 byte headers
+	while (len > 0)
+	{
+		if (ulog_remaining > 0)
+		{
+			int n = (int)ulog_remaining < len ? (int)ulog_remaining : len;
+			ulog_remaining -= n;
+			ulog_stream_offset += n;
+			data += n;
+			len -= n;
+			continue;
+		}
+
+		ulog_header[ulog_header_len++] = *data++;
+		ulog_stream_offset++;
+		len--;
+		if (ulog_header_len == 3)
+		{
+			ulog_remaining = ulog_header[0] | (ulog_header[1] << 8);
+			ulog_header_len = 0;
+		}
+	}
+}
+
+// ------------------------------------------------------------------------------
+//   ArduPilot dataflash stream
+// ------------------------------------------------------------------------------
+void
+Log_Receiver::
+handle_dataflash(uint32_t seqno, const uint8_t *data)
+{
+	if (!have_next_seq)
+	{
+		next_seq = seqno;
+		have_next_seq = true;
+	}
+
+	// already written, or given up on; ack so it stops being resent
+	if (seqno < next_seq)
+	{
+		_count(stats.duplicates, 1);
+		queue_ack(seqno, MAV_REMOTE_LOG_DATA_BLOCK_ACK);
+		return;
+	}
+
+	uint32_t diff = seqno - next_seq;
+	if (diff >= LOG_RECEIVER_WINDOW)
+	{
+		if (!skip_gap())
+		{
+			// not acked, the autopilot will resend it
+			_count(stats.overruns, 1);
+			return;
+		}
+		diff = seqno - next_seq;
+		if (diff >= LOG_RECEIVER_WINDOW)
+		{
+			_count(stats.lost, diff);
+			next_seq = seqno;
+			diff = 0;
+		}
+	}
+
+	if (diff == 0)
+	{
+		if (!_has_space(LOG_RECEIVER_DATAFLASH_BLOCK))
+		{
+			// not acked, the autopilot will resend it
+			_count(stats.overruns, 1);
+			return;
+		}
+		_append(data, LOG_RECEIVER_DATAFLASH_BLOCK);
+		_count(stats.packets, 1);
+		next_seq++;
+		queue_ack(seqno, MAV_REMOTE_LOG_DATA_BLOCK_ACK);
+		deliver_in_order();
+		return;
+	}
+
+	// ahead of a missing block: hold it and ask for the ones in between
+	Window_Slot &slot = window[seqno % LOG_RECEIVER_WINDOW];
+	if (slot.valid && slot.seq == seqno)
+	{
+		_count(stats.duplicates, 1);
+	}
+	else
+	{
+		slot.valid = true;
+		slot.seq = seqno;
+		slot.len = LOG_RECEIVER_DATAFLASH_BLOCK;
+		memcpy(slot.data, data, LOG_RECEIVER_DATAFLASH_BLOCK);
+		_count(stats.reordered, 1);
+
+		uint32_t from = next_seq > nack_horizon ? next_seq : nack_horizon;
+		for (uint32_t s = from; s < seqno; s++)
+		{
+			const Window_Slot &missing = window[s % LOG_RECEIVER_WINDOW];
+			if (!(missing.valid && missing.seq == s))
+				queue_ack(s, MAV_REMOTE_LOG_DATA_BLOCK_NACK);
+		}
+		if (seqno > nack_horizon)
+			nack_horizon = seqno;
+	}
+	queue_ack(seqno, MAV_REMOTE_LOG_DATA_BLOCK_ACK);
+}
+
+// ------------------------------------------------------------------------------
+//   Reorder Window
+// ------------------------------------------------------------------------------
+void
+Log_Receiver::
+deliver_in_order()
+{
+	while (true)
+	{
+		Window_Slot &slot = window[next_seq % LOG_RECEIVER_WINDOW];
+		if (!(slot.valid && slot.seq == next_seq))
+			break;
+
+		// leave it in the window, the next packet will retry
+		if (format == FORMAT_ULOG)
+		{
+			if (!accept_ulog(slot.len, slot.first_message_offset, slot.data))
+				break;
+			next_seq = (next_seq + 1) & 0xffff;
+		}
+		else
+		{
+			if (!_has_space(slot.len))
+				break;
+			_append(slot.data, slot.len);
+			next_seq++;
+		}
+		slot.valid = false;
+		_count(stats.packets, 1);
+	}
+}
+
+/*
+ * Give up on the packets missing in front of the window.  False when a
+ * dataflash block could not be replaced for lack of space, the gap is
+ * left where it is then.
+ */
+bool
+Log_Receiver::
+skip_gap()
+{
+	bool skipped = true;
+	for (int i = 0; i < LOG_RECEIVER_WINDOW; i++)
+	{
+		const Window_Slot &slot = window[next_seq % LOG_RECEIVER_WINDOW];
+		if (slot.valid && slot.seq == next_seq)
+			break;
+
+		if (format == FORMAT_ULOG)
+		{
+			next_seq = (next_seq + 1) & 0xffff;
+			ulog_resync = true;
+		}
+		else
+		{
+			// keep dataflash blocks at their seqno offset in the file
+			if (!_has_space(LOG_RECEIVER_DATAFLASH_BLOCK))
+			{
+				skipped = false;
+				break;
+			}
+			_append(zero_block, LOG_RECEIVER_DATAFLASH_BLOCK);
+			next_seq++;
+		}
+		_count(stats.lost, 1);
+	}
+
+	deliver_in_order();
+	return skipped;
+}
+
+// ------------------------------------------------------------------------------
+//   Double Buffer
+// ------------------------------------------------------------------------------
+bool
+Log_Receiver::
+_has_space(int len)
+{
+	pthread_mutex_lock(&lock);
+	int space = full[active] ? 0 : chunk_size - fill[active];
+	if (!full[1 - active])
+		space += chunk_size - fill[1 - active];
+	pthread_mutex_unlock(&lock);
+
+	return space >= len;
+}
+
+// Callers check _has_space() first; this never waits for the writer.  The
+// copies are one log packet at most, they are made under the lock with the
+// fill they advance
+void
+Log_Receiver::
+_append(const uint8_t *data, int len)
+{
+	pthread_mutex_lock(&lock);
+	while (len > 0)
+	{
+		// the writer may have emptied the other buffer since this one filled
+		if (full[active] && !full[1 - active])
+			active = 1 - active;
+		if (full[active])
+		{
+			stats.overruns++;
+			break;
+		}
+
+		int n = chunk_size - fill[active];
+		if (n > len)
+			n = len;
+		memcpy(buffers[active] + fill[active], data, n);
+		fill[active] += n;
+		data += n;
+		len -= n;
+
+		if (fill[active] == chunk_size)
+		{
+			full[active] = true;
+			pthread_cond_signal(&cond);
+			if (!full[1 - active])
+				active = 1 - active;
+		}
+	}
+	pthread_mutex_unlock(&lock);
+}
+
+int
+Log_Receiver::
+_query_chunk_size()
+{
+	// FAT reports the cluster size as the block size
+	struct statfs fs;
+	if (statfs(path, &fs) == 0 && fs.f_bsize > 0)
+	{
+		int size = (int)fs.f_bsize;
+		if (size < LOG_RECEIVER_DEFAULT_CHUNK)
+			size = LOG_RECEIVER_DEFAULT_CHUNK;
+		if (size > LOG_RECEIVER_MAX_CHUNK)
+			size = LOG_RECEIVER_MAX_CHUNK;
+		return size;
+	}
+
+	return LOG_RECEIVER_DEFAULT_CHUNK;
+}
+
+// ------------------------------------------------------------------------------
+//   Acks
+// ------------------------------------------------------------------------------
+void
+Log_Receiver::
+queue_ack(uint32_t seq, uint8_t status)
+{
+	if (num_pending_acks == LOG_RECEIVER_ACK_BATCH)
+		flush_acks();
+
+	pending_acks[num_pending_acks].seq = seq;
+	pending_acks[num_pending_acks].status = status;
+	num_pending_acks++;
+
+	if (num_pending_acks == LOG_RECEIVER_ACK_BATCH)
+		flush_acks();
+}
+
+void
+Log_Receiver::
+flush_acks()
+{
+	for (int i = 0; i < num_pending_acks; i++)
+	{
+		mavlink_message_t message;
+
+		if (format == FORMAT_ULOG)
+		{
+			mavlink_msg_logging_ack_pack(system_id, companion_id, &message,
+										 pending_acks[i].seq, target_system, target_component);
+		}
+		else
+		{
+			mavlink_msg_remote_log_block_status_pack(system_id, companion_id, &message,
+													 target_system, target_component,
+													 pending_acks[i].seq, pending_acks[i].status);
+		}
+
+		int len = port->write_message(message);
+		if (len <= 0)
+			fprintf(stderr, "WARNING: could not send log ack \n");
+
+		if (pending_acks[i].status == MAV_REMOTE_LOG_DATA_BLOCK_NACK && format == FORMAT_DATAFLASH)
+			_count(stats.nacks, 1);
+		else
+			_count(stats.acks, 1);
+	}
+
+	num_pending_acks = 0;
+	last_ack_flush = _now_usec();
+}
+
+// ------------------------------------------------------------------------------
+//   Start / Stop Request
+// ------------------------------------------------------------------------------
+void
+Log_Receiver::
+send_start_request(bool start)
+{
+	mavlink_message_t message;
+
+	// PX4: MAV_CMD_LOGGING_START / STOP ( 2510 / 2511 ), ulog format
+	mavlink_command_long_t com = {
+		0,	 // param1
+		0,	 // param2
+		0,	 // param3
+		0,	 // param4
+		0,	 // param5
+		0,	 // param6
+		0,	 // param7
+		0,	 // command
+		0,	 // target_system
+		0,	 // target_component
+		0	 // confirmation
+	};
+	com.target_system = target_system;
+	com.target_component = target_component;
+	com.command = start ? MAV_CMD_LOGGING_START : MAV_CMD_LOGGING_STOP;
+	mavlink_msg_command_long_encode(system_id, companion_id, &message, &com);
+	if (port->write_message(message) <= 0)
+		fprintf(stderr, "WARNING: could not send MAV_CMD_LOGGING_START \n");
+
+	// ArduPilot: block status with the start / stop command as seqno
+	mavlink_msg_remote_log_block_status_pack(system_id, companion_id, &message,
+											 target_system, target_component,
+											 start ? MAV_REMOTE_LOG_DATA_BLOCK_START : MAV_REMOTE_LOG_DATA_BLOCK_STOP,
+											 MAV_REMOTE_LOG_DATA_BLOCK_ACK);
+	if (port->write_message(message) <= 0)
+		fprintf(stderr, "WARNING: could not send REMOTE_LOG_BLOCK_STATUS \n");
+}
+
+// ------------------------------------------------------------------------------
+//   Write Thread
+// ------------------------------------------------------------------------------
+void
+Log_Receiver::
+start_write_thread()
+{
+	write_thread();
+}
+
+void
+Log_Receiver::
+write_thread()
+{
+	pthread_mutex_lock(&lock);
+
+	while (true)
+	{
+		// buffers fill in turn, write them in the same order
+		while (!full[write_index] && !time_to_exit)
+			pthread_cond_wait(&cond, &lock);
+
+		if (!full[write_index])
+		{
+			if (full[1 - write_index])
+			{
+				write_index = 1 - write_index;
+				continue;
+			}
+			break; // time to exit and nothing left
+		}
+
+		int i = write_index;
+		int len = fill[i];
+		pthread_mutex_unlock(&lock);
+
+		// the only place that touches storage
+		int written = 0;
+		while (written < len)
+		{
+			int result = write(fd, buffers[i] + written, len - written);
+			if (result <= 0)
+				break;
+			written += result;
+		}
+
+		pthread_mutex_lock(&lock);
+		if (written < len)
+			stats.write_errors++;
+		stats.bytes_written += written;
+		fill[i] = 0;
+		full[i] = false;
+		write_index = 1 - i;
+	}
+
+	pthread_mutex_unlock(&lock);
+}
+
+// End Log_Receiver
+
+// ------------------------------------------------------------------------------
+//  Pthread Starter Helper Functions
+// ------------------------------------------------------------------------------
+
+void *
+start_log_receiver_write_thread(void *args)
+{
+	// takes a log receiver object argument
+	Log_Receiver *log_receiver = (Log_Receiver *)args;
+
+	// run the object's write thread
+	log_receiver->start_write_thread();
+
+	// done!
+	return NULL;
+}
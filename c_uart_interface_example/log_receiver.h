@@ -0,0 +1,189 @@
+/**
+ * @file log_receiver.h
+ *
+ * @brief Streaming autopilot log receiver definition
+ *
+ * Receives PX4 ulog streams (LOGGING_DATA / LOGGING_DATA_ACKED) and
+ * ArduPilot dataflash blocks (REMOTE_LOG_DATA_BLOCK) and writes them to
+ * storage through double-buffered asynchronous flushes.
+ *
+ */
+
+#ifndef LOG_RECEIVER_H_
+#define LOG_RECEIVER_H_
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pthread.h> // This uses POSIX Threads
+
+#include "../include/mavlink/v2.0/spresense/mavlink.h"
+#include "../include/mavlink/v2.0/spresense/mavlink_views.h"
+
+#include "generic_port.h"
+#include "../include/thread_config.h"
+
+// ------------------------------------------------------------------------------
+//   Defines
+// ------------------------------------------------------------------------------
+
+// Number of out-of-order packets kept while waiting for a missing one
+#define LOG_RECEIVER_WINDOW 32
+
+// Acks are sent once this many are pending, or after LOG_RECEIVER_ACK_US
+#define LOG_RECEIVER_ACK_BATCH 16
+#define LOG_RECEIVER_ACK_US 20000
+
+// Write size used when the file system cluster size cannot be queried
+#define LOG_RECEIVER_DEFAULT_CHUNK 4096
+
+// Bytes per ArduPilot dataflash block
+#define LOG_RECEIVER_DATAFLASH_BLOCK 200
+
+// ------------------------------------------------------------------------------
+//   Data Structures
+// ------------------------------------------------------------------------------
+
+struct Log_Receiver_Stats
+{
+	uint32_t packets;	// log packets accepted
+	uint32_t duplicates; // retransmissions of packets already written
+	uint32_t reordered;	 // packets that arrived ahead of a missing one
+	uint32_t lost;		 // packets given up on
+	uint32_t overruns;	 // packets refused because both buffers were busy
+	uint32_t acks;		 // ack messages sent
+	uint32_t nacks;		 // nack messages sent (dataflash only)
+	uint64_t bytes_written;
+	uint32_t write_errors;
+};
+
+// ----------------------------------------------------------------------------------
+//   Log Receiver Class
+// ----------------------------------------------------------------------------------
+/*
+ * Log Receiver Class
+ *
+ * handle_message() is called from the read thread for every log packet.  It
+ * only copies the payload into the active buffer and queues the ack; a
+ * writer thread flushes full buffers to storage in cluster sized writes, so
+ * the MAVLink read path never waits on the SD card.  Packets that arrive
+ * ahead of a missing one are held in a small window until the gap is filled
+ * or given up on.
+ */
+class Log_Receiver
+{
+
+public:
+	Log_Receiver(Generic_Port *port_, const char *path_);
+	Log_Receiver(Generic_Port *port_, const char *path_, int chunk_size_);
+	~Log_Receiver();
+
+	void start(int system_id_, int companion_id_, int target_system_, int target_component_);
+	void stop();
+
+	void handle_message(const mavlink_message_t &message);
+	void poll();
+	void flush_acks();
+
+	bool is_running()
+	{
+		return is_open;
+	}
+	Log_Receiver_Stats get_stats();
+
+	void start_write_thread();
+
+private:
+	enum Stream_Format
+	{
+		FORMAT_UNKNOWN = 0,
+		FORMAT_ULOG,
+		FORMAT_DATAFLASH
+	};
+
+	struct Window_Slot
+	{
+		bool valid;
+		uint32_t seq;
+		uint8_t len;
+		uint8_t first_message_offset;
+		uint8_t data[MAVLINK_MSG_LOGGING_DATA_FIELD_DATA_LEN];
+	};
+
+	struct Pending_Ack
+	{
+		uint32_t seq;
+		uint8_t status;
+	};
+
+	Generic_Port *port;
+	const char *path;
+	int fd;
+	bool is_open;
+	bool time_to_exit;
+
+	int system_id;
+	int companion_id;
+	int target_system;
+	int target_component;
+
+	Stream_Format format;
+
+	// reorder window, owned by the read thread
+	bool have_next_seq;
+	uint32_t next_seq;
+	uint32_t nack_horizon;
+	Window_Slot window[LOG_RECEIVER_WINDOW];
+
+	// ulog message framing, used to keep the file parseable across a gap
+	uint32_t ulog_stream_offset;
+	uint32_t ulog_remaining;
+	uint8_t ulog_header[3];
+	uint8_t ulog_header_len;
+	bool ulog_resync;
+
+	// batched acks, owned by the read thread
+	Pending_Ack pending_acks[LOG_RECEIVER_ACK_BATCH];
+	int num_pending_acks;
+	uint64_t last_ack_flush;
+
+	// double buffer shared with the writer thread
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	pthread_t write_tid;
+	int chunk_size;
+	uint8_t *buffers[2];
+	int fill[2];
+	bool full[2];
+	int active;
+	int write_index;
+
+	Log_Receiver_Stats stats;
+
+	void initialize_defaults();
+	int _query_chunk_size();
+
+	void handle_ulog(uint16_t seq, uint8_t len, uint8_t first_message_offset, const uint8_t *data, bool acked);
+	void handle_dataflash(uint32_t seqno, const uint8_t *data);
+	void deliver_in_order();
+	bool skip_gap();
+	bool accept_ulog(uint8_t len, uint8_t first_message_offset, const uint8_t *data);
+	bool _pad_ulog();
+
+	void _count(uint32_t &counter, uint32_t n);
+	bool _has_space(int len);
+	void _append(const uint8_t *data, int len);
+	void _track_ulog(const uint8_t *data, int len);
+
+	void queue_ack(uint32_t seq, uint8_t status);
+	void send_start_request(bool start);
+
+	void write_thread();
+};
+
+void *start_log_receiver_write_thread(void *args);
+
+#endif // LOG_RECEIVER_H_
@@ -0,0 +1,340 @@
+/**
+ * @file loopback_port.cpp
+ *
+ * @brief In-process loopback interface functions
+ *
+ * Functions for passing MAVLink frames between two ports in one process
+ *
+ */
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include "loopback_port.h"
+
+#include <cstdlib>
+#include <string.h>
+#include <sched.h>
+
+// ----------------------------------------------------------------------------------
+//   Loopback Ring Class
+// ----------------------------------------------------------------------------------
+
+Loopback_Ring::
+Loopback_Ring(int capacity_)
+{
+	capacity = 1;
+	while (capacity < (uint32_t)capacity_)
+		capacity <<= 1;
+	mask = capacity - 1;
+
+	buffer = (uint8_t *)malloc(capacity);
+	if (buffer == NULL)
+	{
+		printf("\n loopback ring allocation failed\n");
+		throw 1;
+	}
+
+	head.store(0);
+	tail.store(0);
+}
+
+Loopback_Ring::
+~Loopback_Ring()
+{
+	free(buffer);
+}
+
+int
+Loopback_Ring::
+write(const uint8_t *data, int len)
+{
+	uint32_t h = head.load(std::memory_order_relaxed);
+	uint32_t t = tail.load(std::memory_order_acquire);
+
+	if (capacity - (h - t) < (uint32_t)len)
+		return 0;
+
+	// at most two copies, before and after the wrap
+	uint32_t pos = h & mask;
+	uint32_t first = capacity - pos < (uint32_t)len ? capacity - pos : len;
+	memcpy(&buffer[pos], data, first);
+	memcpy(&buffer[0], data + first, len - first);
+
+	head.store(h + len, std::memory_order_release);
+	return len;
+}
+
+int
+Loopback_Ring::
+read(uint8_t *data, int max)
+{
+	uint32_t t = tail.load(std::memory_order_relaxed);
+	uint32_t h = head.load(std::memory_order_acquire);
+
+	uint32_t len = h - t < (uint32_t)max ? h - t : max;
+	if (len == 0)
+		return 0;
+
+	uint32_t pos = t & mask;
+	uint32_t first = capacity - pos < len ? capacity - pos : len;
+	memcpy(data, &buffer[pos], first);
+	memcpy(data + first, &buffer[0], len - first);
+
+	tail.store(t + len, std::memory_order_release);
+	return len;
+}
+
+// ----------------------------------------------------------------------------------
+//   Loopback Port Manager Class
+// ----------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+//   Con/De structors
+// ------------------------------------------------------------------------------
+Loopback_Port::
+Loopback_Port(Loopback_Ring *rx_, Loopback_Ring *tx_)
+{
+	rx = rx_;
+	tx = tx_;
+	peer = NULL;
+	is_open.store(false);
+
+	memset(&rx_buffer, 0, sizeof(rx_buffer));
+	memset(&rx_status, 0, sizeof(rx_status));
+	chunk_len = 0;
+	chunk_pos = 0;
+	chunk_stamp = 0;
+
+	messages_read.store(0);
+	messages_written.store(0);
+	write_full.store(0);
+	bad_frames.store(0);
+
+	// Start mutex
+	int result = pthread_mutex_init(&lock, NULL);
+	if ( result != 0 )
+	{
+		printf("\n mutex init failed\n");
+		throw 1;
+	}
+}
+
+Loopback_Port::
+~Loopback_Port()
+{
+	link_stats_unregister(&link_stats);
+
+	// destroy mutex
+	pthread_mutex_destroy(&lock);
+}
+
+// ------------------------------------------------------------------------------
+//   Start / Stop
+// ------------------------------------------------------------------------------
+void
+Loopback_Port::
+start()
+{
+	is_open.store(true, std::memory_order_release);
+	link_stats_register(&link_stats);
+}
+
+void
+Loopback_Port::
+stop()
+{
+	// ordered after the last write, so the reader sees every byte before the hang up
+	is_open.store(false, std::memory_order_release);
+}
+
+bool
+Loopback_Port::
+is_running()
+{
+	if (!is_open.load(std::memory_order_relaxed))
+		return false;
+
+	// the peer hanging up reads like the end of a file, after the last byte
+	if (peer && !peer->is_open.load(std::memory_order_acquire) && rx->empty() && chunk_pos >= chunk_len)
+		return false;
+
+	return true;
+}
+
+// ------------------------------------------------------------------------------
+//   Stats
+// ------------------------------------------------------------------------------
+Loopback_Port_Stats
+Loopback_Port::
+get_stats()
+{
+	Loopback_Port_Stats result;
+	result.messages_read = messages_read.load(std::memory_order_relaxed);
+	result.messages_written = messages_written.load(std::memory_order_relaxed);
+	result.write_full = write_full.load(std::memory_order_relaxed);
+	result.bad_frames = bad_frames.load(std::memory_order_relaxed);
+
+	return result;
+}
+
+// ------------------------------------------------------------------------------
+//   Read from Peer
+// ------------------------------------------------------------------------------
+int
+Loopback_Port::
+read_message(mavlink_message_t &message)
+{
+	while (true)
+	{
+		// refill from the ring, a chunk at a time
+		if (chunk_pos >= chunk_len)
+		{
+			chunk_len = rx->read(chunk, LOOPBACK_READ_CHUNK);
+			chunk_pos = 0;
+			chunk_stamp = latency_stamp();
+			link_stats.rx_bytes(chunk_len);
+			if (chunk_len == 0)
+			{
+				sched_yield();
+				return 0;
+			}
+		}
+
+		while (chunk_pos < chunk_len)
+		{
+			// bytes of a chunk arrive together, one stamp for all of them
+			if (rx_status.parse_state <= MAVLINK_PARSE_STATE_IDLE)
+				rx_start_stamp = chunk_stamp;
+
+			uint8_t result = mavlink_frame_char_buffer(&rx_buffer, &rx_status, chunk[chunk_pos++], &message, NULL);
+
+			Mavlink_Signing *signer = signing.load();
+			if (result == MAVLINK_FRAMING_OK && signer && !signer->verify(message))
+			{
+				bad_frames.fetch_add(1, std::memory_order_relaxed);
+				link_stats.signature_error();
+				continue;
+			}
+			if (result == MAVLINK_FRAMING_OK)
+			{
+				rx_frame_stamp = latency_stamp();
+				latency_histogram(LATENCY_RX_FRAME).record_between(rx_start_stamp, rx_frame_stamp);
+
+				messages_read.fetch_add(1, std::memory_order_relaxed);
+				link_stats.rx_frame(message.msgid, mavlink_msg_get_send_buffer_length(&message));
+
+				if (recorder)
+					recorder->record(message);
+				return 1;
+			}
+			if (result == MAVLINK_FRAMING_BAD_CRC && !mavlink_get_msg_entry(rx_buffer.msgid))
+			{
+				link_stats.unknown_msgid(rx_buffer.msgid);
+			}
+			else if (result != MAVLINK_FRAMING_INCOMPLETE)
+			{
+				bad_frames.fetch_add(1, std::memory_order_relaxed);
+				link_stats.crc_error();
+			}
+		}
+	}
+}
+
+// ------------------------------------------------------------------------------
+//   Write to Peer
+// ------------------------------------------------------------------------------
+int
+Loopback_Port::
+write_message(const mavlink_message_t &message)
+{
+	uint8_t buf[FRAME_ENCODER_BUFFER_LEN];
+	uint32_t start = latency_stamp();
+
+	// Translate message to buffer
+	unsigned len = mavlink_msg_to_send_buffer(buf, &message);
+
+	return _send_frame(buf, len, start);
+}
+
+// already serialized by frame_encode(), no copy on the way
+int
+Loopback_Port::
+write_frame(uint8_t *frame, unsigned len)
+{
+	return _send_frame(frame, len, latency_stamp());
+}
+
+int
+Loopback_Port::
+_send_frame(uint8_t *frame, unsigned len, uint32_t start)
+{
+	Mavlink_Signing *signer = signing.load();
+	if (signer)
+		len = signer->sign(frame, len);
+
+	// one producer per ring
+	uint32_t wait = latency_stamp();
+	pthread_mutex_lock(&lock);
+	latency_histogram(LATENCY_LOCK_WAIT).record_since(wait);
+	int bytesWritten = tx->write(frame, len);
+	pthread_mutex_unlock(&lock);
+	latency_histogram(LATENCY_ENCODE_WRITE).record_since(start);
+
+	if (bytesWritten == 0)
+	{
+		write_full.fetch_add(1, std::memory_order_relaxed);
+		link_stats.overrun();
+		return 0;
+	}
+
+	messages_written.fetch_add(1, std::memory_order_relaxed);
+	link_stats.tx_frame(frame_msgid(frame), len);
+	if (recorder)
+		recorder->record(frame, len);
+
+	return bytesWritten;
+}
+
+// ----------------------------------------------------------------------------------
+//   Loopback Pair Class
+// ----------------------------------------------------------------------------------
+
+Loopback_Pair::
+Loopback_Pair()
+{
+	initialize(LOOPBACK_DEFAULT_CAPACITY);
+}
+
+Loopback_Pair::
+Loopback_Pair(int capacity_)
+{
+	initialize(capacity_);
+}
+
+Loopback_Pair::
+~Loopback_Pair()
+{
+	delete autopilot;
+	delete companion;
+	delete to_companion;
+	delete to_autopilot;
+}
+
+void
+Loopback_Pair::
+initialize(int capacity_)
+{
+	to_companion = new Loopback_Ring(capacity_);
+	to_autopilot = new Loopback_Ring(capacity_);
+
+	autopilot = new Loopback_Port(to_autopilot, to_companion);
+	companion = new Loopback_Port(to_companion, to_autopilot);
+
+	autopilot->set_peer(companion);
+	companion->set_peer(autopilot);
+
+	autopilot->get_link_stats()->set_name("loopback autopilot");
+	companion->get_link_stats()->set_name("loopback companion");
+}
@@ -0,0 +1,167 @@
+/**
+ * @file loopback_port.h
+ *
+ * @brief In-process loopback interface definition
+ *
+ * A pair of connected Generic_Ports backed by lock-free byte rings, for
+ * tests and benchmarks without a tty or a socket
+ *
+ */
+
+#ifndef LOOPBACK_PORT_H_
+#define LOOPBACK_PORT_H_
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pthread.h> // This uses POSIX Threads
+#include <atomic>
+
+#include "../include/mavlink/v2.0/spresense/mavlink.h"
+
+#include "generic_port.h"
+
+// ------------------------------------------------------------------------------
+//   Defines
+// ------------------------------------------------------------------------------
+
+// Bytes per direction, rounded up to a power of two
+#define LOOPBACK_DEFAULT_CAPACITY 8192
+
+// Bytes taken out of the ring at a time by the reader
+#define LOOPBACK_READ_CHUNK 256
+
+// ------------------------------------------------------------------------------
+//   Data Structures
+// ------------------------------------------------------------------------------
+
+struct Loopback_Port_Stats
+{
+	uint32_t messages_read;
+	uint32_t messages_written;
+	uint32_t write_full; // frames refused because the ring had no room
+	uint32_t bad_frames;
+};
+
+// ----------------------------------------------------------------------------------
+//   Loopback Ring Class
+// ----------------------------------------------------------------------------------
+/*
+ * Single producer, single consumer byte ring.  Head and tail live on their
+ * own cache lines so the two sides do not bounce a line between cores.
+ * write() is all-or-nothing so a frame is never split by a full ring.
+ */
+class Loopback_Ring
+{
+
+public:
+	Loopback_Ring(int capacity_);
+	~Loopback_Ring();
+
+	int write(const uint8_t *data, int len);
+	int read(uint8_t *data, int max);
+
+	bool empty()
+	{
+		return head.load(std::memory_order_acquire) == tail.load(std::memory_order_relaxed);
+	}
+
+private:
+	uint8_t *buffer;
+	uint32_t capacity;
+	uint32_t mask;
+
+	alignas(64) std::atomic<uint32_t> head; // written by the producer
+	alignas(64) std::atomic<uint32_t> tail; // written by the consumer
+};
+
+// ----------------------------------------------------------------------------------
+//   Loopback Port Manager Class
+// ----------------------------------------------------------------------------------
+/*
+ * Loopback Port Class
+ *
+ * One end of a Loopback_Pair.  Reads drain the peer's ring in chunks and
+ * parse them with a parser state of its own, so both ends can live in one
+ * process without sharing a MAVLink channel.  read_message() does not block;
+ * it yields and returns 0 when there is nothing to read.  Writers are
+ * serialized with a mutex like the serial port, which keeps the ring single
+ * producer.  Once the peer is stopped and everything it sent has been read,
+ * is_running() turns false.
+ */
+class Loopback_Port : public Generic_Port
+{
+
+public:
+	Loopback_Port(Loopback_Ring *rx_, Loopback_Ring *tx_);
+	virtual ~Loopback_Port();
+
+	int read_message(mavlink_message_t &message);
+	int write_message(const mavlink_message_t &message);
+	int write_frame(uint8_t *frame, unsigned len);
+
+	bool is_running();
+	void start();
+	void stop();
+
+	void set_peer(Loopback_Port *peer_)
+	{
+		peer = peer_;
+	}
+	Loopback_Port_Stats get_stats();
+
+private:
+	Loopback_Ring *rx;
+	Loopback_Ring *tx;
+	Loopback_Port *peer;
+	std::atomic<bool> is_open;
+
+	pthread_mutex_t lock;
+
+	// reader side, owned by the read thread
+	mavlink_message_t rx_buffer;
+	mavlink_status_t rx_status;
+	uint8_t chunk[LOOPBACK_READ_CHUNK];
+	int chunk_len;
+	int chunk_pos;
+	uint32_t chunk_stamp;	// when the chunk came out of the ring
+
+	std::atomic<uint32_t> messages_read;
+	std::atomic<uint32_t> messages_written;
+	std::atomic<uint32_t> write_full;
+	std::atomic<uint32_t> bad_frames;
+
+	int _send_frame(uint8_t *frame, unsigned len, uint32_t start);
+};
+
+// ----------------------------------------------------------------------------------
+//   Loopback Pair Class
+// ----------------------------------------------------------------------------------
+/*
+ * Loopback Pair Class
+ *
+ * Owns both rings and both ends.  Whatever is written to autopilot comes out
+ * of companion and the other way round.
+ */
+class Loopback_Pair
+{
+
+public:
+	Loopback_Pair();
+	Loopback_Pair(int capacity_);
+	~Loopback_Pair();
+
+	Loopback_Port *autopilot;
+	Loopback_Port *companion;
+
+private:
+	Loopback_Ring *to_companion;
+	Loopback_Ring *to_autopilot;
+
+	void initialize(int capacity_);
+};
+
+#endif // LOOPBACK_PORT_H_
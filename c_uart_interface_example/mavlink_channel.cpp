@@ -0,0 +1,113 @@
+/**
+ * @file mavlink_channel.cpp
+ *
+ * @brief MAVLink parser channel allocator functions
+ *
+ * Functions for handing out parser channels, and the channel arrays of
+ * mavlink_helpers.h for the whole program
+ *
+ */
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include "mavlink_channel.h"
+
+#include <string.h>
+#include <pthread.h> // This uses POSIX Threads
+
+// ------------------------------------------------------------------------------
+//   Channel Arrays
+// ------------------------------------------------------------------------------
+
+// declared by the generated mavlink.h, used by mavlink_get_channel_status()
+// and mavlink_get_channel_buffer() in every translation unit
+mavlink_status_t m_mavlink_status[MAVLINK_COMM_NUM_BUFFERS];
+mavlink_message_t m_mavlink_buffer[MAVLINK_COMM_NUM_BUFFERS];
+
+// ------------------------------------------------------------------------------
+//   Allocator
+// ------------------------------------------------------------------------------
+
+static pthread_mutex_t channel_lock = PTHREAD_MUTEX_INITIALIZER;
+static char channel_names[MAVLINK_COMM_NUM_BUFFERS][MAVLINK_CHANNEL_NAME_LEN];
+static bool channel_used[MAVLINK_COMM_NUM_BUFFERS];
+
+/*
+ * A channel nobody else parses on, with its parser reset.  Returns
+ * MAVLINK_CHANNEL_NONE when MAVLINK_COMM_NUM_BUFFERS - 1 are taken.
+ */
+uint8_t
+mavlink_channel_alloc(const char *name)
+{
+	uint8_t chan = MAVLINK_CHANNEL_NONE;
+
+	pthread_mutex_lock(&channel_lock);
+	for (int i = 0; i < MAVLINK_COMM_NUM_BUFFERS; i++)
+	{
+		if (i == MAVLINK_CHANNEL_TX || channel_used[i])
+			continue;
+
+		chan = i;
+		channel_used[i] = true;
+		strncpy(channel_names[i], name ? name : "", MAVLINK_CHANNEL_NAME_LEN - 1);
+		channel_names[i][MAVLINK_CHANNEL_NAME_LEN - 1] = '\0';
+		break;
+	}
+	pthread_mutex_unlock(&channel_lock);
+
+	if (chan != MAVLINK_CHANNEL_NONE)
+	{
+		// what the last owner left half parsed
+		memset(&m_mavlink_buffer[chan], 0, sizeof(m_mavlink_buffer[chan]));
+		memset(&m_mavlink_status[chan], 0, sizeof(m_mavlink_status[chan]));
+		mavlink_reset_channel_status(chan);
+	}
+	return chan;
+}
+
+void
+mavlink_channel_free(uint8_t chan)
+{
+	if (chan >= MAVLINK_COMM_NUM_BUFFERS || chan == MAVLINK_CHANNEL_TX)
+		return;
+
+	pthread_mutex_lock(&channel_lock);
+	channel_used[chan] = false;
+	channel_names[chan][0] = '\0';
+	pthread_mutex_unlock(&channel_lock);
+}
+
+int
+mavlink_channel_in_use()
+{
+	int count = 0;
+
+	pthread_mutex_lock(&channel_lock);
+	for (int i = 0; i < MAVLINK_COMM_NUM_BUFFERS; i++)
+	{
+		if (channel_used[i])
+			count++;
+	}
+	pthread_mutex_unlock(&channel_lock);
+
+	return count;
+}
+
+void
+mavlink_channel_dump(FILE *out)
+{
+	pthread_mutex_lock(&channel_lock);
+	fprintf(out, "MAVLINK CHANNELS: %d, channel %d numbers the frames sent\n",
+			MAVLINK_COMM_NUM_BUFFERS, MAVLINK_CHANNEL_TX);
+	for (int i = 0; i < MAVLINK_COMM_NUM_BUFFERS; i++)
+	{
+		if (!channel_used[i])
+			continue;
+		const mavlink_status_t &status = m_mavlink_status[i];
+		fprintf(out, "  %d %-24s %lu parsed, %lu dropped\n", i, channel_names[i],
+				(unsigned long)status.packet_rx_success_count, (unsigned long)status.packet_rx_drop_count);
+	}
+	pthread_mutex_unlock(&channel_lock);
+}
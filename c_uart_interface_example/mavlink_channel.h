@@ -0,0 +1,52 @@
+/**
+ * @file mavlink_channel.h
+ *
+ * @brief MAVLink parser channel allocator definition
+ *
+ * mavlink_parse_char() keeps the state of a half parsed frame per channel.
+ * The generated mavlink.h takes those arrays out of mavlink_helpers.h,
+ * where each translation unit had copies of its own, and they are defined
+ * once here; every port that parses takes a channel of its own for as
+ * long as it lives, so two ports never mix their bytes in one parser.
+ *
+ */
+
+#ifndef MAVLINK_CHANNEL_H_
+#define MAVLINK_CHANNEL_H_
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "../include/mavlink/v2.0/spresense/mavlink.h"
+
+// ------------------------------------------------------------------------------
+//   Defines
+// ------------------------------------------------------------------------------
+
+#if !defined(MAVLINK_EXTERNAL_RX_STATUS) || !defined(MAVLINK_EXTERNAL_RX_BUFFER)
+#error "regenerate the dialect with Channels set in config/mavlink_dialect.conf"
+#endif
+
+// Numbers the frames sent with mavlink_msg_X_encode() and frame_encode(),
+// never handed out for parsing
+#define MAVLINK_CHANNEL_TX MAVLINK_COMM_0
+
+// What mavlink_channel_alloc() returns when all are taken
+#define MAVLINK_CHANNEL_NONE 0xFF
+
+#define MAVLINK_CHANNEL_NAME_LEN 32
+
+// ------------------------------------------------------------------------------
+//   Prototypes
+// ------------------------------------------------------------------------------
+
+uint8_t mavlink_channel_alloc(const char *name);
+void mavlink_channel_free(uint8_t chan);
+int mavlink_channel_in_use();
+void mavlink_channel_dump(FILE *out);
+
+#endif // MAVLINK_CHANNEL_H_
@@ -75,6 +75,8 @@
 // ------------------------------------------------------------------------------
 int top(int argc, char **argv)
 {
+	// time zero of the startup timeline
+	startup_events().launch();
 
 	// --------------------------------------------------------------------------
 	//   PARSE THE COMMANDS
@@ -92,14 +94,58 @@ int top(int argc, char **argv)
 	char *udp_ip = (char *)"127.0.0.1";
 	int udp_port = 14540;
 	bool autotakeoff = false;
+	char *log_path = NULL;
+	char *tlog_path = NULL;
+	char *signing_key = NULL;
+	char *trace_path = NULL;
+	int baud_up = 0;
+	char *baud_param = (char *)SERIAL_NEGOTIATE_DEFAULT_PARAM;
+	char *latency_profile = (char *)"default";
+	bool keep_streams = false;
+	bool tx_schedule = false;
+	bool aggregate = false;
+	bool redundant = false;
 
 	// do the parse, will throw an int if it fails
-	parse_commandline(argc, argv, uart_name, baudrate, use_udp, udp_ip, udp_port, autotakeoff);
+	parse_commandline(argc, argv, uart_name, baudrate, use_udp, udp_ip, udp_port, autotakeoff, log_path, tlog_path, signing_key, trace_path, baud_up, baud_param, latency_profile, keep_streams, tx_schedule, aggregate, redundant);
+
+	// the link threads read the serial port from the start
+	if (aggregate && baud_up > 0)
+	{
+		fprintf(stderr, "WARNING: -B is not used with -A or -R\n");
+		baud_up = 0;
+	}
 
 	// --------------------------------------------------------------------------
 	//   PORT and THREAD STARTUP
 	// --------------------------------------------------------------------------
 
+	/*
+	 * Place this thread
+	 *
+	 * CPU、優先度はスレッド構成表 (include/thread_config.h) に従います。
+	 * 以降に起動するスレッドも同じ表から配置されます。
+	 */
+	thread_config_apply_self(THREAD_CONTROL);
+
+	/*
+	 * Instantiate a trace drain
+	 *
+	 * ホットパスが記録したトレースイベントを低優先度のスレッドで取り出します。
+	 * 通常はテキストでコンソールへ、-T 指定時はバイナリのままファイルへ書き出し、
+	 * mavlink_bench trace でオフラインに整形します。
+	 */
+	Trace_Drain *trace_drain;
+	if (trace_path)
+	{
+		trace_drain = new Trace_Drain((const char *)trace_path);
+	}
+	else
+	{
+		trace_drain = new Trace_Drain(stdout);
+	}
+	trace_drain->start();
+
 	/*
 	 * Instantiate a generic port object
 	 *
@@ -109,13 +155,89 @@ int top(int argc, char **argv)
 	 * シリアルポートでも UDP ポートでもかまいません。
 	 */
 	Generic_Port *port;
-	if (use_udp)
+	Serial_Port *serial_port = NULL;
+	UDP_Port *udp_link = NULL;
+	if (use_udp && !aggregate)
 	{
 		port = new UDP_Port(udp_ip, udp_port);
 	}
 	else
 	{
-		port = new Serial_Port(uart_name, baudrate);
+		serial_port = new Serial_Port(uart_name, baudrate);
+		if (!serial_port->set_profile(latency_profile))
+		{
+			fprintf(stderr, "ERROR: no latency profile %s\n", latency_profile);
+			Serial_Port::list_profiles(stderr);
+			throw EXIT_FAILURE;
+		}
+		port = serial_port;
+	}
+
+	/*
+	 * Instantiate a transmit scheduler, if asked for
+	 *
+	 * 送信するフレームを優先度クラスごとのキューに入れ、ボーレートから決めた
+	 * トークンバケットの速度で送り出します。パラメータやログなどの大量の送信が
+	 * HIL_GPS やセットポイントを遅らせないようにします。シリアルポートのみ。
+	 */
+	Generic_Port *link_port = port;
+	Tx_Scheduler *tx_scheduler = NULL;
+	if (tx_schedule && serial_port)
+	{
+		tx_scheduler = new Tx_Scheduler(serial_port, baudrate);
+		port = tx_scheduler;
+	}
+
+	/*
+	 * Instantiate a link aggregator, if asked for
+	 *
+	 * シリアルポートと UDP ポートを同時に使い、両方から受信したフレームを
+	 * 到着順に一つのオートパイロットインタフェースへ渡します。ポートごとに
+	 * 別の MAVLink チャネルで、それぞれのスレッドが解析します。
+	 * target_system のあるメッセージはそのシステムを最後に受信したリンクへ、
+	 * それ以外は両方のリンクへ送信します。
+	 *
+	 * -R では両方のリンクが同じ機体につながっている冗長構成として扱います。
+	 * 同じフレーム (sysid, compid, seq, msgid) は先に届いた方だけを渡し、
+	 * リンクごとの遅れと欠落から主リンクを選びます。制御系のメッセージは
+	 * 両方のリンクへ、それ以外は主リンクへ送信します。
+	 */
+	Link_Aggregator *link_aggregator = NULL;
+	if (aggregate)
+	{
+		udp_link = new UDP_Port(udp_ip, udp_port);
+		if (redundant)
+		{
+			Redundant_Port *redundant_port = new Redundant_Port();
+			if (tx_scheduler)
+				redundant_port->set_scheduler(tx_scheduler);
+			link_aggregator = redundant_port;
+		}
+		else
+		{
+			link_aggregator = new Link_Aggregator();
+		}
+		link_aggregator->add_link(port);
+		link_aggregator->add_link(udp_link);
+		port = link_aggregator;
+	}
+
+	/*
+	 * Instantiate a telemetry recorder, if asked for
+	 *
+	 * ポートで送受信した全フレームをタイムスタンプ付きでリングバッファに記録し、
+	 * バックグラウンドで tlog 形式のファイルへ書き出します。
+	 */
+	Tlog_Recorder *tlog_recorder = NULL;
+	if (tlog_path)
+	{
+		// *.mlog selects the seekable indexed container
+		const char *ext = strrchr(tlog_path, '.');
+		Tlog_Format format = (ext && strcmp(ext, ".mlog") == 0) ? TLOG_FORMAT_INDEXED : TLOG_FORMAT_TLOG;
+
+		tlog_recorder = new Tlog_Recorder(tlog_path, TLOG_RECORDER_DEFAULT_SLOTS, format);
+		tlog_recorder->start();
+		port->set_recorder(tlog_recorder);
 	}
 
 	/*
@@ -131,6 +253,43 @@ int top(int argc, char **argv)
 	 */
 	Autopilot_Interface autopilot_interface(port);
 
+	/*
+	 * Ask the autopilot only for the streams that are used
+	 *
+	 * commands() などが必要なメッセージとレートを登録し、それ以外のストリームは
+	 * 届いた時点で MAV_CMD_SET_MESSAGE_INTERVAL で止めます。
+	 * --keep-streams を指定すると止めずにオートパイロットの既定のままにします。
+	 */
+	autopilot_interface.get_message_intervals().set_disable_unused(!keep_streams);
+
+	/*
+	 * Instantiate an autopilot log receiver, if asked for
+	 *
+	 * オートパイロットのログストリーム（PX4 ulog / ArduPilot dataflash）を受信し、
+	 * 読み込みスレッドを止めずに SD カードへ書き出します。
+	 */
+	Log_Receiver *log_receiver = NULL;
+	if (log_path)
+	{
+		log_receiver = new Log_Receiver(port, log_path);
+		autopilot_interface.set_log_receiver(log_receiver);
+	}
+
+	/*
+	 * Instantiate a signing engine, if asked for
+	 *
+	 * 鍵は 64 桁の16進数か、MAVProxy と同じく SHA-256 で鍵にするパスフレーズで指定します。
+	 * 起動後に SETUP_SIGNING で鍵をオートパイロットへ渡し、以降の送信フレームに署名します。
+	 */
+	Mavlink_Signing *signing = NULL;
+	if (signing_key)
+	{
+		uint8_t key[MAVLINK_SIGNING_KEY_LEN];
+		Mavlink_Signing::key_from_string(signing_key, key);
+		signing = new Mavlink_Signing(key, 0);
+		memset(key, 0, sizeof(key));
+	}
+
 	/*
 	 * Setup interrupt signal handler
 	 *
@@ -141,6 +300,9 @@ int top(int argc, char **argv)
 	 */
 	port_quit = port;
 	autopilot_interface_quit = &autopilot_interface;
+	log_receiver_quit = log_receiver;
+	tlog_recorder_quit = tlog_recorder;
+	trace_drain_quit = trace_drain;
 	signal(SIGINT, quit_handler);
 
 	/*
@@ -150,8 +312,30 @@ int top(int argc, char **argv)
 	 *
 	 */
 	port->start();
+
+	/*
+	 * Step the serial link up, if asked for
+	 *
+	 * 安全な既定のボーレートで接続した後、オートパイロットのボーレートパラメータを
+	 * 設定し、新しいボーレートでフレームが届くことを確認してから切り替えます。
+	 * 確認できなければ元のボーレートに戻します。読み込みスレッドの起動前に行います。
+	 */
+	if (serial_port && baud_up > 0 &&
+		serial_port->negotiate_baudrate(baud_up, baud_param, autopilot_interface.system_id, autopilot_interface.companion_id) &&
+		tx_scheduler)
+		tx_scheduler->set_baudrate(serial_port->get_baudrate());
+
 	autopilot_interface.start();
 
+	if (signing)
+		autopilot_interface.enable_signing(signing);
+
+	if (log_receiver)
+	{
+		log_receiver->start(autopilot_interface.system_id, autopilot_interface.companion_id,
+							autopilot_interface.system_id, autopilot_interface.autopilot_id);
+	}
+
 	// --------------------------------------------------------------------------
 	//   RUN COMMANDS
 	// --------------------------------------------------------------------------
@@ -169,9 +353,45 @@ int top(int argc, char **argv)
 	 * Now that we are done we can stop the threads and close the port
 	 */
 	autopilot_interface.stop();
+	autopilot_interface.get_message_intervals().dump(stdout);
+
+	// link health for the whole run, the same text as /proc/mavlink
+	link_stats_dump(stdout);
+	latency_dump(stdout);
+
+	if (log_receiver)
+	{
+		log_receiver->stop();
+		delete log_receiver;
+	}
 	port->stop();
 
-	delete port;
+	if (link_aggregator)
+	{
+		link_aggregator->dump(stdout);
+		delete link_aggregator;
+	}
+	if (tx_scheduler)
+	{
+		tx_scheduler->dump(stdout);
+		delete tx_scheduler;
+	}
+	mavlink_channel_dump(stdout);
+	delete link_port;
+	delete udp_link;
+	delete signing;
+
+	if (tlog_recorder)
+	{
+		tlog_recorder->stop();
+		delete tlog_recorder;
+	}
+
+	trace_drain->stop();
+	delete trace_drain;
+
+	// where each thread ran and what it cost
+	thread_config_report(stdout);
 
 	// --------------------------------------------------------------------------
 	//   DONE
@@ -190,13 +410,19 @@ void commands(Autopilot_Interface &api, bool autotakeoff)
 
 	printf("SEND CALIBRATION COMMAND\n");
 	api.autopilot_calibrate();
-	usleep(100);														   // 100us
-	api.set_message_interval(MAVLINK_MSG_ID_EXTENDED_SYS_STATE, 1000000);  // 1e+06s
-	usleep(100);														   // 100us
-	api.set_message_interval(MAVLINK_MSG_ID_GLOBAL_POSITION_INT, 1000000); // 1e+06s
-	usleep(100);														   // 100us
-
-	usleep(2 * 1000 * 1000); // 50s
+	usleep(100); // 100us
+
+	// the streams read below, the read thread sends the intervals
+	Message_Intervals &intervals = api.get_message_intervals();
+	int consumer = intervals.add_consumer("commands");
+	intervals.subscribe(consumer, MAVLINK_MSG_ID_EXTENDED_SYS_STATE, 1);
+	intervals.subscribe(consumer, MAVLINK_MSG_ID_GLOBAL_POSITION_INT, 1);
+	intervals.subscribe(consumer, MAVLINK_MSG_ID_LOCAL_POSITION_NED, 1);
+	intervals.subscribe(consumer, MAVLINK_MSG_ID_HIGHRES_IMU, 1);
+
+	// until the autopilot answers, not a fixed 2 s
+	if (!startup_events().wait(STARTUP_CALIBRATE_ACK, 2000))
+		printf("no command ack yet, going on\n");
 	// --------------------------------------------------------------------------
 	//   START OFFBOARD MODE
 	// --------------------------------------------------------------------------
@@ -223,6 +449,7 @@ void commands(Autopilot_Interface &api, bool autotakeoff)
 	mavlink_highres_imu_t imu = messages.highres_imu;
 	time_t now = time(NULL);
 	uint64_t now64 = (uint64_t)now;
+	bool timeline_shown = false;
 
 	while (true)
 	{
@@ -235,7 +462,13 @@ void commands(Autopilot_Interface &api, bool autotakeoff)
 		// api.send_input_gps_message(now64);
 		// printf("send_input_gps_message\n");
 		api.send_input_hil_gps_message(now64);
-		printf("send_input_hil_gps_message\n");
+
+		// launch to the first fix on the wire, once
+		if (!timeline_shown && startup_events().is_set(STARTUP_FIRST_HIL_GPS))
+		{
+			startup_events().dump(stdout);
+			timeline_shown = true;
+		}
 		usleep(1000 * 1000); // 1000ms
 	}
 
@@ -345,11 +578,16 @@ void commands(Autopilot_Interface &api, bool autotakeoff)
 // ------------------------------------------------------------------------------
 // throws EXIT_FAILURE if could not open the port
 void parse_commandline(int argc, char **argv, char *&uart_name, int &baudrate,
-					   bool &use_udp, char *&udp_ip, int &udp_port, bool &autotakeoff)
+					   bool &use_udp, char *&udp_ip, int &udp_port, bool &autotakeoff,
+					   char *&log_path, char *&tlog_path, char *&signing_key,
+					   char *&trace_path, int &baud_up, char *&baud_param,
+					   char *&latency_profile, bool &keep_streams,
+					   bool &tx_schedule, bool &aggregate,
+					   bool &redundant)
 {
 
 	// string for command line usage
-	const char *commandline_usage = "usage: mavlink_control [-d <devicename> -b <baudrate>] [-u <udp_ip> -p <udp_port>] [-a ]";
+	const char *commandline_usage = "usage: mavlink_control [-d <devicename> -b <baudrate>] [-u <udp_ip> -p <udp_port>] [-a ] [-l <logfile>] [-t <tlogfile|mlogfile>] [-k <key|passphrase>] [-T <tracefile>] [-B <baudrate> [--baud-param <name>]] [-L <default|low_latency|throughput>] [--keep-streams] [-S] [-A | -R]";
 
 	// Read input arguments
 	for (int i = 1; i < argc; i++)
@@ -428,6 +666,136 @@ void parse_commandline(int argc, char **argv, char *&uart_name, int &baudrate,
 		{
 			autotakeoff = true;
 		}
+
+		// Autopilot log file
+		if (strcmp(argv[i], "-l") == 0 || strcmp(argv[i], "--log") == 0)
+		{
+			if (argc > i + 1)
+			{
+				i++;
+				log_path = argv[i];
+			}
+			else
+			{
+				printf("%s\n", commandline_usage);
+				throw EXIT_FAILURE;
+			}
+		}
+
+		// Telemetry recording
+		if (strcmp(argv[i], "-t") == 0 || strcmp(argv[i], "--tlog") == 0)
+		{
+			if (argc > i + 1)
+			{
+				i++;
+				tlog_path = argv[i];
+			}
+			else
+			{
+				printf("%s\n", commandline_usage);
+				throw EXIT_FAILURE;
+			}
+		}
+
+		// MAVLink 2 signing
+		if (strcmp(argv[i], "-k") == 0 || strcmp(argv[i], "--key") == 0)
+		{
+			if (argc > i + 1)
+			{
+				i++;
+				signing_key = argv[i];
+			}
+			else
+			{
+				printf("%s\n", commandline_usage);
+				throw EXIT_FAILURE;
+			}
+		}
+
+		// Binary trace file
+		if (strcmp(argv[i], "-T") == 0 || strcmp(argv[i], "--trace") == 0)
+		{
+			if (argc > i + 1)
+			{
+				i++;
+				trace_path = argv[i];
+			}
+			else
+			{
+				printf("%s\n", commandline_usage);
+				throw EXIT_FAILURE;
+			}
+		}
+
+		// Baud rate to step up to once connected
+		if (strcmp(argv[i], "-B") == 0 || strcmp(argv[i], "--baud-up") == 0)
+		{
+			if (argc > i + 1)
+			{
+				i++;
+				baud_up = atoi(argv[i]);
+			}
+			else
+			{
+				printf("%s\n", commandline_usage);
+				throw EXIT_FAILURE;
+			}
+		}
+
+		// Autopilot parameter holding the rate of its port
+		if (strcmp(argv[i], "--baud-param") == 0)
+		{
+			if (argc > i + 1)
+			{
+				i++;
+				baud_param = argv[i];
+			}
+			else
+			{
+				printf("%s\n", commandline_usage);
+				throw EXIT_FAILURE;
+			}
+		}
+
+		// Serial latency profile
+		if (strcmp(argv[i], "-L") == 0 || strcmp(argv[i], "--latency") == 0)
+		{
+			if (argc > i + 1)
+			{
+				i++;
+				latency_profile = argv[i];
+			}
+			else
+			{
+				printf("%s\n", commandline_usage);
+				throw EXIT_FAILURE;
+			}
+		}
+
+		// Leave the streams nobody reads at the autopilot's defaults
+		if (strcmp(argv[i], "--keep-streams") == 0)
+		{
+			keep_streams = true;
+		}
+
+		// Transmit scheduler
+		if (strcmp(argv[i], "-S") == 0 || strcmp(argv[i], "--schedule") == 0)
+		{
+			tx_schedule = true;
+		}
+
+		// Serial and UDP at once
+		if (strcmp(argv[i], "-A") == 0 || strcmp(argv[i], "--aggregate") == 0)
+		{
+			aggregate = true;
+		}
+
+		// Serial and UDP to the same vehicle, each frame from the first
+		if (strcmp(argv[i], "-R") == 0 || strcmp(argv[i], "--redundant") == 0)
+		{
+			aggregate = true;
+			redundant = true;
+		}
 	}
 	// end: for each input argument
 
@@ -454,6 +822,16 @@ void quit_handler(int sig)
 	{
 	}
 
+	// log receiver, flush what is buffered before the port goes away
+	try
+	{
+		if (log_receiver_quit)
+			log_receiver_quit->stop();
+	}
+	catch (int error)
+	{
+	}
+
 	// port
 	try
 	{
@@ -463,6 +841,26 @@ void quit_handler(int sig)
 	{
 	}
 
+	// telemetry recorder, after the port so the last frames are kept
+	try
+	{
+		if (tlog_recorder_quit)
+			tlog_recorder_quit->stop();
+	}
+	catch (int error)
+	{
+	}
+
+	// trace drain, last so the shutdown events are in it
+	try
+	{
+		if (trace_drain_quit)
+			trace_drain_quit->stop();
+	}
+	catch (int error)
+	{
+	}
+
 	// end program here
 	exit(0);
 }
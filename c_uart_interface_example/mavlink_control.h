@@ -66,11 +66,17 @@
 using std::string;
 using namespace std;
 
-#include "../include/mavlink/v2.0/common/mavlink.h"
+#include "../include/mavlink/v2.0/spresense/mavlink.h"
 
 #include "autopilot_interface.h"
 #include "serial_port.h"
 #include "udp_port.h"
+#include "log_receiver.h"
+#include "trace_drain.h"
+#include "tx_scheduler.h"
+#include "link_aggregator.h"
+#include "redundant_port.h"
+#include "mavlink_channel.h"
 
 // ------------------------------------------------------------------------------
 //   Prototypes
@@ -82,10 +88,18 @@ int top(int argc, char **argv);
 
 void commands(Autopilot_Interface &autopilot_interface, bool autotakeoff);
 void parse_commandline(int argc, char **argv, char *&uart_name, int &baudrate,
-					   bool &use_udp, char *&udp_ip, int &udp_port, bool &autotakeoff);
+					   bool &use_udp, char *&udp_ip, int &udp_port, bool &autotakeoff,
+					   char *&log_path, char *&tlog_path, char *&signing_key,
+					   char *&trace_path, int &baud_up, char *&baud_param,
+					   char *&latency_profile, bool &keep_streams,
+					   bool &tx_schedule, bool &aggregate,
+					   bool &redundant);
 
 // quit handler
 Autopilot_Interface *autopilot_interface_quit;
 Generic_Port *port_quit;
+Log_Receiver *log_receiver_quit;
+Tlog_Recorder *tlog_recorder_quit;
+Trace_Drain *trace_drain_quit;
 
 void quit_handler(int sig);
\ No newline at end of file
@@ -0,0 +1,600 @@
+/**
+ * @file mavlink_signing.cpp
+ *
+ * @brief MAVLink 2 signing engine functions
+ *
+ * Functions for signing and verifying MAVLink 2 frames
+ *
+ */
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include "mavlink_signing.h"
+
+#include <cstdlib>
+#include <string.h>
+#include <time.h>
+
+// ------------------------------------------------------------------------------
+//   SHA-256
+// ------------------------------------------------------------------------------
+
+static const uint32_t sha256_k[64] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+	0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+	0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+	0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+	0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+	0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static const uint32_t sha256_iv[8] = {
+	0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+#define ROR32(x, n)	(((x) >> (n)) | ((x) << (32 - (n))))
+#define SIGMA0(x)	(ROR32(x, 2) ^ ROR32(x, 13) ^ ROR32(x, 22))
+#define SIGMA1(x)	(ROR32(x, 6) ^ ROR32(x, 11) ^ ROR32(x, 25))
+#define sigma0(x)	(ROR32(x, 7) ^ ROR32(x, 18) ^ ((x) >> 3))
+#define sigma1(x)	(ROR32(x, 17) ^ ROR32(x, 19) ^ ((x) >> 10))
+#define CH(x, y, z)	(((x) & (y)) ^ (~(x) & (z)))
+#define MAJ(x, y, z)	(((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
+
+static inline uint32_t
+_load_be32(const uint8_t *p)
+{
+	return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+// one round, the working variables rotate by renaming instead of moving
+#define ROUND(a, b, c, d, e, f, g, h, i) \
+	do { \
+		uint32_t t1 = h + SIGMA1(e) + CH(e, f, g) + sha256_k[i] + w[i]; \
+		d += t1; \
+		h = t1 + SIGMA0(a) + MAJ(a, b, c); \
+	} while (0)
+
+/*
+ * Runs rounds first..63 of one block, first is a multiple of 8.  w[0..15]
+ * is the message block, s[] holds the working variables a..h on entry;
+ * the chaining value h[] gets the result added in.
+ */
+static void
+_sha256_rounds(uint32_t h[8], const uint32_t s[8], uint32_t w[64], int first)
+{
+	for (int i = 16; i < 64; i++)
+		w[i] = sigma1(w[i - 2]) + w[i - 7] + sigma0(w[i - 15]) + w[i - 16];
+
+	uint32_t a = s[0], b = s[1], c = s[2], d = s[3];
+	uint32_t e = s[4], f = s[5], g = s[6], k = s[7];
+
+	for (int i = first; i < 64; i += 8)
+	{
+		ROUND(a, b, c, d, e, f, g, k, i);
+		ROUND(k, a, b, c, d, e, f, g, i + 1);
+		ROUND(g, k, a, b, c, d, e, f, i + 2);
+		ROUND(f, g, k, a, b, c, d, e, i + 3);
+		ROUND(e, f, g, k, a, b, c, d, i + 4);
+		ROUND(d, e, f, g, k, a, b, c, i + 5);
+		ROUND(c, d, e, f, g, k, a, b, i + 6);
+		ROUND(b, c, d, e, f, g, k, a, i + 7);
+	}
+
+	h[0] += a; h[1] += b; h[2] += c; h[3] += d;
+	h[4] += e; h[5] += f; h[6] += g; h[7] += k;
+}
+
+static void
+_sha256_block(uint32_t h[8], const uint8_t *block)
+{
+	uint32_t w[64];
+	for (int i = 0; i < 16; i++)
+		w[i] = _load_be32(&block[i * 4]);
+
+	uint32_t s[8];
+	memcpy(s, h, sizeof(s));
+	_sha256_rounds(h, s, w, 0);
+}
+
+/*
+ * Pads len bytes sitting in buf into whole blocks, buf needs 72 spare bytes
+ * behind them.  Returns the number of blocks.
+ */
+static unsigned
+_sha256_pad(uint8_t *buf, unsigned len)
+{
+	unsigned padded = (len + 9 + 63) & ~63u;
+	buf[len] = 0x80;
+	memset(&buf[len + 1], 0, padded - len - 9);
+
+	uint64_t bits = (uint64_t)len * 8;
+	for (int i = 0; i < 8; i++)
+		buf[padded - 1 - i] = (uint8_t)(bits >> (i * 8));
+
+	return padded / 64;
+}
+
+// ----------------------------------------------------------------------------------
+//   Mavlink Signing Class
+// ----------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+//   Con/De structors
+// ------------------------------------------------------------------------------
+Mavlink_Signing::
+Mavlink_Signing()
+{
+	initialize_defaults(SIGNING_STREAM_TABLE_DEFAULT_CAPACITY);
+}
+
+Mavlink_Signing::
+Mavlink_Signing(const uint8_t key_[MAVLINK_SIGNING_KEY_LEN], uint8_t link_id_)
+{
+	initialize_defaults(SIGNING_STREAM_TABLE_DEFAULT_CAPACITY);
+	set_key(key_);
+	signing.link_id = link_id_;
+}
+
+Mavlink_Signing::
+Mavlink_Signing(const uint8_t key_[MAVLINK_SIGNING_KEY_LEN], uint8_t link_id_, int max_streams)
+{
+	initialize_defaults(max_streams);
+	set_key(key_);
+	signing.link_id = link_id_;
+}
+
+Mavlink_Signing::
+~Mavlink_Signing()
+{
+	delete streams;
+
+	// destroy mutex
+	pthread_mutex_destroy(&lock);
+}
+
+void
+Mavlink_Signing::
+initialize_defaults(int max_streams)
+{
+	// Initialize attributes
+	memset(&signing, 0, sizeof(signing));
+	streams = new Signing_Stream_Table(max_streams);
+	signing.flags = MAVLINK_SIGNING_FLAG_SIGN_OUTGOING;
+	signing.timestamp = now_timestamp();
+	allow_unsigned = false;
+
+	memset(key_words, 0, sizeof(key_words));
+	memset(midstate, 0, sizeof(midstate));
+	memset(&stats, 0, sizeof(stats));
+
+	// Start mutex
+	int result = pthread_mutex_init(&lock, NULL);
+	if ( result != 0 )
+	{
+		printf("\n mutex init failed\n");
+		throw 1;
+	}
+}
+
+// ------------------------------------------------------------------------------
+//   Key
+// ------------------------------------------------------------------------------
+/*
+ * The first eight rounds of block 0 only read the key words, run them here
+ * once.  Everything after depends on the packet.
+ */
+void
+Mavlink_Signing::
+set_key(const uint8_t key_[MAVLINK_SIGNING_KEY_LEN])
+{
+	pthread_mutex_lock(&lock);
+
+	memcpy(signing.secret_key, key_, MAVLINK_SIGNING_KEY_LEN);
+	for (int i = 0; i < 8; i++)
+		key_words[i] = _load_be32(&key_[i * 4]);
+
+	uint32_t w[8];
+	memcpy(w, key_words, sizeof(w));
+
+	uint32_t a = sha256_iv[0], b = sha256_iv[1], c = sha256_iv[2], d = sha256_iv[3];
+	uint32_t e = sha256_iv[4], f = sha256_iv[5], g = sha256_iv[6], k = sha256_iv[7];
+	ROUND(a, b, c, d, e, f, g, k, 0);
+	ROUND(k, a, b, c, d, e, f, g, 1);
+	ROUND(g, k, a, b, c, d, e, f, 2);
+	ROUND(f, g, k, a, b, c, d, e, 3);
+	ROUND(e, f, g, k, a, b, c, d, 4);
+	ROUND(d, e, f, g, k, a, b, c, 5);
+	ROUND(c, d, e, f, g, k, a, b, 6);
+	ROUND(b, c, d, e, f, g, k, a, 7);
+	midstate[0] = a; midstate[1] = b; midstate[2] = c; midstate[3] = d;
+	midstate[4] = e; midstate[5] = f; midstate[6] = g; midstate[7] = k;
+
+	// a new key starts new streams
+	streams->clear();
+
+	pthread_mutex_unlock(&lock);
+}
+
+void
+Mavlink_Signing::
+get_key(uint8_t key_[MAVLINK_SIGNING_KEY_LEN])
+{
+	pthread_mutex_lock(&lock);
+	memcpy(key_, signing.secret_key, MAVLINK_SIGNING_KEY_LEN);
+	pthread_mutex_unlock(&lock);
+}
+
+void
+Mavlink_Signing::
+set_link_id(uint8_t link_id_)
+{
+	pthread_mutex_lock(&lock);
+	signing.link_id = link_id_;
+	pthread_mutex_unlock(&lock);
+}
+
+void
+Mavlink_Signing::
+set_allow_unsigned(bool allow)
+{
+	allow_unsigned = allow;
+}
+
+// ------------------------------------------------------------------------------
+//   Timestamps
+// ------------------------------------------------------------------------------
+uint64_t
+Mavlink_Signing::
+now_timestamp()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_REALTIME, &ts);
+
+	// a board without a clock set still counts up from the epoch
+	if ((uint64_t)ts.tv_sec < MAVLINK_SIGNING_EPOCH_SEC)
+		return 0;
+
+	return ((uint64_t)ts.tv_sec - MAVLINK_SIGNING_EPOCH_SEC) * 100000ULL + ts.tv_nsec / 10000;
+}
+
+uint64_t
+Mavlink_Signing::
+get_timestamp()
+{
+	pthread_mutex_lock(&lock);
+	uint64_t result = signing.timestamp;
+	pthread_mutex_unlock(&lock);
+
+	return result;
+}
+
+/*
+ * Every signed frame needs a timestamp above the last one on the link,
+ * take the clock when it is ahead and count up from the last one when not.
+ * Called with the lock held.
+ */
+uint64_t
+Mavlink_Signing::
+_next_timestamp()
+{
+	uint64_t now = now_timestamp();
+	signing.timestamp = now > signing.timestamp ? now : signing.timestamp + 1;
+
+	return signing.timestamp;
+}
+
+// ------------------------------------------------------------------------------
+//   Signature
+// ------------------------------------------------------------------------------
+/*
+ * Hashes key, header, payload, crc, link id and timestamp.  The key is not
+ * copied, the first block resumes from the midstate at round 8 and only
+ * reads the 32 packet bytes behind the key.
+ */
+void
+Mavlink_Signing::
+_signature(const uint8_t *header, const uint8_t *payload, uint8_t payload_len,
+		   const uint8_t crc[2], const uint8_t link_ts[7], uint8_t out[6])
+{
+	// room for the key, the packet and the padding
+	uint8_t buf[MAVLINK_SIGNING_KEY_LEN + MAVLINK_MAX_PACKET_LEN + 72];
+
+	unsigned len = MAVLINK_SIGNING_KEY_LEN;
+	memcpy(&buf[len], header, MAVLINK_NUM_HEADER_BYTES);
+	len += MAVLINK_NUM_HEADER_BYTES;
+	memcpy(&buf[len], payload, payload_len);
+	len += payload_len;
+	memcpy(&buf[len], crc, 2);
+	len += 2;
+	memcpy(&buf[len], link_ts, 7);
+	len += 7;
+
+	unsigned blocks = _sha256_pad(buf, len);
+
+	// --------------------------------------------------------------------------
+	//   FIRST BLOCK FROM THE MIDSTATE
+	// --------------------------------------------------------------------------
+	uint32_t h[8];
+	memcpy(h, sha256_iv, sizeof(h));
+
+	uint32_t w[64];
+	memcpy(w, key_words, sizeof(key_words));
+	for (int i = 8; i < 16; i++)
+		w[i] = _load_be32(&buf[i * 4]);
+
+	uint32_t s[8];
+	memcpy(s, midstate, sizeof(s));
+	_sha256_rounds(h, s, w, 8);
+
+	// --------------------------------------------------------------------------
+	//   THE REST
+	// --------------------------------------------------------------------------
+	for (unsigned i = 1; i < blocks; i++)
+		_sha256_block(h, &buf[i * 64]);
+
+	// first 48 bits of the digest
+	out[0] = h[0] >> 24;
+	out[1] = h[0] >> 16;
+	out[2] = h[0] >> 8;
+	out[3] = h[0];
+	out[4] = h[1] >> 24;
+	out[5] = h[1] >> 16;
+}
+
+// ------------------------------------------------------------------------------
+//   Sign Outgoing Frame
+// ------------------------------------------------------------------------------
+/*
+ * Signs a serialized frame in place, frame needs MAVLINK_MAX_PACKET_LEN
+ * bytes of room.  An already signed frame is signed again with our key.
+ * Returns the new length; MAVLink 1 frames and messages this dialect does
+ * not know come back unchanged.
+ */
+unsigned
+Mavlink_Signing::
+sign(uint8_t *frame, unsigned len)
+{
+	if (len < MAVLINK_NUM_NON_PAYLOAD_BYTES || frame[0] != MAVLINK_STX)
+		return len;
+
+	uint8_t payload_len = frame[1];
+	uint32_t msgid = frame[7] | ((uint32_t)frame[8] << 8) | ((uint32_t)frame[9] << 16);
+	const mavlink_msg_entry_t *entry = mavlink_get_msg_entry(msgid);
+	if (entry == NULL)
+		return len;
+
+	// --------------------------------------------------------------------------
+	//   NEW CRC OVER THE SIGNED FLAG
+	// --------------------------------------------------------------------------
+	frame[2] |= MAVLINK_IFLAG_SIGNED;
+
+	uint16_t checksum = crc_calculate(&frame[1], MAVLINK_CORE_HEADER_LEN + payload_len);
+	crc_accumulate(entry->crc_extra, &checksum);
+
+	unsigned crc_pos = MAVLINK_NUM_HEADER_BYTES + payload_len;
+	frame[crc_pos] = (uint8_t)(checksum & 0xFF);
+	frame[crc_pos + 1] = (uint8_t)(checksum >> 8);
+
+	// --------------------------------------------------------------------------
+	//   SIGNATURE BLOCK
+	// --------------------------------------------------------------------------
+	uint8_t *block = &frame[crc_pos + 2];
+
+	pthread_mutex_lock(&lock);
+
+	uint64_t tstamp = _next_timestamp();
+	block[0] = signing.link_id;
+	for (int i = 0; i < 6; i++)
+		block[1 + i] = (uint8_t)(tstamp >> (i * 8));
+
+	_signature(frame, &frame[MAVLINK_NUM_HEADER_BYTES], payload_len, &frame[crc_pos], block, &block[7]);
+	stats.signed_out++;
+
+	pthread_mutex_unlock(&lock);
+
+	return crc_pos + 2 + MAVLINK_SIGNATURE_BLOCK_LEN;
+}
+
+// ------------------------------------------------------------------------------
+//   Verify Incoming Message
+// ------------------------------------------------------------------------------
+bool
+Mavlink_Signing::
+verify(const mavlink_message_t &message)
+{
+	if (message.magic != MAVLINK_STX || !(message.incompat_flags & MAVLINK_IFLAG_SIGNED))
+	{
+		pthread_mutex_lock(&lock);
+		stats.unsigned_in++;
+		pthread_mutex_unlock(&lock);
+		return allow_unsigned;
+	}
+
+	uint8_t header[MAVLINK_NUM_HEADER_BYTES];
+	header[0] = message.magic;
+	header[1] = message.len;
+	header[2] = message.incompat_flags;
+	header[3] = message.compat_flags;
+	header[4] = message.seq;
+	header[5] = message.sysid;
+	header[6] = message.compid;
+	header[7] = message.msgid & 0xFF;
+	header[8] = (message.msgid >> 8) & 0xFF;
+	header[9] = (message.msgid >> 16) & 0xFF;
+
+	uint8_t crc[2];
+	crc[0] = message.ck[0];
+	crc[1] = message.ck[1];
+
+	uint8_t expected[6];
+
+	pthread_mutex_lock(&lock);
+
+	_signature(header, (const uint8_t *)_MAV_PAYLOAD(&message), message.len, crc, message.signature, expected);
+
+	bool result;
+	if (memcmp(expected, &message.signature[7], 6) != 0)
+	{
+		signing.last_status = MAVLINK_SIGNING_STATUS_BAD_SIGNATURE;
+		stats.bad_signature++;
+		result = false;
+	}
+	else
+	{
+		uint64_t tstamp = 0;
+		for (int i = 5; i >= 0; i--)
+			tstamp = (tstamp << 8) | message.signature[1 + i];
+
+		result = _check_stream(message, tstamp);
+		if (result)
+			stats.verified++;
+	}
+
+	pthread_mutex_unlock(&lock);
+
+	return result;
+}
+
+/*
+ * Replay protection, same rules as mavlink_signature_check(): a known
+ * stream must move forward, a new one must be no more than a minute behind
+ * the link.  Called with the lock held.
+ */
+bool
+Mavlink_Signing::
+_check_stream(const mavlink_message_t &message, uint64_t tstamp)
+{
+	uint8_t status = streams->check(message.signature[0], message.sysid, message.compid, tstamp, signing.timestamp);
+	signing.last_status = (mavlink_signing_status_t)status;
+
+	if (status == MAVLINK_SIGNING_STATUS_TOO_MANY_STREAMS)
+	{
+		stats.no_stream++;
+		return false;
+	}
+	if (status != MAVLINK_SIGNING_STATUS_OK)
+	{
+		stats.replayed++;
+		return false;
+	}
+
+	// our own timestamps never fall behind what the link has seen
+	if (tstamp > signing.timestamp)
+		signing.timestamp = tstamp;
+
+	return true;
+}
+
+// ------------------------------------------------------------------------------
+//   Stats
+// ------------------------------------------------------------------------------
+Mavlink_Signing_Stats
+Mavlink_Signing::
+get_stats()
+{
+	pthread_mutex_lock(&lock);
+	Mavlink_Signing_Stats result = stats;
+	result.streams = streams->size();
+	pthread_mutex_unlock(&lock);
+
+	return result;
+}
+
+/*
+ * Replay state from and to the MAVLink helpers' struct, e.g. to keep it
+ * across a restart.  Saving keeps the newest streams when there are more
+ * than the struct holds.
+ */
+void
+Mavlink_Signing::
+load_streams(const mavlink_signing_streams_t &streams_)
+{
+	pthread_mutex_lock(&lock);
+	streams->load_streams(streams_);
+	pthread_mutex_unlock(&lock);
+}
+
+void
+Mavlink_Signing::
+save_streams(mavlink_signing_streams_t &streams_)
+{
+	pthread_mutex_lock(&lock);
+	streams->save_streams(streams_);
+	pthread_mutex_unlock(&lock);
+}
+
+// ------------------------------------------------------------------------------
+//   Key Helpers
+// ------------------------------------------------------------------------------
+void
+Mavlink_Signing::
+sha256(const uint8_t *data, unsigned len, uint8_t digest[32])
+{
+	uint32_t h[8];
+	memcpy(h, sha256_iv, sizeof(h));
+
+	unsigned done = 0;
+	while (len - done >= 64)
+	{
+		_sha256_block(h, &data[done]);
+		done += 64;
+	}
+
+	uint8_t tail[128];
+	memcpy(tail, &data[done], len - done);
+	unsigned padded = (len - done + 9 + 63) & ~63u;
+	tail[len - done] = 0x80;
+	memset(&tail[len - done + 1], 0, padded - (len - done) - 9);
+	uint64_t bits = (uint64_t)len * 8;
+	for (int i = 0; i < 8; i++)
+		tail[padded - 1 - i] = (uint8_t)(bits >> (i * 8));
+
+	for (unsigned i = 0; i < padded; i += 64)
+		_sha256_block(h, &tail[i]);
+
+	for (int i = 0; i < 8; i++)
+	{
+		digest[i * 4] = h[i] >> 24;
+		digest[i * 4 + 1] = h[i] >> 16;
+		digest[i * 4 + 2] = h[i] >> 8;
+		digest[i * 4 + 3] = h[i];
+	}
+}
+
+/*
+ * A key is given either as 64 hex digits or as a passphrase, which is
+ * hashed with SHA-256 the same way MAVProxy's "signing setup" does.
+ * Returns 0, or -1 for an empty string.
+ */
+int
+Mavlink_Signing::
+key_from_string(const char *text, uint8_t key_[MAVLINK_SIGNING_KEY_LEN])
+{
+	unsigned len = strlen(text);
+	if (len == 0)
+		return -1;
+
+	bool hex = len == MAVLINK_SIGNING_KEY_LEN * 2;
+	for (unsigned i = 0; hex && i < len; i++)
+	{
+		char c = text[i];
+		hex = (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+	}
+
+	if (hex)
+	{
+		for (int i = 0; i < MAVLINK_SIGNING_KEY_LEN; i++)
+		{
+			char byte[3] = { text[i * 2], text[i * 2 + 1], 0 };
+			key_[i] = (uint8_t)strtoul(byte, NULL, 16);
+		}
+		return 0;
+	}
+
+	sha256((const uint8_t *)text, len, key_);
+	return 0;
+}
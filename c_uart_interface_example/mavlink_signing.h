@@ -0,0 +1,118 @@
+/**
+ * @file mavlink_signing.h
+ *
+ * @brief MAVLink 2 signing engine definition
+ *
+ * Signs outgoing frames and verifies incoming ones with a SHA-256 whose
+ * key-dependent work is done once per key instead of once per packet.
+ *
+ */
+
+#ifndef MAVLINK_SIGNING_H_
+#define MAVLINK_SIGNING_H_
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pthread.h> // This uses POSIX Threads
+
+#include "../include/mavlink/v2.0/spresense/mavlink.h"
+
+#include "signing_stream_table.h"
+
+// ------------------------------------------------------------------------------
+//   Defines
+// ------------------------------------------------------------------------------
+
+#define MAVLINK_SIGNING_KEY_LEN 32
+
+// Signature timestamps count 10 us ticks from 2015-01-01 00:00:00 GMT
+#define MAVLINK_SIGNING_EPOCH_SEC 1420070400ULL
+
+// ------------------------------------------------------------------------------
+//   Data Structures
+// ------------------------------------------------------------------------------
+
+struct Mavlink_Signing_Stats
+{
+	uint32_t signed_out;
+	uint32_t verified;
+	uint32_t unsigned_in;	// accepted or rejected per allow_unsigned
+	uint32_t bad_signature;
+	uint32_t replayed;		// old timestamp on a known or new stream
+	uint32_t no_stream;		// stream table full
+	uint32_t streams;		// streams known
+};
+
+// ----------------------------------------------------------------------------------
+//   Mavlink Signing Class
+// ----------------------------------------------------------------------------------
+/*
+ * Mavlink Signing Class
+ *
+ * The signature is the first 48 bits of SHA-256(key, header, payload, crc,
+ * link id, timestamp).  The key fills the first half of the first SHA-256
+ * block, so the first eight compression rounds of that block only depend on
+ * the key; set_key() runs them once and every packet resumes from there,
+ * then hashes the rest of the packet in a single pass without the
+ * incremental buffering of mavlink_sha256_update().
+ *
+ * sign() turns a serialized MAVLink 2 frame into a signed one in place:
+ * it sets the signed flag, recomputes the crc and appends the signature
+ * block.  verify() checks the signature of a parsed message and its
+ * timestamp against the per stream replay state in a Signing_Stream_Table,
+ * with the same rules as mavlink_signature_check() but without its limit
+ * of 16 streams.
+ */
+class Mavlink_Signing
+{
+
+public:
+	Mavlink_Signing();
+	Mavlink_Signing(const uint8_t key_[MAVLINK_SIGNING_KEY_LEN], uint8_t link_id_);
+	Mavlink_Signing(const uint8_t key_[MAVLINK_SIGNING_KEY_LEN], uint8_t link_id_, int max_streams);
+	~Mavlink_Signing();
+
+	void set_key(const uint8_t key_[MAVLINK_SIGNING_KEY_LEN]);
+	void set_link_id(uint8_t link_id_);
+	void set_allow_unsigned(bool allow);
+
+	unsigned sign(uint8_t *frame, unsigned len);
+	bool verify(const mavlink_message_t &message);
+
+	uint64_t get_timestamp();
+	void get_key(uint8_t key_[MAVLINK_SIGNING_KEY_LEN]);
+	Mavlink_Signing_Stats get_stats();
+
+	void load_streams(const mavlink_signing_streams_t &streams_);
+	void save_streams(mavlink_signing_streams_t &streams_);
+
+	static uint64_t now_timestamp();
+	static void sha256(const uint8_t *data, unsigned len, uint8_t digest[32]);
+	static int key_from_string(const char *text, uint8_t key_[MAVLINK_SIGNING_KEY_LEN]);
+
+private:
+	mavlink_signing_t signing;
+	Signing_Stream_Table *streams;
+	bool allow_unsigned;
+
+	// SHA-256 state after the 8 key-only rounds of the first block
+	uint32_t key_words[8];
+	uint32_t midstate[8];
+
+	pthread_mutex_t lock;
+
+	Mavlink_Signing_Stats stats;
+
+	void initialize_defaults(int max_streams);
+
+	uint64_t _next_timestamp();
+	void _signature(const uint8_t *header, const uint8_t *payload, uint8_t payload_len,
+					const uint8_t crc[2], const uint8_t link_ts[7], uint8_t out[6]);
+	bool _check_stream(const mavlink_message_t &message, uint64_t tstamp);
+};
+
+#endif // MAVLINK_SIGNING_H_
@@ -0,0 +1,521 @@
+/**
+ * @file message_intervals.cpp
+ *
+ * @brief Message interval subscription manager functions
+ *
+ * Functions for working out the streams the consumers need and setting
+ * them on the autopilot
+ *
+ */
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include "message_intervals.h"
+
+#include <string.h>
+#include <time.h>
+
+static uint64_t
+_now_usec()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// ----------------------------------------------------------------------------------
+//   Message Intervals Class
+// ----------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+//   Con/De structors
+// ------------------------------------------------------------------------------
+Message_Intervals::
+Message_Intervals(Generic_Port *port_)
+{
+	initialize_defaults();
+	port = port_;
+}
+
+Message_Intervals::
+~Message_Intervals()
+{
+	// destroy mutex
+	pthread_mutex_destroy(&lock);
+}
+
+void
+Message_Intervals::
+initialize_defaults()
+{
+	// Initialize attributes
+	port = NULL;
+	pthread_mutex_init(&lock, NULL);
+
+	started = false;
+	disable_unused = true;
+
+	system_id = 0;
+	companion_id = 0;
+	target_system = 0;
+	target_component = 0;
+
+	num_consumers = 0;
+	num_intervals = 0;
+	in_flight = NULL;
+
+	last_heartbeat_usec = 0;
+	last_boot_ms = 0;
+	unknown_check_usec = 0;
+
+	memset(&stats, 0, sizeof(stats));
+}
+
+/*
+ * Commands go out from here on, once the autopilot ids are known.  What
+ * was subscribed before is sent then.
+ */
+void
+Message_Intervals::
+start(int system_id_, int companion_id_, int target_system_, int target_component_)
+{
+	pthread_mutex_lock(&lock);
+	system_id = system_id_;
+	companion_id = companion_id_;
+	target_system = target_system_;
+	target_component = target_component_;
+	started = true;
+	pthread_mutex_unlock(&lock);
+}
+
+// ------------------------------------------------------------------------------
+//   Subscriptions
+// ------------------------------------------------------------------------------
+
+// Returns the consumer id to subscribe with, -1 when the table is full
+int
+Message_Intervals::
+add_consumer(const char *name)
+{
+	pthread_mutex_lock(&lock);
+	int consumer = -1;
+	if (num_consumers < MESSAGE_INTERVALS_MAX_CONSUMERS)
+	{
+		consumer = num_consumers++;
+		consumers[consumer] = name;
+	}
+	pthread_mutex_unlock(&lock);
+	return consumer;
+}
+
+bool
+Message_Intervals::
+subscribe(int consumer, uint16_t msgid, float rate_hz)
+{
+	if (consumer < 0 || consumer >= num_consumers || rate_hz <= 0)
+		return false;
+
+	pthread_mutex_lock(&lock);
+	Interval *interval = _find(msgid);
+	if (!interval)
+		interval = _add(msgid);
+	if (interval)
+	{
+		interval->rate_hz[consumer] = rate_hz;
+		_update(*interval);
+	}
+	pthread_mutex_unlock(&lock);
+
+	if (!interval)
+		fprintf(stderr, "WARNING: no room to subscribe to message %u\n", msgid);
+	return interval != NULL;
+}
+
+// The stream goes back to off, or to the autopilot default, with no consumers
+void
+Message_Intervals::
+unsubscribe(int consumer, uint16_t msgid)
+{
+	if (consumer < 0 || consumer >= num_consumers)
+		return;
+
+	pthread_mutex_lock(&lock);
+	Interval *interval = _find(msgid);
+	if (interval && interval->rate_hz[consumer] > 0)
+	{
+		interval->rate_hz[consumer] = 0;
+		_update(*interval);
+	}
+	pthread_mutex_unlock(&lock);
+}
+
+// Off leaves the streams nobody subscribed to at the autopilot's defaults
+void
+Message_Intervals::
+set_disable_unused(bool disable_unused_)
+{
+	pthread_mutex_lock(&lock);
+	disable_unused = disable_unused_;
+	for (int i = 0; i < num_intervals; i++)
+		_update(intervals[i]);
+	pthread_mutex_unlock(&lock);
+}
+
+Message_Intervals::Interval *
+Message_Intervals::
+_find(uint16_t msgid)
+{
+	for (int i = 0; i < num_intervals; i++)
+	{
+		if (intervals[i].msgid == msgid)
+			return &intervals[i];
+	}
+	return NULL;
+}
+
+Message_Intervals::Interval *
+Message_Intervals::
+_add(uint16_t msgid)
+{
+	if (num_intervals == MESSAGE_INTERVALS_MAX)
+		return NULL;
+
+	Interval &interval = intervals[num_intervals++];
+	memset(&interval, 0, sizeof(interval));
+	interval.msgid = msgid;
+	interval.applied_us = 0;
+	interval.state = INTERVAL_APPLIED;
+	return &interval;
+}
+
+// Works out the interval the consumers need, queues it if it changed
+void
+Message_Intervals::
+_update(Interval &interval)
+{
+	float rate_hz = 0;
+	for (int i = 0; i < num_consumers; i++)
+	{
+		if (interval.rate_hz[i] > rate_hz)
+			rate_hz = interval.rate_hz[i];
+	}
+
+	int32_t wanted = rate_hz > 0 ? (int32_t)(1000000.0f / rate_hz) : (disable_unused ? -1 : 0);
+	if (wanted == interval.interval_us && interval.state != INTERVAL_FAILED)
+		return;
+
+	interval.interval_us = wanted;
+	interval.retries = 0;
+	if (&interval != in_flight)
+		interval.state = wanted == interval.applied_us ? INTERVAL_APPLIED : INTERVAL_PENDING;
+}
+
+// ------------------------------------------------------------------------------
+//   Read Thread
+// ------------------------------------------------------------------------------
+void
+Message_Intervals::
+handle_message(const mavlink_message_t &message)
+{
+	if (!started || message.sysid != target_system || message.compid != target_component)
+		return;
+
+	pthread_mutex_lock(&lock);
+
+	switch (message.msgid)
+	{
+	case MAVLINK_MSG_ID_HEARTBEAT:
+	{
+		uint64_t now = _now_usec();
+		if (last_heartbeat_usec && now - last_heartbeat_usec > MESSAGE_INTERVALS_LINK_LOSS_US)
+		{
+			printf("MESSAGE INTERVALS: link back after %lu ms, setting streams again\n",
+				   (unsigned long)((now - last_heartbeat_usec) / 1000));
+			_reapply();
+		}
+		last_heartbeat_usec = now;
+		break;
+	}
+
+	case MAVLINK_MSG_ID_COMMAND_ACK:
+		_handle_ack(Command_Ack_View(message));
+		break;
+
+	// the clocks of the autopilot, whichever is streamed
+	case MAVLINK_MSG_ID_SYSTEM_TIME:
+		_check_boot_time(mavlink_msg_system_time_get_time_boot_ms(&message));
+		break;
+	case MAVLINK_MSG_ID_ATTITUDE:
+		_check_boot_time(mavlink_msg_attitude_get_time_boot_ms(&message));
+		break;
+	case MAVLINK_MSG_ID_GLOBAL_POSITION_INT:
+		_check_boot_time(mavlink_msg_global_position_int_get_time_boot_ms(&message));
+		break;
+	case MAVLINK_MSG_ID_LOCAL_POSITION_NED:
+		_check_boot_time(mavlink_msg_local_position_ned_get_time_boot_ms(&message));
+		break;
+	}
+
+	// a stream nobody asked for
+	if (disable_unused && _is_stream(message.msgid) && !_find(message.msgid))
+		_switch_off(message.msgid);
+
+	pthread_mutex_unlock(&lock);
+}
+
+void
+Message_Intervals::
+_switch_off(uint16_t msgid)
+{
+	Interval *interval = _add(msgid);
+	if (interval)
+	{
+		_update(*interval);
+		stats.streams_off++;
+	}
+}
+
+/*
+ * A msgid the dialect was pruned of fails the checksum in the parser and
+ * never reaches handle_message(), the port counts it as unknown.  The
+ * sender is not known either, on a link to one autopilot it is that one.
+ * Every link of an aggregated port is looked at, the stream may only
+ * come in on one of them.
+ */
+void
+Message_Intervals::
+_check_unknown()
+{
+	for (int link = 0; link < port->get_num_link_stats(); link++)
+	{
+		int n = port->get_link_stats_at(link)->snapshot_msgids(link_msgids, LINK_STATS_MSGID_SLOTS + 1);
+		for (int i = 0; i < n; i++)
+		{
+			uint32_t msgid = link_msgids[i].msgid;
+			if (msgid > 0xFFFF || link_msgids[i].rx_unknown < MESSAGE_INTERVALS_UNKNOWN_MIN)
+				continue;
+			if (_is_stream(msgid) && !_find(msgid))
+				_switch_off(msgid);
+		}
+	}
+}
+
+void
+Message_Intervals::
+_check_boot_time(uint32_t time_boot_ms)
+{
+	if (last_boot_ms > time_boot_ms + MESSAGE_INTERVALS_REBOOT_MS)
+	{
+		printf("MESSAGE INTERVALS: autopilot rebooted, setting streams again\n");
+		_reapply();
+	}
+	last_boot_ms = time_boot_ms;
+}
+
+// The ack does not name the stream, it answers the one command in flight
+void
+Message_Intervals::
+_handle_ack(const Command_Ack_View &ack)
+{
+	if (ack.command() != MAV_CMD_SET_MESSAGE_INTERVAL || !in_flight)
+		return;
+
+	Interval &interval = *in_flight;
+	in_flight = NULL;
+
+	if (ack.result() == MAV_RESULT_ACCEPTED)
+	{
+		stats.acked++;
+		interval.applied_us = interval.sent_us;
+
+		// subscribed again while this was in flight
+		interval.state = interval.applied_us == interval.interval_us ? INTERVAL_APPLIED : INTERVAL_PENDING;
+	}
+	else if (ack.result() == MAV_RESULT_TEMPORARILY_REJECTED)
+	{
+		interval.state = INTERVAL_PENDING;
+	}
+	else
+	{
+		stats.failed++;
+		interval.state = INTERVAL_FAILED;
+		fprintf(stderr, "WARNING: interval of message %u refused (%u)\n", interval.msgid, ack.result());
+	}
+}
+
+/*
+ * Sends the next command when none is in flight, or the one in flight
+ * again when its ack is late.  Cheap when there is nothing to do.
+ */
+void
+Message_Intervals::
+poll()
+{
+	if (!started)
+		return;
+
+	pthread_mutex_lock(&lock);
+	uint64_t now = _now_usec();
+
+	if (in_flight && now - in_flight->sent_usec > MESSAGE_INTERVALS_ACK_US)
+	{
+		if (in_flight->retries < MESSAGE_INTERVALS_RETRIES)
+		{
+			in_flight->retries++;
+			stats.retries++;
+			_send(*in_flight);
+		}
+		else
+		{
+			stats.failed++;
+			in_flight->state = INTERVAL_FAILED;
+			fprintf(stderr, "WARNING: no ack for the interval of message %u\n", in_flight->msgid);
+			in_flight = NULL;
+		}
+	}
+
+	// no stream is set while the link is down
+	bool link_up = last_heartbeat_usec && now - last_heartbeat_usec <= MESSAGE_INTERVALS_LINK_LOSS_US;
+
+	if (disable_unused && link_up && now - unknown_check_usec > MESSAGE_INTERVALS_UNKNOWN_CHECK_US)
+	{
+		unknown_check_usec = now;
+		_check_unknown();
+	}
+
+	for (int i = 0; !in_flight && link_up && i < num_intervals; i++)
+	{
+		Interval &interval = intervals[i];
+		if (interval.state == INTERVAL_PENDING)
+		{
+			in_flight = &interval;
+			_send(interval);
+		}
+	}
+
+	pthread_mutex_unlock(&lock);
+}
+
+// Everything sent again, what failed tried again too
+void
+Message_Intervals::
+reapply()
+{
+	pthread_mutex_lock(&lock);
+	_reapply();
+	pthread_mutex_unlock(&lock);
+}
+
+void
+Message_Intervals::
+_reapply()
+{
+	stats.reapplied++;
+	in_flight = NULL;
+	for (int i = 0; i < num_intervals; i++)
+	{
+		intervals[i].applied_us = 0;
+		intervals[i].retries = 0;
+		intervals[i].state = INTERVAL_PENDING;
+	}
+}
+
+void
+Message_Intervals::
+_send(Interval &interval)
+{
+	mavlink_command_long_t com;
+	memset(&com, 0, sizeof(com));
+	com.target_system = target_system;
+	com.target_component = target_component;
+	com.command = MAV_CMD_SET_MESSAGE_INTERVAL;
+	com.confirmation = interval.retries;
+	com.param1 = interval.msgid;
+	com.param2 = interval.interval_us;
+	com.param7 = 0; // to the requester
+
+	mavlink_message_t message;
+	mavlink_msg_command_long_encode(system_id, companion_id, &message, &com);
+
+	interval.state = INTERVAL_SENT;
+	interval.sent_us = interval.interval_us;
+	interval.sent_usec = _now_usec();
+	stats.commands++;
+
+	if (port->write_message(message) <= 0)
+		fprintf(stderr, "WARNING: could not send MAV_CMD_SET_MESSAGE_INTERVAL \n");
+}
+
+/*
+ * Messages that are answers, events or requested data rather than streams,
+ * never switched off
+ */
+bool
+Message_Intervals::
+_is_stream(uint16_t msgid)
+{
+	switch (msgid)
+	{
+	case MAVLINK_MSG_ID_HEARTBEAT:
+	case MAVLINK_MSG_ID_COMMAND_ACK:
+	case MAVLINK_MSG_ID_COMMAND_LONG:
+	case MAVLINK_MSG_ID_STATUSTEXT:
+	case MAVLINK_MSG_ID_PARAM_VALUE:
+	case MAVLINK_MSG_ID_TIMESYNC:
+	case MAVLINK_MSG_ID_AUTOPILOT_VERSION:
+	case MAVLINK_MSG_ID_MESSAGE_INTERVAL:
+	case MAVLINK_MSG_ID_LOGGING_DATA:
+	case MAVLINK_MSG_ID_LOGGING_DATA_ACKED:
+	case MAVLINK_MSG_ID_REMOTE_LOG_DATA_BLOCK:
+	case MAVLINK_MSG_ID_MISSION_ACK:
+	case MAVLINK_MSG_ID_MISSION_REQUEST:
+	case MAVLINK_MSG_ID_MISSION_REQUEST_INT:
+	case MAVLINK_MSG_ID_MISSION_COUNT:
+	case MAVLINK_MSG_ID_MISSION_ITEM_INT:
+		return false;
+	default:
+		return true;
+	}
+}
+
+// ------------------------------------------------------------------------------
+//   Report
+// ------------------------------------------------------------------------------
+
+Message_Intervals_Stats
+Message_Intervals::
+get_stats()
+{
+	pthread_mutex_lock(&lock);
+	Message_Intervals_Stats copy = stats;
+	pthread_mutex_unlock(&lock);
+	return copy;
+}
+
+void
+Message_Intervals::
+dump(FILE *out)
+{
+	static const char *states[] = {"applied", "pending", "sent", "failed"};
+
+	pthread_mutex_lock(&lock);
+	fprintf(out, "MESSAGE INTERVALS: %lu commands, %lu acked, %lu retries, %lu failed, "
+				 "%lu streams off, %lu reapplied\n",
+			(unsigned long)stats.commands, (unsigned long)stats.acked, (unsigned long)stats.retries,
+			(unsigned long)stats.failed, (unsigned long)stats.streams_off, (unsigned long)stats.reapplied);
+	fprintf(out, "  %6s %12s %8s  %s\n", "msgid", "interval us", "state", "consumers");
+	for (int i = 0; i < num_intervals; i++)
+	{
+		const Interval &interval = intervals[i];
+		fprintf(out, "  %6u %12ld %8s ", interval.msgid, (long)interval.interval_us, states[interval.state]);
+		for (int c = 0; c < num_consumers; c++)
+		{
+			if (interval.rate_hz[c] > 0)
+				fprintf(out, " %s@%gHz", consumers[c], interval.rate_hz[c]);
+		}
+		fprintf(out, "\n");
+	}
+	pthread_mutex_unlock(&lock);
+}
@@ -0,0 +1,168 @@
+/**
+ * @file message_intervals.h
+ *
+ * @brief Message interval subscription manager definition
+ *
+ * Asks the autopilot for the messages something here reads, at the rate
+ * it reads them, with MAV_CMD_SET_MESSAGE_INTERVAL, and for nothing else.
+ *
+ */
+
+#ifndef MESSAGE_INTERVALS_H_
+#define MESSAGE_INTERVALS_H_
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pthread.h> // This uses POSIX Threads
+
+#include "../include/mavlink/v2.0/spresense/mavlink.h"
+#include "../include/mavlink/v2.0/spresense/mavlink_views.h"
+
+#include "generic_port.h"
+
+// ------------------------------------------------------------------------------
+//   Defines
+// ------------------------------------------------------------------------------
+
+// Streams tracked, subscribed or switched off
+#define MESSAGE_INTERVALS_MAX 32
+
+// Consumers that can subscribe
+#define MESSAGE_INTERVALS_MAX_CONSUMERS 8
+
+// A command not acked in this time is sent again, at most this often
+#define MESSAGE_INTERVALS_ACK_US 500000
+#define MESSAGE_INTERVALS_RETRIES 3
+
+// No heartbeat for this long is a lost link, everything is set again after
+#define MESSAGE_INTERVALS_LINK_LOSS_US 3000000
+
+// time_boot_ms going back more than this is an autopilot reboot
+#define MESSAGE_INTERVALS_REBOOT_MS 1000
+
+// How often the link is asked for streams of msgids not in the dialect,
+// and how many frames of one make it a stream and not line noise
+#define MESSAGE_INTERVALS_UNKNOWN_CHECK_US 1000000
+#define MESSAGE_INTERVALS_UNKNOWN_MIN 3
+
+// ------------------------------------------------------------------------------
+//   Data Structures
+// ------------------------------------------------------------------------------
+
+struct Message_Intervals_Stats
+{
+	uint32_t commands;	// SET_MESSAGE_INTERVAL sent, retries included
+	uint32_t acked;
+	uint32_t retries;
+	uint32_t failed;	// denied, or no ack after the retries
+	uint32_t streams_off; // unused streams switched off
+	uint32_t reapplied;	// times everything was set again
+};
+
+// ----------------------------------------------------------------------------------
+//   Message Intervals Class
+// ----------------------------------------------------------------------------------
+/*
+ * Message Intervals Class
+ *
+ * A consumer subscribes to a msgid with the rate it needs; the stream runs
+ * at the highest rate any consumer asked for.  Streams the autopilot sends
+ * that nobody subscribed to are switched off as they show up, except the
+ * ones that are not streams (heartbeat, acks, parameters, log data).
+ * Streams of msgids the dialect does not have never parse; they are found
+ * in the link's unknown msgid counts instead.
+ *
+ * handle_message() and poll() run on the read thread.  poll() keeps one
+ * command in flight and tracks its COMMAND_ACK, which does not say which
+ * stream it is for.  After a lost link or an autopilot reboot every stream
+ * is set again.
+ */
+class Message_Intervals
+{
+
+public:
+	Message_Intervals(Generic_Port *port_);
+	~Message_Intervals();
+
+	void start(int system_id_, int companion_id_, int target_system_, int target_component_);
+
+	int add_consumer(const char *name);
+	bool subscribe(int consumer, uint16_t msgid, float rate_hz);
+	void unsubscribe(int consumer, uint16_t msgid);
+
+	void set_disable_unused(bool disable_unused_);
+
+	void handle_message(const mavlink_message_t &message);
+	void poll();
+	void reapply();
+
+	Message_Intervals_Stats get_stats();
+	void dump(FILE *out);
+
+private:
+	enum Interval_State
+	{
+		INTERVAL_APPLIED = 0,
+		INTERVAL_PENDING,	// to send
+		INTERVAL_SENT,		// waiting for the ack
+		INTERVAL_FAILED		// given up until the next reapply()
+	};
+
+	struct Interval
+	{
+		uint16_t msgid;
+		float rate_hz[MESSAGE_INTERVALS_MAX_CONSUMERS]; // 0 not wanted
+		int32_t interval_us;	// wanted, -1 off, 0 the autopilot default
+		int32_t applied_us;		// last acked
+		int32_t sent_us;		// in the command in flight
+		uint8_t state;
+		uint8_t retries;
+		uint64_t sent_usec;
+	};
+
+	Generic_Port *port;
+	pthread_mutex_t lock;
+
+	bool started;
+	bool disable_unused;
+
+	int system_id;
+	int companion_id;
+	int target_system;
+	int target_component;
+
+	const char *consumers[MESSAGE_INTERVALS_MAX_CONSUMERS];
+	int num_consumers;
+
+	Interval intervals[MESSAGE_INTERVALS_MAX];
+	int num_intervals;
+	Interval *in_flight;
+
+	// link watch, read thread only
+	uint64_t last_heartbeat_usec;
+	uint32_t last_boot_ms;
+	uint64_t unknown_check_usec;
+	Link_Stats_Msgid link_msgids[LINK_STATS_MSGID_SLOTS + 1];
+
+	Message_Intervals_Stats stats;
+
+	void initialize_defaults();
+
+	Interval *_find(uint16_t msgid);
+	Interval *_add(uint16_t msgid);
+	void _update(Interval &interval);
+	void _switch_off(uint16_t msgid);
+	void _check_unknown();
+	void _reapply();
+	void _handle_ack(const Command_Ack_View &ack);
+	void _check_boot_time(uint32_t time_boot_ms);
+	void _send(Interval &interval);
+
+	static bool _is_stream(uint16_t msgid);
+};
+
+#endif // MESSAGE_INTERVALS_H_
@@ -0,0 +1,263 @@
+/**
+ * @file redundant_port.cpp
+ *
+ * @brief Redundant port functions
+ *
+ * Functions for delivering the first copy of each frame and choosing the
+ * link to write on
+ *
+ */
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include "redundant_port.h"
+
+#include <string.h>
+
+// ----------------------------------------------------------------------------------
+//   Redundant Port Class
+// ----------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+//   Con/De structors
+// ------------------------------------------------------------------------------
+Redundant_Port::
+Redundant_Port()
+{
+	initialize_defaults();
+}
+
+Redundant_Port::
+Redundant_Port(int depth_) : Link_Aggregator(depth_)
+{
+	initialize_defaults();
+}
+
+Redundant_Port::
+~Redundant_Port()
+{
+	// the link threads call into this object until they are joined
+	stop();
+}
+
+void
+Redundant_Port::
+initialize_defaults()
+{
+	// Initialize attributes
+	memset(seen, 0, sizeof(seen));
+	seen_head = 0;
+
+	critical_class = TX_CLASS_CONTROL;
+	scheduler = NULL;
+	primary = 0;
+	switches = 0;
+
+	memset(stats, 0, sizeof(stats));
+	for (int i = 0; i < LINK_AGGREGATOR_MAX_LINKS; i++)
+	{
+		char name[LATENCY_NAME_LEN];
+		snprintf(name, sizeof(name), "link %d", i);
+		lag[i].set_name(name);
+	}
+
+	window_frames = 0;
+	memset(window_missed, 0, sizeof(window_missed));
+	memset(window_copies, 0, sizeof(window_copies));
+	memset(window_lag_us, 0, sizeof(window_lag_us));
+}
+
+void
+Redundant_Port::
+set_critical_class(Tx_Class critical_class_)
+{
+	pthread_mutex_lock(&lock);
+	critical_class = critical_class_;
+	pthread_mutex_unlock(&lock);
+}
+
+// Before start()
+void
+Redundant_Port::
+set_scheduler(Tx_Scheduler *scheduler_)
+{
+	scheduler = scheduler_;
+}
+
+// ------------------------------------------------------------------------------
+//   Read
+// ------------------------------------------------------------------------------
+
+// Called by the link threads with the lock held
+bool
+Redundant_Port::
+_accept(Link_Reader &reader, const mavlink_message_t &message, uint32_t stamp)
+{
+	uint64_t key = ((uint64_t)message.sysid << 40) | ((uint64_t)message.compid << 32) |
+				   ((uint64_t)message.seq << 24) | message.msgid;
+	uint8_t bit = 1 << reader.index;
+
+	// newest first, a copy is rarely more than a few frames behind
+	for (int i = 1; i <= REDUNDANT_PORT_SEEN_DEPTH; i++)
+	{
+		Seen_Frame &frame = seen[(seen_head + REDUNDANT_PORT_SEEN_DEPTH - i) % REDUNDANT_PORT_SEEN_DEPTH];
+		if (!frame.links)
+			break;
+		if (frame.key != key)
+			continue;
+
+		stats[reader.index].duplicates++;
+		if (frame.links & bit)
+			return false;
+		frame.links |= bit;
+
+		// 0 when parsed before the queued copy, its thread took the lock later
+		uint32_t ns = (int32_t)(stamp - frame.stamp) > 0 ? latency_delta_ns(frame.stamp, stamp) : 0;
+		_record_lag(reader.index, ns);
+		return false;
+	}
+
+	// the oldest makes room, the links it never came in on missed it
+	Seen_Frame &frame = seen[seen_head];
+	if (frame.links)
+		_retire(frame);
+
+	frame.key = key;
+	frame.stamp = stamp;
+	frame.links = bit;
+	seen_head = (seen_head + 1) % REDUNDANT_PORT_SEEN_DEPTH;
+
+	stats[reader.index].first++;
+	_record_lag(reader.index, 0);
+	return true;
+}
+
+void
+Redundant_Port::
+_record_lag(int link, uint32_t ns)
+{
+	lag[link].record(ns);
+	window_copies[link]++;
+	window_lag_us[link] += ns / 1000;
+}
+
+void
+Redundant_Port::
+_retire(const Seen_Frame &frame)
+{
+	for (int i = 0; i < num_links; i++)
+	{
+		if (frame.links & (1 << i))
+			continue;
+		stats[i].missed++;
+		window_missed[i]++;
+	}
+
+	if (++window_frames < REDUNDANT_PORT_WINDOW)
+		return;
+
+	_choose_primary();
+
+	window_frames = 0;
+	memset(window_missed, 0, sizeof(window_missed));
+	memset(window_copies, 0, sizeof(window_copies));
+	memset(window_lag_us, 0, sizeof(window_lag_us));
+}
+
+void
+Redundant_Port::
+_choose_primary()
+{
+	uint64_t score[LINK_AGGREGATOR_MAX_LINKS];
+	for (int i = 0; i < num_links; i++)
+	{
+		score[i] = (uint64_t)window_missed[i] * REDUNDANT_PORT_MISS_COST_US;
+		if (window_copies[i])
+			score[i] += window_lag_us[i] / window_copies[i];
+	}
+
+	int best = primary;
+	for (int i = 0; i < num_links; i++)
+	{
+		if (score[i] < score[best])
+			best = i;
+	}
+
+	if (best != primary && score[best] + REDUNDANT_PORT_HYSTERESIS_US < score[primary])
+	{
+		primary = best;
+		switches++;
+	}
+}
+
+// ------------------------------------------------------------------------------
+//   Write
+// ------------------------------------------------------------------------------
+
+// The critical classes to every link, the rest to the primary
+int
+Redundant_Port::
+_route(uint32_t msgid, const uint8_t *, unsigned)
+{
+	Tx_Class tx_class = scheduler ? scheduler->classify(msgid) : Tx_Scheduler::class_of(msgid);
+
+	pthread_mutex_lock(&lock);
+	int link = tx_class <= critical_class ? -1 : primary;
+	pthread_mutex_unlock(&lock);
+	return link;
+}
+
+// ------------------------------------------------------------------------------
+//   Report
+// ------------------------------------------------------------------------------
+
+int
+Redundant_Port::
+get_primary()
+{
+	pthread_mutex_lock(&lock);
+	int copy = primary;
+	pthread_mutex_unlock(&lock);
+	return copy;
+}
+
+Redundant_Link_Stats
+Redundant_Port::
+get_redundant_stats(int index)
+{
+	pthread_mutex_lock(&lock);
+	Redundant_Link_Stats copy = stats[index];
+	pthread_mutex_unlock(&lock);
+	return copy;
+}
+
+void
+Redundant_Port::
+dump(FILE *out)
+{
+	Link_Aggregator::dump(out);
+
+	pthread_mutex_lock(&lock);
+	int primary_copy = primary;
+	uint32_t switches_copy = switches;
+	pthread_mutex_unlock(&lock);
+
+	fprintf(out, "REDUNDANT: primary link %d, %lu switches\n", primary_copy, (unsigned long)switches_copy);
+	fprintf(out, "%-4s %-24s %10s %10s %10s\n", "link", "name", "first", "duplicates", "missed");
+	for (int i = 0; i < num_links; i++)
+	{
+		Redundant_Link_Stats copy = get_redundant_stats(i);
+		fprintf(out, "%-4d %-24s %10lu %10lu %10lu\n", i, links[i].port->get_link_stats()->get_name(),
+				(unsigned long)copy.first, (unsigned long)copy.duplicates, (unsigned long)copy.missed);
+	}
+
+	char line[128];
+	fprintf(out, "%-24s %10s %14s %14s %14s %14s\n", "copy lag (us)", "count", "p50", "p99", "p99.9", "max");
+	for (int i = 0; i < num_links; i++)
+	{
+		lag[i].format(line, sizeof(line));
+		fputs(line, out);
+	}
+}
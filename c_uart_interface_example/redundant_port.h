@@ -0,0 +1,128 @@
+/**
+ * @file redundant_port.h
+ *
+ * @brief Redundant port definition
+ *
+ * A Link_Aggregator over links to the same vehicle, a telemetry radio and
+ * a UDP backhaul, that delivers each frame once from whichever link it
+ * came in on first and keeps writing on the link that has been first
+ * most, so losing one link costs nothing
+ *
+ */
+
+#ifndef REDUNDANT_PORT_H_
+#define REDUNDANT_PORT_H_
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "link_aggregator.h"
+#include "latency_histogram.h"
+#include "tx_scheduler.h"
+
+// ------------------------------------------------------------------------------
+//   Defines
+// ------------------------------------------------------------------------------
+
+// Frames remembered to recognize their copies from the other links; a copy
+// later than this many frames is delivered again
+#define REDUNDANT_PORT_SEEN_DEPTH 32
+
+// Frames the links are compared over before the primary is chosen again
+#define REDUNDANT_PORT_WINDOW 32
+
+// A frame a link missed counts as this much lag against it
+#define REDUNDANT_PORT_MISS_COST_US 10000
+
+// A link has to be this much better than the primary to take over
+#define REDUNDANT_PORT_HYSTERESIS_US 2000
+
+// ------------------------------------------------------------------------------
+//   Data Structures
+// ------------------------------------------------------------------------------
+
+struct Redundant_Link_Stats
+{
+	uint32_t first;			// delivered, no other link had it yet
+	uint32_t duplicates;	// a copy of one delivered, not delivered again
+	uint32_t missed;		// delivered from another link, never came on this one
+};
+
+// ----------------------------------------------------------------------------------
+//   Redundant Port Class
+// ----------------------------------------------------------------------------------
+/*
+ * Redundant Port Class
+ *
+ * A frame is known by (sysid, compid, seq, msgid).  The first copy read on
+ * any link is queued, the copies after it are dropped and their lag behind
+ * the first one recorded for their link.  A frame leaving the seen ring
+ * counts as missed on the links it never came in on.
+ *
+ * Every REDUNDANT_PORT_WINDOW frames each link is scored by its mean lag
+ * plus REDUNDANT_PORT_MISS_COST_US for each frame it missed, and the best
+ * becomes the primary when it beats the current one by the hysteresis.
+ * Messages of the critical classes (control by default, classed as the
+ * Tx_Scheduler classes them) are written on every link, the rest on the
+ * primary alone.
+ */
+class Redundant_Port : public Link_Aggregator
+{
+
+public:
+	Redundant_Port();
+	Redundant_Port(int depth_);
+	~Redundant_Port();
+
+	// messages of this class and the ones above it go on every link
+	void set_critical_class(Tx_Class critical_class_);
+
+	// messages are classed as this scheduler classes them, its set_class()
+	// overrides included, instead of by Tx_Scheduler::class_of()
+	void set_scheduler(Tx_Scheduler *scheduler_);
+
+	int get_primary();
+	Redundant_Link_Stats get_redundant_stats(int index);
+	void dump(FILE *out);
+
+protected:
+	bool _accept(Link_Reader &reader, const mavlink_message_t &message, uint32_t stamp);
+	int _route(uint32_t msgid, const uint8_t *payload, unsigned len);
+
+private:
+	struct Seen_Frame
+	{
+		uint64_t key;
+		uint32_t stamp;		// latency_stamp() of the first copy
+		uint8_t links;		// bit per link it came in on, 0 while free
+	};
+
+	Seen_Frame seen[REDUNDANT_PORT_SEEN_DEPTH];
+	int seen_head;
+
+	Tx_Class critical_class;
+	Tx_Scheduler *scheduler;
+	int primary;
+	uint32_t switches;
+
+	Redundant_Link_Stats stats[LINK_AGGREGATOR_MAX_LINKS];
+	Latency_Histogram lag[LINK_AGGREGATOR_MAX_LINKS];
+
+	// since the primary was last chosen, lag over the copies counted
+	int window_frames;
+	uint32_t window_missed[LINK_AGGREGATOR_MAX_LINKS];
+	uint32_t window_copies[LINK_AGGREGATOR_MAX_LINKS];
+	uint64_t window_lag_us[LINK_AGGREGATOR_MAX_LINKS];
+
+	void initialize_defaults();
+
+	void _record_lag(int link, uint32_t ns);
+	void _retire(const Seen_Frame &frame);
+	void _choose_primary();
+};
+
+#endif // REDUNDANT_PORT_H_
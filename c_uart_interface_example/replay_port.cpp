@@ -0,0 +1,416 @@
+/**
+ * @file replay_port.cpp
+ *
+ * @brief Replay interface functions
+ *
+ * Functions for playing back a recorded tlog as a port
+ *
+ */
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include "replay_port.h"
+
+#include <cstdlib>
+#include <string.h>
+#include <unistd.h>	// UNIX standard function definitions
+#include <fcntl.h>	// File control definitions
+#include <time.h>
+#include <sys/stat.h>
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+// ------------------------------------------------------------------------------
+//   Helpers
+// ------------------------------------------------------------------------------
+
+// Bytes in front of every frame in a tlog
+#define TLOG_TIMESTAMP_LEN 8
+
+static uint64_t
+_now_usec()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// ----------------------------------------------------------------------------------
+//   Replay Port Manager Class
+// ----------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+//   Con/De structors
+// ------------------------------------------------------------------------------
+Replay_Port::
+Replay_Port(const char *path_)
+{
+	initialize_defaults();
+	path = path_;
+}
+
+Replay_Port::
+Replay_Port(const char *path_, bool realtime_, int passes_)
+{
+	initialize_defaults();
+	path = path_;
+	realtime = realtime_;
+	passes = passes_;
+}
+
+Replay_Port::
+~Replay_Port()
+{
+	stop();
+
+	// destroy mutex
+	pthread_mutex_destroy(&lock);
+}
+
+void
+Replay_Port::
+initialize_defaults()
+{
+	// Initialize attributes
+	path = "flight.tlog";
+	realtime = false;
+	passes = 1;
+	fd = -1;
+	is_open = false;
+	finished = false;
+
+	memset(&rx_buffer, 0, sizeof(rx_buffer));
+	memset(&rx_status, 0, sizeof(rx_status));
+
+	data = NULL;
+	size = 0;
+	cursor = 0;
+	mapped = false;
+	chunk = NULL;
+
+	have_first = false;
+	first_log_usec = 0;
+	first_wall_usec = 0;
+
+	memset(&stats, 0, sizeof(stats));
+
+	// Start mutex
+	int result = pthread_mutex_init(&lock, NULL);
+	if ( result != 0 )
+	{
+		printf("\n mutex init failed\n");
+		throw 1;
+	}
+}
+
+// ------------------------------------------------------------------------------
+//   Open Log
+// ------------------------------------------------------------------------------
+/**
+ * throws EXIT_FAILURE if the log could not be opened
+ */
+void
+Replay_Port::
+start()
+{
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+	{
+		fprintf(stderr, "ERROR: could not open replay log %s\n", path);
+		throw EXIT_FAILURE;
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) < 0)
+	{
+		close(fd);
+		fd = -1;
+		throw EXIT_FAILURE;
+	}
+
+#if defined(__linux__)
+	// --------------------------------------------------------------------------
+	//   MAP THE WHOLE LOG
+	// --------------------------------------------------------------------------
+	if (st.st_size > 0)
+	{
+		void *m = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (m != MAP_FAILED)
+		{
+			madvise(m, st.st_size, MADV_SEQUENTIAL);
+			data = (const uint8_t *)m;
+			size = st.st_size;
+			mapped = true;
+		}
+	}
+#endif
+
+	// --------------------------------------------------------------------------
+	//   OR READ IT IN CHUNKS
+	// --------------------------------------------------------------------------
+	if (!mapped)
+	{
+		chunk = (uint8_t *)malloc(REPLAY_PORT_CHUNK);
+		if (chunk == NULL)
+		{
+			fprintf(stderr, "ERROR: could not allocate %d bytes of replay buffer\n", REPLAY_PORT_CHUNK);
+			close(fd);
+			fd = -1;
+			throw EXIT_FAILURE;
+		}
+		data = chunk;
+		size = 0;
+	}
+
+	cursor = 0;
+	finished = false;
+	have_first = false;
+	is_open = true;
+
+	printf("Replaying %s (%llu bytes, %s, %s)\n", path, (unsigned long long)st.st_size,
+		   mapped ? "mapped" : "buffered", realtime ? "real time" : "max speed");
+}
+
+// ------------------------------------------------------------------------------
+//   Close Log
+// ------------------------------------------------------------------------------
+void
+Replay_Port::
+stop()
+{
+	if (!is_open)
+		return;
+
+	is_open = false;
+
+#if defined(__linux__)
+	if (mapped)
+		munmap((void *)data, size);
+#endif
+	mapped = false;
+	free(chunk);
+	chunk = NULL;
+	data = NULL;
+
+	close(fd);
+	fd = -1;
+}
+
+// ------------------------------------------------------------------------------
+//   Stats
+// ------------------------------------------------------------------------------
+Replay_Port_Stats
+Replay_Port::
+get_stats()
+{
+	pthread_mutex_lock(&lock);
+	Replay_Port_Stats result = stats;
+	pthread_mutex_unlock(&lock);
+
+	return result;
+}
+
+// ------------------------------------------------------------------------------
+//   Read from Log
+// ------------------------------------------------------------------------------
+/*
+ * Plays back one tlog record.  Returns 1 with the message when the frame
+ * parsed, 0 when it did not or the log is exhausted.
+ */
+int
+Replay_Port::
+read_message(mavlink_message_t &message)
+{
+	if (!is_open || finished)
+		return 0;
+
+	// --------------------------------------------------------------------------
+	//   TIMESTAMP
+	// --------------------------------------------------------------------------
+	if (!_ensure(TLOG_TIMESTAMP_LEN + 1))
+	{
+		bool again = passes == 0 || (int)stats.loops + 1 < passes;
+		if (!again || !_rewind() || !_ensure(TLOG_TIMESTAMP_LEN + 1))
+		{
+			finished = true;
+			return 0;
+		}
+	}
+
+	uint64_t log_usec = 0;
+	for (int i = 0; i < TLOG_TIMESTAMP_LEN; i++)
+		log_usec = (log_usec << 8) | data[cursor + i];
+	cursor += TLOG_TIMESTAMP_LEN;
+
+	_pace(log_usec);
+
+	// --------------------------------------------------------------------------
+	//   PARSE FRAME
+	// --------------------------------------------------------------------------
+	uint64_t frame_start = cursor;
+	uint8_t result = MAVLINK_FRAMING_INCOMPLETE;
+	while (result == MAVLINK_FRAMING_INCOMPLETE && _ensure(1))
+	{
+		result = mavlink_frame_char_buffer(&rx_buffer, &rx_status, data[cursor], &message, NULL);
+		cursor++;
+	}
+
+	// no wire to time, but dispatch is measured from here
+	rx_frame_stamp = latency_stamp();
+
+	pthread_mutex_lock(&lock);
+	stats.frames++;
+	stats.bytes += TLOG_TIMESTAMP_LEN + (cursor - frame_start);
+	if (result == MAVLINK_FRAMING_OK)
+		stats.messages++;
+	else
+		stats.bad_frames++;
+	pthread_mutex_unlock(&lock);
+
+	// record what went through, same as the real ports
+	if (result == MAVLINK_FRAMING_OK && recorder)
+		recorder->record(message);
+
+	return result == MAVLINK_FRAMING_OK;
+}
+
+// ------------------------------------------------------------------------------
+//   Capture Writes
+// ------------------------------------------------------------------------------
+int
+Replay_Port::
+write_message(const mavlink_message_t &message)
+{
+	uint8_t buf[TLOG_TIMESTAMP_LEN + MAVLINK_MAX_PACKET_LEN];
+
+	// stamp captured frames with replay time so they line up with the log
+	uint64_t t = have_first ? first_log_usec + (_now_usec() - first_wall_usec) : 0;
+	for (int i = TLOG_TIMESTAMP_LEN - 1; i >= 0; i--)
+	{
+		buf[i] = (uint8_t)(t & 0xff);
+		t >>= 8;
+	}
+
+	unsigned len = mavlink_msg_to_send_buffer(&buf[TLOG_TIMESTAMP_LEN], &message);
+
+	pthread_mutex_lock(&lock);
+	writes.insert(writes.end(), buf, buf + TLOG_TIMESTAMP_LEN + len);
+	stats.writes++;
+	pthread_mutex_unlock(&lock);
+
+	if (recorder)
+		recorder->record(&buf[TLOG_TIMESTAMP_LEN], len);
+
+	return len;
+}
+
+/*
+ * Saves the captured writes as a tlog, returns the bytes written or -1.
+ */
+int
+Replay_Port::
+save_writes(const char *path_)
+{
+	int out = open(path_, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+	if (out < 0)
+	{
+		fprintf(stderr, "ERROR: could not open %s\n", path_);
+		return -1;
+	}
+
+	pthread_mutex_lock(&lock);
+	int written = 0;
+	int total = writes.size();
+	while (written < total)
+	{
+		int result = write(out, &writes[written], total - written);
+		if (result <= 0)
+			break;
+		written += result;
+	}
+	pthread_mutex_unlock(&lock);
+
+	close(out);
+	return written == total ? written : -1;
+}
+
+// ------------------------------------------------------------------------------
+//   Log Access
+// ------------------------------------------------------------------------------
+/*
+ * Makes sure len bytes are available at the cursor.  A mapped log always
+ * has them until its end; a buffered log slides its chunk forward.
+ */
+bool
+Replay_Port::
+_ensure(uint64_t len)
+{
+	if (cursor + len <= size)
+		return true;
+	if (mapped)
+		return false;
+
+	// keep the unread tail and fill up behind it
+	uint64_t rest = size - cursor;
+	memmove(chunk, chunk + cursor, rest);
+	cursor = 0;
+	size = rest;
+
+	while (size < len)
+	{
+		int result = read(fd, chunk + size, REPLAY_PORT_CHUNK - size);
+		if (result <= 0)
+			return false;
+		size += result;
+	}
+
+	return true;
+}
+
+bool
+Replay_Port::
+_rewind()
+{
+	if (!mapped)
+	{
+		if (lseek(fd, 0, SEEK_SET) < 0)
+			return false;
+		size = 0;
+	}
+	cursor = 0;
+
+	// timestamps restart with the log
+	have_first = false;
+	memset(&rx_status, 0, sizeof(rx_status));
+
+	pthread_mutex_lock(&lock);
+	stats.loops++;
+	pthread_mutex_unlock(&lock);
+
+	return true;
+}
+
+void
+Replay_Port::
+_pace(uint64_t log_usec)
+{
+	uint64_t now = _now_usec();
+	if (!have_first)
+	{
+		first_log_usec = log_usec;
+		first_wall_usec = now;
+		have_first = true;
+		return;
+	}
+
+	if (!realtime)
+		return;
+
+	// wait until as much time has passed as in the recording
+	uint64_t due = first_wall_usec + (log_usec - first_log_usec);
+	if (log_usec > first_log_usec && due > now)
+		usleep(due - now);
+}
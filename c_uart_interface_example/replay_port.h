@@ -0,0 +1,119 @@
+/**
+ * @file replay_port.h
+ *
+ * @brief Replay interface definition
+ *
+ * Generic_Port that plays back a recorded tlog
+ *
+ */
+
+#ifndef REPLAY_PORT_H_
+#define REPLAY_PORT_H_
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pthread.h> // This uses POSIX Threads
+#include <vector>
+
+#include "../include/mavlink/v2.0/spresense/mavlink.h"
+
+#include "generic_port.h"
+
+// ------------------------------------------------------------------------------
+//   Defines
+// ------------------------------------------------------------------------------
+
+// Read size when the log cannot be memory mapped
+#define REPLAY_PORT_CHUNK 4096
+
+// ------------------------------------------------------------------------------
+//   Data Structures
+// ------------------------------------------------------------------------------
+
+struct Replay_Port_Stats
+{
+	uint32_t frames;	 // records taken from the log
+	uint32_t messages;	 // frames that parsed with a good crc
+	uint32_t bad_frames; // frames the parser rejected (unknown id, bad crc)
+	uint32_t loops;		 // times the log was restarted
+	uint64_t bytes;
+	uint32_t writes;	 // frames captured from write_message()
+};
+
+// ----------------------------------------------------------------------------------
+//   Replay Port Manager Class
+// ----------------------------------------------------------------------------------
+/*
+ * Replay Port Class
+ *
+ * Feeds the frames of a tlog through the MAVLink parser one record per
+ * read_message() call, either paced by the recorded timestamps or as fast
+ * as the reader can take them.  The log is memory mapped where mmap is
+ * available and read in chunks otherwise.  Frames passed to write_message()
+ * are kept in memory and can be saved as a tlog for comparison with a
+ * reference run.  is_running() turns false once the log has been played
+ * the requested number of times.
+ */
+class Replay_Port : public Generic_Port
+{
+
+public:
+	Replay_Port(const char *path_);
+	Replay_Port(const char *path_, bool realtime_, int passes_);
+	virtual ~Replay_Port();
+
+	int read_message(mavlink_message_t &message);
+	int write_message(const mavlink_message_t &message);
+
+	bool is_running()
+	{
+		return is_open && !finished;
+	}
+	void start();
+	void stop();
+
+	Replay_Port_Stats get_stats();
+	int save_writes(const char *path_);
+
+private:
+	const char *path;
+	bool realtime;
+	int passes; // times to play the log, 0 for forever
+	int fd;
+	bool is_open;
+	bool finished;
+
+	// parser state of our own, so replay does not share a channel with a port
+	mavlink_message_t rx_buffer;
+	mavlink_status_t rx_status;
+
+	// log contents, either the whole mapping or a sliding chunk
+	const uint8_t *data;
+	uint64_t size;	  // bytes valid in data
+	uint64_t cursor;  // read position in data
+	bool mapped;
+	uint8_t *chunk;
+
+	// pacing, log time of the first record against the clock
+	bool have_first;
+	uint64_t first_log_usec;
+	uint64_t first_wall_usec;
+
+	// captured writes, serialized frames with their tlog timestamps
+	pthread_mutex_t lock;
+	std::vector<uint8_t> writes;
+
+	Replay_Port_Stats stats;
+
+	void initialize_defaults();
+
+	bool _ensure(uint64_t len);
+	bool _rewind();
+	void _pace(uint64_t log_usec);
+};
+
+#endif // REPLAY_PORT_H_
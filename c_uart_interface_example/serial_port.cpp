@@ -53,6 +53,15 @@
 // ------------------------------------------------------------------------------
 
 #include "serial_port.h"
+#include "../include/mavlink/v2.0/spresense/mavlink_views.h"
+
+#include <string.h>
+#include <time.h>
+#include <poll.h>
+#if defined(SERIAL_TERMIOS2)
+#include <sys/ioctl.h>
+#include <linux/serial.h>
+#endif
 
 
 // ----------------------------------------------------------------------------------
@@ -68,6 +77,7 @@ Serial_Port(const char *uart_name_ , int baudrate_)
 	initialize_defaults();
 	uart_name = uart_name_;
 	baudrate  = baudrate_;
+	link_stats.set_name(uart_name);
 }
 
 Serial_Port::
@@ -79,7 +89,11 @@ Serial_Port()
 Serial_Port::
 ~Serial_Port()
 {
+	link_stats_unregister(&link_stats);
+	mavlink_channel_free(rx_chan);
+
 	// destroy mutex
+	pthread_mutex_destroy(&read_lock);
 	pthread_mutex_destroy(&lock);
 }
 
@@ -94,9 +108,25 @@ initialize_defaults()
 
 	uart_name = (char*)"/dev/ttyUSB0";
 	baudrate  = 57600;
+	effective_baudrate = 0;
+
+	profile = *find_profile("default");
+	rx_len = 0;
+	rx_pos = 0;
+
+	// a parser of its own, other ports parse on other channels
+	rx_chan = mavlink_channel_alloc("serial");
+	if (rx_chan == MAVLINK_CHANNEL_NONE)
+	{
+		printf("\n no free MAVLink channel, %d in use\n", mavlink_channel_in_use());
+		throw 1;
+	}
 
-	// Start mutex
+	// Start mutex, reads have their own so a read waiting for bytes never
+	// holds up a write
 	int result = pthread_mutex_init(&lock, NULL);
+	if ( result == 0 )
+		result = pthread_mutex_init(&read_lock, NULL);
 	if ( result != 0 )
 	{
 		printf("\n mutex init failed\n");
@@ -104,6 +134,74 @@ initialize_defaults()
 	}
 }
 
+// ------------------------------------------------------------------------------
+//   Latency Profiles
+// ------------------------------------------------------------------------------
+
+static const Serial_Profile serial_profiles[] =
+{
+	// as the port always was: a byte per read(), every write drained
+	{"default",     false, 1, 10, false, 1, true},
+
+	// whatever has arrived in one read(), writes left to the driver
+	{"low_latency", true, 1, 0, true, MAVLINK_MAX_PACKET_LEN, false},
+
+	// a frame header or more per read(), fewer wakeups under load
+	{"throughput",  true, MAVLINK_NUM_NON_PAYLOAD_BYTES, 1, false, SERIAL_RX_BUFFER_MAX, false},
+};
+
+#define SERIAL_NUM_PROFILES (int)(sizeof(serial_profiles) / sizeof(serial_profiles[0]))
+
+const Serial_Profile *
+Serial_Port::
+find_profile(const char *name)
+{
+	for (int i = 0; i < SERIAL_NUM_PROFILES; i++)
+	{
+		if (strcmp(serial_profiles[i].name, name) == 0)
+			return &serial_profiles[i];
+	}
+	return NULL;
+}
+
+void
+Serial_Port::
+list_profiles(FILE *out)
+{
+	fprintf(out, "%-12s %7s %5s %6s %11s %10s %6s\n",
+			"profile", "rtscts", "vmin", "vtime", "low latency", "rx buffer", "drain");
+	for (int i = 0; i < SERIAL_NUM_PROFILES; i++)
+	{
+		const Serial_Profile &p = serial_profiles[i];
+		fprintf(out, "%-12s %7s %5d %6d %11s %10d %6s\n", p.name,
+				p.flow_control ? "yes" : "no", p.vmin, p.vtime,
+				p.low_latency ? "yes" : "no", p.rx_buffer, p.drain ? "yes" : "no");
+	}
+}
+
+// Before start(), returns false for a name not in the table
+bool
+Serial_Port::
+set_profile(const char *name)
+{
+	const Serial_Profile *found = find_profile(name);
+	if (!found)
+		return false;
+	set_profile(*found);
+	return true;
+}
+
+void
+Serial_Port::
+set_profile(const Serial_Profile &profile_)
+{
+	profile = profile_;
+	if (profile.rx_buffer < 1)
+		profile.rx_buffer = 1;
+	if (profile.rx_buffer > SERIAL_RX_BUFFER_MAX)
+		profile.rx_buffer = SERIAL_RX_BUFFER_MAX;
+}
+
 
 // ------------------------------------------------------------------------------
 //   Read from Serial
@@ -120,17 +218,48 @@ read_message(mavlink_message_t &message)
 	//   READ FROM PORT
 	// --------------------------------------------------------------------------
 
-	// this function locks the port during read
-	int result = _read_port(cp);
+	// only once the bytes of the last read are parsed, locks the port
+	if (rx_pos == rx_len)
+	{
+		int result = _read_port(rx_buf, profile.rx_buffer);
+
+		// Couldn't read from port
+		if (result < 0)
+		{
+			link_stats.read_error();
+			fprintf(stderr, "ERROR: Could not read from fd %d\n", fd);
+			return 0;
+		}
+
+		// VTIME ran out with nothing in
+		if (result == 0)
+			return 0;
 
+		link_stats.rx_bytes(result);
+		rx_len = result;
+		rx_pos = 0;
+	}
 
 	// --------------------------------------------------------------------------
 	//   PARSE MESSAGE
 	// --------------------------------------------------------------------------
-	if (result > 0)
+	// up to the end of the first frame, the rest waits for the next call
+	while (!msgReceived && rx_pos < rx_len)
 	{
+		cp = rx_buf[rx_pos++];
+
+		// a frame starts with the byte read while the parser is idle
+		uint32_t stamp = latency_stamp();
+		if (mavlink_get_channel_status(rx_chan)->parse_state <= MAVLINK_PARSE_STATE_IDLE)
+			rx_start_stamp = stamp;
+
 		// the parsing
-		msgReceived = mavlink_parse_char(MAVLINK_COMM_1, cp, &message, &status);
+		msgReceived = link_stats_parse_char(link_stats, rx_chan, cp, &message, &status);
+		if (msgReceived)
+		{
+			rx_frame_stamp = latency_stamp();
+			latency_histogram(LATENCY_RX_FRAME).record_between(rx_start_stamp, rx_frame_stamp);
+		}
 
 		// check for dropped packets
 		if ( (lastStatus.packet_rx_drop_count != status.packet_rx_drop_count) && debug )
@@ -140,12 +269,18 @@ read_message(mavlink_message_t &message)
 			fprintf(stderr,"%02x ", v);
 		}
 		lastStatus = status;
-	}
 
-	// Couldn't read from port
-	else
-	{
-		fprintf(stderr, "ERROR: Could not read from fd %d\n", fd);
+		// drop frames that fail the signature or replay check
+		Mavlink_Signing *signer = signing.load();
+		if (msgReceived && signer && !signer->verify(message))
+		{
+			link_stats.signature_error();
+			msgReceived = false;
+		}
+
+		// record the validated frame, costs one copy into the ring
+		if (msgReceived && recorder)
+			recorder->record(message);
 	}
 
 	// --------------------------------------------------------------------------
@@ -192,13 +327,41 @@ int
 Serial_Port::
 write_message(const mavlink_message_t &message)
 {
-	char buf[300];
+	uint8_t buf[FRAME_ENCODER_BUFFER_LEN];
+	uint32_t start = latency_stamp();
 
 	// Translate message to buffer
-	unsigned len = mavlink_msg_to_send_buffer((uint8_t*)buf, &message);
+	unsigned len = mavlink_msg_to_send_buffer(buf, &message);
+
+	return _send_frame(buf, len, start);
+}
+
+// already serialized by frame_encode(), no copy on the way
+int
+Serial_Port::
+write_frame(uint8_t *frame, unsigned len)
+{
+	return _send_frame(frame, len, latency_stamp());
+}
+
+int
+Serial_Port::
+_send_frame(uint8_t *frame, unsigned len, uint32_t start)
+{
+	// sign in place, adds the 13 byte signature block
+	Mavlink_Signing *signer = signing.load();
+	if (signer)
+		len = signer->sign(frame, len);
 
 	// Write buffer to serial port, locks port while writing
-	int bytesWritten = _write_port(buf,len);
+	int bytesWritten = _write_port((char*)frame,len);
+	latency_histogram(LATENCY_ENCODE_WRITE).record_since(start);
+	if (bytesWritten > 0)
+		link_stats.tx_frame(frame_msgid(frame), bytesWritten);
+	else
+		link_stats.write_error();
+	if (bytesWritten > 0 && recorder)
+		recorder->record(frame, len);
 
 	return bytesWritten;
 }
@@ -232,7 +395,9 @@ start()
 	// --------------------------------------------------------------------------
 	//   SETUP PORT
 	// --------------------------------------------------------------------------
-	bool success = _setup_port(baudrate, 8, 1, false, false);
+	bool success = _setup_port(baudrate, 8, 1, false, profile.flow_control);
+	if (success)
+		_set_low_latency(profile.low_latency);
 
 	// --------------------------------------------------------------------------
 	//   CHECK STATUS
@@ -251,11 +416,18 @@ start()
 	// --------------------------------------------------------------------------
 	//   CONNECTED!
 	// --------------------------------------------------------------------------
-	printf("Connected to %s with %d baud, 8 data bits, no parity, 1 stop bit (8N1)\n", uart_name, baudrate);
+	printf("Connected to %s with %d baud (%d effective), 8 data bits, no parity, 1 stop bit (8N1)\n",
+		   uart_name, baudrate, effective_baudrate);
+	printf("Latency profile %s: %s, VMIN %d, VTIME %d, %d byte reads%s\n", profile.name,
+		   profile.flow_control ? "RTS/CTS" : "no flow control", profile.vmin, profile.vtime,
+		   profile.rx_buffer, profile.drain ? ", drained writes" : "");
 	lastStatus.packet_rx_drop_count = 0;
 
 	is_open = true;
 
+	// visible in /proc/mavlink from now on
+	link_stats_register(&link_stats);
+
 	printf("\n");
 
 	return;
@@ -373,80 +545,34 @@ _setup_port(int baud, int data_bits, int stop_bits, bool parity, bool hardware_c
 	config.c_cflag &= ~(CSIZE | PARENB);
 	config.c_cflag |= CS8;
 
-	// One input byte is enough to return from read()
-	// Inter-character timer off
-	config.c_cc[VMIN]  = 1;
-	config.c_cc[VTIME] = 10; // was 0
+	// Hardware flow control, the CXD56 UART2 driver has RTS/CTS built in
+#ifdef CRTSCTS
+	if (hardware_control)
+		config.c_cflag |= CRTSCTS;
+	else
+		config.c_cflag &= ~CRTSCTS;
+#else
+	if (hardware_control)
+	{
+		fprintf(stderr, "\nERROR: no RTS/CTS flow control on this system\n");
+		return false;
+	}
+#endif
+
+	// When read() returns, from the latency profile
+	config.c_cc[VMIN]  = profile.vmin;
+	config.c_cc[VTIME] = profile.vtime;
 
 	// Get the current options for the port
 	////struct termios options;
 	////tcgetattr(fd, &options);
 
-	// Apply baudrate
-	switch (baud)
+	// Apply baudrate, any rate the driver takes, checked below
+	bool custom = false;
+	if (!_set_speed(config, baud, custom))
 	{
-		case 1200:
-			if (cfsetispeed(&config, B1200) < 0 || cfsetospeed(&config, B1200) < 0)
-			{
-				fprintf(stderr, "\nERROR: Could not set desired baud rate of %d Baud\n", baud);
-				return false;
-			}
-			break;
-		case 1800:
-			cfsetispeed(&config, B1800);
-			cfsetospeed(&config, B1800);
-			break;
-		case 9600:
-			cfsetispeed(&config, B9600);
-			cfsetospeed(&config, B9600);
-			break;
-		case 19200:
-			cfsetispeed(&config, B19200);
-			cfsetospeed(&config, B19200);
-			break;
-		case 38400:
-			if (cfsetispeed(&config, B38400) < 0 || cfsetospeed(&config, B38400) < 0)
-			{
-				fprintf(stderr, "\nERROR: Could not set desired baud rate of %d Baud\n", baud);
-				return false;
-			}
-			break;
-		case 57600:
-			if (cfsetispeed(&config, B57600) < 0 || cfsetospeed(&config, B57600) < 0)
-			{
-				fprintf(stderr, "\nERROR: Could not set desired baud rate of %d Baud\n", baud);
-				return false;
-			}
-			break;
-		case 115200:
-			if (cfsetispeed(&config, B115200) < 0 || cfsetospeed(&config, B115200) < 0)
-			{
-				fprintf(stderr, "\nERROR: Could not set desired baud rate of %d Baud\n", baud);
-				return false;
-			}
-			break;
-
-		// These two non-standard (by the 70'ties ) rates are fully supported on
-		// current Debian and Mac OS versions (tested since 2010).
-		case 460800:
-			if (cfsetispeed(&config, B460800) < 0 || cfsetospeed(&config, B460800) < 0)
-			{
-				fprintf(stderr, "\nERROR: Could not set desired baud rate of %d Baud\n", baud);
-				return false;
-			}
-			break;
-		case 921600:
-			if (cfsetispeed(&config, B921600) < 0 || cfsetospeed(&config, B921600) < 0)
-			{
-				fprintf(stderr, "\nERROR: Could not set desired baud rate of %d Baud\n", baud);
-				return false;
-			}
-			break;
-		default:
-			fprintf(stderr, "ERROR: Desired baud rate %d could not be set, aborting.\n", baud);
-			return false;
-
-			break;
+		fprintf(stderr, "\nERROR: Could not set desired baud rate of %d Baud\n", baud);
+		return false;
 	}
 
 	// Finally, apply the configuration
@@ -456,27 +582,350 @@ _setup_port(int baud, int data_bits, int stop_bits, bool parity, bool hardware_c
 		return false;
 	}
 
+	// flushed with the kernel buffers, bytes at the old settings
+	rx_len = 0;
+	rx_pos = 0;
+
+	// Rates without a Bxxx constant go through termios2 on Linux
+	if (custom && !_set_custom_speed(baud))
+	{
+		fprintf(stderr, "ERROR: Desired baud rate %d could not be set, aborting.\n", baud);
+		return false;
+	}
+
+	// What the driver made of it
+	int effective = _get_speed();
+	if (effective > 0 && !_speed_matches(baud, effective))
+	{
+		fprintf(stderr, "ERROR: Asked for %d baud, the port runs at %d, aborting.\n", baud, effective);
+		return false;
+	}
+	effective_baudrate = effective > 0 ? effective : baud;
+
 	// Done!
 	return true;
 }
 
 
 
+// ------------------------------------------------------------------------------
+//   Baud Rate
+// ------------------------------------------------------------------------------
+
+// The rates with a Bxxx constant
+static const struct
+{
+	int baud;
+	speed_t code;
+} serial_speeds[] =
+{
+	{1200, B1200}, {1800, B1800}, {2400, B2400}, {4800, B4800},
+	{9600, B9600}, {19200, B19200}, {38400, B38400}, {57600, B57600},
+	{115200, B115200}, {230400, B230400}, {460800, B460800}, {921600, B921600},
+#ifdef B1000000
+	{1000000, B1000000},
+#endif
+#ifdef B1500000
+	{1500000, B1500000},
+#endif
+#ifdef B2000000
+	{2000000, B2000000},
+#endif
+#ifdef B3000000
+	{3000000, B3000000},
+#endif
+};
+
+#define SERIAL_NUM_SPEEDS (int)(sizeof(serial_speeds) / sizeof(serial_speeds[0]))
+
+/*
+ * Puts the rate in config.  A rate without a constant is given as the
+ * number on NuttX, whose cfsetspeed() takes any rate and the CXD56 driver
+ * programs its divisor from it; on Linux custom is set and the rate goes
+ * in afterwards with termios2.  Elsewhere only the constants work.
+ */
+bool
+Serial_Port::
+_set_speed(struct termios &config, int baud, bool &custom)
+{
+	custom = false;
+
+	for (int i = 0; i < SERIAL_NUM_SPEEDS; i++)
+	{
+		if (serial_speeds[i].baud == baud)
+			return cfsetispeed(&config, serial_speeds[i].code) == 0 &&
+				   cfsetospeed(&config, serial_speeds[i].code) == 0;
+	}
+
+#if defined(__NuttX__)
+	return cfsetspeed(&config, (speed_t)baud) == 0;
+#elif defined(SERIAL_TERMIOS2)
+	// placeholder until termios2 overrides it
+	custom = true;
+	return cfsetispeed(&config, B38400) == 0 && cfsetospeed(&config, B38400) == 0;
+#else
+	return false;
+#endif
+}
+
+bool
+Serial_Port::
+_set_custom_speed(int baud)
+{
+#if defined(SERIAL_TERMIOS2)
+	struct serial_termios2 config2;
+	if (ioctl(fd, SERIAL_TCGETS2, &config2) < 0)
+		return false;
+
+	config2.c_cflag &= ~CBAUD;
+	config2.c_cflag |= BOTHER;
+	config2.c_ispeed = baud;
+	config2.c_ospeed = baud;
+	return ioctl(fd, SERIAL_TCSETS2, &config2) == 0;
+#else
+	(void)baud;
+	return false;
+#endif
+}
+
+/*
+ * The output rate the port is set to, read back from the driver, or -1 if
+ * it cannot say.
+ */
+int
+Serial_Port::
+_get_speed()
+{
+#if defined(SERIAL_TERMIOS2)
+	struct serial_termios2 config2;
+	if (ioctl(fd, SERIAL_TCGETS2, &config2) == 0 && (config2.c_cflag & CBAUD) == BOTHER)
+		return config2.c_ospeed;
+#endif
+
+	struct termios config;
+	if (tcgetattr(fd, &config) < 0)
+		return -1;
+	speed_t speed = cfgetospeed(&config);
+
+	for (int i = 0; i < SERIAL_NUM_SPEEDS; i++)
+	{
+		if (serial_speeds[i].code == speed)
+			return serial_speeds[i].baud;
+	}
+
+	// NuttX and the BSDs keep the plain number
+	return speed > 0 ? (int)speed : -1;
+}
+
+// A UART is fine within 2% of the rate asked for
+bool
+Serial_Port::
+_speed_matches(int baud, int effective)
+{
+	int diff = baud > effective ? baud - effective : effective - baud;
+	return diff * 50 <= baud;
+}
+
+int
+Serial_Port::
+get_baudrate()
+{
+	return effective_baudrate;
+}
+
+// ------------------------------------------------------------------------------
+//   Baud Rate Negotiation
+// ------------------------------------------------------------------------------
+/*
+ * Waits for a frame, any with msgid < 0, using poll() so the wait ends
+ * even when nothing arrives at all.  Before the read thread runs only.
+ */
+bool
+Serial_Port::
+_wait_message(int msgid, int timeout_ms, mavlink_message_t &message)
+{
+	uint64_t deadline = _now_msec() + timeout_ms;
+
+	while (1)
+	{
+		int64_t left = (int64_t)(deadline - _now_msec());
+		if (left <= 0)
+			return false;
+
+		// bytes of the last read still to parse
+		if (rx_pos < rx_len)
+		{
+			if (read_message(message) && (msgid < 0 || (int)message.msgid == msgid))
+				return true;
+			continue;
+		}
+
+		struct pollfd pfd;
+		pfd.fd = fd;
+		pfd.events = POLLIN;
+		pfd.revents = 0;
+		if (poll(&pfd, 1, (int)left) <= 0)
+			continue;
+
+		if (read_message(message) && (msgid < 0 || (int)message.msgid == msgid))
+			return true;
+	}
+}
+
+uint64_t
+Serial_Port::
+_now_msec()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/*
+ * Steps the link up from the rate it was opened at.  Once the autopilot is
+ * heard, the baud parameter of its port is set and echoed back, then this
+ * end switches and waits for a frame at the new rate; without one it goes
+ * back to the old rate, so a failed attempt leaves the link as it was.
+ *
+ * ArduPilot SERIALn_BAUD holds the rate in kbaud (921 for 921600, 1500
+ * for 1.5M) as a plain float; other names, PX4's SER_TEL1_BAUD and the
+ * like, get the rate itself as a bytewise int32.  An autopilot that only
+ * applies the parameter after a reboot fails the check and the link stays
+ * at the old rate until then.
+ *
+ * The PARAM_SET goes out as system_id / companion_id, the ids the caller's
+ * other senders use; a system_id of 0, not learned yet, takes the one of
+ * the autopilot heard, as Autopilot_Interface does.
+ *
+ * Returns true if the link now runs at baud.
+ */
+bool
+Serial_Port::
+negotiate_baudrate(int baud, const char *param, int system_id, int companion_id)
+{
+	int old_baud = baudrate;
+	mavlink_message_t message;
+
+	if (baud == old_baud)
+		return true;
+
+	printf("NEGOTIATE %d BAUD\n", baud);
+
+	// --------------------------------------------------------------------------
+	//   HEAR THE AUTOPILOT
+	// --------------------------------------------------------------------------
+	if (!_wait_message(MAVLINK_MSG_ID_HEARTBEAT, SERIAL_NEGOTIATE_TIMEOUT_MS, message))
+	{
+		fprintf(stderr, "WARNING: no heartbeat at %d baud, staying there\n", old_baud);
+		return false;
+	}
+	uint8_t target_system = message.sysid;
+	uint8_t target_component = message.compid;
+
+	// --------------------------------------------------------------------------
+	//   SET ITS BAUD PARAMETER
+	// --------------------------------------------------------------------------
+	mavlink_param_set_t set;
+	memset(&set, 0, sizeof(set));
+	set.target_system = target_system;
+	set.target_component = target_component;
+	strncpy(set.param_id, param, sizeof(set.param_id));
+	set.param_type = MAV_PARAM_TYPE_INT32;
+	if (strncmp(param, "SERIAL", 6) == 0)
+	{
+		set.param_value = (float)(baud / 1000);
+	}
+	else
+	{
+		int32_t value = baud;
+		memcpy(&set.param_value, &value, sizeof(value));
+	}
+
+	if (system_id == 0)
+		system_id = target_system;
+	mavlink_msg_param_set_encode(system_id, companion_id, &message, &set);
+	write_message(message);
+
+	bool echoed = false;
+	uint64_t deadline = _now_msec() + SERIAL_NEGOTIATE_TIMEOUT_MS;
+	while (!echoed && _now_msec() < deadline)
+	{
+		if (!_wait_message(MAVLINK_MSG_ID_PARAM_VALUE, (int)(deadline - _now_msec()), message))
+			break;
+		echoed = strncmp(Param_Value_View(message).param_id(), set.param_id, sizeof(set.param_id)) == 0;
+	}
+	if (!echoed)
+	{
+		fprintf(stderr, "WARNING: %s not acknowledged, staying at %d baud\n", param, old_baud);
+		return false;
+	}
+
+	// --------------------------------------------------------------------------
+	//   SWITCH, AND CHECK THE LINK STILL WORKS
+	// --------------------------------------------------------------------------
+	if (_setup_port(baud, 8, 1, false, profile.flow_control) &&
+		_wait_message(-1, SERIAL_NEGOTIATE_CONFIRM_MS, message))
+	{
+		baudrate = baud;
+		printf("Now at %d baud (%d effective)\n", baud, effective_baudrate);
+		return true;
+	}
+
+	fprintf(stderr, "WARNING: nothing heard at %d baud, back to %d\n", baud, old_baud);
+	_setup_port(old_baud, 8, 1, false, profile.flow_control);
+	return false;
+}
+
+// ------------------------------------------------------------------------------
+//   Helper Function - Low Latency
+// ------------------------------------------------------------------------------
+/*
+ * Linux 8250/16550 drivers and most USB serial ones pass bytes up as they
+ * arrive instead of in timer ticks.  NuttX has no such flag, the CXD56
+ * driver hands bytes on from its receive interrupt already.
+ */
+void
+Serial_Port::
+_set_low_latency(bool on)
+{
+#if defined(SERIAL_TERMIOS2)
+	struct serial_struct serial;
+	if (ioctl(fd, TIOCGSERIAL, &serial) < 0)
+	{
+		if (on)
+			fprintf(stderr, "WARNING: %s has no low latency mode\n", uart_name);
+		return;
+	}
+
+	if (on)
+		serial.flags |= ASYNC_LOW_LATENCY;
+	else
+		serial.flags &= ~ASYNC_LOW_LATENCY;
+
+	if (ioctl(fd, TIOCSSERIAL, &serial) < 0 && on)
+		fprintf(stderr, "WARNING: could not set low latency on %s\n", uart_name);
+#else
+	(void)on;
+#endif
+}
+
 // ------------------------------------------------------------------------------
 //   Read Port with Lock
 // ------------------------------------------------------------------------------
 int
 Serial_Port::
-_read_port(uint8_t &cp)
+_read_port(uint8_t *buf, int len)
 {
 
-	// Lock
-	pthread_mutex_lock(&lock);
+	// Lock, timing the wait
+	uint32_t wait = latency_stamp();
+	pthread_mutex_lock(&read_lock);
+	latency_histogram(LATENCY_LOCK_WAIT).record_since(wait);
 
-	int result = read(fd, &cp, 1);
+	int result = read(fd, buf, len);
 
 	// Unlock
-	pthread_mutex_unlock(&lock);
+	pthread_mutex_unlock(&read_lock);
 
 	return result;
 }
@@ -490,14 +939,17 @@ Serial_Port::
 _write_port(char *buf, unsigned len)
 {
 
-	// Lock
+	// Lock, timing the wait
+	uint32_t wait = latency_stamp();
 	pthread_mutex_lock(&lock);
+	latency_histogram(LATENCY_LOCK_WAIT).record_since(wait);
 
 	// Write packet via serial link
 	const int bytesWritten = static_cast<int>(write(fd, buf, len));
 
 	// Wait until all data has been written
-	tcdrain(fd);
+	if (profile.drain)
+		tcdrain(fd);
 
 	// Unlock
 	pthread_mutex_unlock(&lock);
@@ -62,9 +62,10 @@
 #include <pthread.h> // This uses POSIX Threads
 #include <signal.h>
 
-#include "../include/mavlink/v2.0/common/mavlink.h"
+#include "../include/mavlink/v2.0/spresense/mavlink.h"
 
 #include "generic_port.h"
+#include "mavlink_channel.h"
 
 // ------------------------------------------------------------------------------
 //   Defines
@@ -80,6 +81,64 @@
 #define B921600 921600
 #endif
 
+// Linux takes any rate through termios2 and BOTHER, declared here because
+// <asm/termbits.h> clashes with <termios.h>
+#if defined(__linux__) && !defined(__NuttX__)
+#define SERIAL_TERMIOS2
+
+#define SERIAL_KERNEL_NCCS 19
+
+struct serial_termios2
+{
+	tcflag_t c_iflag;
+	tcflag_t c_oflag;
+	tcflag_t c_cflag;
+	tcflag_t c_lflag;
+	cc_t c_line;
+	cc_t c_cc[SERIAL_KERNEL_NCCS];
+	speed_t c_ispeed;
+	speed_t c_ospeed;
+};
+
+#define SERIAL_TCGETS2 _IOR('T', 0x2A, struct serial_termios2)
+#define SERIAL_TCSETS2 _IOW('T', 0x2B, struct serial_termios2)
+
+#ifndef BOTHER
+#define BOTHER 0010000
+#endif
+#endif
+
+// Waiting for the autopilot and for its parameter echo while negotiating
+#define SERIAL_NEGOTIATE_TIMEOUT_MS 3000
+
+// Waiting for a frame at the new rate, a bit over two heartbeats
+#define SERIAL_NEGOTIATE_CONFIRM_MS 2500
+
+// ArduPilot TELEM1, the port a companion computer usually sits on
+#define SERIAL_NEGOTIATE_DEFAULT_PARAM "SERIAL1_BAUD"
+
+// Most bytes one read() may take, the rx_buffer of a profile is capped to it
+#define SERIAL_RX_BUFFER_MAX 512
+
+// ------------------------------------------------------------------------------
+//   Latency Profiles
+// ------------------------------------------------------------------------------
+/*
+ * How the port trades latency against system calls.  VMIN and VTIME are
+ * the termios ones: read() returns once vmin bytes are in, or vtime tenths
+ * of a second after the last byte when some are.
+ */
+struct Serial_Profile
+{
+	const char *name;
+	bool flow_control;	// RTS/CTS
+	int vmin;
+	int vtime;
+	bool low_latency;	// ASYNC_LOW_LATENCY, Linux only
+	int rx_buffer;		// bytes one read() may take, 1 reads byte by byte
+	bool drain;			// every write waits in tcdrain() until it is out
+};
+
 // ------------------------------------------------------------------------------
 //   Prototypes
 // ------------------------------------------------------------------------------
@@ -108,6 +167,7 @@ public:
 
 	int read_message(mavlink_message_t &message);
 	int write_message(const mavlink_message_t &message);
+	int write_frame(uint8_t *frame, unsigned len);
 
 	bool is_running()
 	{
@@ -116,22 +176,50 @@ public:
 	void start();
 	void stop();
 
+	int get_baudrate();
+	bool negotiate_baudrate(int baud, const char *param, int system_id, int companion_id);
+
+	bool set_profile(const char *name);
+	void set_profile(const Serial_Profile &profile_);
+	const Serial_Profile &get_profile() { return profile; }
+
+	static const Serial_Profile *find_profile(const char *name);
+	static void list_profiles(FILE *out);
+
 private:
 	int fd;
+	uint8_t rx_chan;	// from mavlink_channel_alloc()
 	mavlink_status_t lastStatus;
 	pthread_mutex_t lock;
+	pthread_mutex_t read_lock;
 
 	void initialize_defaults();
 
 	bool debug;
 	const char *uart_name;
 	int baudrate;
+	int effective_baudrate;	// read back from the driver
 	bool is_open;
 
+	Serial_Profile profile;
+
+	// bytes read but not parsed yet
+	uint8_t rx_buf[SERIAL_RX_BUFFER_MAX];
+	int rx_len;
+	int rx_pos;
+
 	int _open_port(const char *port);
 	bool _setup_port(int baud, int data_bits, int stop_bits, bool parity, bool hardware_control);
-	int _read_port(uint8_t &cp);
+	bool _set_speed(struct termios &config, int baud, bool &custom);
+	bool _set_custom_speed(int baud);
+	int _get_speed();
+	static bool _speed_matches(int baud, int effective);
+	bool _wait_message(int msgid, int timeout_ms, mavlink_message_t &message);
+	static uint64_t _now_msec();
+	void _set_low_latency(bool on);
+	int _read_port(uint8_t *buf, int len);
 	int _write_port(char *buf, unsigned len);
+	int _send_frame(uint8_t *frame, unsigned len, uint32_t start);
 };
 
 #endif // SERIAL_PORT_H_
@@ -0,0 +1,226 @@
+/**
+ * @file signing_stream_table.cpp
+ *
+ * @brief Signing stream table functions
+ *
+ * Functions for tracking replay state of MAVLink 2 signing streams
+ *
+ */
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include "signing_stream_table.h"
+
+#include <cstdlib>
+#include <string.h>
+
+// ------------------------------------------------------------------------------
+//   Helpers
+// ------------------------------------------------------------------------------
+
+static inline uint32_t
+_stream_key(uint8_t link_id, uint8_t sysid, uint8_t compid)
+{
+	// bit 24 keeps a used entry from ever being 0
+	return (1u << 24) | ((uint32_t)link_id << 16) | ((uint32_t)sysid << 8) | compid;
+}
+
+// ----------------------------------------------------------------------------------
+//   Signing Stream Table Class
+// ----------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+//   Con/De structors
+// ------------------------------------------------------------------------------
+Signing_Stream_Table::
+Signing_Stream_Table()
+{
+	initialize(SIGNING_STREAM_TABLE_DEFAULT_CAPACITY);
+}
+
+Signing_Stream_Table::
+Signing_Stream_Table(int capacity_)
+{
+	initialize(capacity_);
+}
+
+Signing_Stream_Table::
+~Signing_Stream_Table()
+{
+	free(entries);
+}
+
+void
+Signing_Stream_Table::
+initialize(int capacity_)
+{
+	capacity = capacity_ > 0 ? capacity_ : 1;
+	count = 0;
+
+	// at most half full
+	uint32_t buckets = 2;
+	shift = 31;
+	while (buckets < (uint32_t)capacity * 2)
+	{
+		buckets <<= 1;
+		shift--;
+	}
+	mask = buckets - 1;
+
+	entries = (Entry *)calloc(buckets, sizeof(Entry));
+	if (entries == NULL)
+	{
+		printf("\n signing stream table allocation failed\n");
+		throw 1;
+	}
+}
+
+void
+Signing_Stream_Table::
+clear()
+{
+	memset(entries, 0, (mask + 1) * sizeof(Entry));
+	count = 0;
+}
+
+// ------------------------------------------------------------------------------
+//   Lookup
+// ------------------------------------------------------------------------------
+/*
+ * Returns the entry holding key, or the free bucket it would go in.
+ */
+Signing_Stream_Table::Entry *
+Signing_Stream_Table::
+_find(uint32_t key)
+{
+	// Fibonacci hashing spreads the sysid and link id bits over the index
+	uint32_t i = (key * 2654435769u) >> shift;
+
+	while (entries[i].key != 0 && entries[i].key != key)
+		i = (i + 1) & mask;
+
+	return &entries[i];
+}
+
+bool
+Signing_Stream_Table::
+last_timestamp(uint8_t link_id, uint8_t sysid, uint8_t compid, uint64_t &tstamp)
+{
+	Entry *entry = _find(_stream_key(link_id, sysid, compid));
+	if (entry->key == 0)
+		return false;
+
+	tstamp = entry->tstamp;
+	return true;
+}
+
+// ------------------------------------------------------------------------------
+//   Replay Check
+// ------------------------------------------------------------------------------
+/*
+ * A known stream must move forward, a new one must not be more than a
+ * minute behind link_tstamp, the newest timestamp seen on the link.  The
+ * stream's timestamp is updated when the frame is accepted.
+ */
+uint8_t
+Signing_Stream_Table::
+check(uint8_t link_id, uint8_t sysid, uint8_t compid, uint64_t tstamp, uint64_t link_tstamp)
+{
+	uint32_t key = _stream_key(link_id, sysid, compid);
+	Entry *entry = _find(key);
+
+	if (entry->key == 0)
+	{
+		if (count >= capacity)
+			return MAVLINK_SIGNING_STATUS_TOO_MANY_STREAMS;
+		if (tstamp + SIGNING_STREAM_MAX_AGE < link_tstamp)
+			return MAVLINK_SIGNING_STATUS_OLD_TIMESTAMP;
+
+		entry->key = key;
+		count++;
+	}
+	else if (tstamp <= entry->tstamp)
+	{
+		return MAVLINK_SIGNING_STATUS_REPLAY;
+	}
+
+	entry->tstamp = tstamp;
+	return MAVLINK_SIGNING_STATUS_OK;
+}
+
+// ------------------------------------------------------------------------------
+//   mavlink_signing_streams_t
+// ------------------------------------------------------------------------------
+void
+Signing_Stream_Table::
+load_streams(const mavlink_signing_streams_t &streams)
+{
+	clear();
+
+	for (int i = 0; i < streams.num_signing_streams && i < MAVLINK_MAX_SIGNING_STREAMS && count < capacity; i++)
+	{
+		const auto &stream = streams.stream[i];
+		Entry *entry = _find(_stream_key(stream.link_id, stream.sysid, stream.compid));
+		if (entry->key == 0)
+			count++;
+
+		// timestamp_bytes is the low 48 bits, little endian
+		uint64_t tstamp = 0;
+		for (int j = 5; j >= 0; j--)
+			tstamp = (tstamp << 8) | stream.timestamp_bytes[j];
+
+		entry->key = _stream_key(stream.link_id, stream.sysid, stream.compid);
+		entry->tstamp = tstamp;
+	}
+}
+
+/*
+ * Copies as many streams as the struct holds.  When there are more, the
+ * newest are kept since they are the ones most likely still talking.
+ */
+void
+Signing_Stream_Table::
+save_streams(mavlink_signing_streams_t &streams)
+{
+	memset(&streams, 0, sizeof(streams));
+
+	for (uint32_t i = 0; i <= mask; i++)
+	{
+		if (entries[i].key == 0)
+			continue;
+
+		int slot = streams.num_signing_streams;
+		if (slot == MAVLINK_MAX_SIGNING_STREAMS)
+		{
+			// full, replace the oldest if this one is newer
+			slot = 0;
+			uint64_t oldest = UINT64_MAX;
+			for (int j = 0; j < MAVLINK_MAX_SIGNING_STREAMS; j++)
+			{
+				uint64_t t = 0;
+				for (int k = 5; k >= 0; k--)
+					t = (t << 8) | streams.stream[j].timestamp_bytes[k];
+				if (t < oldest)
+				{
+					oldest = t;
+					slot = j;
+				}
+			}
+			if (entries[i].tstamp <= oldest)
+				continue;
+		}
+		else
+		{
+			streams.num_signing_streams++;
+		}
+
+		auto &stream = streams.stream[slot];
+		stream.link_id = (entries[i].key >> 16) & 0xFF;
+		stream.sysid = (entries[i].key >> 8) & 0xFF;
+		stream.compid = entries[i].key & 0xFF;
+		for (int j = 0; j < 6; j++)
+			stream.timestamp_bytes[j] = (uint8_t)(entries[i].tstamp >> (j * 8));
+	}
+}
@@ -0,0 +1,85 @@
+/**
+ * @file signing_stream_table.h
+ *
+ * @brief Signing stream table definition
+ *
+ * Replay state for MAVLink 2 signing, one entry per (link id, sysid,
+ * compid) stream, found by hash instead of by scan
+ *
+ */
+
+#ifndef SIGNING_STREAM_TABLE_H_
+#define SIGNING_STREAM_TABLE_H_
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "../include/mavlink/v2.0/spresense/mavlink.h"
+
+// ------------------------------------------------------------------------------
+//   Defines
+// ------------------------------------------------------------------------------
+
+// Streams remembered by default, mavlink_signing_streams_t holds 16
+#define SIGNING_STREAM_TABLE_DEFAULT_CAPACITY 256
+
+// A new stream may start at most this far (10 us ticks) behind the link, as
+// in mavlink_signature_check()
+#define SIGNING_STREAM_MAX_AGE (6000 * 1000ULL)
+
+// ----------------------------------------------------------------------------------
+//   Signing Stream Table Class
+// ----------------------------------------------------------------------------------
+/*
+ * Signing Stream Table Class
+ *
+ * Open addressing with linear probing over a power of two number of
+ * buckets, at least twice the capacity so probes stay short when full.
+ * Streams are never removed while running, like in the MAVLink helpers; a
+ * new key or clear() starts over.
+ *
+ * check() applies the rules of mavlink_signature_check() and returns a
+ * mavlink_signing_status.  load_streams() and save_streams() convert from
+ * and to mavlink_signing_streams_t, so state kept in that struct carries
+ * over both ways.
+ */
+class Signing_Stream_Table
+{
+
+public:
+	Signing_Stream_Table();
+	Signing_Stream_Table(int capacity_);
+	~Signing_Stream_Table();
+
+	uint8_t check(uint8_t link_id, uint8_t sysid, uint8_t compid, uint64_t tstamp, uint64_t link_tstamp);
+	bool last_timestamp(uint8_t link_id, uint8_t sysid, uint8_t compid, uint64_t &tstamp);
+
+	void clear();
+	int size() { return count; }
+	int get_capacity() { return capacity; }
+
+	void load_streams(const mavlink_signing_streams_t &streams);
+	void save_streams(mavlink_signing_streams_t &streams);
+
+private:
+	struct Entry
+	{
+		uint32_t key;		// 1 << 24 | link id << 16 | sysid << 8 | compid, 0 when free
+		uint64_t tstamp;	// last accepted timestamp
+	};
+
+	Entry *entries;
+	uint32_t mask;
+	uint32_t shift;
+	int capacity;
+	int count;
+
+	void initialize(int capacity_);
+	Entry *_find(uint32_t key);
+};
+
+#endif // SIGNING_STREAM_TABLE_H_
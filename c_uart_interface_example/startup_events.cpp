@@ -0,0 +1,212 @@
+/**
+ * @file startup_events.cpp
+ *
+ * @brief Startup event flags functions
+ *
+ * Functions for signalling, waiting for and reporting the startup
+ * milestones
+ *
+ */
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include "startup_events.h"
+
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+
+// ----------------------------------------------------------------------------------
+//   Startup Events Class
+// ----------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+//   Con/De structors
+// ------------------------------------------------------------------------------
+Startup_Events::
+Startup_Events()
+{
+	initialize_defaults();
+}
+
+Startup_Events::
+~Startup_Events()
+{
+	pthread_cond_destroy(&changed);
+	pthread_mutex_destroy(&lock);
+}
+
+void
+Startup_Events::
+initialize_defaults()
+{
+	// Initialize attributes
+	pthread_mutex_init(&lock, NULL);
+	pthread_cond_init(&changed, NULL);
+
+	flags = 0;
+	launch_usec = _now_usec();
+	memset(set_usec, 0, sizeof(set_usec));
+}
+
+uint64_t
+Startup_Events::
+_now_usec()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// ------------------------------------------------------------------------------
+//   Signal
+// ------------------------------------------------------------------------------
+/*
+ * Time zero of the timeline, called first thing in the app.  Without it
+ * the timeline starts when the events were first used.
+ */
+void
+Startup_Events::
+launch()
+{
+	pthread_mutex_lock(&lock);
+	launch_usec = _now_usec();
+	pthread_mutex_unlock(&lock);
+}
+
+void
+Startup_Events::
+set(Startup_Event event)
+{
+	uint32_t bit = STARTUP_BIT(event);
+	if (flags.load(std::memory_order_acquire) & bit)
+		return;
+
+	pthread_mutex_lock(&lock);
+	if (!(flags.load(std::memory_order_relaxed) & bit))
+	{
+		set_usec[event] = _now_usec();
+		flags.fetch_or(bit, std::memory_order_release);
+		pthread_cond_broadcast(&changed);
+	}
+	pthread_mutex_unlock(&lock);
+}
+
+bool
+Startup_Events::
+is_set(Startup_Event event)
+{
+	return flags.load(std::memory_order_acquire) & STARTUP_BIT(event);
+}
+
+// ------------------------------------------------------------------------------
+//   Wait
+// ------------------------------------------------------------------------------
+/*
+ * Blocks until the event, at most timeout_ms or for good if negative.
+ * STARTUP_EXIT ends every wait.  Returns whether the event was set.
+ */
+bool
+Startup_Events::
+wait(Startup_Event event, int timeout_ms)
+{
+	uint32_t wake = STARTUP_BIT(event) | STARTUP_BIT(STARTUP_EXIT);
+
+	struct timespec deadline;
+	clock_gettime(CLOCK_REALTIME, &deadline);
+	if (timeout_ms > 0)
+	{
+		deadline.tv_sec += timeout_ms / 1000;
+		deadline.tv_nsec += (timeout_ms % 1000) * 1000000L;
+		if (deadline.tv_nsec >= 1000000000L)
+		{
+			deadline.tv_sec++;
+			deadline.tv_nsec -= 1000000000L;
+		}
+	}
+
+	pthread_mutex_lock(&lock);
+	while (!(flags.load(std::memory_order_relaxed) & wake) && timeout_ms != 0)
+	{
+		int result = timeout_ms < 0 ? pthread_cond_wait(&changed, &lock)
+									: pthread_cond_timedwait(&changed, &lock, &deadline);
+		if (result == ETIMEDOUT)
+			break;
+	}
+	pthread_mutex_unlock(&lock);
+
+	return is_set(event);
+}
+
+// ------------------------------------------------------------------------------
+//   Timeline
+// ------------------------------------------------------------------------------
+
+const char *
+Startup_Events::
+name(Startup_Event event)
+{
+	static const char *names[STARTUP_NUM_EVENTS] =
+	{
+		"msglib ready",
+		"read thread ready",
+		"first message",
+		"first heartbeat",
+		"write thread ready",
+		"calibrate ack",
+		"first HIL_GPS",
+		"exit",
+	};
+	return event < STARTUP_NUM_EVENTS ? names[event] : "?";
+}
+
+// microseconds since launch(), or -1 if not set yet
+int64_t
+Startup_Events::
+get_time_usec(Startup_Event event)
+{
+	if (!is_set(event))
+		return -1;
+	return (int64_t)(set_usec[event] - launch_usec);
+}
+
+// the events so far, in the order they happened
+void
+Startup_Events::
+dump(FILE *out)
+{
+	bool done[STARTUP_NUM_EVENTS] = {false};
+
+	fprintf(out, "STARTUP TIMELINE\n");
+	for (int n = 0; n < STARTUP_NUM_EVENTS; n++)
+	{
+		int next = -1;
+		for (int i = 0; i < STARTUP_NUM_EVENTS; i++)
+		{
+			if (done[i] || !is_set((Startup_Event)i))
+				continue;
+			if (next < 0 || set_usec[i] < set_usec[next])
+				next = i;
+		}
+		if (next < 0)
+			break;
+		done[next] = true;
+
+		int64_t usec = get_time_usec((Startup_Event)next);
+		fprintf(out, "  %8lu.%03lu ms  %s\n", (unsigned long)(usec / 1000),
+				(unsigned long)(usec % 1000), name((Startup_Event)next));
+	}
+}
+
+// ------------------------------------------------------------------------------
+//   Image Events
+// ------------------------------------------------------------------------------
+
+Startup_Events &
+startup_events()
+{
+	static Startup_Events events;
+	return events;
+}
@@ -0,0 +1,84 @@
+/**
+ * @file startup_events.h
+ *
+ * @brief Startup event flags definition
+ *
+ * The milestones of bringing the link up, each set once by whoever
+ * reaches it and waited for by whoever needs it, with the time it was
+ * reached for a timeline of the startup
+ *
+ */
+
+#ifndef STARTUP_EVENTS_H_
+#define STARTUP_EVENTS_H_
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pthread.h> // This uses POSIX Threads
+#include <atomic>
+
+// ------------------------------------------------------------------------------
+//   Events
+// ------------------------------------------------------------------------------
+
+enum Startup_Event
+{
+	STARTUP_MSGLIB_READY,		// message queues initialised
+	STARTUP_READ_READY,			// read thread running
+	STARTUP_FIRST_MESSAGE,		// first frame from the autopilot, ids known
+	STARTUP_FIRST_HEARTBEAT,
+	STARTUP_WRITE_READY,		// first setpoint written
+	STARTUP_CALIBRATE_ACK,		// autopilot acked autopilot_calibrate()'s command
+	STARTUP_FIRST_HIL_GPS,		// first fix on the wire
+	STARTUP_EXIT,				// shutting down, wakes every waiter
+	STARTUP_NUM_EVENTS
+};
+
+#define STARTUP_BIT(event) (1u << (event))
+
+// ----------------------------------------------------------------------------------
+//   Startup Events Class
+// ----------------------------------------------------------------------------------
+/*
+ * Startup Events Class
+ *
+ * A set of flags behind one condition variable.  set() is cheap once the
+ * flag is up, a single atomic load, so it can sit on the receive path.
+ * Times are microseconds since launch().
+ */
+class Startup_Events
+{
+
+public:
+	Startup_Events();
+	~Startup_Events();
+
+	void launch();
+	void set(Startup_Event event);
+	bool is_set(Startup_Event event);
+	bool wait(Startup_Event event, int timeout_ms);
+
+	int64_t get_time_usec(Startup_Event event);
+	void dump(FILE *out);
+
+	static const char *name(Startup_Event event);
+
+private:
+	pthread_mutex_t lock;
+	pthread_cond_t changed;
+	std::atomic<uint32_t> flags;
+	uint64_t launch_usec;
+	uint64_t set_usec[STARTUP_NUM_EVENTS];
+
+	void initialize_defaults();
+	static uint64_t _now_usec();
+};
+
+// One for the image, the autopilot interface and mavlink_control share it
+Startup_Events &startup_events();
+
+#endif // STARTUP_EVENTS_H_
@@ -0,0 +1,488 @@
+/**
+ * @file tlog_recorder.cpp
+ *
+ * @brief Binary telemetry recorder functions
+ *
+ * Functions for recording raw MAVLink frames and writing them out as a tlog
+ *
+ */
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include "tlog_recorder.h"
+
+#include <cstdlib>
+#include <string.h>
+#include <unistd.h>	// UNIX standard function definitions
+#include <fcntl.h>	// File control definitions
+#include <time.h>
+
+// ------------------------------------------------------------------------------
+//   Helpers
+// ------------------------------------------------------------------------------
+
+// Bytes in front of every frame in a tlog
+#define TLOG_TIMESTAMP_LEN 8
+
+static uint64_t
+_clock_usec(clockid_t clock)
+{
+	struct timespec ts;
+	clock_gettime(clock, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// ----------------------------------------------------------------------------------
+//   Tlog Recorder Class
+// ----------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+//   Con/De structors
+// ------------------------------------------------------------------------------
+Tlog_Recorder::
+Tlog_Recorder(const char *path_)
+{
+	initialize_defaults();
+	path = path_;
+}
+
+Tlog_Recorder::
+Tlog_Recorder(const char *path_, int num_slots_)
+{
+	initialize_defaults();
+	path = path_;
+	_set_num_slots(num_slots_);
+}
+
+Tlog_Recorder::
+Tlog_Recorder(const char *path_, int num_slots_, Tlog_Format format_)
+{
+	initialize_defaults();
+	path = path_;
+	format = format_;
+	_set_num_slots(num_slots_);
+}
+
+Tlog_Recorder::
+~Tlog_Recorder()
+{
+	stop();
+
+	delete[] slots;
+	delete index_writer;
+	free(chunk);
+}
+
+void
+Tlog_Recorder::
+initialize_defaults()
+{
+	// Initialize attributes
+	path = "flight.tlog";
+	format = TLOG_FORMAT_TLOG;
+	fd = -1;
+	is_open = false;
+	time_to_exit = false;
+
+	slots = NULL;
+	num_slots = TLOG_RECORDER_DEFAULT_SLOTS;
+	mask = num_slots - 1;
+	head.store(0);
+	in_flight.store(0);
+	tail = 0;
+
+	frames.store(0);
+	drops.store(0);
+
+	write_tid = 0;
+	chunk = NULL;
+	fill = 0;
+	last_flush = 0;
+	wall_offset = 0;
+	index_writer = NULL;
+	bytes_written.store(0);
+	write_errors.store(0);
+}
+
+void
+Tlog_Recorder::
+_set_num_slots(int num_slots_)
+{
+	num_slots = 1;
+	while (num_slots < (uint32_t)num_slots_)
+		num_slots <<= 1;
+	mask = num_slots - 1;
+}
+
+// ------------------------------------------------------------------------------
+//   Start Recording
+// ------------------------------------------------------------------------------
+/**
+ * throws EXIT_FAILURE if the tlog could not be opened
+ */
+void
+Tlog_Recorder::
+start()
+{
+	// --------------------------------------------------------------------------
+	//   OPEN FILE
+	// --------------------------------------------------------------------------
+	if (format == TLOG_FORMAT_INDEXED)
+	{
+		// appends to an existing log, so a restart after a power loss
+		// continues the same file
+		index_writer = new Indexed_Log_Writer();
+		if (index_writer->open(path) < 0)
+		{
+			delete index_writer;
+			index_writer = NULL;
+			throw EXIT_FAILURE;
+		}
+	}
+	else
+	{
+		fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+		if (fd < 0)
+		{
+			fprintf(stderr, "ERROR: could not open tlog %s\n", path);
+			throw EXIT_FAILURE;
+		}
+	}
+
+	// --------------------------------------------------------------------------
+	//   ALLOCATE RING
+	// --------------------------------------------------------------------------
+	slots = new Slot[num_slots];
+	if (index_writer == NULL)
+	{
+		chunk = (uint8_t *)malloc(TLOG_RECORDER_CHUNK);
+		if (chunk == NULL)
+		{
+			fprintf(stderr, "ERROR: could not allocate %d bytes of tlog buffer\n", TLOG_RECORDER_CHUNK);
+			close(fd);
+			fd = -1;
+			throw EXIT_FAILURE;
+		}
+	}
+
+	// a slot is free for position p when its sequence equals p
+	for (uint32_t i = 0; i < num_slots; i++)
+		slots[i].sequence.store(i, std::memory_order_relaxed);
+	head.store(0, std::memory_order_relaxed);
+	tail = 0;
+	fill = 0;
+
+	// frames are stamped with the cheap monotonic clock, tlogs want wall time
+	wall_offset = (int64_t)_clock_usec(CLOCK_REALTIME) - (int64_t)_clock_usec(CLOCK_MONOTONIC);
+	last_flush = _clock_usec(CLOCK_MONOTONIC);
+
+	// --------------------------------------------------------------------------
+	//   WRITE THREAD
+	// --------------------------------------------------------------------------
+	time_to_exit = false;
+	int result = thread_config_create(&write_tid, THREAD_LOG, &start_tlog_recorder_write_thread, this);
+	if (result)
+		throw result;
+
+	is_open = true;
+
+	printf("Recording telemetry to %s (%lu slots)\n", path, (unsigned long)num_slots);
+}
+
+// ------------------------------------------------------------------------------
+//   Stop Recording
+// ------------------------------------------------------------------------------
+void
+Tlog_Recorder::
+stop()
+{
+	if (!is_open)
+		return;
+
+	is_open = false;
+
+	// a producer already past the check in _claim() publishes before the
+	// writer's last drain
+	while (in_flight.load() != 0)
+		usleep(100);
+
+	// the writer drains the ring before it exits
+	time_to_exit = true;
+	thread_config_join(write_tid, NULL);
+
+	if (index_writer)
+	{
+		index_writer->close();
+	}
+	else
+	{
+		fsync(fd);
+		close(fd);
+		fd = -1;
+	}
+
+	Tlog_Recorder_Stats s = get_stats();
+	printf("TLOG CLOSED: %lu bytes, %lu frames, %lu dropped\n",
+		   (unsigned long)s.bytes_written, (unsigned long)s.frames, (unsigned long)s.drops);
+}
+
+// ------------------------------------------------------------------------------
+//   Stats
+// ------------------------------------------------------------------------------
+Tlog_Recorder_Stats
+Tlog_Recorder::
+get_stats()
+{
+	Tlog_Recorder_Stats result;
+	result.frames = frames.load(std::memory_order_relaxed);
+	result.drops = drops.load(std::memory_order_relaxed);
+	result.bytes_written = bytes_written.load(std::memory_order_relaxed);
+	result.write_errors = write_errors.load(std::memory_order_relaxed);
+
+	return result;
+}
+
+// ------------------------------------------------------------------------------
+//   Record Frame
+// ------------------------------------------------------------------------------
+/*
+ * Hot path, called from the port read and write paths.  Returns false and
+ * counts a drop when the ring is full.
+ */
+bool
+Tlog_Recorder::
+record(const mavlink_message_t &message)
+{
+	uint32_t pos;
+	Slot *slot = _claim(pos);
+	if (slot == NULL)
+		return false;
+
+	// serialize straight into the slot, no intermediate buffer
+	slot->len = mavlink_msg_to_send_buffer(slot->data, &message);
+
+	_publish(slot, pos);
+	return true;
+}
+
+bool
+Tlog_Recorder::
+record(const uint8_t *frame, unsigned len)
+{
+	if (len > MAVLINK_MAX_PACKET_LEN)
+	{
+		drops.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	uint32_t pos;
+	Slot *slot = _claim(pos);
+	if (slot == NULL)
+		return false;
+
+	memcpy(slot->data, frame, len);
+	slot->len = len;
+
+	_publish(slot, pos);
+	return true;
+}
+
+Tlog_Recorder::Slot *
+Tlog_Recorder::
+_claim(uint32_t &pos)
+{
+	// counted before is_open is checked, stop() waits for it to drop
+	in_flight.fetch_add(1);
+	if (!is_open)
+	{
+		in_flight.fetch_sub(1, std::memory_order_release);
+		return NULL;
+	}
+
+	pos = head.load(std::memory_order_relaxed);
+	while (true)
+	{
+		Slot *slot = &slots[pos & mask];
+		uint32_t seq = slot->sequence.load(std::memory_order_acquire);
+		int32_t diff = (int32_t)(seq - pos);
+
+		if (diff == 0)
+		{
+			// slot is free, try to take it; on failure pos holds the new head
+			if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+			{
+				slot->timestamp = _clock_usec(CLOCK_MONOTONIC);
+				return slot;
+			}
+		}
+		else if (diff < 0)
+		{
+			// writer has not consumed this slot yet, the ring is full
+			drops.fetch_add(1, std::memory_order_relaxed);
+			in_flight.fetch_sub(1, std::memory_order_release);
+			return NULL;
+		}
+		else
+		{
+			// another producer took it first
+			pos = head.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+void
+Tlog_Recorder::
+_publish(Slot *slot, uint32_t pos)
+{
+	frames.fetch_add(1, std::memory_order_relaxed);
+	slot->sequence.store(pos + 1, std::memory_order_release);
+	in_flight.fetch_sub(1, std::memory_order_release);
+}
+
+// ------------------------------------------------------------------------------
+//   Drain Ring
+// ------------------------------------------------------------------------------
+/*
+ * Moves every published frame into the chunk buffer, returns the number of
+ * frames moved.  Only the writer thread calls this.
+ */
+int
+Tlog_Recorder::
+_drain()
+{
+	int n = 0;
+
+	while (true)
+	{
+		Slot *slot = &slots[tail & mask];
+		uint32_t seq = slot->sequence.load(std::memory_order_acquire);
+
+		// not published yet
+		if (seq != tail + 1)
+			break;
+
+		_emit(slot->timestamp, slot->data, slot->len);
+
+		// hand the slot back to the producers for the next lap
+		slot->sequence.store(tail + num_slots, std::memory_order_release);
+		tail++;
+		n++;
+	}
+
+	return n;
+}
+
+void
+Tlog_Recorder::
+_emit(uint64_t timestamp, const uint8_t *frame, int len)
+{
+	if (index_writer)
+	{
+		// the indexed log does its own block buffering
+		int result = index_writer->append((uint64_t)((int64_t)timestamp + wall_offset), frame, len);
+		if (result < 0)
+			write_errors.fetch_add(1, std::memory_order_relaxed);
+		else
+			bytes_written.fetch_add(result, std::memory_order_relaxed);
+		fill = 1; // something to flush
+		return;
+	}
+
+	if (fill + TLOG_TIMESTAMP_LEN + len > TLOG_RECORDER_CHUNK)
+		_flush();
+
+	// tlog timestamps are big-endian microseconds since the epoch
+	uint64_t t = (uint64_t)((int64_t)timestamp + wall_offset);
+	for (int i = TLOG_TIMESTAMP_LEN - 1; i >= 0; i--)
+	{
+		chunk[fill + i] = (uint8_t)(t & 0xff);
+		t >>= 8;
+	}
+	memcpy(&chunk[fill + TLOG_TIMESTAMP_LEN], frame, len);
+	fill += TLOG_TIMESTAMP_LEN + len;
+}
+
+void
+Tlog_Recorder::
+_flush()
+{
+	if (index_writer)
+	{
+		int result = index_writer->flush();
+		if (result < 0)
+			write_errors.fetch_add(1, std::memory_order_relaxed);
+		else
+			bytes_written.fetch_add(result, std::memory_order_relaxed);
+		fill = 0;
+		last_flush = _clock_usec(CLOCK_MONOTONIC);
+		return;
+	}
+
+	int written = 0;
+	while (written < fill)
+	{
+		int result = write(fd, chunk + written, fill - written);
+		if (result <= 0)
+		{
+			write_errors.fetch_add(1, std::memory_order_relaxed);
+			break;
+		}
+		written += result;
+	}
+
+	bytes_written.fetch_add(written, std::memory_order_relaxed);
+	fill = 0;
+	last_flush = _clock_usec(CLOCK_MONOTONIC);
+}
+
+// ------------------------------------------------------------------------------
+//   Write Thread
+// ------------------------------------------------------------------------------
+void
+Tlog_Recorder::
+start_write_thread()
+{
+	write_thread();
+}
+
+void
+Tlog_Recorder::
+write_thread()
+{
+	while (!time_to_exit)
+	{
+		if (_drain() > 0)
+			continue;
+
+		// ring is empty, push out a partial chunk every so often so a crash
+		// loses at most TLOG_RECORDER_FLUSH_US of telemetry
+		if (fill > 0 && _clock_usec(CLOCK_MONOTONIC) - last_flush >= TLOG_RECORDER_FLUSH_US)
+			_flush();
+
+		usleep(TLOG_RECORDER_IDLE_US);
+	}
+
+	// producers have stopped, take whatever is left
+	_drain();
+	if (fill > 0)
+		_flush();
+}
+
+// ------------------------------------------------------------------------------
+//  Pthread Starter Helper Functions
+// ------------------------------------------------------------------------------
+
+void *
+start_tlog_recorder_write_thread(void *args)
+{
+	// takes a tlog recorder object argument
+	Tlog_Recorder *tlog_recorder = (Tlog_Recorder *)args;
+
+	// run the object's write thread
+	tlog_recorder->start_write_thread();
+
+	// done!
+	return NULL;
+}
@@ -0,0 +1,151 @@
+/**
+ * @file tlog_recorder.h
+ *
+ * @brief Binary telemetry recorder definition
+ *
+ * Records every inbound and outbound MAVLink frame with a timestamp into a
+ * lock-free ring, and persists the ring to storage in the tlog layout used
+ * by QGroundControl and MAVProxy.
+ *
+ */
+
+#ifndef TLOG_RECORDER_H_
+#define TLOG_RECORDER_H_
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pthread.h> // This uses POSIX Threads
+#include <atomic>
+
+#include "../include/mavlink/v2.0/spresense/mavlink.h"
+
+#include "indexed_log.h"
+#include "../include/thread_config.h"
+
+// ------------------------------------------------------------------------------
+//   Defines
+// ------------------------------------------------------------------------------
+
+// Ring slots, rounded up to a power of two
+#define TLOG_RECORDER_DEFAULT_SLOTS 64
+
+// Size of a single write to storage
+#define TLOG_RECORDER_CHUNK 4096
+
+// Writer sleeps this long when the ring is empty
+#define TLOG_RECORDER_IDLE_US 5000
+
+// A partly filled chunk is written out after this long
+#define TLOG_RECORDER_FLUSH_US 500000
+
+// ------------------------------------------------------------------------------
+//   Data Structures
+// ------------------------------------------------------------------------------
+
+enum Tlog_Format
+{
+	TLOG_FORMAT_TLOG = 0, // plain tlog, timestamp + frame
+	TLOG_FORMAT_INDEXED	  // seekable container, see indexed_log.h
+};
+
+struct Tlog_Recorder_Stats
+{
+	uint32_t frames;	   // frames taken into the ring
+	uint32_t drops;		   // frames lost because the ring was full
+	uint32_t bytes_written; // FAT limits the file to 4 GB anyway
+	uint32_t write_errors;
+};
+
+// ----------------------------------------------------------------------------------
+//   Tlog Recorder Class
+// ----------------------------------------------------------------------------------
+/*
+ * Tlog Recorder Class
+ *
+ * record() may be called from any number of threads (the port read and write
+ * paths).  It claims a slot with a single compare-and-swap, copies the frame
+ * and a monotonic timestamp into it and publishes it; it never locks and
+ * never touches storage.  When the ring is full the frame is counted as a
+ * drop instead of waiting.  A single writer thread drains the ring, converts
+ * timestamps to wall clock time and writes each frame as an 8 byte big-endian
+ * microsecond timestamp followed by the raw frame, or hands it to an
+ * Indexed_Log_Writer when TLOG_FORMAT_INDEXED is chosen.
+ */
+class Tlog_Recorder
+{
+
+public:
+	Tlog_Recorder(const char *path_);
+	Tlog_Recorder(const char *path_, int num_slots_);
+	Tlog_Recorder(const char *path_, int num_slots_, Tlog_Format format_);
+	~Tlog_Recorder();
+
+	void start();
+	void stop();
+
+	bool record(const mavlink_message_t &message);
+	bool record(const uint8_t *frame, unsigned len);
+
+	bool is_running()
+	{
+		return is_open;
+	}
+	Tlog_Recorder_Stats get_stats();
+
+	void start_write_thread();
+
+private:
+	struct Slot
+	{
+		std::atomic<uint32_t> sequence;
+		uint16_t len;
+		uint64_t timestamp;
+		uint8_t data[MAVLINK_MAX_PACKET_LEN];
+	};
+
+	const char *path;
+	Tlog_Format format;
+	int fd;
+	std::atomic<bool> is_open;
+	volatile bool time_to_exit;
+
+	// ring shared by the producers and the writer thread
+	Slot *slots;
+	uint32_t num_slots;
+	uint32_t mask;
+	std::atomic<uint32_t> head;
+	std::atomic<uint32_t> in_flight; // producers between _claim() and _publish()
+	uint32_t tail; // owned by the writer thread
+
+	std::atomic<uint32_t> frames;
+	std::atomic<uint32_t> drops;
+
+	// owned by the writer thread
+	pthread_t write_tid;
+	uint8_t *chunk;
+	int fill;
+	uint64_t last_flush;
+	int64_t wall_offset;
+	Indexed_Log_Writer *index_writer;
+	std::atomic<uint32_t> bytes_written;
+	std::atomic<uint32_t> write_errors;
+
+	void initialize_defaults();
+	void _set_num_slots(int num_slots_);
+
+	Slot *_claim(uint32_t &pos);
+	void _publish(Slot *slot, uint32_t pos);
+	int _drain();
+	void _emit(uint64_t timestamp, const uint8_t *frame, int len);
+	void _flush();
+
+	void write_thread();
+};
+
+void *start_tlog_recorder_write_thread(void *args);
+
+#endif // TLOG_RECORDER_H_
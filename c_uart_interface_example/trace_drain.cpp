@@ -0,0 +1,343 @@
+/**
+ * @file trace_drain.cpp
+ *
+ * @brief Trace drain functions
+ *
+ * Functions for emptying and formatting the trace rings
+ *
+ */
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include "trace_drain.h"
+
+#include <cstdlib>
+#include <string.h>
+#include <unistd.h>	// UNIX standard function definitions
+#include <fcntl.h>	// File control definitions
+#include <sched.h>
+
+// ------------------------------------------------------------------------------
+//   Formatting
+// ------------------------------------------------------------------------------
+
+static const char *trace_formats[TRACE_NUM_EVENTS] = {
+#define TRACE_EVENT_FORMAT(id, format) format,
+	TRACE_EVENTS(TRACE_EVENT_FORMAT)
+#undef TRACE_EVENT_FORMAT
+};
+
+/*
+ * One line for one event, "<seconds> [<thread>] <message>".  Each
+ * conversion in the format takes the next argument, as a float for %f, %e
+ * and %g and as an integer otherwise.  Returns the length written.
+ */
+int
+trace_format(const Trace_Event &event, char *buf, int size)
+{
+	int len = snprintf(buf, size, "%llu.%06llu [%u] ",
+					   (unsigned long long)(event.usec / 1000000),
+					   (unsigned long long)(event.usec % 1000000), event.thread);
+
+	if (event.id >= TRACE_NUM_EVENTS)
+	{
+		len += snprintf(buf + len, size - len, "unknown event %u\n", event.id);
+		return len < size ? len : size - 1;
+	}
+
+	const char *p = trace_formats[event.id];
+	int arg = 0;
+	char spec[16];
+
+	while (*p && len < size - 1)
+	{
+		if (*p != '%')
+		{
+			buf[len++] = *p++;
+			continue;
+		}
+		if (p[1] == '%')
+		{
+			buf[len++] = '%';
+			p += 2;
+			continue;
+		}
+
+		// copy one conversion, up to and including its letter
+		int n = 0;
+		spec[n++] = *p++;
+		while (*p && strchr("diouxXcfFeEgGs", *p) == NULL && n < (int)sizeof(spec) - 2)
+			spec[n++] = *p++;
+		char conversion = *p;
+		if (*p)
+			spec[n++] = *p++;
+		spec[n] = 0;
+
+		uint32_t value = arg < event.nargs ? event.args[arg] : 0;
+		arg++;
+
+		if (strchr("fFeEgG", conversion))
+		{
+			float f;
+			memcpy(&f, &value, sizeof(f));
+			len += snprintf(buf + len, size - len, spec, (double)f);
+		}
+		else if (conversion == 's')
+		{
+			len += snprintf(buf + len, size - len, "?");
+		}
+		else
+		{
+			len += snprintf(buf + len, size - len, spec, (int)value);
+		}
+	}
+
+	if (len < size - 1)
+		buf[len++] = '\n';
+	if (len > size - 1)
+		len = size - 1;
+	buf[len] = 0;
+
+	return len;
+}
+
+/*
+ * Prints a binary trace saved by a Trace_Drain.  Returns the number of
+ * events, or -1 if the file is not a trace.
+ */
+int
+trace_decode(const char *path, FILE *out)
+{
+	FILE *in = fopen(path, "rb");
+	if (in == NULL)
+	{
+		fprintf(stderr, "ERROR: could not open %s\n", path);
+		return -1;
+	}
+
+	uint32_t header[2];
+	if (fread(header, sizeof(header), 1, in) != 1 ||
+		header[0] != TRACE_FILE_MAGIC || header[1] != sizeof(Trace_Event))
+	{
+		fprintf(stderr, "ERROR: %s is not a trace\n", path);
+		fclose(in);
+		return -1;
+	}
+
+	int count = 0;
+	Trace_Event event;
+	char line[256];
+	while (fread(&event, sizeof(event), 1, in) == 1)
+	{
+		trace_format(event, line, sizeof(line));
+		fputs(line, out);
+		count++;
+	}
+
+	fclose(in);
+	return count;
+}
+
+// ----------------------------------------------------------------------------------
+//   Trace Drain Class
+// ----------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+//   Con/De structors
+// ------------------------------------------------------------------------------
+Trace_Drain::
+Trace_Drain(FILE *out_)
+{
+	initialize_defaults();
+	out = out_;
+}
+
+Trace_Drain::
+Trace_Drain(const char *path_)
+{
+	initialize_defaults();
+	path = path_;
+}
+
+Trace_Drain::
+~Trace_Drain()
+{
+	stop();
+}
+
+void
+Trace_Drain::
+initialize_defaults()
+{
+	// Initialize attributes
+	out = NULL;
+	path = NULL;
+	fd = -1;
+
+	time_to_exit = false;
+	drain_tid = 0;
+
+	memset(reported_drops, 0, sizeof(reported_drops));
+	memset(&stats, 0, sizeof(stats));
+}
+
+// ------------------------------------------------------------------------------
+//   Start / Stop
+// ------------------------------------------------------------------------------
+/**
+ * throws EXIT_FAILURE if the trace file could not be opened
+ */
+void
+Trace_Drain::
+start()
+{
+	if (path)
+	{
+		fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+		if (fd < 0)
+		{
+			fprintf(stderr, "ERROR: could not open trace file %s\n", path);
+			throw EXIT_FAILURE;
+		}
+
+		uint32_t header[2] = { TRACE_FILE_MAGIC, sizeof(Trace_Event) };
+		if (write(fd, header, sizeof(header)) != sizeof(header))
+			fprintf(stderr, "WARNING: could not write trace header\n");
+	}
+
+	// below the tasks it drains, so formatting never holds them up
+	time_to_exit = false;
+	int result = thread_config_create(&drain_tid, THREAD_TRACE, &start_trace_drain_thread, this);
+	if (result)
+		throw result;
+}
+
+void
+Trace_Drain::
+stop()
+{
+	if (drain_tid)
+	{
+		time_to_exit = true;
+		thread_config_join(drain_tid, NULL);
+		drain_tid = 0;
+	}
+
+	// whatever came in since the last pass
+	drain();
+
+	if (fd >= 0)
+	{
+		close(fd);
+		fd = -1;
+	}
+	if (out)
+		fflush(out);
+}
+
+// ------------------------------------------------------------------------------
+//   Drain
+// ------------------------------------------------------------------------------
+/*
+ * One pass over every ring.  Returns the number of events taken out.
+ */
+int
+Trace_Drain::
+drain()
+{
+	Trace_Buffer &buffer = trace_buffer();
+	int count = 0;
+
+	for (int i = 0; i < TRACE_MAX_THREADS; i++)
+	{
+		Trace_Ring &ring = buffer.rings[i];
+		if (ring.state.load(std::memory_order_acquire) != 2 &&
+			ring.head.load(std::memory_order_acquire) == ring.tail.load(std::memory_order_relaxed))
+			continue;
+
+		uint32_t t = ring.tail.load(std::memory_order_relaxed);
+		uint32_t h = ring.head.load(std::memory_order_acquire);
+		for (; t != h; t++)
+		{
+			_emit(ring.events[t & (TRACE_RING_EVENTS - 1)]);
+			count++;
+		}
+		ring.tail.store(t, std::memory_order_release);
+
+		// say so when events were lost, once per batch
+		uint32_t drops = ring.drops.load(std::memory_order_relaxed);
+		if (drops != reported_drops[i])
+		{
+			if (out)
+				fprintf(out, "trace: %lu events dropped on [%d]\n",
+						(unsigned long)(drops - reported_drops[i]), i);
+			stats.drops += drops - reported_drops[i];
+			reported_drops[i] = drops;
+		}
+	}
+
+	stats.events += count;
+	stats.no_ring = buffer.no_ring.load(std::memory_order_relaxed);
+
+	return count;
+}
+
+void
+Trace_Drain::
+_emit(const Trace_Event &event)
+{
+	if (fd >= 0)
+	{
+		if (write(fd, &event, sizeof(event)) != sizeof(event))
+			stats.drops++;
+		return;
+	}
+
+	if (out)
+	{
+		char line[256];
+		trace_format(event, line, sizeof(line));
+		fputs(line, out);
+	}
+}
+
+Trace_Drain_Stats
+Trace_Drain::
+get_stats()
+{
+	return stats;
+}
+
+// ------------------------------------------------------------------------------
+//   Drain Thread
+// ------------------------------------------------------------------------------
+void
+Trace_Drain::
+drain_thread()
+{
+	while (!time_to_exit)
+	{
+		if (drain() == 0)
+			usleep(TRACE_DRAIN_PERIOD_US);
+		else if (out)
+			fflush(out);
+	}
+}
+
+// ------------------------------------------------------------------------------
+//  Pthread Starter Helper Function
+// ------------------------------------------------------------------------------
+void *
+start_trace_drain_thread(void *args)
+{
+	// takes a trace drain object argument
+	Trace_Drain *trace_drain = (Trace_Drain *)args;
+
+	// run the object's drain thread
+	trace_drain->drain_thread();
+
+	// done!
+	return NULL;
+}
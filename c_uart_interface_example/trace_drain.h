@@ -0,0 +1,97 @@
+/**
+ * @file trace_drain.h
+ *
+ * @brief Trace drain definition
+ *
+ * Empties the trace rings of include/trace.h from a low priority thread,
+ * either formatting the events as text or saving them as they are for
+ * trace_decode() to format later
+ *
+ */
+
+#ifndef TRACE_DRAIN_H_
+#define TRACE_DRAIN_H_
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pthread.h> // This uses POSIX Threads
+
+#include "../include/trace.h"
+#include "../include/thread_config.h"
+
+// ------------------------------------------------------------------------------
+//   Defines
+// ------------------------------------------------------------------------------
+
+// Binary traces start with "MTRC", then the record size, then the records
+#define TRACE_FILE_MAGIC 0x4352544d
+
+// Time between passes over the rings
+#define TRACE_DRAIN_PERIOD_US 100000
+
+// ------------------------------------------------------------------------------
+//   Prototypes
+// ------------------------------------------------------------------------------
+
+int trace_format(const Trace_Event &event, char *buf, int size);
+int trace_decode(const char *path, FILE *out);
+
+void *start_trace_drain_thread(void *args);
+
+// ------------------------------------------------------------------------------
+//   Data Structures
+// ------------------------------------------------------------------------------
+
+struct Trace_Drain_Stats
+{
+	uint32_t events;
+	uint32_t drops;		// ring full, summed over all rings
+	uint32_t no_ring;	// more threads tracing than rings
+};
+
+// ----------------------------------------------------------------------------------
+//   Trace Drain Class
+// ----------------------------------------------------------------------------------
+/*
+ * Trace Drain Class
+ *
+ * Constructed with a FILE it prints every event as a line of text, with
+ * a path it writes the raw 32 byte events to that file.  Only one drain
+ * may run at a time, it is the single consumer of every ring.
+ */
+class Trace_Drain
+{
+
+public:
+	Trace_Drain(FILE *out_);
+	Trace_Drain(const char *path_);
+	~Trace_Drain();
+
+	void start();
+	void stop();
+	int drain();
+
+	Trace_Drain_Stats get_stats();
+
+	void drain_thread();
+
+private:
+	FILE *out;
+	const char *path;
+	int fd;
+
+	bool time_to_exit;
+	pthread_t drain_tid;
+
+	uint32_t reported_drops[TRACE_MAX_THREADS];
+	Trace_Drain_Stats stats;
+
+	void initialize_defaults();
+	void _emit(const Trace_Event &event);
+};
+
+#endif // TRACE_DRAIN_H_
@@ -0,0 +1,633 @@
+/**
+ * @file tx_scheduler.cpp
+ *
+ * @brief Transmit scheduler functions
+ *
+ * Functions for queueing frames by priority class and pacing them onto
+ * the lower port
+ *
+ */
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include "tx_scheduler.h"
+
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+
+static uint64_t
+_now_usec()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// Queue limit and drop policy of each class
+static const Tx_Class_Config tx_class_configs[TX_NUM_CLASSES] =
+{
+	// name         limit  policy
+	{"control",     16,    TX_DROP_NEWEST},
+	{"position",    8,     TX_KEEP_LATEST},
+	{"telemetry",   16,    TX_DROP_OLDEST},
+	{"bulk",        32,    TX_DROP_NEWEST},
+};
+
+// ----------------------------------------------------------------------------------
+//   Transmit Scheduler Class
+// ----------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------
+//   Con/De structors
+// ------------------------------------------------------------------------------
+Tx_Scheduler::
+Tx_Scheduler(Generic_Port *lower_, int baudrate_)
+{
+	initialize_defaults();
+	lower = lower_;
+	set_baudrate(baudrate_);
+}
+
+Tx_Scheduler::
+~Tx_Scheduler()
+{
+	for (int c = 0; c < TX_NUM_CLASSES; c++)
+		delete[] queues[c].slots;
+
+	// destroy mutex
+	pthread_cond_destroy(&cond);
+	pthread_mutex_destroy(&lock);
+}
+
+void
+Tx_Scheduler::
+initialize_defaults()
+{
+	// Initialize attributes
+	lower = NULL;
+	tx_tid = 0;
+	time_to_exit = false;
+	busy = false;
+
+	pthread_mutex_init(&lock, NULL);
+	pthread_cond_init(&cond, NULL);
+
+	for (int c = 0; c < TX_NUM_CLASSES; c++)
+	{
+		queues[c].slots = new Tx_Slot[tx_class_configs[c].limit];
+		queues[c].head = 0;
+		queues[c].count = 0;
+		latency[c].set_name(tx_class_configs[c].name);
+	}
+	memset(stats, 0, sizeof(stats));
+	num_overrides = 0;
+
+	rate = 0;
+	measured = 0;
+	tokens = TX_SCHEDULER_BURST_BYTES;
+	refill_usec = _now_usec();
+	start_usec = refill_usec;
+	throttled_usec = 0;
+}
+
+// ------------------------------------------------------------------------------
+//   Lower Port
+// ------------------------------------------------------------------------------
+
+int
+Tx_Scheduler::
+read_message(mavlink_message_t &message)
+{
+	return lower->read_message(message);
+}
+
+bool
+Tx_Scheduler::
+is_running()
+{
+	return lower->is_running();
+}
+
+void
+Tx_Scheduler::
+set_recorder(Tlog_Recorder *recorder_)
+{
+	lower->set_recorder(recorder_);
+}
+
+// What was queued before goes out unsigned, as the caller wrote it
+void
+Tx_Scheduler::
+set_signing(Mavlink_Signing *signing_)
+{
+	if (!flush(TX_SCHEDULER_FLUSH_MS))
+		fprintf(stderr, "WARNING: tx queues not empty when signing changed\n");
+	lower->set_signing(signing_);
+
+	// frames grow by the signature from now on
+	pthread_mutex_lock(&lock);
+	signing = signing_;
+	pthread_mutex_unlock(&lock);
+}
+
+Link_Stats *
+Tx_Scheduler::
+get_link_stats()
+{
+	return lower->get_link_stats();
+}
+
+int
+Tx_Scheduler::
+get_num_link_stats()
+{
+	return lower->get_num_link_stats();
+}
+
+Link_Stats *
+Tx_Scheduler::
+get_link_stats_at(int index)
+{
+	return lower->get_link_stats_at(index);
+}
+
+uint32_t
+Tx_Scheduler::
+get_frame_stamp()
+{
+	return lower->get_frame_stamp();
+}
+
+// ------------------------------------------------------------------------------
+//   Configuration
+// ------------------------------------------------------------------------------
+
+// 10 bits a byte on the wire, 8N1
+void
+Tx_Scheduler::
+set_baudrate(int baudrate_)
+{
+	set_rate(baudrate_ / 10.0 * TX_SCHEDULER_UTILIZATION);
+}
+
+void
+Tx_Scheduler::
+set_rate(double bytes_per_sec)
+{
+	pthread_mutex_lock(&lock);
+	rate = bytes_per_sec > 0 ? bytes_per_sec : 1;
+	measured = 0;
+	pthread_cond_broadcast(&cond);
+	pthread_mutex_unlock(&lock);
+}
+
+// Before start(), a handful of msgids at most
+void
+Tx_Scheduler::
+set_class(uint32_t msgid, Tx_Class tx_class)
+{
+	pthread_mutex_lock(&lock);
+	int i = 0;
+	while (i < num_overrides && override_msgid[i] != msgid)
+		i++;
+	if (i < (int)(sizeof(override_msgid) / sizeof(override_msgid[0])))
+	{
+		override_msgid[i] = msgid;
+		override_class[i] = tx_class;
+		if (i == num_overrides)
+			num_overrides++;
+	}
+	pthread_mutex_unlock(&lock);
+}
+
+Tx_Class
+Tx_Scheduler::
+class_of(uint32_t msgid)
+{
+	switch (msgid)
+	{
+	case MAVLINK_MSG_ID_HEARTBEAT:
+	case MAVLINK_MSG_ID_COMMAND_LONG:
+	case MAVLINK_MSG_ID_COMMAND_INT:
+	case MAVLINK_MSG_ID_COMMAND_ACK:
+	case MAVLINK_MSG_ID_SETUP_SIGNING:
+	case MAVLINK_MSG_ID_SET_MODE:
+		return TX_CLASS_CONTROL;
+
+	case MAVLINK_MSG_ID_HIL_GPS:
+	case MAVLINK_MSG_ID_GPS_INPUT:
+	case MAVLINK_MSG_ID_GPS_RAW_INT:
+	case MAVLINK_MSG_ID_GLOBAL_POSITION_INT:
+	case MAVLINK_MSG_ID_SET_POSITION_TARGET_LOCAL_NED:
+	case MAVLINK_MSG_ID_SET_POSITION_TARGET_GLOBAL_INT:
+	case MAVLINK_MSG_ID_SET_ATTITUDE_TARGET:
+	case MAVLINK_MSG_ID_VISION_POSITION_ESTIMATE:
+	case MAVLINK_MSG_ID_ODOMETRY:
+		return TX_CLASS_POSITION;
+
+	case MAVLINK_MSG_ID_PARAM_REQUEST_READ:
+	case MAVLINK_MSG_ID_PARAM_REQUEST_LIST:
+	case MAVLINK_MSG_ID_PARAM_SET:
+	case MAVLINK_MSG_ID_PARAM_VALUE:
+	case MAVLINK_MSG_ID_MISSION_ITEM_INT:
+	case MAVLINK_MSG_ID_MISSION_COUNT:
+	case MAVLINK_MSG_ID_MISSION_REQUEST_INT:
+	case MAVLINK_MSG_ID_MISSION_ACK:
+	case MAVLINK_MSG_ID_FILE_TRANSFER_PROTOCOL:
+	case MAVLINK_MSG_ID_LOG_REQUEST_LIST:
+	case MAVLINK_MSG_ID_LOG_REQUEST_DATA:
+	case MAVLINK_MSG_ID_LOGGING_ACK:
+	case MAVLINK_MSG_ID_REMOTE_LOG_BLOCK_STATUS:
+		return TX_CLASS_BULK;
+
+	default:
+		return TX_CLASS_TELEMETRY;
+	}
+}
+
+Tx_Class
+Tx_Scheduler::
+classify(uint32_t msgid)
+{
+	pthread_mutex_lock(&lock);
+	Tx_Class tx_class = _classify(msgid);
+	pthread_mutex_unlock(&lock);
+	return tx_class;
+}
+
+Tx_Class
+Tx_Scheduler::
+_classify(uint32_t msgid)
+{
+	for (int i = 0; i < num_overrides; i++)
+	{
+		if (override_msgid[i] == msgid)
+			return (Tx_Class)override_class[i];
+	}
+	return class_of(msgid);
+}
+
+// ------------------------------------------------------------------------------
+//   Queue
+// ------------------------------------------------------------------------------
+
+Tx_Scheduler::Tx_Slot &
+Tx_Scheduler::
+_slot(Tx_Class tx_class, int i)
+{
+	Tx_Queue &queue = queues[tx_class];
+	return queue.slots[(queue.head + i) % tx_class_configs[tx_class].limit];
+}
+
+/*
+ * The slot a frame of msgid goes in, the one of the same msgid it replaces
+ * or a new one at the tail, or NULL when its class refuses it.  Called
+ * with the lock held; the caller fills in the frame.
+ */
+Tx_Scheduler::Tx_Slot *
+Tx_Scheduler::
+_reserve(uint32_t msgid, uint16_t len, uint32_t stamp)
+{
+	Tx_Class tx_class = _classify(msgid);
+	const Tx_Class_Config &config = tx_class_configs[tx_class];
+	Tx_Queue &queue = queues[tx_class];
+	Tx_Class_Stats &class_stats = stats[tx_class];
+	Tx_Slot *slot = NULL;
+
+	// the one of this msgid still waiting is out of date
+	if (config.policy == TX_KEEP_LATEST)
+	{
+		for (int i = 0; i < queue.count && !slot; i++)
+		{
+			if (_slot(tx_class, i).msgid == msgid)
+			{
+				slot = &_slot(tx_class, i);
+				class_stats.replaced++;
+			}
+		}
+	}
+
+	if (!slot)
+	{
+		if (queue.count == config.limit && config.policy == TX_DROP_NEWEST)
+		{
+			class_stats.dropped++;
+			return NULL;
+		}
+		if (queue.count == config.limit)
+		{
+			queue.head = (queue.head + 1) % config.limit;
+			queue.count--;
+			class_stats.dropped++;
+		}
+		slot = &_slot(tx_class, queue.count++);
+		class_stats.queued++;
+
+		if ((uint32_t)queue.count > class_stats.peak)
+			class_stats.peak = queue.count;
+	}
+
+	slot->msgid = msgid;
+	slot->len = len;
+	slot->stamp = stamp;
+	return slot;
+}
+
+/*
+ * Queues the frame and returns its length, or 0 when its class refused
+ * it.  Never waits for the link.  Serialized straight into the slot.
+ */
+int
+Tx_Scheduler::
+write_message(const mavlink_message_t &message)
+{
+	uint32_t stamp = latency_stamp();
+	uint16_t len = mavlink_msg_get_send_buffer_length(&message);
+
+	pthread_mutex_lock(&lock);
+	if (signing)
+		len += MAVLINK_SIGNATURE_BLOCK_LEN;
+
+	Tx_Slot *slot = _reserve(message.msgid, len, stamp);
+	if (slot)
+		slot->size = mavlink_msg_to_send_buffer(slot->frame, &message);
+
+	pthread_cond_broadcast(&cond);
+	pthread_mutex_unlock(&lock);
+
+	return slot ? len : 0;
+}
+
+// The same for a frame from frame_encode(), copied as it is
+int
+Tx_Scheduler::
+write_frame(uint8_t *frame, unsigned len)
+{
+	uint32_t stamp = latency_stamp();
+	uint16_t wire = len;
+
+	pthread_mutex_lock(&lock);
+	if (signing)
+		wire += MAVLINK_SIGNATURE_BLOCK_LEN;
+
+	Tx_Slot *slot = _reserve(frame_msgid(frame), wire, stamp);
+	if (slot)
+	{
+		memcpy(slot->frame, frame, len);
+		slot->size = len;
+	}
+
+	pthread_cond_broadcast(&cond);
+	pthread_mutex_unlock(&lock);
+
+	return slot ? wire : 0;
+}
+
+// Waits until everything queued is on the lower port, false on timeout
+bool
+Tx_Scheduler::
+flush(int timeout_ms)
+{
+	struct timespec deadline;
+	clock_gettime(CLOCK_REALTIME, &deadline);
+	deadline.tv_sec += timeout_ms / 1000;
+	deadline.tv_nsec += (timeout_ms % 1000) * 1000000L;
+	if (deadline.tv_nsec >= 1000000000L)
+	{
+		deadline.tv_sec++;
+		deadline.tv_nsec -= 1000000000L;
+	}
+
+	pthread_mutex_lock(&lock);
+	bool empty = false;
+	while (tx_tid && !time_to_exit)
+	{
+		empty = !busy;
+		for (int c = 0; c < TX_NUM_CLASSES && empty; c++)
+			empty = queues[c].count == 0;
+		if (empty || pthread_cond_timedwait(&cond, &lock, &deadline) == ETIMEDOUT)
+			break;
+	}
+	pthread_mutex_unlock(&lock);
+
+	// nothing sends without the thread, nothing to wait for either
+	return empty || !tx_tid;
+}
+
+// ------------------------------------------------------------------------------
+//   Token Bucket
+// ------------------------------------------------------------------------------
+
+// The configured rate, or what writes drained at when the link is slower
+double
+Tx_Scheduler::
+_rate()
+{
+	return measured > 0 && measured < rate ? measured : rate;
+}
+
+void
+Tx_Scheduler::
+_refill(uint64_t now)
+{
+	tokens += _rate() * (now - refill_usec) / 1e6;
+	if (tokens > TX_SCHEDULER_BURST_BYTES)
+		tokens = TX_SCHEDULER_BURST_BYTES;
+	refill_usec = now;
+}
+
+// ------------------------------------------------------------------------------
+//   Transmit Thread
+// ------------------------------------------------------------------------------
+void
+Tx_Scheduler::
+tx_thread()
+{
+	pthread_mutex_lock(&lock);
+
+	while (!time_to_exit)
+	{
+		// highest class with something queued
+		int c = 0;
+		while (c < TX_NUM_CLASSES && queues[c].count == 0)
+			c++;
+		if (c == TX_NUM_CLASSES)
+		{
+			pthread_cond_wait(&cond, &lock);
+			continue;
+		}
+		Tx_Class tx_class = (Tx_Class)c;
+
+		uint64_t now = _now_usec();
+		_refill(now);
+
+		// not enough in the bucket, wait for it or for a more urgent frame
+		Tx_Slot &next = _slot(tx_class, 0);
+		if (tokens < next.len)
+		{
+			uint64_t wait_us = (uint64_t)((next.len - tokens) * 1e6 / _rate()) + 1;
+
+			struct timespec deadline;
+			clock_gettime(CLOCK_REALTIME, &deadline);
+			deadline.tv_sec += wait_us / 1000000;
+			deadline.tv_nsec += (wait_us % 1000000) * 1000;
+			if (deadline.tv_nsec >= 1000000000L)
+			{
+				deadline.tv_sec++;
+				deadline.tv_nsec -= 1000000000L;
+			}
+			pthread_cond_timedwait(&cond, &lock, &deadline);
+			throttled_usec += _now_usec() - now;
+			continue;
+		}
+
+		// take it off the queue and write it without the lock, the slot
+		// may be reused meanwhile so the frame is copied out, just its bytes
+		uint8_t frame[FRAME_ENCODER_BUFFER_LEN];
+		unsigned size = next.size;
+		uint32_t stamp = next.stamp;
+		memcpy(frame, next.frame, size);
+		tokens -= next.len;
+
+		Tx_Queue &queue = queues[tx_class];
+		queue.head = (queue.head + 1) % tx_class_configs[tx_class].limit;
+		queue.count--;
+		busy = true;
+		pthread_mutex_unlock(&lock);
+
+		uint64_t write_start = _now_usec();
+		int written = lower->write_frame(frame, size);
+		uint64_t write_usec = _now_usec() - write_start;
+		latency[tx_class].record_since(stamp);
+
+		pthread_mutex_lock(&lock);
+		busy = false;
+		if (written > 0)
+			stats[tx_class].sent++;
+		else
+			stats[tx_class].dropped++;
+
+		// a write that waited for the wire tells how fast the link drains, one
+		// that did not says it drains faster than that, back toward the
+		// configured rate; either moves the average by an eighth, so a single
+		// preempted write does not throttle the link
+		if (written > 0)
+		{
+			double current = measured > 0 ? measured : rate;
+			double drained = write_usec >= TX_SCHEDULER_MIN_MEASURE_US ? written * 1e6 / write_usec : rate;
+			if (measured > 0 || drained < rate)
+				measured = current + (drained - current) / 8;
+		}
+
+		pthread_cond_broadcast(&cond);
+	}
+
+	pthread_mutex_unlock(&lock);
+}
+
+void *
+start_tx_scheduler_thread(void *args)
+{
+	// takes a Tx_Scheduler object argument
+	Tx_Scheduler *tx_scheduler = (Tx_Scheduler *)args;
+
+	// run the object's tx thread
+	tx_scheduler->start_tx_thread();
+
+	// done!
+	return NULL;
+}
+
+void
+Tx_Scheduler::
+start_tx_thread()
+{
+	tx_thread();
+}
+
+// ------------------------------------------------------------------------------
+//   Start / Stop
+// ------------------------------------------------------------------------------
+void
+Tx_Scheduler::
+start()
+{
+	lower->start();
+
+	pthread_mutex_lock(&lock);
+	time_to_exit = false;
+	start_usec = _now_usec();
+	refill_usec = start_usec;
+	pthread_mutex_unlock(&lock);
+
+	int result = thread_config_create(&tx_tid, THREAD_TX, &start_tx_scheduler_thread, this);
+	if (result)
+		throw result;
+}
+
+// What is still queued gets TX_SCHEDULER_FLUSH_MS to go out
+void
+Tx_Scheduler::
+stop()
+{
+	if (tx_tid)
+	{
+		flush(TX_SCHEDULER_FLUSH_MS);
+
+		pthread_mutex_lock(&lock);
+		time_to_exit = true;
+		pthread_cond_broadcast(&cond);
+		pthread_mutex_unlock(&lock);
+
+		thread_config_join(tx_tid, NULL);
+		tx_tid = 0;
+	}
+
+	lower->stop();
+}
+
+// ------------------------------------------------------------------------------
+//   Report
+// ------------------------------------------------------------------------------
+
+Tx_Class_Stats
+Tx_Scheduler::
+get_stats(Tx_Class tx_class)
+{
+	pthread_mutex_lock(&lock);
+	Tx_Class_Stats copy = stats[tx_class];
+	pthread_mutex_unlock(&lock);
+	return copy;
+}
+
+// per class counters and time from write_message() to the lower port
+void
+Tx_Scheduler::
+dump(FILE *out)
+{
+	pthread_mutex_lock(&lock);
+	uint64_t elapsed = _now_usec() - start_usec;
+	fprintf(out, "TX SCHEDULER: %.0f B/s configured, %.0f B/s measured, throttled %.1f%% of %.1f s\n",
+			rate, measured, elapsed ? 100.0 * throttled_usec / elapsed : 0.0, elapsed / 1e6);
+	fprintf(out, "  %-10s %8s %8s %8s %8s %5s %6s\n", "class", "queued", "sent", "dropped",
+			"replaced", "peak", "limit");
+	for (int c = 0; c < TX_NUM_CLASSES; c++)
+	{
+		fprintf(out, "  %-10s %8lu %8lu %8lu %8lu %5lu %6d\n", tx_class_configs[c].name,
+				(unsigned long)stats[c].queued, (unsigned long)stats[c].sent,
+				(unsigned long)stats[c].dropped, (unsigned long)stats[c].replaced,
+				(unsigned long)stats[c].peak, tx_class_configs[c].limit);
+	}
+	pthread_mutex_unlock(&lock);
+
+	char line[128];
+	fprintf(out, "%-24s %10s %14s %14s %14s %14s\n", "tx latency (us)", "count", "p50", "p99", "p99.9", "max");
+	for (int c = 0; c < TX_NUM_CLASSES; c++)
+	{
+		latency[c].format(line, sizeof(line));
+		fputs(line, out);
+	}
+}
@@ -0,0 +1,190 @@
+/**
+ * @file tx_scheduler.h
+ *
+ * @brief Transmit scheduler definition
+ *
+ * Sits in front of a port and sends what is written to it by priority
+ * class, paced by a token bucket at the rate the link can carry, so bulk
+ * traffic waits behind GPS fixes and setpoints instead of ahead of them.
+ *
+ */
+
+#ifndef TX_SCHEDULER_H_
+#define TX_SCHEDULER_H_
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pthread.h> // This uses POSIX Threads
+
+#include "../include/mavlink/v2.0/spresense/mavlink.h"
+
+#include "generic_port.h"
+#include "latency_histogram.h"
+#include "../include/thread_config.h"
+
+// ------------------------------------------------------------------------------
+//   Defines
+// ------------------------------------------------------------------------------
+
+// Share of the line rate used, the rest is slack for the autopilot's replies
+// on a half duplex radio and for UART start/stop bit jitter
+#define TX_SCHEDULER_UTILIZATION 0.9
+
+// Bucket depth in bytes, two full signed frames
+#define TX_SCHEDULER_BURST_BYTES 600
+
+// Writes shorter than this did not wait for the wire, not a measurement
+#define TX_SCHEDULER_MIN_MEASURE_US 200
+
+// How long set_signing() waits for queued frames to go out unsigned
+#define TX_SCHEDULER_FLUSH_MS 1000
+
+// ------------------------------------------------------------------------------
+//   Data Structures
+// ------------------------------------------------------------------------------
+
+// Highest priority first
+enum Tx_Class
+{
+	TX_CLASS_CONTROL,	// heartbeat, commands and their acks
+	TX_CLASS_POSITION,	// GPS fixes and setpoints
+	TX_CLASS_TELEMETRY,	// everything not listed
+	TX_CLASS_BULK,		// parameters, missions, FTP, log acks
+	TX_NUM_CLASSES
+};
+
+enum Tx_Drop_Policy
+{
+	TX_DROP_NEWEST,		// refuse the frame, the caller sees 0 and may retry
+	TX_DROP_OLDEST,		// make room by dropping the oldest queued
+	TX_KEEP_LATEST		// replace the queued frame with the same msgid
+};
+
+struct Tx_Class_Config
+{
+	const char *name;
+	int limit;			// frames queued at most
+	Tx_Drop_Policy policy;
+};
+
+struct Tx_Class_Stats
+{
+	uint32_t queued;
+	uint32_t sent;
+	uint32_t dropped;	// refused or pushed out
+	uint32_t replaced;	// by a newer frame of the same msgid
+	uint32_t peak;		// deepest the queue got
+};
+
+// ----------------------------------------------------------------------------------
+//   Transmit Scheduler Class
+// ----------------------------------------------------------------------------------
+/*
+ * Transmit Scheduler Class
+ *
+ * write_message() and write_frame() classify the frame by msgid and queue
+ * it serialized, they never wait for the link.  A tx thread takes the highest class with anything
+ * queued and sends it on the lower port once the bucket holds enough bytes
+ * for it.  The bucket fills at the configured rate, from the baud rate,
+ * or at the rate writes were measured to drain at when that is lower, as
+ * on a radio that holds CTS.  Reads go straight to the lower port.
+ *
+ * Each class has its own queue limit and drop policy and a histogram of
+ * the time from write_message() until the frame was on the lower port.
+ */
+class Tx_Scheduler : public Generic_Port
+{
+
+public:
+	Tx_Scheduler(Generic_Port *lower_, int baudrate_);
+	virtual ~Tx_Scheduler();
+
+	int read_message(mavlink_message_t &message);
+	int write_message(const mavlink_message_t &message);
+	int write_frame(uint8_t *frame, unsigned len);
+
+	bool is_running();
+	void start();
+	void stop();
+
+	void set_recorder(Tlog_Recorder *recorder_);
+	void set_signing(Mavlink_Signing *signing_);
+	Link_Stats *get_link_stats();
+	int get_num_link_stats();
+	Link_Stats *get_link_stats_at(int index);
+	uint32_t get_frame_stamp();
+
+	void set_baudrate(int baudrate_);
+	void set_rate(double bytes_per_sec);
+	void set_class(uint32_t msgid, Tx_Class tx_class);
+	bool flush(int timeout_ms);
+
+	Tx_Class_Stats get_stats(Tx_Class tx_class);
+	void dump(FILE *out);
+
+	// class_of() with the set_class() overrides
+	Tx_Class classify(uint32_t msgid);
+	static Tx_Class class_of(uint32_t msgid);
+
+	void start_tx_thread();
+
+private:
+	// serialized as it goes to the lower port, signed there
+	struct Tx_Slot
+	{
+		uint8_t frame[FRAME_ENCODER_BUFFER_LEN];
+		uint32_t msgid;
+		uint32_t stamp;		// latency_stamp() when written
+		uint16_t size;		// bytes in frame
+		uint16_t len;		// bytes on the wire
+	};
+
+	struct Tx_Queue
+	{
+		Tx_Slot *slots;
+		int head;
+		int count;
+	};
+
+	Generic_Port *lower;
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	pthread_t tx_tid;
+	bool time_to_exit;
+	bool busy;			// a frame is being written
+
+	Tx_Queue queues[TX_NUM_CLASSES];
+	Tx_Class_Stats stats[TX_NUM_CLASSES];
+	Latency_Histogram latency[TX_NUM_CLASSES];
+
+	// msgids moved to another class than class_of() says
+	uint32_t override_msgid[16];
+	uint8_t override_class[16];
+	int num_overrides;
+
+	// token bucket, in bytes
+	double rate;		// configured
+	double measured;	// what writes drained at, 0 until one drained slower than rate
+	double tokens;
+	uint64_t refill_usec;
+	uint64_t start_usec;
+	uint64_t throttled_usec;	// time a frame waited for tokens
+
+	void initialize_defaults();
+
+	Tx_Class _classify(uint32_t msgid);
+	Tx_Slot &_slot(Tx_Class tx_class, int i);
+	Tx_Slot *_reserve(uint32_t msgid, uint16_t len, uint32_t stamp);
+	double _rate();
+	void _refill(uint64_t now);
+
+	void tx_thread();
+};
+
+void *start_tx_scheduler_thread(void *args);
+
+#endif // TX_SCHEDULER_H_
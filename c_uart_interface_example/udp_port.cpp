@@ -71,6 +71,10 @@ UDP_Port(const char *target_ip_, int udp_port_)
 	target_ip = target_ip_;
 	rx_port  = udp_port_;
 	is_open = false;
+
+	char name[LINK_STATS_NAME_LEN];
+	snprintf(name, sizeof(name), "udp %s:%d", target_ip, rx_port);
+	link_stats.set_name(name);
 }
 
 UDP_Port::
@@ -82,6 +86,9 @@ UDP_Port()
 UDP_Port::
 ~UDP_Port()
 {
+	link_stats_unregister(&link_stats);
+	mavlink_channel_free(rx_chan);
+
 	// destroy mutex
 	pthread_mutex_destroy(&lock);
 }
@@ -98,6 +105,14 @@ initialize_defaults()
 	debug = false;
 	sock = -1;
 
+	// a parser of its own, other ports parse on other channels
+	rx_chan = mavlink_channel_alloc("udp");
+	if (rx_chan == MAVLINK_CHANNEL_NONE)
+	{
+		printf("\n no free MAVLink channel, %d in use\n", mavlink_channel_in_use());
+		throw 1;
+	}
+
 	// Start mutex
 	int result = pthread_mutex_init(&lock, NULL);
 	if ( result != 0 )
@@ -132,8 +147,18 @@ read_message(mavlink_message_t &message)
 	// --------------------------------------------------------------------------
 	if (result > 0)
 	{
+		// a frame starts with the byte read while the parser is idle
+		uint32_t stamp = latency_stamp();
+		if (mavlink_get_channel_status(rx_chan)->parse_state <= MAVLINK_PARSE_STATE_IDLE)
+			rx_start_stamp = stamp;
+
 		// the parsing
-		msgReceived = mavlink_parse_char(MAVLINK_COMM_1, cp, &message, &status);
+		msgReceived = link_stats_parse_char(link_stats, rx_chan, cp, &message, &status);
+		if (msgReceived)
+		{
+			rx_frame_stamp = latency_stamp();
+			latency_histogram(LATENCY_RX_FRAME).record_between(rx_start_stamp, rx_frame_stamp);
+		}
 
 		// check for dropped packets
 		if ( (lastStatus.packet_rx_drop_count != status.packet_rx_drop_count) && debug )
@@ -143,11 +168,24 @@ read_message(mavlink_message_t &message)
 			fprintf(stderr,"%02x ", v);
 		}
 		lastStatus = status;
+
+		// drop frames that fail the signature or replay check
+		Mavlink_Signing *signer = signing.load();
+		if (msgReceived && signer && !signer->verify(message))
+		{
+			link_stats.signature_error();
+			msgReceived = false;
+		}
+
+		// record the validated frame, costs one copy into the ring
+		if (msgReceived && recorder)
+			recorder->record(message);
 	}
 
 	// Couldn't read from port
 	else
 	{
+		link_stats.read_error();
 		fprintf(stderr, "ERROR: Could not read, res = %d, errno = %d : %m\n", result, errno);
 	}
 
@@ -195,13 +233,41 @@ int
 UDP_Port::
 write_message(const mavlink_message_t &message)
 {
-	char buf[300];
+	uint8_t buf[FRAME_ENCODER_BUFFER_LEN];
+	uint32_t start = latency_stamp();
 
 	// Translate message to buffer
-	unsigned len = mavlink_msg_to_send_buffer((uint8_t*)buf, &message);
+	unsigned len = mavlink_msg_to_send_buffer(buf, &message);
+
+	return _send_frame(buf, len, start);
+}
+
+// already serialized by frame_encode(), no copy on the way
+int
+UDP_Port::
+write_frame(uint8_t *frame, unsigned len)
+{
+	return _send_frame(frame, len, latency_stamp());
+}
+
+int
+UDP_Port::
+_send_frame(uint8_t *frame, unsigned len, uint32_t start)
+{
+	// sign in place, adds the 13 byte signature block
+	Mavlink_Signing *signer = signing.load();
+	if (signer)
+		len = signer->sign(frame, len);
 
 	// Write buffer to UDP port, locks port while writing
-	int bytesWritten = _write_port(buf,len);
+	int bytesWritten = _write_port((char*)frame,len);
+	latency_histogram(LATENCY_ENCODE_WRITE).record_since(start);
+	if (bytesWritten > 0)
+		link_stats.tx_frame(frame_msgid(frame), bytesWritten);
+	else
+		link_stats.write_error();
+	if (bytesWritten > 0 && recorder)
+		recorder->record(frame, len);
 	if(bytesWritten < 0){
 		fprintf(stderr, "ERROR: Could not write, res = %d, errno = %d : %m\n", bytesWritten, errno);
 	}
@@ -262,6 +328,9 @@ start()
 
 	is_open = true;
 
+	// visible in /proc/mavlink from now on
+	link_stats_register(&link_stats);
+
 	printf("\n");
 
 	return;
@@ -302,8 +371,10 @@ _read_port(uint8_t &cp)
 
 	socklen_t len;
 
-	// Lock
+	// Lock, timing the wait
+	uint32_t wait = latency_stamp();
 	pthread_mutex_lock(&lock);
+	latency_histogram(LATENCY_LOCK_WAIT).record_since(wait);
 
 	int result = -1;
 	if(buff_ptr < buff_len){
@@ -323,6 +394,7 @@ _read_port(uint8_t &cp)
 			}
 		}
 		if(result > 0){
+			link_stats.rx_bytes(result);
 			buff_len=result;
 			buff_ptr=0;
 			cp=buff[buff_ptr];
@@ -346,8 +418,10 @@ UDP_Port::
 _write_port(char *buf, unsigned len)
 {
 
-	// Lock
+	// Lock, timing the wait
+	uint32_t wait = latency_stamp();
 	pthread_mutex_lock(&lock);
+	latency_histogram(LATENCY_LOCK_WAIT).record_since(wait);
 
 	// Write packet via UDP link
 	int bytesWritten = 0;
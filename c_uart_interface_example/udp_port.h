@@ -73,9 +73,10 @@
 #include <arpa/inet.h>
 #include <stdbool.h>
 
-#include "../include/mavlink/v2.0/common/mavlink.h"
+#include "../include/mavlink/v2.0/spresense/mavlink.h"
 
 #include "generic_port.h"
+#include "mavlink_channel.h"
 
 // ------------------------------------------------------------------------------
 //   Defines
@@ -107,6 +108,7 @@ public:
 
 	int read_message(mavlink_message_t &message);
 	int write_message(const mavlink_message_t &message);
+	int write_frame(uint8_t *frame, unsigned len);
 
 	bool is_running()
 	{
@@ -116,6 +118,7 @@ public:
 	void stop();
 
 private:
+	uint8_t rx_chan;	// from mavlink_channel_alloc()
 	mavlink_status_t lastStatus;
 	pthread_mutex_t lock;
 
@@ -134,6 +137,7 @@ private:
 
 	int _read_port(uint8_t &cp);
 	int _write_port(char *buf, unsigned len);
+	int _send_frame(uint8_t *frame, unsigned len, uint32_t start);
 };
 
 #endif // UDP_PORT_H_
@@ -0,0 +1,644 @@
+#!/usr/bin/env python3
+#
+# mavlink_dialect.py
+#
+# Builds a MAVLink dialect holding only the messages this application uses,
+# from message_definitions/*.xml.  Driven by mavlink_dialect.conf.
+#
+# The message headers are the ones mavgen generated for the dialect that
+# defines each message, copied after their CRC_EXTRA and lengths were
+# checked against the XML.  The dialect header, the enums and the
+# MAVLINK_MESSAGE_CRCS entry table are generated here.  The entry table is
+# what mavlink_get_msg_entry() bisects on every frame parsed and every frame
+# sent, and each translation unit that parses or sends keeps its own copy.
+#
+# mavlink_views.h gets a Mavlink_View class per message (include/
+# mavlink_view.h), with an accessor per field at the wire offset given in
+# the header's MAVLINK_MESSAGE_INFO_* table.
+#
+# With Channels set, mavlink.h moves the parser state and buffer of each
+# channel out of mavlink_helpers.h, where every translation unit gets its
+# own, to one array for the program that the application defines.
+#
+# With BenchOutput set, also writes the table of mavlink_bench msgs: a
+# function per message of the whole Base dialect, filled with the test
+# values of the mavgen testsuite.h and calling that message's pack, encode
+# and decode.
+#
+
+import hashlib
+import os
+import re
+import shutil
+import struct
+import sys
+import xml.etree.ElementTree as ET
+
+# Set by mavlink_dialect.conf
+Name = 'spresense'
+Definitions = 'message_definitions'
+Base = 'ardupilotmega.xml'
+Messages = []
+OutputDir = '.'
+Channels = 0
+BenchOutput = None
+
+TYPE_LENGTHS = {
+    'char': 1, 'uint8_t': 1, 'int8_t': 1,
+    'uint16_t': 2, 'int16_t': 2,
+    'uint32_t': 4, 'int32_t': 4, 'float': 4,
+    'uint64_t': 8, 'int64_t': 8, 'double': 8,
+}
+
+MAV_MSG_ENTRY_FLAG_HAVE_TARGET_SYSTEM = 1
+MAV_MSG_ENTRY_FLAG_HAVE_TARGET_COMPONENT = 2
+
+# MAVLINK_TYPE_* of the field tables
+INFO_TYPES = {
+    'CHAR': 'char', 'UINT8_T': 'uint8_t', 'INT8_T': 'int8_t',
+    'UINT16_T': 'uint16_t', 'INT16_T': 'int16_t',
+    'UINT32_T': 'uint32_t', 'INT32_T': 'int32_t', 'FLOAT': 'float',
+    'UINT64_T': 'uint64_t', 'INT64_T': 'int64_t', 'DOUBLE': 'double',
+}
+
+# field names that cannot be accessor names as they are
+RESERVED = set(['valid', 'message', 'msgid', 'class', 'default', 'delete', 'new',
+                'private', 'public', 'protected', 'register', 'signed', 'union',
+                'operator', 'template', 'this', 'switch', 'case', 'return'])
+
+
+class Field(object):
+    def __init__(self, elem, extension):
+        self.name = elem.get('name')
+        self.extension = extension
+        self.array_length = 0
+        type = elem.get('type')
+        m = re.match(r'^(\w+)\[(\d+)\]$', type)
+        if m:
+            type = m.group(1)
+            self.array_length = int(m.group(2))
+        if type == 'uint8_t_mavlink_version':
+            type = 'uint8_t'
+        if type not in TYPE_LENGTHS:
+            raise SystemExit('unknown field type %s in %s' % (type, self.name))
+        self.type = type
+        self.wire_length = TYPE_LENGTHS[type] * max(self.array_length, 1)
+
+
+class Message(object):
+    def __init__(self, elem, dialect):
+        self.name = elem.get('name')
+        self.id = int(elem.get('id'))
+        self.dialect = dialect
+
+        fields = []
+        extension = False
+        for child in elem:
+            if child.tag == 'extensions':
+                extension = True
+            elif child.tag == 'field':
+                fields.append(Field(child, extension))
+
+        # wire order: base fields by element size, largest first, stable,
+        # then the extensions as written
+        base = [f for f in fields if not f.extension]
+        ordered = sorted(base, key=lambda f: TYPE_LENGTHS[f.type], reverse=True)
+        ordered += [f for f in fields if f.extension]
+        self.fields = ordered
+
+        self.min_len = sum(f.wire_length for f in base)
+        self.max_len = sum(f.wire_length for f in ordered)
+        self.crc_extra = _crc_extra(self.name, ordered[:len(base)])
+
+        self.flags = 0
+        self.target_system_ofs = 0
+        self.target_component_ofs = 0
+        offset = 0
+        for f in ordered:
+            # MANUAL_CONTROL calls it target
+            if f.name in ('target_system', 'target') and f.type == 'uint8_t':
+                self.flags |= MAV_MSG_ENTRY_FLAG_HAVE_TARGET_SYSTEM
+                self.target_system_ofs = offset
+            elif f.name == 'target_component' and f.type == 'uint8_t':
+                self.flags |= MAV_MSG_ENTRY_FLAG_HAVE_TARGET_COMPONENT
+                self.target_component_ofs = offset
+            offset += f.wire_length
+
+
+class Enum(object):
+    def __init__(self, name, description):
+        self.name = name
+        self.description = description
+        self.entries = []
+
+
+def _x25(data, crc):
+    for b in data:
+        tmp = b ^ (crc & 0xFF)
+        tmp = (tmp ^ (tmp << 4)) & 0xFF
+        crc = ((crc >> 8) ^ (tmp << 8) ^ (tmp << 3) ^ (tmp >> 4)) & 0xFFFF
+    return crc
+
+
+def _crc_extra(name, fields):
+    crc = _x25((name + ' ').encode(), 0xFFFF)
+    for f in fields:
+        crc = _x25((f.type + ' ').encode(), crc)
+        crc = _x25((f.name + ' ').encode(), crc)
+        if f.array_length:
+            crc = _x25([f.array_length], crc)
+    return (crc & 0xFF) ^ (crc >> 8)
+
+
+def _text(elem):
+    if elem is None or elem.text is None:
+        return ''
+    text = ' '.join(elem.text.split())
+    return text.replace('*/', '* /')
+
+
+def _load(path, messages, enums, enum_order, loaded):
+    path = os.path.normpath(path)
+    if path in loaded:
+        return
+    loaded.add(path)
+
+    root = ET.parse(path).getroot()
+    dialect = os.path.splitext(os.path.basename(path))[0]
+
+    # included files first, as mavgen does
+    for include in root.findall('include'):
+        _load(os.path.join(os.path.dirname(path), include.text.strip()),
+              messages, enums, enum_order, loaded)
+
+    for elem in root.findall('enums/enum'):
+        name = elem.get('name')
+        if name not in enums:
+            enums[name] = Enum(name, _text(elem.find('description')))
+            enum_order.append(name)
+        enum = enums[name]
+        for entry in elem.findall('entry'):
+            value = entry.get('value')
+            if value is None:
+                value = enum.entries[-1][1] + 1 if enum.entries else 0
+            else:
+                value = int(value, 0)
+            enum.entries.append((entry.get('name'), value, _text(entry.find('description'))))
+
+    for elem in root.findall('messages/message'):
+        message = Message(elem, dialect)
+        if message.name in messages:
+            raise SystemExit('message %s defined twice' % message.name)
+        messages[message.name] = message
+
+
+def _header_define(text, name):
+    m = re.search(r'#define %s (\d+)' % name, text)
+    return int(m.group(1)) if m else None
+
+
+def _copy_message(message, include_dir, output_dir):
+    header = 'mavlink_msg_%s.h' % message.name.lower()
+    src = os.path.join(include_dir, message.dialect, header)
+    if not os.path.exists(src):
+        raise SystemExit('%s: no %s, generate the %s dialect with mavgen first'
+                         % (message.name, src, message.dialect))
+
+    # the header must be the one generated from this XML
+    with open(src) as f:
+        text = f.read()
+    prefix = 'MAVLINK_MSG_ID_%s' % message.name
+    checks = [('_CRC', message.crc_extra), ('_MIN_LEN', message.min_len), ('_LEN', message.max_len)]
+    for suffix, wanted in checks:
+        found = _header_define(text, prefix + suffix)
+        if found != wanted:
+            raise SystemExit('%s: %s%s is %s in %s, the XML says %d; regenerate %s with mavgen'
+                             % (message.name, prefix, suffix, found, src, wanted, message.dialect))
+
+    shutil.copyfile(src, os.path.join(output_dir, header))
+    return header
+
+
+def _info_fields(message, text):
+    """(name, type, array_length, wire_offset) of each field, in XML order"""
+    m = re.search(r'#define MAVLINK_MESSAGE_INFO_%s \{(.*?)\n\}' % message.name, text, re.S)
+    if not m:
+        raise SystemExit('%s: no MAVLINK_MESSAGE_INFO_%s' % (message.name, message.name))
+    fields = []
+    for name, type, array_length, offset in re.findall(
+            r'\{ "(\w+)", (?:NULL|"[^"]*"), MAVLINK_TYPE_(\w+), (\d+), (\d+), offsetof', m.group(1)):
+        fields.append((name, INFO_TYPES[type], int(array_length), int(offset)))
+    return fields
+
+
+def _view_class(name):
+    return '_'.join(word.capitalize() for word in name.split('_')) + '_View'
+
+
+def _write_views_h(path, messages, output_dir):
+    out = []
+    out.append('''/** @file
+ *  @brief Read-only views over the payload of the %(name)s messages
+ *  Generated by config/mavlink_dialect.py from MAVLINK_MESSAGE_INFO_*
+ *  @see include/mavlink_view.h
+ */
+#pragma once
+#ifndef MAVLINK_%(upper)s_VIEWS_H
+#define MAVLINK_%(upper)s_VIEWS_H
+
+#include "mavlink.h"
+#include "../../../mavlink_view.h"
+
+''' % {'name': Name, 'upper': Name.upper()})
+
+    for message in messages:
+        with open(os.path.join(output_dir, 'mavlink_msg_%s.h' % message.name.lower())) as f:
+            fields = _info_fields(message, f.read())
+        view = _view_class(message.name)
+
+        out.append('// %s, %d to %d bytes\n' % (message.name, message.min_len, message.max_len))
+        out.append('class %s : public Mavlink_View<MAVLINK_MSG_ID_%s>\n{\n' % (view, message.name))
+        out.append('public:\n')
+        out.append('\texplicit %s(const mavlink_message_t &message_) : Mavlink_View(message_) {}\n\n' % view)
+        for name, type, array_length, offset in fields:
+            accessor = name + '_' if name in RESERVED else name
+            if not array_length:
+                out.append('\t%s %s() const { return _field<%s>(%d); }\n' % (type, accessor, type, offset))
+            elif TYPE_LENGTHS[type] == 1:
+                terminated = ', not terminated when full' if type == 'char' else ''
+                out.append('\tconst %s *%s() const { return _array<%s>(%d); } // [%d]%s\n'
+                           % (type, accessor, type, offset, array_length, terminated))
+            else:
+                out.append('\t%s %s(int i) const { return _field<%s>(%d + i * %d); } // [%d]\n'
+                           % (type, accessor, type, offset, TYPE_LENGTHS[type], array_length))
+        out.append('};\n\n')
+
+    out.append('#endif // MAVLINK_%s_VIEWS_H\n' % Name.upper())
+
+    with open(path, 'w') as f:
+        f.write(''.join(out))
+
+
+def _testsuite_functions(path, seen):
+    """mavlink_test_X bodies of a mavgen testsuite.h and the ones it includes"""
+    path = os.path.normpath(path)
+    if path in seen:
+        return []
+    seen.add(path)
+    with open(path) as f:
+        text = f.read()
+
+    found = []
+    for include in re.findall(r'#include "(\.\./\w+/testsuite\.h)"', text):
+        found += _testsuite_functions(os.path.join(os.path.dirname(path), include), seen)
+    for name, body in re.findall(
+            r'static void mavlink_test_(\w+)\(uint8_t system_id, uint8_t component_id, '
+            r'mavlink_message_t \*last_msg\)\n\{(.*?)\n\}\n', text, re.S):
+        if 'packet_in' in body:
+            found.append((name, body))
+    return found
+
+
+def _split_initializer(values):
+    """Top level elements of a C initializer list, braces and strings kept whole"""
+    elements, depth, quoted, start = [], 0, False, 0
+    for i, c in enumerate(values):
+        if quoted:
+            quoted = c != '"' or values[i - 1] == '\\'
+        elif c == '"':
+            quoted = True
+        elif c == '{':
+            depth += 1
+        elif c == '}':
+            depth -= 1
+        elif c == ',' and depth == 0:
+            elements.append(values[start:i].strip())
+            start = i + 1
+    elements.append(values[start:].strip())
+    return elements
+
+
+def _cast_initializer(message, values):
+    """
+    The testsuite.h values with a cast to their field's type.  The testsuite
+    is C, where 223 into an int8_t is fine; in a C++ brace initializer it
+    is a narrowing error.
+    """
+    elements = _split_initializer(values)
+    if len(elements) != len(message.fields):
+        raise SystemExit('mavlink_test_%s: %d values for %d fields'
+                         % (message.name.lower(), len(elements), len(message.fields)))
+
+    cast = []
+    for field, value in zip(message.fields, elements):
+        if value.startswith('"'):
+            cast.append(value)
+        elif value.startswith('{'):
+            cast.append('{ %s }' % ', '.join('(%s)%s' % (field.type, v) for v in _split_initializer(value.strip('{} '))))
+        else:
+            cast.append('(%s)%s' % (field.type, value))
+    return ', '.join(cast)
+
+
+def _bench_function(message, body):
+    """The mavgen test of one message, timed instead of checked"""
+    name = message.name.lower()
+
+    def part(pattern):
+        m = re.search(pattern, body, re.S)
+        if not m:
+            raise SystemExit('mavlink_test_%s: unexpected testsuite.h, no %s' % (name, pattern))
+        return m.group(1).strip()
+
+    values = _cast_initializer(message, part(r'packet_in = \{(.*?)\};'))
+    copies = [line.strip() for line in
+              part(r'memset\(&packet1, 0, sizeof\(packet1\)\);(.*?)#ifdef').split('\n') if line.strip()]
+    arguments = part(r'_pack\(system_id, component_id, &msg ,(.*?)\);')
+
+    out = []
+    out.append('static void\nmsgbench_%s(Msgbench_Run &run)\n{\n' % name)
+    out.append('\tmavlink_%s_t packet_in = {\n\t\t%s\n\t};\n' % (name, values))
+    out.append('\tmavlink_%s_t packet1, packet2;\n' % name)
+    out.append('\tmemset(&packet1, 0, sizeof(packet1));\n')
+    for line in copies:
+        out.append('\t%s\n' % line)
+    out.append('\tmemset(&packet2, 0, sizeof(packet2));\n\n')
+    out.append('\tMSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_%s_pack(run.system_id, run.component_id, '
+               '&run.message, %s));\n' % (name, arguments))
+    out.append('\tMSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_%s_encode(run.system_id, '
+               'run.component_id, &run.message, &packet1));\n' % name)
+    out.append('\tMSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_%s_decode(&run.message, &packet2));\n'
+               % name)
+    out.append('\trun.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;\n')
+    out.append('}\n\n')
+    return ''.join(out)
+
+
+def _write_bench_h(path, messages, include_dir):
+    suite = os.path.join(include_dir, os.path.splitext(Base)[0], 'testsuite.h')
+    if not os.path.exists(suite):
+        raise SystemExit('no %s, generate the %s dialect with mavgen first' % (suite, Base))
+
+    by_name = dict((m.name.lower(), m) for m in messages.values())
+    selected = set(m.lower() for m in Messages)
+    functions = []
+    for name, body in _testsuite_functions(suite, set()):
+        if name not in by_name:
+            raise SystemExit('mavlink_test_%s: no such message in %s' % (name, Base))
+        functions.append((by_name[name], _bench_function(by_name[name], body)))
+    missing = set(by_name) - set(m.name.lower() for m, _ in functions)
+    if missing:
+        raise SystemExit('%s: no test for %s' % (suite, ', '.join(sorted(missing))))
+    functions.sort(key=lambda f: f[0].id)
+
+    out = []
+    out.append('''/** @file
+ *  @brief Throughput benchmark of every message of %(base)s, one function each
+ *  Generated by config/mavlink_dialect.py from %(suite)s
+ *  @see mavlink_bench/mavlink_msgbench.cpp
+ */
+#pragma once
+#ifndef MAVLINK_MSGBENCH_TABLE_H
+#define MAVLINK_MSGBENCH_TABLE_H
+
+''' % {'base': Base, 'suite': os.path.relpath(suite, os.path.dirname(include_dir))})
+    for _, function in functions:
+        out.append(function)
+
+    out.append('// by msgid, MSGBENCH_DIALECT where the message is compiled into %s\n' % Name)
+    out.append('static const Msgbench_Entry msgbench_entries[] = {\n')
+    for m, _ in functions:
+        out.append('\t{ MAVLINK_MSG_ID_%s, "%s", %s, msgbench_%s },\n'
+                   % (m.name, m.name, 'MSGBENCH_DIALECT' if m.name.lower() in selected else '0', m.name.lower()))
+    out.append('};\n\n')
+    out.append('#endif // MAVLINK_MSGBENCH_TABLE_H\n')
+
+    with open(path, 'w') as f:
+        f.write(''.join(out))
+    return len(functions)
+
+
+def _xml_hash(messages, enums):
+    h = hashlib.sha256()
+    for m in messages:
+        h.update(('%s %d %d %d %d\n' % (m.name, m.id, m.crc_extra, m.min_len, m.max_len)).encode())
+    for e in enums:
+        for entry in e.entries:
+            h.update(('%s %d\n' % (entry[0], entry[1])).encode())
+    return struct.unpack('<Q', h.digest()[:8])[0] >> 1
+
+
+def _write_mavlink_h(path, xml_hash):
+    channels = ''
+    if Channels:
+        channels = '''
+// The parser state and buffer of every channel, one array for the program
+// defined by c_uart_interface_example/mavlink_channel.cpp instead of one in
+// each translation unit; ports take a channel from mavlink_channel_alloc()
+#ifndef MAVLINK_COMM_NUM_BUFFERS
+#define MAVLINK_COMM_NUM_BUFFERS %d
+#endif
+
+#define MAVLINK_EXTERNAL_RX_STATUS
+#define MAVLINK_EXTERNAL_RX_BUFFER
+
+#include "../mavlink_types.h"
+
+extern mavlink_status_t m_mavlink_status[MAVLINK_COMM_NUM_BUFFERS];
+extern mavlink_message_t m_mavlink_buffer[MAVLINK_COMM_NUM_BUFFERS];
+''' % Channels
+
+    with open(path, 'w') as f:
+        f.write('''/** @file
+ *  @brief MAVLink comm protocol built from %(base)s, pruned to %(name)s
+ *  @see config/mavlink_dialect.conf
+ */
+#pragma once
+#ifndef MAVLINK_H
+#define MAVLINK_H
+
+#define MAVLINK_PRIMARY_XML_HASH %(hash)d
+
+#ifndef MAVLINK_STX
+#define MAVLINK_STX 253
+#endif
+
+#ifndef MAVLINK_ENDIAN
+#define MAVLINK_ENDIAN MAVLINK_LITTLE_ENDIAN
+#endif
+
+#ifndef MAVLINK_ALIGNED_FIELDS
+#define MAVLINK_ALIGNED_FIELDS 1
+#endif
+
+#ifndef MAVLINK_CRC_EXTRA
+#define MAVLINK_CRC_EXTRA 1
+#endif
+
+#ifndef MAVLINK_COMMAND_24BIT
+#define MAVLINK_COMMAND_24BIT 1
+#endif
+%(channels)s
+#include "version.h"
+#include "%(name)s.h"
+
+#endif // MAVLINK_H
+''' % {'base': Base, 'name': Name, 'hash': xml_hash, 'channels': channels})
+
+
+def _write_version_h(path, max_len):
+    with open(path, 'w') as f:
+        f.write('''/** @file
+ *  @brief MAVLink comm protocol built from %(base)s, pruned to %(name)s
+ *  @see config/mavlink_dialect.conf
+ */
+#pragma once
+
+#ifndef MAVLINK_VERSION_H
+#define MAVLINK_VERSION_H
+
+#define MAVLINK_WIRE_PROTOCOL_VERSION "2.0"
+#define MAVLINK_MAX_DIALECT_PAYLOAD_SIZE %(max_len)d
+
+#endif // MAVLINK_VERSION_H
+''' % {'base': Base, 'name': Name, 'max_len': max_len})
+
+
+def _write_dialect_h(path, messages, enums, headers, xml_hash):
+    upper = Name.upper()
+    by_id = sorted(messages, key=lambda m: m.id)
+    by_name = sorted(messages, key=lambda m: m.name)
+
+    crcs = ', '.join('{%d, %d, %d, %d, %d, %d, %d}' % (m.id, m.crc_extra, m.min_len, m.max_len,
+                                                       m.flags, m.target_system_ofs,
+                                                       m.target_component_ofs) for m in by_id)
+    info = ', '.join('MAVLINK_MESSAGE_INFO_%s' % m.name for m in by_id)
+    names = ', '.join('{ "%s", %d }' % (m.name, m.id) for m in by_name)
+
+    out = []
+    out.append('''/** @file
+ *  @brief MAVLink comm protocol generated from %(base)s, pruned to the
+ *  messages listed in config/mavlink_dialect.conf
+ *  @see http://mavlink.org
+ */
+#pragma once
+#ifndef MAVLINK_%(upper)s_H
+#define MAVLINK_%(upper)s_H
+
+#ifndef MAVLINK_H
+    #error Wrong include order: MAVLINK_%(upper)s.H MUST NOT BE DIRECTLY USED. Include mavlink.h from the same directory instead or set ALL AND EVERY defines from MAVLINK.H manually accordingly, including the #define MAVLINK_H call.
+#endif
+
+#define MAVLINK_%(upper)s_XML_HASH %(hash)d
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// MESSAGE LENGTHS AND CRCS
+
+#ifndef MAVLINK_MESSAGE_LENGTHS
+#define MAVLINK_MESSAGE_LENGTHS {}
+#endif
+
+// %(count)d messages; any other msgid fails the checksum and is counted as
+// unknown by link_stats_parse_char()
+#ifndef MAVLINK_MESSAGE_CRCS
+#define MAVLINK_MESSAGE_CRCS {%(crcs)s}
+#endif
+
+#include "../protocol.h"
+
+#define MAVLINK_ENABLED_%(upper)s
+
+// ENUM DEFINITIONS
+
+''' % {'base': Base, 'upper': upper, 'hash': xml_hash, 'count': len(messages), 'crcs': crcs})
+
+    for e in enums:
+        out.append('/** @brief %s */\n' % e.description)
+        out.append('#ifndef HAVE_ENUM_%s\n#define HAVE_ENUM_%s\n' % (e.name, e.name))
+        out.append('typedef enum %s\n{\n' % e.name)
+        for name, value, description in e.entries:
+            out.append('   %s=%d, /* %s | */\n' % (name, value, description))
+        end = max(v for _, v, _ in e.entries) + 1 if e.entries else 1
+        out.append('   %s_ENUM_END=%d, /*  | */\n' % (e.name, end))
+        out.append('} %s;\n#endif\n\n' % e.name)
+
+    out.append('''// MAVLINK VERSION
+
+#ifndef MAVLINK_VERSION
+#define MAVLINK_VERSION 2
+#endif
+
+#if (MAVLINK_VERSION == 0)
+#undef MAVLINK_VERSION
+#define MAVLINK_VERSION 2
+#endif
+
+// MESSAGE DEFINITIONS
+''')
+    for header in headers:
+        out.append('#include "./%s"\n' % header)
+
+    out.append('''
+
+#if MAVLINK_%(upper)s_XML_HASH == MAVLINK_PRIMARY_XML_HASH
+# define MAVLINK_MESSAGE_INFO {%(info)s}
+# define MAVLINK_MESSAGE_NAMES {%(names)s}
+# if MAVLINK_COMMAND_24BIT
+#  include "../mavlink_get_info.h"
+# endif
+#endif
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+#endif // MAVLINK_%(upper)s_H
+''' % {'upper': upper, 'info': info, 'names': names})
+
+    with open(path, 'w') as f:
+        f.write(''.join(out))
+
+
+def generate_files():
+    messages = {}
+    enums = {}
+    enum_order = []
+    _load(os.path.join(Definitions, Base), messages, enums, enum_order, set())
+
+    selected = []
+    for name in Messages:
+        if name not in messages:
+            raise SystemExit('%s is not a message of %s' % (name, Base))
+        selected.append(messages[name])
+    selected.sort(key=lambda m: m.id)
+
+    include_dir = os.path.dirname(os.path.normpath(Definitions))
+    if os.path.isdir(OutputDir):
+        for old in os.listdir(OutputDir):
+            if old.endswith('.h'):
+                os.remove(os.path.join(OutputDir, old))
+    else:
+        os.makedirs(OutputDir)
+
+    headers = [_copy_message(m, include_dir, OutputDir) for m in selected]
+    ordered_enums = [enums[name] for name in enum_order]
+    xml_hash = _xml_hash(selected, ordered_enums)
+
+    _write_mavlink_h(os.path.join(OutputDir, 'mavlink.h'), xml_hash)
+    _write_version_h(os.path.join(OutputDir, 'version.h'), max(m.max_len for m in selected))
+    _write_dialect_h(os.path.join(OutputDir, Name + '.h'), selected, ordered_enums, headers, xml_hash)
+    _write_views_h(os.path.join(OutputDir, 'mavlink_views.h'), selected, OutputDir)
+
+    print('%s: %d of %d messages, %d enums, largest payload %d bytes'
+          % (OutputDir, len(selected), len(messages), len(ordered_enums),
+             max(m.max_len for m in selected)))
+
+    if BenchOutput:
+        count = _write_bench_h(BenchOutput, messages, include_dir)
+        print('%s: %d messages' % (BenchOutput, count))
+
+
+if __name__ == '__main__':
+    sys.exit('run mavlink_dialect.conf instead')
@@ -41,10 +41,10 @@
 
 extern uint8_t AutoGenMesgBuff[];
 
-/* Message area size: 1204 bytes */
+/* Message area size: 1048 bytes */
 
 #define MSGQ_TOP_DRM (uint32_t)AutoGenMesgBuff
-#define MSGQ_END_DRM (uint32_t)AutoGenMesgBuff + 0x4b4
+#define MSGQ_END_DRM (uint32_t)AutoGenMesgBuff + 0x418
 
 /* Message area fill value after message poped */
 
@@ -66,15 +66,15 @@ extern uint8_t AutoGenMesgBuff[];
 /************************************************************************/
 #define MSGQ_MAVLINK_QUE_BLOCK_DRM 0x44
 #define MSGQ_MAVLINK_N_QUE_DRM 0xcc
-#define MSGQ_MAVLINK_N_SIZE 100
-#define MSGQ_MAVLINK_N_NUM 5
-#define MSGQ_MAVLINK_H_QUE_DRM 0xffffffff
-#define MSGQ_MAVLINK_H_SIZE 0
-#define MSGQ_MAVLINK_H_NUM 0
+#define MSGQ_MAVLINK_N_SIZE 172
+#define MSGQ_MAVLINK_N_NUM 4
+#define MSGQ_MAVLINK_H_QUE_DRM 0x37c
+#define MSGQ_MAVLINK_H_SIZE 48
+#define MSGQ_MAVLINK_H_NUM 2
 /************************************************************************/
 #define MSGQ_GPS_QUE_BLOCK_DRM 0x88
-#define MSGQ_GPS_N_QUE_DRM 0x2c0
-#define MSGQ_GPS_N_SIZE 100
+#define MSGQ_GPS_N_QUE_DRM 0x3dc
+#define MSGQ_GPS_N_SIZE 12
 #define MSGQ_GPS_N_NUM 5
 #define MSGQ_GPS_H_QUE_DRM 0xffffffff
 #define MSGQ_GPS_H_SIZE 0
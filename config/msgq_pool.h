@@ -39,7 +39,7 @@
 
 #include "msgq_id.h"
 
-uint8_t AutoGenMesgBuff[1204];
+uint8_t AutoGenMesgBuff[1048];
 
 extern MsgQueDef MsgqPoolDefs[NUM_MSGQ_POOLS];
 
@@ -48,8 +48,8 @@ MsgQueDef MsgqPoolDefs[NUM_MSGQ_POOLS] =
   /* n_drm, n_size, n_num, h_drm, h_size, h_num */
 
   { 0x00000000, 0, 0, 0x00000000, 0, 0, 0 }, /* MSGQ_NULL */
-  { (drm_t)AutoGenMesgBuff + 0xcc, 100, 5, 0xffffffff, 0, 0 }, /* MSGQ_MAVLINK */
-  { (drm_t)AutoGenMesgBuff + 0x2c0, 100, 5, 0xffffffff, 0, 0 }, /* MSGQ_GPS */
+  { (drm_t)AutoGenMesgBuff + 0xcc, 172, 4, (drm_t)AutoGenMesgBuff + 0x37c, 48, 2 }, /* MSGQ_MAVLINK */
+  { (drm_t)AutoGenMesgBuff + 0x3dc, 12, 5, 0xffffffff, 0, 0 }, /* MSGQ_GPS */
 };
 
 #endif /* MSGQ_POOL_H_INCLUDED */
@@ -0,0 +1,170 @@
+/**
+ * @file gps_msgq.h
+ *
+ * @brief GPS to MAVLink message queue protocol
+ *
+ * What the GPS task and mavlink_control exchange over MsgLib:
+ *
+ *   MSGQ_GPS      requests (message_t) from the MAVLink side
+ *   MSGQ_MAVLINK  high priority lane: the freshest fix, answering a request
+ *                 normal lane: batches of up to GPS_FIX_BATCH_MAX fixes,
+ *                 streamed while the GPS produces faster than it is asked
+ *
+ * A full normal lane is the backpressure signal: the producer never blocks
+ * on it, it keeps the newest fixes of its batch and counts what it thinned
+ * out, and tells the consumer in the next batch.
+ *
+ * Include after a mavlink.h, either dialect; HIL_GPS is the same in both.
+ * The element sizes in config/msgq_layout.conf follow from these structs
+ * and are checked below.
+ *
+ */
+
+#ifndef GPS_MSGQ_H_
+#define GPS_MSGQ_H_
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <memutils/message/Message.h>
+#include "msgq_id.h"
+
+#ifndef MAVLINK_MSG_ID_HIL_GPS
+#error "include a mavlink.h before gps_msgq.h"
+#endif
+
+// ------------------------------------------------------------------------------
+//   Defines
+// ------------------------------------------------------------------------------
+
+// A single fix keeps the type the request/reply exchange always used
+#define MSG_TYPE_GPS_FIX MSG_TYPE_RESPONSE
+#define MSG_TYPE_GPS_BATCH (MSG_TYPE_RESPONSE + 1)
+
+#define GPS_FIX_BATCH_MAX 4
+
+// MsgLib puts an 8 byte header in front of every parameter
+#define GPS_MSGQ_HEADER_LEN 8
+
+// Longest pause between MsgLib::initPerCpu() attempts
+#define GPS_MSGQ_INIT_BACKOFF_MAX_US 64000
+
+// ------------------------------------------------------------------------------
+//   Data Structures
+// ------------------------------------------------------------------------------
+
+// Request for a fix, num counts the requests
+struct message_t
+{
+	int num;
+};
+
+struct gps_fix_batch_t
+{
+	uint32_t seq;		// batch number, a gap means batches were lost
+	uint16_t count;		// fixes in fix[], oldest first
+	uint16_t dropped;	// fixes thinned out of this batch, queue full
+	mavlink_hil_gps_t fix[GPS_FIX_BATCH_MAX];
+};
+
+static_assert(sizeof(message_t) + GPS_MSGQ_HEADER_LEN <= MSGQ_GPS_N_SIZE,
+			  "MSGQ_GPS elements too small for a request");
+static_assert(sizeof(mavlink_hil_gps_t) + GPS_MSGQ_HEADER_LEN <= MSGQ_MAVLINK_H_SIZE,
+			  "MSGQ_MAVLINK high priority elements too small for a fix");
+static_assert(sizeof(gps_fix_batch_t) + GPS_MSGQ_HEADER_LEN <= MSGQ_MAVLINK_N_SIZE,
+			  "MSGQ_MAVLINK normal elements too small for a batch");
+
+// ------------------------------------------------------------------------------
+//   Setup
+// ------------------------------------------------------------------------------
+/*
+ * MsgLib for the calling task.  Whichever of the GPS task and
+ * mavlink_control comes first lays out the pools, the other one gets
+ * ERR_STS from initFirst().  initPerCpu() is retried from 1 ms doubling
+ * up to GPS_MSGQ_INIT_BACKOFF_MAX_US, so a retry costs milliseconds, not
+ * seconds.
+ */
+static inline err_t
+gps_msgq_init()
+{
+	err_t err = MsgLib::initFirst(NUM_MSGQ_POOLS, MSGQ_TOP_DRM);
+	if (err != ERR_OK && err != ERR_STS)
+		return err;
+
+	useconds_t backoff = 1000;
+	while (MsgLib::initPerCpu() != ERR_OK)
+	{
+		usleep(backoff);
+		if (backoff < GPS_MSGQ_INIT_BACKOFF_MAX_US)
+			backoff *= 2;
+	}
+	return ERR_OK;
+}
+
+// ------------------------------------------------------------------------------
+//   Batching
+// ------------------------------------------------------------------------------
+
+static inline void
+gps_batch_init(gps_fix_batch_t &batch, uint32_t seq)
+{
+	batch.seq = seq;
+	batch.count = 0;
+	batch.dropped = 0;
+}
+
+/*
+ * Appends a fix.  A full batch that could not be sent yet loses its oldest
+ * fix instead, so what finally goes out is the most recent.
+ */
+static inline void
+gps_batch_add(gps_fix_batch_t &batch, const mavlink_hil_gps_t &fix)
+{
+	if (batch.count == GPS_FIX_BATCH_MAX)
+	{
+		memmove(&batch.fix[0], &batch.fix[1], sizeof(batch.fix[0]) * (GPS_FIX_BATCH_MAX - 1));
+		batch.count--;
+		batch.dropped++;
+	}
+	batch.fix[batch.count++] = fix;
+}
+
+/*
+ * Sends the batch on the normal lane and starts the next one.  When the
+ * lane has no room left returns ERR_QUE_FULL and keeps the batch, the
+ * producer carries on and gps_batch_add() thins it.
+ */
+static inline err_t
+gps_batch_send(gps_fix_batch_t &batch, MsgQueId reply_id)
+{
+	if (batch.count == 0)
+		return ERR_OK;
+
+	MsgQueBlock *que;
+	err_t err = MsgLib::referMsgQueBlock(MSGQ_MAVLINK, &que);
+	if (err != ERR_OK)
+		return err;
+	if (que->getRest(MsgPriNormal) == 0)
+		return ERR_QUE_FULL;
+
+	err = MsgLib::send<gps_fix_batch_t>(MSGQ_MAVLINK, MsgPriNormal, MSG_TYPE_GPS_BATCH, reply_id, batch);
+	if (err == ERR_OK)
+		gps_batch_init(batch, batch.seq + 1);
+	return err;
+}
+
+/*
+ * Answers a request with one fix on the high priority lane, ahead of any
+ * batches waiting in the normal one.
+ */
+static inline err_t
+gps_fix_send(const mavlink_hil_gps_t &fix, MsgQueId reply_id)
+{
+	return MsgLib::send<mavlink_hil_gps_t>(MSGQ_MAVLINK, MsgPriHigh, MSG_TYPE_GPS_FIX, reply_id, fix);
+}
+
+#endif // GPS_MSGQ_H_
@@ -0,0 +1,49 @@
+/** @file
+ *  @brief MAVLink comm protocol built from ardupilotmega.xml, pruned to spresense
+ *  @see config/mavlink_dialect.conf
+ */
+#pragma once
+#ifndef MAVLINK_H
+#define MAVLINK_H
+
+#define MAVLINK_PRIMARY_XML_HASH 8583329730628069199
+
+#ifndef MAVLINK_STX
+#define MAVLINK_STX 253
+#endif
+
+#ifndef MAVLINK_ENDIAN
+#define MAVLINK_ENDIAN MAVLINK_LITTLE_ENDIAN
+#endif
+
+#ifndef MAVLINK_ALIGNED_FIELDS
+#define MAVLINK_ALIGNED_FIELDS 1
+#endif
+
+#ifndef MAVLINK_CRC_EXTRA
+#define MAVLINK_CRC_EXTRA 1
+#endif
+
+#ifndef MAVLINK_COMMAND_24BIT
+#define MAVLINK_COMMAND_24BIT 1
+#endif
+
+// The parser state and buffer of every channel, one array for the program
+// defined by c_uart_interface_example/mavlink_channel.cpp instead of one in
+// each translation unit; ports take a channel from mavlink_channel_alloc()
+#ifndef MAVLINK_COMM_NUM_BUFFERS
+#define MAVLINK_COMM_NUM_BUFFERS 8
+#endif
+
+#define MAVLINK_EXTERNAL_RX_STATUS
+#define MAVLINK_EXTERNAL_RX_BUFFER
+
+#include "../mavlink_types.h"
+
+extern mavlink_status_t m_mavlink_status[MAVLINK_COMM_NUM_BUFFERS];
+extern mavlink_message_t m_mavlink_buffer[MAVLINK_COMM_NUM_BUFFERS];
+
+#include "version.h"
+#include "spresense.h"
+
+#endif // MAVLINK_H
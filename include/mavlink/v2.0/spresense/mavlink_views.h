@@ -0,0 +1,758 @@
+/** @file
+ *  @brief Read-only views over the payload of the spresense messages
+ *  Generated by config/mavlink_dialect.py from MAVLINK_MESSAGE_INFO_*
+ *  @see include/mavlink_view.h
+ */
+#pragma once
+#ifndef MAVLINK_SPRESENSE_VIEWS_H
+#define MAVLINK_SPRESENSE_VIEWS_H
+
+#include "mavlink.h"
+#include "../../../mavlink_view.h"
+
+// HEARTBEAT, 9 to 9 bytes
+class Heartbeat_View : public Mavlink_View<MAVLINK_MSG_ID_HEARTBEAT>
+{
+public:
+	explicit Heartbeat_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint8_t type() const { return _field<uint8_t>(4); }
+	uint8_t autopilot() const { return _field<uint8_t>(5); }
+	uint8_t base_mode() const { return _field<uint8_t>(6); }
+	uint32_t custom_mode() const { return _field<uint32_t>(0); }
+	uint8_t system_status() const { return _field<uint8_t>(7); }
+	uint8_t mavlink_version() const { return _field<uint8_t>(8); }
+};
+
+// SYS_STATUS, 31 to 43 bytes
+class Sys_Status_View : public Mavlink_View<MAVLINK_MSG_ID_SYS_STATUS>
+{
+public:
+	explicit Sys_Status_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint32_t onboard_control_sensors_present() const { return _field<uint32_t>(0); }
+	uint32_t onboard_control_sensors_enabled() const { return _field<uint32_t>(4); }
+	uint32_t onboard_control_sensors_health() const { return _field<uint32_t>(8); }
+	uint16_t load() const { return _field<uint16_t>(12); }
+	uint16_t voltage_battery() const { return _field<uint16_t>(14); }
+	int16_t current_battery() const { return _field<int16_t>(16); }
+	int8_t battery_remaining() const { return _field<int8_t>(30); }
+	uint16_t drop_rate_comm() const { return _field<uint16_t>(18); }
+	uint16_t errors_comm() const { return _field<uint16_t>(20); }
+	uint16_t errors_count1() const { return _field<uint16_t>(22); }
+	uint16_t errors_count2() const { return _field<uint16_t>(24); }
+	uint16_t errors_count3() const { return _field<uint16_t>(26); }
+	uint16_t errors_count4() const { return _field<uint16_t>(28); }
+	uint32_t onboard_control_sensors_present_extended() const { return _field<uint32_t>(31); }
+	uint32_t onboard_control_sensors_enabled_extended() const { return _field<uint32_t>(35); }
+	uint32_t onboard_control_sensors_health_extended() const { return _field<uint32_t>(39); }
+};
+
+// SYSTEM_TIME, 12 to 12 bytes
+class System_Time_View : public Mavlink_View<MAVLINK_MSG_ID_SYSTEM_TIME>
+{
+public:
+	explicit System_Time_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint64_t time_unix_usec() const { return _field<uint64_t>(0); }
+	uint32_t time_boot_ms() const { return _field<uint32_t>(8); }
+};
+
+// SET_MODE, 6 to 6 bytes
+class Set_Mode_View : public Mavlink_View<MAVLINK_MSG_ID_SET_MODE>
+{
+public:
+	explicit Set_Mode_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint8_t target_system() const { return _field<uint8_t>(4); }
+	uint8_t base_mode() const { return _field<uint8_t>(5); }
+	uint32_t custom_mode() const { return _field<uint32_t>(0); }
+};
+
+// PARAM_REQUEST_READ, 20 to 20 bytes
+class Param_Request_Read_View : public Mavlink_View<MAVLINK_MSG_ID_PARAM_REQUEST_READ>
+{
+public:
+	explicit Param_Request_Read_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint8_t target_system() const { return _field<uint8_t>(2); }
+	uint8_t target_component() const { return _field<uint8_t>(3); }
+	const char *param_id() const { return _array<char>(4); } // [16], not terminated when full
+	int16_t param_index() const { return _field<int16_t>(0); }
+};
+
+// PARAM_REQUEST_LIST, 2 to 2 bytes
+class Param_Request_List_View : public Mavlink_View<MAVLINK_MSG_ID_PARAM_REQUEST_LIST>
+{
+public:
+	explicit Param_Request_List_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint8_t target_system() const { return _field<uint8_t>(0); }
+	uint8_t target_component() const { return _field<uint8_t>(1); }
+};
+
+// PARAM_VALUE, 25 to 25 bytes
+class Param_Value_View : public Mavlink_View<MAVLINK_MSG_ID_PARAM_VALUE>
+{
+public:
+	explicit Param_Value_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	const char *param_id() const { return _array<char>(8); } // [16], not terminated when full
+	float param_value() const { return _field<float>(0); }
+	uint8_t param_type() const { return _field<uint8_t>(24); }
+	uint16_t param_count() const { return _field<uint16_t>(4); }
+	uint16_t param_index() const { return _field<uint16_t>(6); }
+};
+
+// PARAM_SET, 23 to 23 bytes
+class Param_Set_View : public Mavlink_View<MAVLINK_MSG_ID_PARAM_SET>
+{
+public:
+	explicit Param_Set_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint8_t target_system() const { return _field<uint8_t>(4); }
+	uint8_t target_component() const { return _field<uint8_t>(5); }
+	const char *param_id() const { return _array<char>(6); } // [16], not terminated when full
+	float param_value() const { return _field<float>(0); }
+	uint8_t param_type() const { return _field<uint8_t>(22); }
+};
+
+// GPS_RAW_INT, 30 to 52 bytes
+class Gps_Raw_Int_View : public Mavlink_View<MAVLINK_MSG_ID_GPS_RAW_INT>
+{
+public:
+	explicit Gps_Raw_Int_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint64_t time_usec() const { return _field<uint64_t>(0); }
+	uint8_t fix_type() const { return _field<uint8_t>(28); }
+	int32_t lat() const { return _field<int32_t>(8); }
+	int32_t lon() const { return _field<int32_t>(12); }
+	int32_t alt() const { return _field<int32_t>(16); }
+	uint16_t eph() const { return _field<uint16_t>(20); }
+	uint16_t epv() const { return _field<uint16_t>(22); }
+	uint16_t vel() const { return _field<uint16_t>(24); }
+	uint16_t cog() const { return _field<uint16_t>(26); }
+	uint8_t satellites_visible() const { return _field<uint8_t>(29); }
+	int32_t alt_ellipsoid() const { return _field<int32_t>(30); }
+	uint32_t h_acc() const { return _field<uint32_t>(34); }
+	uint32_t v_acc() const { return _field<uint32_t>(38); }
+	uint32_t vel_acc() const { return _field<uint32_t>(42); }
+	uint32_t hdg_acc() const { return _field<uint32_t>(46); }
+	uint16_t yaw() const { return _field<uint16_t>(50); }
+};
+
+// ATTITUDE, 28 to 28 bytes
+class Attitude_View : public Mavlink_View<MAVLINK_MSG_ID_ATTITUDE>
+{
+public:
+	explicit Attitude_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint32_t time_boot_ms() const { return _field<uint32_t>(0); }
+	float roll() const { return _field<float>(4); }
+	float pitch() const { return _field<float>(8); }
+	float yaw() const { return _field<float>(12); }
+	float rollspeed() const { return _field<float>(16); }
+	float pitchspeed() const { return _field<float>(20); }
+	float yawspeed() const { return _field<float>(24); }
+};
+
+// LOCAL_POSITION_NED, 28 to 28 bytes
+class Local_Position_Ned_View : public Mavlink_View<MAVLINK_MSG_ID_LOCAL_POSITION_NED>
+{
+public:
+	explicit Local_Position_Ned_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint32_t time_boot_ms() const { return _field<uint32_t>(0); }
+	float x() const { return _field<float>(4); }
+	float y() const { return _field<float>(8); }
+	float z() const { return _field<float>(12); }
+	float vx() const { return _field<float>(16); }
+	float vy() const { return _field<float>(20); }
+	float vz() const { return _field<float>(24); }
+};
+
+// GLOBAL_POSITION_INT, 28 to 28 bytes
+class Global_Position_Int_View : public Mavlink_View<MAVLINK_MSG_ID_GLOBAL_POSITION_INT>
+{
+public:
+	explicit Global_Position_Int_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint32_t time_boot_ms() const { return _field<uint32_t>(0); }
+	int32_t lat() const { return _field<int32_t>(4); }
+	int32_t lon() const { return _field<int32_t>(8); }
+	int32_t alt() const { return _field<int32_t>(12); }
+	int32_t relative_alt() const { return _field<int32_t>(16); }
+	int16_t vx() const { return _field<int16_t>(20); }
+	int16_t vy() const { return _field<int16_t>(22); }
+	int16_t vz() const { return _field<int16_t>(24); }
+	uint16_t hdg() const { return _field<uint16_t>(26); }
+};
+
+// MISSION_REQUEST, 4 to 5 bytes
+class Mission_Request_View : public Mavlink_View<MAVLINK_MSG_ID_MISSION_REQUEST>
+{
+public:
+	explicit Mission_Request_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint8_t target_system() const { return _field<uint8_t>(2); }
+	uint8_t target_component() const { return _field<uint8_t>(3); }
+	uint16_t seq() const { return _field<uint16_t>(0); }
+	uint8_t mission_type() const { return _field<uint8_t>(4); }
+};
+
+// MISSION_COUNT, 4 to 9 bytes
+class Mission_Count_View : public Mavlink_View<MAVLINK_MSG_ID_MISSION_COUNT>
+{
+public:
+	explicit Mission_Count_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint8_t target_system() const { return _field<uint8_t>(2); }
+	uint8_t target_component() const { return _field<uint8_t>(3); }
+	uint16_t count() const { return _field<uint16_t>(0); }
+	uint8_t mission_type() const { return _field<uint8_t>(4); }
+	uint32_t opaque_id() const { return _field<uint32_t>(5); }
+};
+
+// MISSION_ACK, 3 to 8 bytes
+class Mission_Ack_View : public Mavlink_View<MAVLINK_MSG_ID_MISSION_ACK>
+{
+public:
+	explicit Mission_Ack_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint8_t target_system() const { return _field<uint8_t>(0); }
+	uint8_t target_component() const { return _field<uint8_t>(1); }
+	uint8_t type() const { return _field<uint8_t>(2); }
+	uint8_t mission_type() const { return _field<uint8_t>(3); }
+	uint32_t opaque_id() const { return _field<uint32_t>(4); }
+};
+
+// MISSION_REQUEST_INT, 4 to 5 bytes
+class Mission_Request_Int_View : public Mavlink_View<MAVLINK_MSG_ID_MISSION_REQUEST_INT>
+{
+public:
+	explicit Mission_Request_Int_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint8_t target_system() const { return _field<uint8_t>(2); }
+	uint8_t target_component() const { return _field<uint8_t>(3); }
+	uint16_t seq() const { return _field<uint16_t>(0); }
+	uint8_t mission_type() const { return _field<uint8_t>(4); }
+};
+
+// MISSION_ITEM_INT, 37 to 38 bytes
+class Mission_Item_Int_View : public Mavlink_View<MAVLINK_MSG_ID_MISSION_ITEM_INT>
+{
+public:
+	explicit Mission_Item_Int_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint8_t target_system() const { return _field<uint8_t>(32); }
+	uint8_t target_component() const { return _field<uint8_t>(33); }
+	uint16_t seq() const { return _field<uint16_t>(28); }
+	uint8_t frame() const { return _field<uint8_t>(34); }
+	uint16_t command() const { return _field<uint16_t>(30); }
+	uint8_t current() const { return _field<uint8_t>(35); }
+	uint8_t autocontinue() const { return _field<uint8_t>(36); }
+	float param1() const { return _field<float>(0); }
+	float param2() const { return _field<float>(4); }
+	float param3() const { return _field<float>(8); }
+	float param4() const { return _field<float>(12); }
+	int32_t x() const { return _field<int32_t>(16); }
+	int32_t y() const { return _field<int32_t>(20); }
+	float z() const { return _field<float>(24); }
+	uint8_t mission_type() const { return _field<uint8_t>(37); }
+};
+
+// COMMAND_INT, 35 to 35 bytes
+class Command_Int_View : public Mavlink_View<MAVLINK_MSG_ID_COMMAND_INT>
+{
+public:
+	explicit Command_Int_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint8_t target_system() const { return _field<uint8_t>(30); }
+	uint8_t target_component() const { return _field<uint8_t>(31); }
+	uint8_t frame() const { return _field<uint8_t>(32); }
+	uint16_t command() const { return _field<uint16_t>(28); }
+	uint8_t current() const { return _field<uint8_t>(33); }
+	uint8_t autocontinue() const { return _field<uint8_t>(34); }
+	float param1() const { return _field<float>(0); }
+	float param2() const { return _field<float>(4); }
+	float param3() const { return _field<float>(8); }
+	float param4() const { return _field<float>(12); }
+	int32_t x() const { return _field<int32_t>(16); }
+	int32_t y() const { return _field<int32_t>(20); }
+	float z() const { return _field<float>(24); }
+};
+
+// COMMAND_LONG, 33 to 33 bytes
+class Command_Long_View : public Mavlink_View<MAVLINK_MSG_ID_COMMAND_LONG>
+{
+public:
+	explicit Command_Long_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint8_t target_system() const { return _field<uint8_t>(30); }
+	uint8_t target_component() const { return _field<uint8_t>(31); }
+	uint16_t command() const { return _field<uint16_t>(28); }
+	uint8_t confirmation() const { return _field<uint8_t>(32); }
+	float param1() const { return _field<float>(0); }
+	float param2() const { return _field<float>(4); }
+	float param3() const { return _field<float>(8); }
+	float param4() const { return _field<float>(12); }
+	float param5() const { return _field<float>(16); }
+	float param6() const { return _field<float>(20); }
+	float param7() const { return _field<float>(24); }
+};
+
+// COMMAND_ACK, 3 to 10 bytes
+class Command_Ack_View : public Mavlink_View<MAVLINK_MSG_ID_COMMAND_ACK>
+{
+public:
+	explicit Command_Ack_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint16_t command() const { return _field<uint16_t>(0); }
+	uint8_t result() const { return _field<uint8_t>(2); }
+	uint8_t progress() const { return _field<uint8_t>(3); }
+	int32_t result_param2() const { return _field<int32_t>(4); }
+	uint8_t target_system() const { return _field<uint8_t>(8); }
+	uint8_t target_component() const { return _field<uint8_t>(9); }
+};
+
+// SET_ATTITUDE_TARGET, 39 to 51 bytes
+class Set_Attitude_Target_View : public Mavlink_View<MAVLINK_MSG_ID_SET_ATTITUDE_TARGET>
+{
+public:
+	explicit Set_Attitude_Target_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint32_t time_boot_ms() const { return _field<uint32_t>(0); }
+	uint8_t target_system() const { return _field<uint8_t>(36); }
+	uint8_t target_component() const { return _field<uint8_t>(37); }
+	uint8_t type_mask() const { return _field<uint8_t>(38); }
+	float q(int i) const { return _field<float>(4 + i * 4); } // [4]
+	float body_roll_rate() const { return _field<float>(20); }
+	float body_pitch_rate() const { return _field<float>(24); }
+	float body_yaw_rate() const { return _field<float>(28); }
+	float thrust() const { return _field<float>(32); }
+	float thrust_body(int i) const { return _field<float>(39 + i * 4); } // [3]
+};
+
+// SET_POSITION_TARGET_LOCAL_NED, 53 to 53 bytes
+class Set_Position_Target_Local_Ned_View : public Mavlink_View<MAVLINK_MSG_ID_SET_POSITION_TARGET_LOCAL_NED>
+{
+public:
+	explicit Set_Position_Target_Local_Ned_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint32_t time_boot_ms() const { return _field<uint32_t>(0); }
+	uint8_t target_system() const { return _field<uint8_t>(50); }
+	uint8_t target_component() const { return _field<uint8_t>(51); }
+	uint8_t coordinate_frame() const { return _field<uint8_t>(52); }
+	uint16_t type_mask() const { return _field<uint16_t>(48); }
+	float x() const { return _field<float>(4); }
+	float y() const { return _field<float>(8); }
+	float z() const { return _field<float>(12); }
+	float vx() const { return _field<float>(16); }
+	float vy() const { return _field<float>(20); }
+	float vz() const { return _field<float>(24); }
+	float afx() const { return _field<float>(28); }
+	float afy() const { return _field<float>(32); }
+	float afz() const { return _field<float>(36); }
+	float yaw() const { return _field<float>(40); }
+	float yaw_rate() const { return _field<float>(44); }
+};
+
+// POSITION_TARGET_LOCAL_NED, 51 to 51 bytes
+class Position_Target_Local_Ned_View : public Mavlink_View<MAVLINK_MSG_ID_POSITION_TARGET_LOCAL_NED>
+{
+public:
+	explicit Position_Target_Local_Ned_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint32_t time_boot_ms() const { return _field<uint32_t>(0); }
+	uint8_t coordinate_frame() const { return _field<uint8_t>(50); }
+	uint16_t type_mask() const { return _field<uint16_t>(48); }
+	float x() const { return _field<float>(4); }
+	float y() const { return _field<float>(8); }
+	float z() const { return _field<float>(12); }
+	float vx() const { return _field<float>(16); }
+	float vy() const { return _field<float>(20); }
+	float vz() const { return _field<float>(24); }
+	float afx() const { return _field<float>(28); }
+	float afy() const { return _field<float>(32); }
+	float afz() const { return _field<float>(36); }
+	float yaw() const { return _field<float>(40); }
+	float yaw_rate() const { return _field<float>(44); }
+};
+
+// SET_POSITION_TARGET_GLOBAL_INT, 53 to 53 bytes
+class Set_Position_Target_Global_Int_View : public Mavlink_View<MAVLINK_MSG_ID_SET_POSITION_TARGET_GLOBAL_INT>
+{
+public:
+	explicit Set_Position_Target_Global_Int_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint32_t time_boot_ms() const { return _field<uint32_t>(0); }
+	uint8_t target_system() const { return _field<uint8_t>(50); }
+	uint8_t target_component() const { return _field<uint8_t>(51); }
+	uint8_t coordinate_frame() const { return _field<uint8_t>(52); }
+	uint16_t type_mask() const { return _field<uint16_t>(48); }
+	int32_t lat_int() const { return _field<int32_t>(4); }
+	int32_t lon_int() const { return _field<int32_t>(8); }
+	float alt() const { return _field<float>(12); }
+	float vx() const { return _field<float>(16); }
+	float vy() const { return _field<float>(20); }
+	float vz() const { return _field<float>(24); }
+	float afx() const { return _field<float>(28); }
+	float afy() const { return _field<float>(32); }
+	float afz() const { return _field<float>(36); }
+	float yaw() const { return _field<float>(40); }
+	float yaw_rate() const { return _field<float>(44); }
+};
+
+// POSITION_TARGET_GLOBAL_INT, 51 to 51 bytes
+class Position_Target_Global_Int_View : public Mavlink_View<MAVLINK_MSG_ID_POSITION_TARGET_GLOBAL_INT>
+{
+public:
+	explicit Position_Target_Global_Int_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint32_t time_boot_ms() const { return _field<uint32_t>(0); }
+	uint8_t coordinate_frame() const { return _field<uint8_t>(50); }
+	uint16_t type_mask() const { return _field<uint16_t>(48); }
+	int32_t lat_int() const { return _field<int32_t>(4); }
+	int32_t lon_int() const { return _field<int32_t>(8); }
+	float alt() const { return _field<float>(12); }
+	float vx() const { return _field<float>(16); }
+	float vy() const { return _field<float>(20); }
+	float vz() const { return _field<float>(24); }
+	float afx() const { return _field<float>(28); }
+	float afy() const { return _field<float>(32); }
+	float afz() const { return _field<float>(36); }
+	float yaw() const { return _field<float>(40); }
+	float yaw_rate() const { return _field<float>(44); }
+};
+
+// VISION_POSITION_ESTIMATE, 32 to 117 bytes
+class Vision_Position_Estimate_View : public Mavlink_View<MAVLINK_MSG_ID_VISION_POSITION_ESTIMATE>
+{
+public:
+	explicit Vision_Position_Estimate_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint64_t usec() const { return _field<uint64_t>(0); }
+	float x() const { return _field<float>(8); }
+	float y() const { return _field<float>(12); }
+	float z() const { return _field<float>(16); }
+	float roll() const { return _field<float>(20); }
+	float pitch() const { return _field<float>(24); }
+	float yaw() const { return _field<float>(28); }
+	float covariance(int i) const { return _field<float>(32 + i * 4); } // [21]
+	uint8_t reset_counter() const { return _field<uint8_t>(116); }
+};
+
+// HIGHRES_IMU, 62 to 63 bytes
+class Highres_Imu_View : public Mavlink_View<MAVLINK_MSG_ID_HIGHRES_IMU>
+{
+public:
+	explicit Highres_Imu_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint64_t time_usec() const { return _field<uint64_t>(0); }
+	float xacc() const { return _field<float>(8); }
+	float yacc() const { return _field<float>(12); }
+	float zacc() const { return _field<float>(16); }
+	float xgyro() const { return _field<float>(20); }
+	float ygyro() const { return _field<float>(24); }
+	float zgyro() const { return _field<float>(28); }
+	float xmag() const { return _field<float>(32); }
+	float ymag() const { return _field<float>(36); }
+	float zmag() const { return _field<float>(40); }
+	float abs_pressure() const { return _field<float>(44); }
+	float diff_pressure() const { return _field<float>(48); }
+	float pressure_alt() const { return _field<float>(52); }
+	float temperature() const { return _field<float>(56); }
+	uint16_t fields_updated() const { return _field<uint16_t>(60); }
+	uint8_t id() const { return _field<uint8_t>(62); }
+};
+
+// RADIO_STATUS, 9 to 9 bytes
+class Radio_Status_View : public Mavlink_View<MAVLINK_MSG_ID_RADIO_STATUS>
+{
+public:
+	explicit Radio_Status_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint8_t rssi() const { return _field<uint8_t>(4); }
+	uint8_t remrssi() const { return _field<uint8_t>(5); }
+	uint8_t txbuf() const { return _field<uint8_t>(6); }
+	uint8_t noise() const { return _field<uint8_t>(7); }
+	uint8_t remnoise() const { return _field<uint8_t>(8); }
+	uint16_t rxerrors() const { return _field<uint16_t>(0); }
+	uint16_t fixed() const { return _field<uint16_t>(2); }
+};
+
+// FILE_TRANSFER_PROTOCOL, 254 to 254 bytes
+class File_Transfer_Protocol_View : public Mavlink_View<MAVLINK_MSG_ID_FILE_TRANSFER_PROTOCOL>
+{
+public:
+	explicit File_Transfer_Protocol_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint8_t target_network() const { return _field<uint8_t>(0); }
+	uint8_t target_system() const { return _field<uint8_t>(1); }
+	uint8_t target_component() const { return _field<uint8_t>(2); }
+	const uint8_t *payload() const { return _array<uint8_t>(3); } // [251]
+};
+
+// TIMESYNC, 16 to 18 bytes
+class Timesync_View : public Mavlink_View<MAVLINK_MSG_ID_TIMESYNC>
+{
+public:
+	explicit Timesync_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	int64_t tc1() const { return _field<int64_t>(0); }
+	int64_t ts1() const { return _field<int64_t>(8); }
+	uint8_t target_system() const { return _field<uint8_t>(16); }
+	uint8_t target_component() const { return _field<uint8_t>(17); }
+};
+
+// HIL_GPS, 36 to 39 bytes
+class Hil_Gps_View : public Mavlink_View<MAVLINK_MSG_ID_HIL_GPS>
+{
+public:
+	explicit Hil_Gps_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint64_t time_usec() const { return _field<uint64_t>(0); }
+	uint8_t fix_type() const { return _field<uint8_t>(34); }
+	int32_t lat() const { return _field<int32_t>(8); }
+	int32_t lon() const { return _field<int32_t>(12); }
+	int32_t alt() const { return _field<int32_t>(16); }
+	uint16_t eph() const { return _field<uint16_t>(20); }
+	uint16_t epv() const { return _field<uint16_t>(22); }
+	uint16_t vel() const { return _field<uint16_t>(24); }
+	int16_t vn() const { return _field<int16_t>(26); }
+	int16_t ve() const { return _field<int16_t>(28); }
+	int16_t vd() const { return _field<int16_t>(30); }
+	uint16_t cog() const { return _field<uint16_t>(32); }
+	uint8_t satellites_visible() const { return _field<uint8_t>(35); }
+	uint8_t id() const { return _field<uint8_t>(36); }
+	uint16_t yaw() const { return _field<uint16_t>(37); }
+};
+
+// LOG_REQUEST_LIST, 6 to 6 bytes
+class Log_Request_List_View : public Mavlink_View<MAVLINK_MSG_ID_LOG_REQUEST_LIST>
+{
+public:
+	explicit Log_Request_List_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint8_t target_system() const { return _field<uint8_t>(4); }
+	uint8_t target_component() const { return _field<uint8_t>(5); }
+	uint16_t start() const { return _field<uint16_t>(0); }
+	uint16_t end() const { return _field<uint16_t>(2); }
+};
+
+// LOG_REQUEST_DATA, 12 to 12 bytes
+class Log_Request_Data_View : public Mavlink_View<MAVLINK_MSG_ID_LOG_REQUEST_DATA>
+{
+public:
+	explicit Log_Request_Data_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint8_t target_system() const { return _field<uint8_t>(10); }
+	uint8_t target_component() const { return _field<uint8_t>(11); }
+	uint16_t id() const { return _field<uint16_t>(8); }
+	uint32_t ofs() const { return _field<uint32_t>(0); }
+	uint32_t count() const { return _field<uint32_t>(4); }
+};
+
+// BATTERY_STATUS, 36 to 54 bytes
+class Battery_Status_View : public Mavlink_View<MAVLINK_MSG_ID_BATTERY_STATUS>
+{
+public:
+	explicit Battery_Status_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint8_t id() const { return _field<uint8_t>(32); }
+	uint8_t battery_function() const { return _field<uint8_t>(33); }
+	uint8_t type() const { return _field<uint8_t>(34); }
+	int16_t temperature() const { return _field<int16_t>(8); }
+	uint16_t voltages(int i) const { return _field<uint16_t>(10 + i * 2); } // [10]
+	int16_t current_battery() const { return _field<int16_t>(30); }
+	int32_t current_consumed() const { return _field<int32_t>(0); }
+	int32_t energy_consumed() const { return _field<int32_t>(4); }
+	int8_t battery_remaining() const { return _field<int8_t>(35); }
+	int32_t time_remaining() const { return _field<int32_t>(36); }
+	uint8_t charge_state() const { return _field<uint8_t>(40); }
+	uint16_t voltages_ext(int i) const { return _field<uint16_t>(41 + i * 2); } // [4]
+	uint8_t mode() const { return _field<uint8_t>(49); }
+	uint32_t fault_bitmask() const { return _field<uint32_t>(50); }
+};
+
+// AUTOPILOT_VERSION, 60 to 78 bytes
+class Autopilot_Version_View : public Mavlink_View<MAVLINK_MSG_ID_AUTOPILOT_VERSION>
+{
+public:
+	explicit Autopilot_Version_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint64_t capabilities() const { return _field<uint64_t>(0); }
+	uint32_t flight_sw_version() const { return _field<uint32_t>(16); }
+	uint32_t middleware_sw_version() const { return _field<uint32_t>(20); }
+	uint32_t os_sw_version() const { return _field<uint32_t>(24); }
+	uint32_t board_version() const { return _field<uint32_t>(28); }
+	const uint8_t *flight_custom_version() const { return _array<uint8_t>(36); } // [8]
+	const uint8_t *middleware_custom_version() const { return _array<uint8_t>(44); } // [8]
+	const uint8_t *os_custom_version() const { return _array<uint8_t>(52); } // [8]
+	uint16_t vendor_id() const { return _field<uint16_t>(32); }
+	uint16_t product_id() const { return _field<uint16_t>(34); }
+	uint64_t uid() const { return _field<uint64_t>(8); }
+	const uint8_t *uid2() const { return _array<uint8_t>(60); } // [18]
+};
+
+// REMOTE_LOG_DATA_BLOCK, 206 to 206 bytes
+class Remote_Log_Data_Block_View : public Mavlink_View<MAVLINK_MSG_ID_REMOTE_LOG_DATA_BLOCK>
+{
+public:
+	explicit Remote_Log_Data_Block_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint8_t target_system() const { return _field<uint8_t>(4); }
+	uint8_t target_component() const { return _field<uint8_t>(5); }
+	uint32_t seqno() const { return _field<uint32_t>(0); }
+	const uint8_t *data() const { return _array<uint8_t>(6); } // [200]
+};
+
+// REMOTE_LOG_BLOCK_STATUS, 7 to 7 bytes
+class Remote_Log_Block_Status_View : public Mavlink_View<MAVLINK_MSG_ID_REMOTE_LOG_BLOCK_STATUS>
+{
+public:
+	explicit Remote_Log_Block_Status_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint8_t target_system() const { return _field<uint8_t>(4); }
+	uint8_t target_component() const { return _field<uint8_t>(5); }
+	uint32_t seqno() const { return _field<uint32_t>(0); }
+	uint8_t status() const { return _field<uint8_t>(6); }
+};
+
+// GPS_INPUT, 63 to 65 bytes
+class Gps_Input_View : public Mavlink_View<MAVLINK_MSG_ID_GPS_INPUT>
+{
+public:
+	explicit Gps_Input_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint64_t time_usec() const { return _field<uint64_t>(0); }
+	uint8_t gps_id() const { return _field<uint8_t>(60); }
+	uint16_t ignore_flags() const { return _field<uint16_t>(56); }
+	uint32_t time_week_ms() const { return _field<uint32_t>(8); }
+	uint16_t time_week() const { return _field<uint16_t>(58); }
+	uint8_t fix_type() const { return _field<uint8_t>(61); }
+	int32_t lat() const { return _field<int32_t>(12); }
+	int32_t lon() const { return _field<int32_t>(16); }
+	float alt() const { return _field<float>(20); }
+	float hdop() const { return _field<float>(24); }
+	float vdop() const { return _field<float>(28); }
+	float vn() const { return _field<float>(32); }
+	float ve() const { return _field<float>(36); }
+	float vd() const { return _field<float>(40); }
+	float speed_accuracy() const { return _field<float>(44); }
+	float horiz_accuracy() const { return _field<float>(48); }
+	float vert_accuracy() const { return _field<float>(52); }
+	uint8_t satellites_visible() const { return _field<uint8_t>(62); }
+	uint16_t yaw() const { return _field<uint16_t>(63); }
+};
+
+// MESSAGE_INTERVAL, 6 to 6 bytes
+class Message_Interval_View : public Mavlink_View<MAVLINK_MSG_ID_MESSAGE_INTERVAL>
+{
+public:
+	explicit Message_Interval_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint16_t message_id() const { return _field<uint16_t>(4); }
+	int32_t interval_us() const { return _field<int32_t>(0); }
+};
+
+// EXTENDED_SYS_STATE, 2 to 2 bytes
+class Extended_Sys_State_View : public Mavlink_View<MAVLINK_MSG_ID_EXTENDED_SYS_STATE>
+{
+public:
+	explicit Extended_Sys_State_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint8_t vtol_state() const { return _field<uint8_t>(0); }
+	uint8_t landed_state() const { return _field<uint8_t>(1); }
+};
+
+// STATUSTEXT, 51 to 54 bytes
+class Statustext_View : public Mavlink_View<MAVLINK_MSG_ID_STATUSTEXT>
+{
+public:
+	explicit Statustext_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint8_t severity() const { return _field<uint8_t>(0); }
+	const char *text() const { return _array<char>(1); } // [50], not terminated when full
+	uint16_t id() const { return _field<uint16_t>(51); }
+	uint8_t chunk_seq() const { return _field<uint8_t>(53); }
+};
+
+// SETUP_SIGNING, 42 to 42 bytes
+class Setup_Signing_View : public Mavlink_View<MAVLINK_MSG_ID_SETUP_SIGNING>
+{
+public:
+	explicit Setup_Signing_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint8_t target_system() const { return _field<uint8_t>(8); }
+	uint8_t target_component() const { return _field<uint8_t>(9); }
+	const uint8_t *secret_key() const { return _array<uint8_t>(10); } // [32]
+	uint64_t initial_timestamp() const { return _field<uint64_t>(0); }
+};
+
+// LOGGING_DATA, 255 to 255 bytes
+class Logging_Data_View : public Mavlink_View<MAVLINK_MSG_ID_LOGGING_DATA>
+{
+public:
+	explicit Logging_Data_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint8_t target_system() const { return _field<uint8_t>(2); }
+	uint8_t target_component() const { return _field<uint8_t>(3); }
+	uint16_t sequence() const { return _field<uint16_t>(0); }
+	uint8_t length() const { return _field<uint8_t>(4); }
+	uint8_t first_message_offset() const { return _field<uint8_t>(5); }
+	const uint8_t *data() const { return _array<uint8_t>(6); } // [249]
+};
+
+// LOGGING_DATA_ACKED, 255 to 255 bytes
+class Logging_Data_Acked_View : public Mavlink_View<MAVLINK_MSG_ID_LOGGING_DATA_ACKED>
+{
+public:
+	explicit Logging_Data_Acked_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint8_t target_system() const { return _field<uint8_t>(2); }
+	uint8_t target_component() const { return _field<uint8_t>(3); }
+	uint16_t sequence() const { return _field<uint16_t>(0); }
+	uint8_t length() const { return _field<uint8_t>(4); }
+	uint8_t first_message_offset() const { return _field<uint8_t>(5); }
+	const uint8_t *data() const { return _array<uint8_t>(6); } // [249]
+};
+
+// LOGGING_ACK, 4 to 4 bytes
+class Logging_Ack_View : public Mavlink_View<MAVLINK_MSG_ID_LOGGING_ACK>
+{
+public:
+	explicit Logging_Ack_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint8_t target_system() const { return _field<uint8_t>(2); }
+	uint8_t target_component() const { return _field<uint8_t>(3); }
+	uint16_t sequence() const { return _field<uint16_t>(0); }
+};
+
+// ODOMETRY, 230 to 233 bytes
+class Odometry_View : public Mavlink_View<MAVLINK_MSG_ID_ODOMETRY>
+{
+public:
+	explicit Odometry_View(const mavlink_message_t &message_) : Mavlink_View(message_) {}
+
+	uint64_t time_usec() const { return _field<uint64_t>(0); }
+	uint8_t frame_id() const { return _field<uint8_t>(228); }
+	uint8_t child_frame_id() const { return _field<uint8_t>(229); }
+	float x() const { return _field<float>(8); }
+	float y() const { return _field<float>(12); }
+	float z() const { return _field<float>(16); }
+	float q(int i) const { return _field<float>(20 + i * 4); } // [4]
+	float vx() const { return _field<float>(36); }
+	float vy() const { return _field<float>(40); }
+	float vz() const { return _field<float>(44); }
+	float rollspeed() const { return _field<float>(48); }
+	float pitchspeed() const { return _field<float>(52); }
+	float yawspeed() const { return _field<float>(56); }
+	float pose_covariance(int i) const { return _field<float>(60 + i * 4); } // [21]
+	float velocity_covariance(int i) const { return _field<float>(144 + i * 4); } // [21]
+	uint8_t reset_counter() const { return _field<uint8_t>(230); }
+	uint8_t estimator_type() const { return _field<uint8_t>(231); }
+	int8_t quality() const { return _field<int8_t>(232); }
+};
+
+#endif // MAVLINK_SPRESENSE_VIEWS_H
@@ -0,0 +1,13 @@
+/** @file
+ *  @brief MAVLink comm protocol built from ardupilotmega.xml, pruned to spresense
+ *  @see config/mavlink_dialect.conf
+ */
+#pragma once
+
+#ifndef MAVLINK_VERSION_H
+#define MAVLINK_VERSION_H
+
+#define MAVLINK_WIRE_PROTOCOL_VERSION "2.0"
+#define MAVLINK_MAX_DIALECT_PAYLOAD_SIZE 255
+
+#endif // MAVLINK_VERSION_H
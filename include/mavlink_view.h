@@ -0,0 +1,101 @@
+/**
+ * @file mavlink_view.h
+ *
+ * @brief Read-only typed views over a MAVLink frame's payload
+ *
+ * A view reads the fields of a frame where they lie in the payload, by
+ * wire offset, instead of copying the whole payload into the message
+ * struct first as mavlink_msg_X_decode() does.  The view classes of each
+ * message are generated with the pruned dialect, from its
+ * MAVLINK_MESSAGE_INFO_* field tables, into mavlink_views.h next to its
+ * mavlink.h.  Include that after a mavlink.h of the same dialect.
+ *
+ * Header only.
+ *
+ */
+
+#ifndef MAVLINK_VIEW_H_
+#define MAVLINK_VIEW_H_
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <string.h>
+
+#ifndef MAVLINK_H
+#error "include a mavlink.h before mavlink_view.h"
+#endif
+
+// ----------------------------------------------------------------------------------
+//   MAVLink View Class
+// ----------------------------------------------------------------------------------
+/*
+ * MAVLink View Class
+ *
+ * Holds a reference to the frame, which must outlive the view.  Scalar
+ * fields are read little endian whatever the host, and read as zero where
+ * MAVLink 2 trimmed the trailing zero bytes off the payload, as decode()
+ * does.  Byte and char arrays are handed out in place: bytes past the
+ * received length are zero in a frame from the parser, which clears the
+ * payload up to the message's full length.
+ *
+ * Check valid() before reading, or switch on msgid first.
+ */
+template <uint32_t MSGID>
+class Mavlink_View
+{
+
+public:
+	static const uint32_t msgid = MSGID;
+
+	explicit Mavlink_View(const mavlink_message_t &message_) : message(message_) {}
+
+	bool valid() const { return message.msgid == MSGID; }
+
+protected:
+	const mavlink_message_t &message;
+
+	template <typename T>
+	T _field(unsigned offset) const
+	{
+		const uint8_t *payload = (const uint8_t *)_MAV_PAYLOAD(&message);
+		uint8_t bytes[sizeof(T)];
+
+		if (offset + sizeof(T) <= message.len)
+		{
+			memcpy(bytes, payload + offset, sizeof(T));
+		}
+		else
+		{
+			// trimmed, what is missing was zero
+			memset(bytes, 0, sizeof(T));
+			if (offset < message.len)
+				memcpy(bytes, payload + offset, message.len - offset);
+		}
+
+#if MAVLINK_NEED_BYTE_SWAP
+		for (unsigned i = 0; i < sizeof(T) / 2; i++)
+		{
+			uint8_t swap = bytes[i];
+			bytes[i] = bytes[sizeof(T) - 1 - i];
+			bytes[sizeof(T) - 1 - i] = swap;
+		}
+#endif
+
+		T value;
+		memcpy(&value, bytes, sizeof(T));
+		return value;
+	}
+
+	// in place, bytes only; wider elements go through _field()
+	template <typename T>
+	const T *_array(unsigned offset) const
+	{
+		static_assert(sizeof(T) == 1, "only byte arrays are handed out in place");
+		return (const T *)(_MAV_PAYLOAD(&message) + offset);
+	}
+};
+
+#endif // MAVLINK_VIEW_H_
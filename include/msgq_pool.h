@@ -39,7 +39,7 @@
 
 #include "msgq_id.h"
 
-extern uint8_t AutoGenMesgBuff[1204];
+extern uint8_t AutoGenMesgBuff[1048];
 
 extern MsgQueDef MsgqPoolDefs[NUM_MSGQ_POOLS];
 
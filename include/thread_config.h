@@ -0,0 +1,411 @@
+/**
+ * @file thread_config.h
+ *
+ * @brief Thread placement, priority and stack sizes
+ *
+ * One table for where every long lived thread of the image runs: the CPU
+ * it is pinned to, its SCHED_FIFO priority and its stack.  Threads are
+ * started through thread_config_create(), task main threads place
+ * themselves with thread_config_apply_self(), and thread_config_report()
+ * shows what each one costs so the table can be balanced across the four
+ * cores of the SMP build.
+ *
+ * The same calls work on Linux; priorities are scaled into the SCHED_FIFO
+ * range there, and if real time scheduling is refused the thread still
+ * starts, pinned and with its stack, at the default priority.
+ *
+ * Header only, the GPS task and mavlink_control both use it and share one
+ * registry of threads.
+ *
+ */
+
+#ifndef THREAD_CONFIG_H_
+#define THREAD_CONFIG_H_
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <sched.h>
+#include <pthread.h> // This uses POSIX Threads
+
+// ------------------------------------------------------------------------------
+//   Defines
+// ------------------------------------------------------------------------------
+
+// Threads the registry follows at once, finished ones included
+#define THREAD_CONFIG_MAX_THREADS 16
+
+// No pinning, the scheduler picks a CPU
+#define THREAD_ANY_CPU -1
+
+#if defined(__NuttX__) && defined(CONFIG_SMP)
+#define THREAD_CONFIG_AFFINITY
+#elif !defined(__NuttX__) && defined(__linux__)
+#define THREAD_CONFIG_AFFINITY
+#endif
+
+// ------------------------------------------------------------------------------
+//   Configuration
+// ------------------------------------------------------------------------------
+
+enum Thread_Role
+{
+	THREAD_CONTROL,	// mavlink_control main thread
+	THREAD_READ,	// Autopilot_Interface read thread, parses the link
+	THREAD_WRITE,	// Autopilot_Interface write thread, setpoints at 4 Hz
+	THREAD_GPS,		// GPS task main thread
+	THREAD_LOG,		// log receiver and tlog recorder writers
+	THREAD_TRACE,	// trace drain
+	THREAD_TX,		// Tx_Scheduler, paces frames onto the port
+	THREAD_FORWARD,	// Frame_Forwarder, routes received frames to another port
+	THREAD_LINK,	// Link_Aggregator, parses one of its links
+	THREAD_GPS_FORWARD,	// Autopilot_Interface, sends streamed GPS fixes on
+	THREAD_NUM_ROLES
+};
+
+struct Thread_Config
+{
+	const char *name;
+	int cpu;		// THREAD_ANY_CPU or 0 .. CONFIG_SMP_NCPUS - 1
+	int priority;	// NuttX priority, 1 .. 255
+	int stacksize;	// bytes, 0 for the default
+};
+
+/*
+ * The receive path has a core to itself and the highest priority, the
+ * GPS task and the writer each have theirs, the GPS fixes go out from the
+ * writer's core just below the tx thread, and what only moves data to
+ * storage shares CPU 0 with nsh below everything else.  Task stacks are
+ * set in the app Makefiles, STACKSIZE there matches the entries here.
+ */
+static const Thread_Config thread_configs[THREAD_NUM_ROLES] =
+{
+	// name       cpu  priority  stacksize
+	{"control",   0,   100,      8192},
+	{"read",      1,   200,      4096},
+	{"write",     2,   180,      3072},
+	{"gps",       3,   150,      4096},
+	{"log",       0,   90,       3072},
+	{"trace",     0,   20,       2048},
+	{"tx",        2,   190,      3072},
+	{"forward",   0,   120,      3072},
+	{"link",      1,   200,      4096},
+	{"gpsfwd",    2,   185,      3072},
+};
+
+// ------------------------------------------------------------------------------
+//   Registry
+// ------------------------------------------------------------------------------
+
+struct Thread_Record
+{
+	Thread_Role role;
+	pthread_t tid;
+	bool running;
+	bool realtime;		// got its SCHED_FIFO priority
+	uint64_t start_usec;
+	uint64_t end_usec;
+	uint64_t cpu_usec;	// CPU time when it was joined, Linux only
+};
+
+struct Thread_Registry
+{
+	pthread_mutex_t lock;
+	int count;
+	Thread_Record records[THREAD_CONFIG_MAX_THREADS];
+};
+
+// one for the image, shared by every app that includes this
+inline Thread_Registry &
+thread_registry()
+{
+	static Thread_Registry registry = {PTHREAD_MUTEX_INITIALIZER, 0, {}};
+	return registry;
+}
+
+static inline uint64_t
+thread_config_now_usec()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static inline void
+thread_config_register(Thread_Role role, pthread_t tid, bool realtime, uint64_t start_usec)
+{
+	Thread_Registry &registry = thread_registry();
+
+	pthread_mutex_lock(&registry.lock);
+	int i = registry.count;
+	if (i == THREAD_CONFIG_MAX_THREADS)
+	{
+		// full, reuse the oldest finished slot
+		for (i = 0; i < THREAD_CONFIG_MAX_THREADS && registry.records[i].running; i++)
+			;
+	}
+	if (i < THREAD_CONFIG_MAX_THREADS)
+	{
+		Thread_Record &record = registry.records[i];
+		memset(&record, 0, sizeof(record));
+		record.role = role;
+		record.tid = tid;
+		record.running = true;
+		record.realtime = realtime;
+		record.start_usec = start_usec;
+		if (i == registry.count)
+			registry.count++;
+	}
+	pthread_mutex_unlock(&registry.lock);
+}
+
+// ------------------------------------------------------------------------------
+//   Scheduling
+// ------------------------------------------------------------------------------
+
+// priority in this system's SCHED_FIFO range
+static inline int
+thread_config_priority(int priority)
+{
+#if defined(__NuttX__)
+	return priority;
+#else
+	int low = sched_get_priority_min(SCHED_FIFO);
+	int high = sched_get_priority_max(SCHED_FIFO);
+	return low + (priority - 1) * (high - low) / 254;
+#endif
+}
+
+#if defined(THREAD_CONFIG_AFFINITY)
+static inline void
+thread_config_cpuset(int cpu, cpu_set_t &cpuset)
+{
+	CPU_ZERO(&cpuset);
+	CPU_SET(cpu, &cpuset);
+}
+#endif
+
+/*
+ * pthread_create() with the role's CPU, priority and stack.  Returns what
+ * pthread_create() returns; when only the real time priority is refused,
+ * or the CPU does not exist on this machine, the thread is started again
+ * without it.
+ */
+static inline int
+thread_config_create(pthread_t *tid, Thread_Role role, void *(*start)(void *), void *arg)
+{
+	const Thread_Config &config = thread_configs[role];
+	bool realtime = true;
+	bool pinned = config.cpu != THREAD_ANY_CPU;
+	int result;
+
+	// a higher priority thread may run to its end before create returns
+	uint64_t start_usec = thread_config_now_usec();
+
+	while (1)
+	{
+		pthread_attr_t attr;
+		pthread_attr_init(&attr);
+
+		if (config.stacksize > 0)
+			pthread_attr_setstacksize(&attr, config.stacksize);
+
+#if defined(THREAD_CONFIG_AFFINITY)
+		if (pinned)
+		{
+			cpu_set_t cpuset;
+			thread_config_cpuset(config.cpu, cpuset);
+			pthread_attr_setaffinity_np(&attr, sizeof(cpuset), &cpuset);
+		}
+#endif
+
+		if (realtime)
+		{
+			struct sched_param param;
+			param.sched_priority = thread_config_priority(config.priority);
+			pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+			pthread_attr_setschedparam(&attr, &param);
+			pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+		}
+
+		result = pthread_create(tid, &attr, start, arg);
+		pthread_attr_destroy(&attr);
+
+		if (result == EPERM && realtime)
+		{
+			fprintf(stderr, "WARNING: no real time priority for the %s thread\n", config.name);
+			realtime = false;
+			continue;
+		}
+		if (result == EINVAL && pinned)
+		{
+			fprintf(stderr, "WARNING: no CPU %d for the %s thread\n", config.cpu, config.name);
+			pinned = false;
+			continue;
+		}
+		break;
+	}
+
+	if (result == 0)
+		thread_config_register(role, *tid, realtime, start_usec);
+	return result;
+}
+
+/*
+ * Places the calling thread, for the main thread of a task.  Its stack
+ * was set when the task started.  Returns 0, or the first error.
+ */
+static inline int
+thread_config_apply_self(Thread_Role role)
+{
+	const Thread_Config &config = thread_configs[role];
+	int result = 0;
+
+#if defined(THREAD_CONFIG_AFFINITY)
+	if (config.cpu != THREAD_ANY_CPU)
+	{
+		cpu_set_t cpuset;
+		thread_config_cpuset(config.cpu, cpuset);
+		if (sched_setaffinity(0, sizeof(cpuset), &cpuset) < 0)
+			result = errno;
+	}
+#endif
+
+	struct sched_param param;
+	param.sched_priority = thread_config_priority(config.priority);
+	int error = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+	if (error)
+	{
+		fprintf(stderr, "WARNING: no real time priority for the %s thread\n", config.name);
+		if (result == 0)
+			result = error;
+	}
+
+	thread_config_register(role, pthread_self(), error == 0, thread_config_now_usec());
+	return result;
+}
+
+// ------------------------------------------------------------------------------
+//   CPU Time
+// ------------------------------------------------------------------------------
+/*
+ * CPU time of a running thread in microseconds, or -1 where the system
+ * does not count it per thread.  NuttX only keeps a load average, see
+ * thread_config_load().
+ */
+static inline int64_t
+thread_config_cpu_usec(pthread_t tid)
+{
+#if !defined(__NuttX__)
+	clockid_t clock;
+	struct timespec ts;
+	if (pthread_getcpuclockid(tid, &clock) == 0 && clock_gettime(clock, &ts) == 0)
+		return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#endif
+	(void)tid;
+	return -1;
+}
+
+/*
+ * Share of one CPU in tenths of a percent, or -1 if unknown.  On NuttX the
+ * scheduler's decaying average from /proc/<pid>/loadavg, which needs
+ * CONFIG_SCHED_CPULOAD; elsewhere the average since the thread started.
+ */
+static inline int
+thread_config_load(const Thread_Record &record)
+{
+#if defined(__NuttX__)
+	if (!record.running)
+		return -1;
+
+	char path[32];
+	snprintf(path, sizeof(path), "/proc/%d/loadavg", (int)record.tid);
+	FILE *in = fopen(path, "r");
+	if (in == NULL)
+		return -1;
+
+	int whole = 0, tenths = 0;
+	int fields = fscanf(in, "%d.%d", &whole, &tenths);
+	fclose(in);
+	return fields == 2 ? whole * 10 + tenths : -1;
+#else
+	int64_t cpu = record.running ? thread_config_cpu_usec(record.tid) : (int64_t)record.cpu_usec;
+	uint64_t wall = (record.running ? thread_config_now_usec() : record.end_usec) - record.start_usec;
+	if (cpu < 0 || wall == 0)
+		return -1;
+	return (int)(cpu * 1000 / wall);
+#endif
+}
+
+/*
+ * pthread_join() that keeps the thread's CPU time for the report, taken
+ * just before it goes.
+ */
+static inline int
+thread_config_join(pthread_t tid, void **value)
+{
+	Thread_Registry &registry = thread_registry();
+
+	pthread_mutex_lock(&registry.lock);
+	for (int i = 0; i < registry.count; i++)
+	{
+		Thread_Record &record = registry.records[i];
+		if (record.running && pthread_equal(record.tid, tid))
+		{
+			int64_t cpu = thread_config_cpu_usec(tid);
+			record.cpu_usec = cpu < 0 ? 0 : cpu;
+			record.end_usec = thread_config_now_usec();
+			record.running = false;
+		}
+	}
+	pthread_mutex_unlock(&registry.lock);
+
+	return pthread_join(tid, value);
+}
+
+// ------------------------------------------------------------------------------
+//   Report
+// ------------------------------------------------------------------------------
+
+static inline void
+thread_config_report(FILE *out)
+{
+	Thread_Registry &registry = thread_registry();
+
+	fprintf(out, "%-8s %5s %4s %5s %7s %8s %12s %7s\n",
+			"thread", "state", "cpu", "prio", "stack", "rt", "cpu ms", "load %");
+
+	pthread_mutex_lock(&registry.lock);
+	for (int i = 0; i < registry.count; i++)
+	{
+		const Thread_Record &record = registry.records[i];
+		const Thread_Config &config = thread_configs[record.role];
+
+		int64_t cpu = record.running ? thread_config_cpu_usec(record.tid) : (int64_t)record.cpu_usec;
+		int load = thread_config_load(record);
+
+		char cpu_ms[24], load_pct[16];
+		if (cpu < 0)
+			snprintf(cpu_ms, sizeof(cpu_ms), "-");
+		else
+			snprintf(cpu_ms, sizeof(cpu_ms), "%lu.%03lu",
+					 (unsigned long)(cpu / 1000), (unsigned long)(cpu % 1000));
+		if (load < 0)
+			snprintf(load_pct, sizeof(load_pct), "-");
+		else
+			snprintf(load_pct, sizeof(load_pct), "%d.%d", load / 10, load % 10);
+
+		fprintf(out, "%-8s %5s %4d %5d %7d %8s %12s %7s\n",
+				config.name, record.running ? "run" : "done", config.cpu, config.priority,
+				config.stacksize, record.realtime ? "fifo" : "default", cpu_ms, load_pct);
+	}
+	pthread_mutex_unlock(&registry.lock);
+}
+
+#endif // THREAD_CONFIG_H_
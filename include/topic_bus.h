@@ -0,0 +1,250 @@
+/**
+ * @file topic_bus.h
+ *
+ * @brief In-process publish/subscribe bus
+ *
+ * Typed topics shared by the tasks of the flat NuttX image, in the manner
+ * of PX4's uORB.  A topic keeps its last QUEUE samples; any number of
+ * tasks publish to it and any number subscribe, each subscriber with its
+ * own read position.  A subscriber either reads the latest sample, in
+ * place under the topic lock or as a copy, or takes the samples one by one
+ * in order, finding out how many it missed when it fell more than QUEUE
+ * behind.  Publishing never waits for subscribers.
+ *
+ * Header only, so every app that links into the image can use it without
+ * a library; the topics themselves are listed in topics.h.
+ *
+ */
+
+#ifndef TOPIC_BUS_H_
+#define TOPIC_BUS_H_
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <time.h>
+#include <errno.h>
+#include <pthread.h> // This uses POSIX Threads
+#include <atomic>
+
+// ------------------------------------------------------------------------------
+//   Defines
+// ------------------------------------------------------------------------------
+
+/*
+ * Defines topic_<name>(), the one instance of the topic in the image, its
+ * type <name>_topic_t and <name>_subscriber_t to read it with.  The
+ * instance is a static local of an inline function, so every translation
+ * unit that includes the definition shares it and it is constructed on
+ * first use, whichever task gets there first.
+ */
+#define TOPIC_DEFINE(name, type, queue)                         \
+	typedef Topic<type, queue> name##_topic_t;                  \
+	typedef Topic_Subscriber<type, queue> name##_subscriber_t;  \
+	inline name##_topic_t &topic_##name()                       \
+	{                                                           \
+		static name##_topic_t topic(#name);                     \
+		return topic;                                           \
+	}
+
+// ----------------------------------------------------------------------------------
+//   Topic Class
+// ----------------------------------------------------------------------------------
+/*
+ * Topic Class
+ *
+ * Sample n goes to slots[n % QUEUE], generation counts the samples ever
+ * published.  Publishing and reading hold the topic mutex for the copy
+ * only; updated() is a single atomic load, so a subscriber polling from a
+ * busy loop costs the publisher nothing.
+ */
+template <typename T, int QUEUE = 1>
+class Topic
+{
+	static_assert(QUEUE > 0, "a topic keeps at least one sample");
+
+public:
+	Topic(const char *name_)
+	{
+		name = name_;
+		generation = 0;
+		subscribers = 0;
+		pthread_mutex_init(&lock, NULL);
+		pthread_cond_init(&published, NULL);
+	}
+
+	~Topic()
+	{
+		pthread_cond_destroy(&published);
+		pthread_mutex_destroy(&lock);
+	}
+
+	const char *get_name() { return name; }
+	uint32_t get_generation() { return generation.load(std::memory_order_acquire); }
+	int get_subscribers() { return subscribers.load(std::memory_order_relaxed); }
+
+	void publish(const T &sample)
+	{
+		pthread_mutex_lock(&lock);
+		uint32_t g = generation.load(std::memory_order_relaxed);
+		slots[g % QUEUE] = sample;
+		generation.store(g + 1, std::memory_order_release);
+		pthread_cond_broadcast(&published);
+		pthread_mutex_unlock(&lock);
+	}
+
+	/*
+	 * The latest sample read in place.  Holds the topic lock while it
+	 * lives, so publishers wait on it: read what is needed and let go.
+	 */
+	class Latest
+	{
+	public:
+		Latest(Topic &topic_) : topic(topic_)
+		{
+			pthread_mutex_lock(&topic.lock);
+			uint32_t g = topic.generation.load(std::memory_order_relaxed);
+			sample = g ? &topic.slots[(g - 1) % QUEUE] : NULL;
+		}
+		~Latest() { pthread_mutex_unlock(&topic.lock); }
+
+		// NULL until something was published
+		const T *get() { return sample; }
+
+	private:
+		Topic &topic;
+		const T *sample;
+
+		Latest(const Latest &);
+		Latest &operator=(const Latest &);
+	};
+
+private:
+	template <typename S, int Q>
+	friend class Topic_Subscriber;
+
+	const char *name;
+	pthread_mutex_t lock;
+	pthread_cond_t published;
+	std::atomic<uint32_t> generation;
+	std::atomic<int> subscribers;
+	T slots[QUEUE];
+
+	Topic(const Topic &);
+	Topic &operator=(const Topic &);
+};
+
+// ----------------------------------------------------------------------------------
+//   Topic Subscriber Class
+// ----------------------------------------------------------------------------------
+/*
+ * Topic Subscriber Class
+ *
+ * One task's view of a topic.  Starts after whatever was published before
+ * it subscribed.  Not shared between tasks, each has its own.
+ */
+template <typename T, int QUEUE = 1>
+class Topic_Subscriber
+{
+
+public:
+	Topic_Subscriber(Topic<T, QUEUE> &topic_) : topic(topic_)
+	{
+		seen = topic.get_generation();
+		lost = 0;
+		topic.subscribers.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	~Topic_Subscriber()
+	{
+		topic.subscribers.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	// something published since the last copy() or next()
+	bool updated() { return topic.get_generation() != seen; }
+
+	// samples that went by while this subscriber was more than QUEUE behind
+	uint32_t get_lost() { return lost; }
+
+	/*
+	 * Copies the latest sample and skips to it.  Returns false if nothing
+	 * was published since the last read.
+	 */
+	bool copy(T &sample)
+	{
+		pthread_mutex_lock(&topic.lock);
+		uint32_t g = topic.generation.load(std::memory_order_relaxed);
+		bool fresh = g != seen;
+		if (fresh)
+		{
+			sample = topic.slots[(g - 1) % QUEUE];
+			seen = g;
+		}
+		pthread_mutex_unlock(&topic.lock);
+		return fresh;
+	}
+
+	/*
+	 * Copies the oldest sample not read yet.  Returns false when there is
+	 * none.  Samples already overwritten are counted in get_lost().
+	 */
+	bool next(T &sample)
+	{
+		pthread_mutex_lock(&topic.lock);
+		uint32_t g = topic.generation.load(std::memory_order_relaxed);
+		bool fresh = g != seen;
+		if (fresh)
+		{
+			if (g - seen > (uint32_t)QUEUE)
+			{
+				lost += g - seen - QUEUE;
+				seen = g - QUEUE;
+			}
+			sample = topic.slots[seen % QUEUE];
+			seen++;
+		}
+		pthread_mutex_unlock(&topic.lock);
+		return fresh;
+	}
+
+	/*
+	 * Blocks until something is published, at most timeout_ms, or for
+	 * good with a negative timeout.  Returns updated().
+	 */
+	bool wait(int timeout_ms)
+	{
+		struct timespec deadline;
+		clock_gettime(CLOCK_REALTIME, &deadline);
+		if (timeout_ms > 0)
+		{
+			deadline.tv_sec += timeout_ms / 1000;
+			deadline.tv_nsec += (timeout_ms % 1000) * 1000000L;
+			if (deadline.tv_nsec >= 1000000000L)
+			{
+				deadline.tv_sec++;
+				deadline.tv_nsec -= 1000000000L;
+			}
+		}
+
+		pthread_mutex_lock(&topic.lock);
+		while (topic.generation.load(std::memory_order_relaxed) == seen && timeout_ms != 0)
+		{
+			int result = timeout_ms < 0 ? pthread_cond_wait(&topic.published, &topic.lock)
+										: pthread_cond_timedwait(&topic.published, &topic.lock, &deadline);
+			if (result == ETIMEDOUT)
+				break;
+		}
+		pthread_mutex_unlock(&topic.lock);
+
+		return updated();
+	}
+
+private:
+	Topic<T, QUEUE> &topic;
+	uint32_t seen;
+	uint32_t lost;
+};
+
+#endif // TOPIC_BUS_H_
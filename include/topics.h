@@ -0,0 +1,44 @@
+/**
+ * @file topics.h
+ *
+ * @brief Topics on the in-process bus
+ *
+ * Vehicle telemetry decoded by mavlink_control and the fixes made by the
+ * GPS task, for any app in the image:
+ *
+ *   vehicle_attitude_subscriber_t attitude(topic_vehicle_attitude());
+ *   if (attitude.wait(100))
+ *       attitude.copy(sample);
+ *
+ * Samples are the MAVLink message structs.  Include after a mavlink.h,
+ * either dialect; these messages are the same in both.
+ *
+ */
+
+#ifndef TOPICS_H_
+#define TOPICS_H_
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include "topic_bus.h"
+
+#ifndef MAVLINK_MSG_ID_HIL_GPS
+#error "include a mavlink.h before topics.h"
+#endif
+
+// ------------------------------------------------------------------------------
+//   Topics
+// ------------------------------------------------------------------------------
+
+// every fix the GPS task makes, queued so a slow reader can take them all
+TOPIC_DEFINE(gps_fix, mavlink_hil_gps_t, 8)
+
+// received from the autopilot, latest only
+TOPIC_DEFINE(vehicle_heartbeat, mavlink_heartbeat_t, 1)
+TOPIC_DEFINE(vehicle_attitude, mavlink_attitude_t, 1)
+TOPIC_DEFINE(vehicle_local_position, mavlink_local_position_ned_t, 1)
+TOPIC_DEFINE(vehicle_global_position, mavlink_global_position_int_t, 1)
+
+#endif // TOPICS_H_
@@ -0,0 +1,226 @@
+/**
+ * @file trace.h
+ *
+ * @brief Binary trace rings
+ *
+ * Hot paths record fixed size events (id, timestamp, up to four 32 bit
+ * arguments) with TRACE0 .. TRACE4 instead of printing them.  Each thread
+ * writes a lock-free ring of its own; a drain task or an offline decoder
+ * formats the events later, off the hot path and away from the console.
+ *
+ * Built with MAVLINK_TRACE defined the macros record, otherwise they expand
+ * to nothing and their arguments are not evaluated.
+ *
+ * Header only so every app linked into the image shares one set of rings
+ * through trace_buffer().
+ *
+ */
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h> // This uses POSIX Threads
+#include <atomic>
+
+#include "trace_events.h"
+
+// ------------------------------------------------------------------------------
+//   Defines
+// ------------------------------------------------------------------------------
+
+// Threads that can trace at the same time
+#define TRACE_MAX_THREADS 8
+
+// Events per thread, a power of two
+#define TRACE_RING_EVENTS 128
+
+#define TRACE_MAX_ARGS 4
+
+// ------------------------------------------------------------------------------
+//   Data Structures
+// ------------------------------------------------------------------------------
+
+// 32 bytes, also the record format of binary trace files
+struct Trace_Event
+{
+	uint64_t usec;		// CLOCK_MONOTONIC
+	uint16_t id;		// Trace_Event_Id
+	uint8_t thread;		// ring index
+	uint8_t nargs;
+	uint32_t args[TRACE_MAX_ARGS];	// integers, or float bits for %f
+};
+
+/*
+ * Single producer (the owning thread), single consumer (the drain).  When
+ * full the new event is dropped and counted, the producer never waits.
+ */
+struct Trace_Ring
+{
+	std::atomic<int> state;		// 0 free, 1 being claimed, 2 owned
+	pthread_t owner;
+	alignas(64) std::atomic<uint32_t> head;
+	alignas(64) std::atomic<uint32_t> tail;
+	std::atomic<uint32_t> drops;
+	Trace_Event events[TRACE_RING_EVENTS];
+};
+
+struct Trace_Buffer
+{
+	Trace_Ring rings[TRACE_MAX_THREADS];
+	std::atomic<uint32_t> no_ring;	// events from threads that found no free ring
+};
+
+// ------------------------------------------------------------------------------
+//   Rings
+// ------------------------------------------------------------------------------
+
+// One instance per image; static storage starts zeroed, every ring free
+inline Trace_Buffer &
+trace_buffer()
+{
+	static Trace_Buffer buffer;
+	return buffer;
+}
+
+/*
+ * The calling thread's ring, claimed on its first event.  No thread local
+ * storage on this target, so the owners are scanned; with a handful of
+ * threads that is a few compares.
+ */
+inline Trace_Ring *
+trace_ring()
+{
+	Trace_Buffer &buffer = trace_buffer();
+	pthread_t self = pthread_self();
+
+	for (int i = 0; i < TRACE_MAX_THREADS; i++)
+	{
+		Trace_Ring &ring = buffer.rings[i];
+		if (ring.state.load(std::memory_order_acquire) == 2 && pthread_equal(ring.owner, self))
+			return &ring;
+	}
+
+	for (int i = 0; i < TRACE_MAX_THREADS; i++)
+	{
+		Trace_Ring &ring = buffer.rings[i];
+		int expected = 0;
+		if (ring.state.compare_exchange_strong(expected, 1, std::memory_order_acquire))
+		{
+			ring.owner = self;
+			ring.state.store(2, std::memory_order_release);
+			return &ring;
+		}
+	}
+
+	return NULL;
+}
+
+/*
+ * Gives the calling thread's ring back, e.g. before the thread exits.  The
+ * drain must have emptied it for the events to be seen.
+ */
+inline void
+trace_release()
+{
+	Trace_Buffer &buffer = trace_buffer();
+	pthread_t self = pthread_self();
+
+	for (int i = 0; i < TRACE_MAX_THREADS; i++)
+	{
+		Trace_Ring &ring = buffer.rings[i];
+		if (ring.state.load(std::memory_order_acquire) == 2 && pthread_equal(ring.owner, self))
+			ring.state.store(0, std::memory_order_release);
+	}
+}
+
+// ------------------------------------------------------------------------------
+//   Recording
+// ------------------------------------------------------------------------------
+
+inline uint32_t trace_arg(float value)
+{
+	uint32_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	return bits;
+}
+
+inline uint32_t trace_arg(double value)
+{
+	return trace_arg((float)value);
+}
+
+template <typename T>
+inline uint32_t trace_arg(T value)
+{
+	return (uint32_t)value;
+}
+
+inline void
+trace_record(uint16_t id, int nargs, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3)
+{
+	Trace_Ring *ring = trace_ring();
+	if (ring == NULL)
+	{
+		trace_buffer().no_ring.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	uint32_t h = ring->head.load(std::memory_order_relaxed);
+	uint32_t t = ring->tail.load(std::memory_order_acquire);
+	if (h - t >= TRACE_RING_EVENTS)
+	{
+		ring->drops.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	Trace_Event &event = ring->events[h & (TRACE_RING_EVENTS - 1)];
+	event.usec = (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+	event.id = id;
+	event.thread = ring - trace_buffer().rings;
+	event.nargs = nargs;
+	event.args[0] = a0;
+	event.args[1] = a1;
+	event.args[2] = a2;
+	event.args[3] = a3;
+
+	ring->head.store(h + 1, std::memory_order_release);
+}
+
+// ------------------------------------------------------------------------------
+//   Call Sites
+// ------------------------------------------------------------------------------
+
+#if defined(MAVLINK_TRACE)
+
+#define TRACE0(id) \
+	trace_record(id, 0, 0, 0, 0, 0)
+#define TRACE1(id, a) \
+	trace_record(id, 1, trace_arg(a), 0, 0, 0)
+#define TRACE2(id, a, b) \
+	trace_record(id, 2, trace_arg(a), trace_arg(b), 0, 0)
+#define TRACE3(id, a, b, c) \
+	trace_record(id, 3, trace_arg(a), trace_arg(b), trace_arg(c), 0)
+#define TRACE4(id, a, b, c, d) \
+	trace_record(id, 4, trace_arg(a), trace_arg(b), trace_arg(c), trace_arg(d))
+
+#else
+
+#define TRACE0(id) do {} while (0)
+#define TRACE1(id, a) do {} while (0)
+#define TRACE2(id, a, b) do {} while (0)
+#define TRACE3(id, a, b, c) do {} while (0)
+#define TRACE4(id, a, b, c, d) do {} while (0)
+
+#endif // MAVLINK_TRACE
+
+#endif // TRACE_H_
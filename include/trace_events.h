@@ -0,0 +1,33 @@
+/**
+ * @file trace_events.h
+ *
+ * @brief Trace event ids and their format strings
+ *
+ * One line per event.  The format is only used when the event is printed,
+ * by the drain task or the offline decoder; %f reads a float argument,
+ * every other conversion an integer.  Append new events at the end so ids
+ * in recorded traces keep their meaning.
+ *
+ */
+
+#ifndef TRACE_EVENTS_H_
+#define TRACE_EVENTS_H_
+
+#define TRACE_EVENTS(X) \
+	X(TRACE_GPS_RECEIVE,		"receive_msg: %d") \
+	X(TRACE_GPS_SEND,			"send OK") \
+	X(TRACE_GPS_REQUEST,		"GPS_request: %d") \
+	X(TRACE_HIL_GPS,			"gpsinput.lat = %d, gpsinput.lon = %d") \
+	X(TRACE_SET_POSITION,		"POSITION SETPOINT XYZ = [ %.4f , %.4f , %.4f ]") \
+	X(TRACE_SET_VELOCITY,		"VELOCITY SETPOINT UVW = [ %.4f , %.4f , %.4f ]") \
+	X(TRACE_SET_YAW,			"POSITION SETPOINT YAW = %.4f")
+
+enum Trace_Event_Id
+{
+#define TRACE_EVENT_ID(id, format) id,
+	TRACE_EVENTS(TRACE_EVENT_ID)
+#undef TRACE_EVENT_ID
+	TRACE_NUM_EVENTS
+};
+
+#endif // TRACE_EVENTS_H_
@@ -0,0 +1,1891 @@
+/**
+ * @file mavlink_bench.cpp
+ *
+ * @brief Hardware-free benchmarks of the MAVLink pipeline
+ *
+ * usage: mavlink_bench <benchmark> [options]
+ *
+ *   replay <file.tlog> [-r] [-n <passes>] [-w <writes.tlog>]
+ *       plays a recorded tlog through Autopilot_Interface::read_messages
+ *       and reports messages per second through parse, decode and dispatch
+ *
+ *   loopback [-n <messages>] [-p] [-s] [-c <ring bytes>]
+ *       a writer thread streams a typical telemetry mix into one end of a
+ *       Loopback_Pair, the other end is read through
+ *       Autopilot_Interface::read_messages, or with -p through the port
+ *       alone; no kernel in the path.  -s signs on the way in and verifies
+ *       on the way out
+ *
+ *   signing [-n <messages>] [-b <baudrate>] [-s <streams>]
+ *       signs and verifies the telemetry mix with Mavlink_Signing and signs
+ *       it with mavlink_sign_packet, and compares the cost per frame with
+ *       the time the frame takes on the wire.  Then times the replay check
+ *       with that many streams in a Signing_Stream_Table, and in a
+ *       mavlink_signing_streams_t scanned like mavlink_signature_check()
+ *
+ *   trace [-n <events>] [<file.trc>]
+ *       records trace events into a ring and drains them, against
+ *       formatting the same line with snprintf at the call site.  Given a
+ *       binary trace saved with mavlink_control -T, prints it instead
+ *
+ *   msgq [-n <fixes>]
+ *       stands in for the GPS task and moves fixes over MsgLib, first one
+ *       per request on the normal lane as before, then streamed in batches
+ *       with requests answered on the high priority lane; fixes per second
+ *       and latencies for both.  Stop the GPS task first
+ *
+ *   serial -d <device> [-b <baudrate>] [-L <profile>] [-n <bursts>] [-s <burst>]
+ *       needs the port wired back to itself, TX to RX and RTS to CTS.
+ *       Writes bursts of the telemetry mix back to back, each frame
+ *       followed by a stamped TIMESYNC, at half the line rate on average,
+ *       and reads them back on the same port; frames lost and write to
+ *       parse latency for the profile, or for each one in turn
+ *
+ *   txsched [-b <baudrate>] [-n <seconds>]
+ *       an FTP flood next to HIL_GPS, setpoints, telemetry and heartbeats
+ *       on a port paced to the baud rate, written straight to it and then
+ *       through a Tx_Scheduler; how long the writes block, and the
+ *       scheduler's per class latency from write to port
+ *
+ *   encode [-n <messages>]
+ *       serializes HIL_GPS and SET_POSITION_TARGET_LOCAL_NED with
+ *       mavlink_msg_X_encode() and mavlink_msg_to_send_buffer(), as the
+ *       ports did, and with frame_encode() straight into the send buffer,
+ *       and checks both give the same bytes
+ *
+ *   pool [-n <frames>] [-k <sinks>] [-f <pool frames>]
+ *       hands each frame to k queues as a copy of the mavlink_message_t,
+ *       and as a handle to one pooled frame; then through k
+ *       Frame_Forwarders on their threads, with the pool's high water mark
+ *       and exhaustion count and the RAM each way takes
+ *
+ *   views [-n <messages>]
+ *       reads a few fields of HIGHRES_IMU and REMOTE_LOG_DATA_BLOCK frames
+ *       after mavlink_msg_X_decode(), and through the typed views in place;
+ *       then checks a view reads a trimmed MAVLink 2 payload as decode does
+ *
+ *   topics [-n <samples>] [-k <subscribers>]
+ *       checks the topic bus: the latest sample by copy() and in place,
+ *       queued delivery with next() and the count of samples lost behind
+ *       the queue, each subscriber on its own; then publishes n samples
+ *       as fast as it can to k subscriber threads, which read every one
+ *       in order or count it lost, with their publish to read latency
+ *
+ *   msgs [-n <iterations>] [-d] [-f csv|json]
+ *       pack, encode, to_send_buffer, parse_char and decode of every
+ *       message of the ardupilotmega dialect, and parse MB/s of mixed
+ *       streams, as CSV or JSON lines; see mavlink_msgbench.cpp
+ *
+ */
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include "mavlink_bench.h"
+
+// ------------------------------------------------------------------------------
+//   Helpers
+// ------------------------------------------------------------------------------
+
+uint64_t
+bench_now_usec()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+void
+bench_report(const char *name, uint64_t count, uint64_t bytes, uint64_t elapsed_usec)
+{
+	double seconds = elapsed_usec / 1e6;
+	if (seconds <= 0)
+		seconds = 1e-6;
+
+	printf("%-24s %10" PRIu64 " msgs %8.3f s %12.0f msg/s %10.2f MB/s %8.1f ns/msg\n",
+		   name, count, seconds, count / seconds, bytes / seconds / 1e6,
+		   count ? elapsed_usec * 1000.0 / count : 0.0);
+}
+
+// ------------------------------------------------------------------------------
+//   Replay Benchmark
+// ------------------------------------------------------------------------------
+int
+bench_replay(int argc, char **argv)
+{
+	const char *usage = "usage: mavlink_bench replay <file.tlog> [-r] [-n <passes>] [-w <writes.tlog>]";
+
+	if (argc < 3)
+	{
+		printf("%s\n", usage);
+		return EXIT_FAILURE;
+	}
+
+	const char *path = argv[2];
+	bool realtime = false;
+	int passes = 1;
+	const char *writes_path = NULL;
+
+	for (int i = 3; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-r") == 0)
+		{
+			realtime = true;
+		}
+		else if (strcmp(argv[i], "-n") == 0 && argc > i + 1)
+		{
+			passes = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "-w") == 0 && argc > i + 1)
+		{
+			writes_path = argv[++i];
+		}
+		else
+		{
+			printf("%s\n", usage);
+			return EXIT_FAILURE;
+		}
+	}
+
+	Replay_Port port(path, realtime, passes);
+	port.start();
+
+	// no threads started, read_messages runs right here until the log ends
+	Autopilot_Interface autopilot_interface(&port);
+
+	uint64_t start = bench_now_usec();
+	while (port.is_running())
+		autopilot_interface.read_messages();
+	uint64_t elapsed = bench_now_usec() - start;
+
+	Replay_Port_Stats stats = port.get_stats();
+	bench_report("replay", stats.messages, stats.bytes, elapsed);
+	printf("  frames %lu, rejected %lu, passes %lu, writes captured %lu\n",
+		   (unsigned long)stats.frames, (unsigned long)stats.bad_frames,
+		   (unsigned long)stats.loops + 1, (unsigned long)stats.writes);
+
+	if (writes_path)
+		port.save_writes(writes_path);
+
+	port.stop();
+	return 0;
+}
+
+// ------------------------------------------------------------------------------
+//   Loopback Benchmark
+// ------------------------------------------------------------------------------
+
+// Telemetry an autopilot typically streams, one of each
+#define BENCH_MIX_LEN 9
+
+struct Bench_Writer
+{
+	Loopback_Port *port;
+	uint32_t count;
+	mavlink_message_t mix[BENCH_MIX_LEN];
+};
+
+static void
+bench_make_mix(mavlink_message_t *mix)
+{
+	uint8_t zero[MAVLINK_MAX_PAYLOAD_LEN];
+	memset(zero, 0, sizeof(zero));
+
+	mavlink_msg_heartbeat_encode(1, 1, &mix[0], (mavlink_heartbeat_t *)zero);
+	mavlink_msg_sys_status_encode(1, 1, &mix[1], (mavlink_sys_status_t *)zero);
+	mavlink_msg_attitude_encode(1, 1, &mix[2], (mavlink_attitude_t *)zero);
+	mavlink_msg_local_position_ned_encode(1, 1, &mix[3], (mavlink_local_position_ned_t *)zero);
+	mavlink_msg_global_position_int_encode(1, 1, &mix[4], (mavlink_global_position_int_t *)zero);
+	mavlink_msg_highres_imu_encode(1, 1, &mix[5], (mavlink_highres_imu_t *)zero);
+	mavlink_msg_gps_raw_int_encode(1, 1, &mix[6], (mavlink_gps_raw_int_t *)zero);
+	mavlink_msg_position_target_local_ned_encode(1, 1, &mix[7], (mavlink_position_target_local_ned_t *)zero);
+	mavlink_msg_battery_status_encode(1, 1, &mix[8], (mavlink_battery_status_t *)zero);
+}
+
+static void *
+bench_loopback_writer(void *args)
+{
+	Bench_Writer *writer = (Bench_Writer *)args;
+
+	for (uint32_t i = 0; i < writer->count; i++)
+	{
+		// a full ring is back pressure, wait for the reader
+		while (writer->port->write_message(writer->mix[i % BENCH_MIX_LEN]) == 0)
+			sched_yield();
+	}
+
+	// hang up, the reader sees the end once it has drained the ring
+	writer->port->stop();
+	return NULL;
+}
+
+int
+bench_loopback(int argc, char **argv)
+{
+	const char *usage = "usage: mavlink_bench loopback [-n <messages>] [-p] [-s] [-c <ring bytes>]";
+
+	uint32_t count = 1000000;
+	bool port_only = false;
+	bool sign = false;
+	int capacity = LOOPBACK_DEFAULT_CAPACITY;
+
+	for (int i = 2; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-n") == 0 && argc > i + 1)
+		{
+			count = strtoul(argv[++i], NULL, 10);
+		}
+		else if (strcmp(argv[i], "-p") == 0)
+		{
+			port_only = true;
+		}
+		else if (strcmp(argv[i], "-s") == 0)
+		{
+			sign = true;
+		}
+		else if (strcmp(argv[i], "-c") == 0 && argc > i + 1)
+		{
+			capacity = atoi(argv[++i]);
+		}
+		else
+		{
+			printf("%s\n", usage);
+			return EXIT_FAILURE;
+		}
+	}
+
+	Loopback_Pair pair(capacity);
+	pair.autopilot->start();
+	pair.companion->start();
+
+	// one engine per end, as on two separate systems
+	uint8_t key[MAVLINK_SIGNING_KEY_LEN];
+	Mavlink_Signing::key_from_string("mavlink_bench", key);
+	Mavlink_Signing autopilot_signing(key, 1);
+	Mavlink_Signing companion_signing(key, 2);
+	if (sign)
+	{
+		pair.autopilot->set_signing(&autopilot_signing);
+		pair.companion->set_signing(&companion_signing);
+	}
+
+	Bench_Writer writer;
+	writer.port = pair.autopilot;
+	writer.count = count;
+	bench_make_mix(writer.mix);
+
+	uint64_t bytes = 0;
+	uint8_t buf[MAVLINK_MAX_PACKET_LEN];
+	for (int i = 0; i < BENCH_MIX_LEN; i++)
+		bytes += mavlink_msg_to_send_buffer(buf, &writer.mix[i]) + (sign ? MAVLINK_SIGNATURE_BLOCK_LEN : 0);
+	bytes = bytes * count / BENCH_MIX_LEN;
+
+	Autopilot_Interface *autopilot_interface = NULL;
+	if (!port_only)
+		autopilot_interface = new Autopilot_Interface(pair.companion);
+
+	// stage latencies of this run only
+	latency_reset_all();
+
+	pthread_t write_tid;
+	uint64_t start = bench_now_usec();
+	int result = pthread_create(&write_tid, NULL, &bench_loopback_writer, &writer);
+	if (result)
+		throw result;
+
+	if (autopilot_interface)
+	{
+		while (pair.companion->is_running())
+			autopilot_interface->read_messages();
+	}
+	else
+	{
+		mavlink_message_t message;
+		while (pair.companion->is_running())
+			pair.companion->read_message(message);
+	}
+
+	uint64_t elapsed = bench_now_usec() - start;
+	pthread_join(write_tid, NULL);
+
+	Loopback_Port_Stats stats = pair.companion->get_stats();
+	Loopback_Port_Stats wstats = pair.autopilot->get_stats();
+	const char *name = port_only ? (sign ? "loopback port signed" : "loopback port")
+								 : (sign ? "loopback interface signed" : "loopback interface");
+	bench_report(name, stats.messages_read, bytes, elapsed);
+	printf("  written %lu, ring full %lu, rejected %lu\n",
+		   (unsigned long)wstats.messages_written, (unsigned long)wstats.write_full,
+		   (unsigned long)stats.bad_frames);
+	link_stats_dump(stdout);
+	latency_dump(stdout);
+
+	delete autopilot_interface;
+	return 0;
+}
+
+// ------------------------------------------------------------------------------
+//   Signing Benchmark
+// ------------------------------------------------------------------------------
+int
+bench_signing(int argc, char **argv)
+{
+	const char *usage = "usage: mavlink_bench signing [-n <messages>] [-b <baudrate>] [-s <streams>]";
+
+	uint32_t count = 200000;
+	int baudrate = 921600;
+	int num_streams = MAVLINK_MAX_SIGNING_STREAMS;
+
+	for (int i = 2; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-n") == 0 && argc > i + 1)
+		{
+			count = strtoul(argv[++i], NULL, 10);
+		}
+		else if (strcmp(argv[i], "-b") == 0 && argc > i + 1)
+		{
+			baudrate = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "-s") == 0 && argc > i + 1)
+		{
+			num_streams = atoi(argv[++i]);
+		}
+		else
+		{
+			printf("%s\n", usage);
+			return EXIT_FAILURE;
+		}
+	}
+
+	mavlink_message_t mix[BENCH_MIX_LEN];
+	bench_make_mix(mix);
+
+	uint8_t frames[BENCH_MIX_LEN][MAVLINK_MAX_PACKET_LEN];
+	unsigned lens[BENCH_MIX_LEN];
+	uint64_t bytes = 0;
+	for (int i = 0; i < BENCH_MIX_LEN; i++)
+	{
+		lens[i] = mavlink_msg_to_send_buffer(frames[i], &mix[i]);
+		bytes += lens[i] + MAVLINK_SIGNATURE_BLOCK_LEN;
+	}
+
+	uint8_t key[MAVLINK_SIGNING_KEY_LEN];
+	Mavlink_Signing::key_from_string("mavlink_bench", key);
+	Mavlink_Signing sender(key, 1);
+	Mavlink_Signing receiver(key, 1);
+
+	// --------------------------------------------------------------------------
+	//   SIGN, CACHED KEY STATE
+	// --------------------------------------------------------------------------
+	uint8_t buf[MAVLINK_MAX_PACKET_LEN];
+	uint64_t start = bench_now_usec();
+	for (uint32_t i = 0; i < count; i++)
+	{
+		int m = i % BENCH_MIX_LEN;
+		memcpy(buf, frames[m], lens[m]);
+		sender.sign(buf, lens[m]);
+	}
+	uint64_t sign_usec = bench_now_usec() - start;
+	bench_report("sign Mavlink_Signing", count, bytes * count / BENCH_MIX_LEN, sign_usec);
+
+	// --------------------------------------------------------------------------
+	//   SIGN, MAVLINK HELPERS
+	// --------------------------------------------------------------------------
+	mavlink_signing_t signing;
+	memset(&signing, 0, sizeof(signing));
+	memcpy(signing.secret_key, key, MAVLINK_SIGNING_KEY_LEN);
+	signing.flags = MAVLINK_SIGNING_FLAG_SIGN_OUTGOING;
+	signing.link_id = 1;
+
+	start = bench_now_usec();
+	for (uint32_t i = 0; i < count; i++)
+	{
+		int m = i % BENCH_MIX_LEN;
+		memcpy(buf, frames[m], lens[m]);
+		uint8_t payload_len = buf[1];
+
+		// same framing work as sign(), the way mavlink_finalize_message does it
+		buf[2] |= MAVLINK_IFLAG_SIGNED;
+		uint16_t checksum = crc_calculate(&buf[1], MAVLINK_CORE_HEADER_LEN + payload_len);
+		crc_accumulate(mavlink_get_crc_extra(&mix[m]), &checksum);
+		buf[MAVLINK_NUM_HEADER_BYTES + payload_len] = (uint8_t)(checksum & 0xFF);
+		buf[MAVLINK_NUM_HEADER_BYTES + payload_len + 1] = (uint8_t)(checksum >> 8);
+
+		mavlink_sign_packet(&signing, &buf[MAVLINK_NUM_HEADER_BYTES + payload_len + 2], buf, MAVLINK_NUM_HEADER_BYTES,
+							&buf[MAVLINK_NUM_HEADER_BYTES], payload_len, &buf[MAVLINK_NUM_HEADER_BYTES + payload_len]);
+	}
+	uint64_t helper_usec = bench_now_usec() - start;
+	bench_report("sign mavlink_sign_packet", count, bytes * count / BENCH_MIX_LEN, helper_usec);
+
+	// --------------------------------------------------------------------------
+	//   VERIFY
+	// --------------------------------------------------------------------------
+	mavlink_message_t signed_mix[BENCH_MIX_LEN];
+	for (int i = 0; i < BENCH_MIX_LEN; i++)
+	{
+		mavlink_message_t rx_buffer;
+		mavlink_status_t rx_status;
+		memset(&rx_buffer, 0, sizeof(rx_buffer));
+		memset(&rx_status, 0, sizeof(rx_status));
+
+		memcpy(buf, frames[i], lens[i]);
+		unsigned len = sender.sign(buf, lens[i]);
+		for (unsigned j = 0; j < len; j++)
+			mavlink_frame_char_buffer(&rx_buffer, &rx_status, buf[j], &signed_mix[i], NULL);
+	}
+
+	// the same frames over and over are replays, only the hash is timed
+	uint32_t passed = 0;
+	start = bench_now_usec();
+	for (uint32_t i = 0; i < count; i++)
+		passed += receiver.verify(signed_mix[i % BENCH_MIX_LEN]);
+	uint64_t verify_usec = bench_now_usec() - start;
+	bench_report("verify Mavlink_Signing", count, bytes * count / BENCH_MIX_LEN, verify_usec);
+
+	// --------------------------------------------------------------------------
+	//   LINK BUDGET
+	// --------------------------------------------------------------------------
+	// 10 bits per byte on the wire with start and stop bits
+	double wire_ns = bytes * 10.0 / BENCH_MIX_LEN / baudrate * 1e9;
+	double sign_ns = count ? sign_usec * 1000.0 / count : 0.0;
+	double verify_ns = count ? verify_usec * 1000.0 / count : 0.0;
+	printf("  verified %lu of %lu (the rest are replays), helpers %.2fx slower to sign\n",
+		   (unsigned long)passed, (unsigned long)count, sign_usec ? (double)helper_usec / sign_usec : 0.0);
+	printf("  signed frame %.0f ns on the wire at %d baud, sign + verify %.0f ns (%.1f%% of one core)\n",
+		   wire_ns, baudrate, sign_ns + verify_ns, (sign_ns + verify_ns) / wire_ns * 100.0);
+
+	// --------------------------------------------------------------------------
+	//   STREAM LOOKUP
+	// --------------------------------------------------------------------------
+	if (num_streams < 1)
+		num_streams = 1;
+
+	// frames round robin over the streams, every one a step ahead
+	Signing_Stream_Table table(num_streams);
+	start = bench_now_usec();
+	for (uint32_t i = 0; i < count; i++)
+	{
+		int n = i % num_streams;
+		table.check(n >> 8, n & 0xFF, 1, i + 1, 0);
+	}
+	uint64_t table_usec = bench_now_usec() - start;
+	bench_report("streams hashed", count, 0, table_usec);
+
+	mavlink_signing_streams_t streams;
+	memset(&streams, 0, sizeof(streams));
+	int scanned = num_streams < MAVLINK_MAX_SIGNING_STREAMS ? num_streams : MAVLINK_MAX_SIGNING_STREAMS;
+	start = bench_now_usec();
+	for (uint32_t i = 0; i < count; i++)
+	{
+		int n = i % scanned;
+		uint16_t j;
+		for (j = 0; j < streams.num_signing_streams; j++)
+		{
+			if (streams.stream[j].sysid == (n & 0xFF) && streams.stream[j].compid == 1 &&
+				streams.stream[j].link_id == (n >> 8))
+				break;
+		}
+		if (j == streams.num_signing_streams)
+		{
+			streams.stream[j].sysid = n & 0xFF;
+			streams.stream[j].compid = 1;
+			streams.stream[j].link_id = n >> 8;
+			streams.num_signing_streams++;
+		}
+		uint64_t tstamp = i + 1;
+		memcpy(streams.stream[j].timestamp_bytes, &tstamp, 6);
+	}
+	uint64_t scan_usec = bench_now_usec() - start;
+	bench_report("streams scanned", count, 0, scan_usec);
+	printf("  %d streams hashed, %d scanned (mavlink_signing_streams_t holds %d)\n",
+		   table.size(), scanned, MAVLINK_MAX_SIGNING_STREAMS);
+
+	return 0;
+}
+
+// ------------------------------------------------------------------------------
+//   Trace Benchmark
+// ------------------------------------------------------------------------------
+int
+bench_trace(int argc, char **argv)
+{
+	const char *usage = "usage: mavlink_bench trace [-n <events>] [<file.trc>]";
+
+	uint32_t count = 200000;
+	const char *path = NULL;
+
+	for (int i = 2; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-n") == 0 && argc > i + 1)
+		{
+			count = strtoul(argv[++i], NULL, 10);
+		}
+		else if (argv[i][0] != '-' && path == NULL)
+		{
+			path = argv[i];
+		}
+		else
+		{
+			printf("%s\n", usage);
+			return EXIT_FAILURE;
+		}
+	}
+
+	// offline decode
+	if (path)
+		return trace_decode(path, stdout) < 0 ? EXIT_FAILURE : 0;
+
+	// --------------------------------------------------------------------------
+	//   RECORD, WHAT THE HOT PATH PAYS
+	// --------------------------------------------------------------------------
+	// drained every ring's worth, as the drain thread would keep up
+	FILE *null_out = fopen("/dev/null", "w");
+	Trace_Drain drain(null_out);
+	float x = 1.25f, y = -3.5f, z = 0.0625f;
+
+	uint64_t record_usec = 0;
+	uint64_t drain_usec = 0;
+	uint32_t done = 0;
+	while (done < count)
+	{
+		uint32_t batch = count - done < TRACE_RING_EVENTS ? count - done : TRACE_RING_EVENTS;
+
+		uint64_t start = bench_now_usec();
+		for (uint32_t i = 0; i < batch; i++)
+			trace_record(TRACE_SET_POSITION, 3, trace_arg(x), trace_arg(y), trace_arg(z), 0);
+		record_usec += bench_now_usec() - start;
+
+		start = bench_now_usec();
+		drain.drain();
+		drain_usec += bench_now_usec() - start;
+
+		done += batch;
+	}
+	bench_report("trace record", count, count * sizeof(Trace_Event), record_usec);
+	bench_report("trace drain", count, count * sizeof(Trace_Event), drain_usec);
+
+	// --------------------------------------------------------------------------
+	//   SNPRINTF AT THE CALL SITE
+	// --------------------------------------------------------------------------
+	char line[128];
+	int len = 0;
+	uint64_t start = bench_now_usec();
+	for (uint32_t i = 0; i < count; i++)
+		len += snprintf(line, sizeof(line), "POSITION SETPOINT XYZ = [ %.4f , %.4f , %.4f ] \n", x, y, z);
+	uint64_t printf_usec = bench_now_usec() - start;
+	bench_report("snprintf", count, len, printf_usec);
+
+	Trace_Drain_Stats stats = drain.get_stats();
+	printf("  %" PRIu32 " events drained, %" PRIu32 " dropped, %" PRIu32 " without a ring\n",
+		   stats.events, stats.drops, stats.no_ring);
+
+	fclose(null_out);
+	trace_release();
+	return 0;
+}
+
+// ------------------------------------------------------------------------------
+//   MsgLib Benchmark
+// ------------------------------------------------------------------------------
+/*
+ * Stands in for the GPS task on the far side of MSGQ_GPS, so mavlink_bench
+ * needs the real GPS task stopped.  A request with a negative num ends it.
+ */
+struct bench_msgq_gps
+{
+	bool stream;	// lanes and batches, else one fix per request
+	uint32_t fixes;	// to stream
+};
+
+static mavlink_hil_gps_t
+bench_msgq_fix(uint32_t i)
+{
+	mavlink_hil_gps_t fix;
+	memset(&fix, 0, sizeof(fix));
+	fix.time_usec = latency_stamp(); // when it was made, for its age
+	fix.lat = 356812000 + i;
+	fix.lon = 1397671000;
+	fix.alt = 40000;
+	fix.fix_type = 3;
+	fix.satellites_visible = 10;
+	return fix;
+}
+
+static void *
+bench_msgq_gps_thread(void *args)
+{
+	bench_msgq_gps *gps = (bench_msgq_gps *)args;
+	gps_fix_batch_t batch;
+	gps_batch_init(batch, 0);
+	uint32_t made = 0;
+
+	MsgQueBlock *que;
+	MsgPacket *msg;
+	MsgLib::referMsgQueBlock(MSGQ_GPS, &que);
+
+	while (1)
+	{
+		// streaming, produce as fast as the lane takes them
+		if (gps->stream && made < gps->fixes)
+		{
+			gps_batch_add(batch, bench_msgq_fix(made++));
+			if (batch.count == GPS_FIX_BATCH_MAX || made == gps->fixes)
+			{
+				if (gps_batch_send(batch, MSGQ_GPS) == ERR_QUE_FULL)
+					sched_yield();
+			}
+		}
+		else if (gps->stream && batch.count)
+		{
+			// the last one out before anything else
+			if (gps_batch_send(batch, MSGQ_GPS) == ERR_QUE_FULL)
+				sched_yield();
+			continue;
+		}
+
+		int timeout = gps->stream && made < gps->fixes ? TIME_POLLING : TIME_FOREVER;
+		if (que->recv(timeout, &msg) != ERR_OK)
+			continue;
+
+		message_t request = msg->moveParam<message_t>();
+		que->pop();
+		if (request.num < 0)
+			break;
+
+		mavlink_hil_gps_t fix = bench_msgq_fix(request.num);
+		if (gps->stream)
+			gps_fix_send(fix, MSGQ_GPS);
+		else
+			MsgLib::send<mavlink_hil_gps_t>(MSGQ_MAVLINK, MsgPriNormal, MSG_TYPE_GPS_FIX, MSGQ_GPS, fix);
+	}
+
+	return NULL;
+}
+
+static void
+bench_msgq_stop(pthread_t tid)
+{
+	message_t quit = {-1};
+	MsgLib::send<message_t>(MSGQ_GPS, MsgPriNormal, MSG_TYPE_GPS_FIX, MSGQ_MAVLINK, quit);
+	pthread_join(tid, NULL);
+}
+
+static void
+bench_msgq_histogram(Latency_Histogram &histogram)
+{
+	char line[128];
+	histogram.format(line, sizeof(line));
+	fputs(line, stdout);
+}
+
+int
+bench_msgq(int argc, char **argv)
+{
+	const char *usage = "usage: mavlink_bench msgq [-n <fixes>]";
+
+	uint32_t count = 20000;
+
+	for (int i = 2; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-n") == 0 && argc > i + 1)
+		{
+			count = strtoul(argv[++i], NULL, 10);
+		}
+		else
+		{
+			printf("%s\n", usage);
+			return EXIT_FAILURE;
+		}
+	}
+	if (count == 0)
+		count = 1;
+
+	// already done if mavlink_control runs, fine either way
+	if (gps_msgq_init() != ERR_OK)
+	{
+		fprintf(stderr, "ERROR: MsgLib::initFirst failed\n");
+		return EXIT_FAILURE;
+	}
+
+	MsgQueBlock *que;
+	MsgPacket *msg;
+	MsgLib::referMsgQueBlock(MSGQ_MAVLINK, &que);
+
+	Latency_Histogram reply_latency("request to reply", 1);
+	Latency_Histogram fix_age("batched fix age", 1);
+	Latency_Histogram high_latency("high lane request", 1);
+	pthread_t tid;
+
+	// --------------------------------------------------------------------------
+	//   ONE FIX PER REQUEST, AS BEFORE
+	// --------------------------------------------------------------------------
+	bench_msgq_gps gps = {false, count};
+	pthread_create(&tid, NULL, &bench_msgq_gps_thread, &gps);
+
+	uint64_t start = bench_now_usec();
+	for (uint32_t i = 0; i < count; i++)
+	{
+		message_t request = {(int)i};
+		uint32_t stamp = latency_stamp();
+		MsgLib::send<message_t>(MSGQ_GPS, MsgPriNormal, MSG_TYPE_GPS_FIX, MSGQ_MAVLINK, request);
+
+		que->recv(TIME_FOREVER, &msg);
+		mavlink_hil_gps_t fix = msg->moveParam<mavlink_hil_gps_t>();
+		que->pop();
+		reply_latency.record_since(stamp);
+		(void)fix;
+	}
+	uint64_t elapsed = bench_now_usec() - start;
+	bench_msgq_stop(tid);
+	bench_report("request/reply", count, count * sizeof(mavlink_hil_gps_t), elapsed);
+
+	// --------------------------------------------------------------------------
+	//   STREAMED BATCHES, A REQUEST ON THE HIGH LANE NOW AND THEN
+	// --------------------------------------------------------------------------
+	gps.stream = true;
+	pthread_create(&tid, NULL, &bench_msgq_gps_thread, &gps);
+
+	uint32_t fixes = 0, thinned = 0, batches = 0, lost = 0, next_seq = 0;
+	uint32_t request_stamp = 0;
+	bool request_pending = false;
+
+	start = bench_now_usec();
+	while (fixes + thinned < count)
+	{
+		if (!request_pending && batches % 16 == 0)
+		{
+			message_t request = {(int)batches};
+			request_stamp = latency_stamp();
+			request_pending = MsgLib::send<message_t>(MSGQ_GPS, MsgPriNormal, MSG_TYPE_GPS_FIX,
+													  MSGQ_MAVLINK, request) == ERR_OK;
+		}
+
+		que->recv(TIME_FOREVER, &msg);
+		if (msg->getType() == MSG_TYPE_GPS_BATCH)
+		{
+			gps_fix_batch_t batch = msg->moveParam<gps_fix_batch_t>();
+			que->pop();
+
+			uint32_t now = latency_stamp();
+			for (int i = 0; i < batch.count; i++)
+				fix_age.record_between((uint32_t)batch.fix[i].time_usec, now);
+			if (batch.seq != next_seq)
+				lost += batch.seq - next_seq;
+			next_seq = batch.seq + 1;
+
+			fixes += batch.count;
+			thinned += batch.dropped;
+			batches++;
+		}
+		else
+		{
+			que->pop();
+			high_latency.record_since(request_stamp);
+			request_pending = false;
+		}
+	}
+	elapsed = bench_now_usec() - start;
+
+	// a reply still on its way
+	if (request_pending)
+	{
+		que->recv(TIME_FOREVER, &msg);
+		que->pop();
+	}
+	bench_msgq_stop(tid);
+	bench_report("lanes + batches", fixes, fixes * sizeof(mavlink_hil_gps_t), elapsed);
+
+	printf("  %lu batches, %lu fixes thinned, %lu batches lost\n",
+		   (unsigned long)batches, (unsigned long)thinned, (unsigned long)lost);
+	printf("%-24s %10s %14s %14s %14s %14s\n", "latency (us)", "count", "p50", "p99", "p99.9", "max");
+	bench_msgq_histogram(reply_latency);
+	bench_msgq_histogram(fix_age);
+	bench_msgq_histogram(high_latency);
+
+	return 0;
+}
+
+// ------------------------------------------------------------------------------
+//   Serial Benchmark
+// ------------------------------------------------------------------------------
+/*
+ * A TIMESYNC carries the stamp it was written at in tc1 and its sequence
+ * in ts1; a negative ts1 ends the run, sent a few times in case one is lost.
+ */
+#define BENCH_SERIAL_END_MARKERS 4
+
+struct Bench_Serial_Writer
+{
+	Serial_Port *port;
+	uint32_t bursts;
+	int burst;			// mix frames per burst, each with its TIMESYNC
+	int baud;
+	uint32_t written;	// TIMESYNCs
+	mavlink_message_t mix[BENCH_MIX_LEN];
+};
+
+static void
+bench_serial_stamp(mavlink_message_t &message, int64_t seq)
+{
+	mavlink_msg_timesync_pack(1, 1, &message, latency_stamp(), seq, 0, 0);
+}
+
+static void *
+bench_serial_writer(void *args)
+{
+	Bench_Serial_Writer *writer = (Bench_Serial_Writer *)args;
+	mavlink_message_t stamp;
+	uint8_t buf[MAVLINK_MAX_PACKET_LEN];
+
+	for (uint32_t b = 0; b < writer->bursts; b++)
+	{
+		uint64_t bytes = 0;
+		for (int i = 0; i < writer->burst; i++)
+		{
+			const mavlink_message_t &message = writer->mix[i % BENCH_MIX_LEN];
+			writer->port->write_message(message);
+			bench_serial_stamp(stamp, writer->written++);
+			writer->port->write_message(stamp);
+			bytes += mavlink_msg_to_send_buffer(buf, &message) + mavlink_msg_to_send_buffer(buf, &stamp);
+		}
+
+		// as long again idle, 10 bits a byte on the wire
+		usleep(bytes * 10 * 1000000 / writer->baud);
+	}
+
+	for (int i = 0; i < BENCH_SERIAL_END_MARKERS; i++)
+	{
+		bench_serial_stamp(stamp, -1);
+		writer->port->write_message(stamp);
+	}
+	return NULL;
+}
+
+static void
+bench_serial_profile(const char *device, int baud, const Serial_Profile &profile,
+					 uint32_t bursts, int burst)
+{
+	Serial_Port port(device, baud);
+	port.set_profile(profile);
+	port.start();
+
+	Bench_Serial_Writer writer;
+	writer.port = &port;
+	writer.bursts = bursts;
+	writer.burst = burst;
+	writer.baud = port.get_baudrate();
+	writer.written = 0;
+	bench_make_mix(writer.mix);
+
+	Latency_Histogram latency(profile.name, 1);
+	uint32_t received = 0, out_of_order = 0;
+	int64_t next_seq = 0;
+	mavlink_message_t message;
+
+	pthread_t write_tid;
+	uint64_t start = bench_now_usec();
+	int result = pthread_create(&write_tid, NULL, &bench_serial_writer, &writer);
+	if (result)
+		throw result;
+
+	while (1)
+	{
+		if (!port.read_message(message) || message.msgid != MAVLINK_MSG_ID_TIMESYNC)
+			continue;
+
+		uint32_t now = latency_stamp();
+		mavlink_timesync_t timesync;
+		mavlink_msg_timesync_decode(&message, &timesync);
+		if (timesync.ts1 < 0)
+			break;
+
+		latency.record_between((uint32_t)timesync.tc1, now);
+		if (timesync.ts1 < next_seq)
+			out_of_order++;
+		next_seq = timesync.ts1 + 1;
+		received++;
+	}
+
+	uint64_t elapsed = bench_now_usec() - start;
+	pthread_join(write_tid, NULL);
+	port.stop();
+
+	char line[128];
+	bench_report(profile.name, received, 0, elapsed);
+	printf("  written %lu, lost %lu (%.3f%%), out of order %lu\n",
+		   (unsigned long)writer.written, (unsigned long)(writer.written - received),
+		   writer.written ? 100.0 * (writer.written - received) / writer.written : 0.0,
+		   (unsigned long)out_of_order);
+	printf("%-24s %10s %14s %14s %14s %14s\n", "latency (us)", "count", "p50", "p99", "p99.9", "max");
+	latency.format(line, sizeof(line));
+	fputs(line, stdout);
+	printf("\n");
+}
+
+int
+bench_serial(int argc, char **argv)
+{
+	const char *usage = "usage: mavlink_bench serial -d <device> [-b <baudrate>] [-L <profile>] [-n <bursts>] [-s <burst>]";
+
+	const char *device = NULL;
+	const char *profile = NULL;
+	int baud = 921600;
+	uint32_t bursts = 200;
+	int burst = 32;
+
+	for (int i = 2; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-d") == 0 && argc > i + 1)
+		{
+			device = argv[++i];
+		}
+		else if (strcmp(argv[i], "-b") == 0 && argc > i + 1)
+		{
+			baud = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "-L") == 0 && argc > i + 1)
+		{
+			profile = argv[++i];
+		}
+		else if (strcmp(argv[i], "-n") == 0 && argc > i + 1)
+		{
+			bursts = strtoul(argv[++i], NULL, 10);
+		}
+		else if (strcmp(argv[i], "-s") == 0 && argc > i + 1)
+		{
+			burst = atoi(argv[++i]);
+		}
+		else
+		{
+			printf("%s\n", usage);
+			return EXIT_FAILURE;
+		}
+	}
+	if (!device || baud <= 0 || burst <= 0)
+	{
+		printf("%s\n", usage);
+		return EXIT_FAILURE;
+	}
+
+	Serial_Port::list_profiles(stdout);
+	printf("\n%lu bursts of %d frames at %d baud on %s\n\n", (unsigned long)bursts, burst * 2, baud, device);
+
+	if (profile)
+	{
+		const Serial_Profile *found = Serial_Port::find_profile(profile);
+		if (!found)
+		{
+			printf("%s\n", usage);
+			return EXIT_FAILURE;
+		}
+		bench_serial_profile(device, baud, *found, bursts, burst);
+		return 0;
+	}
+
+	const char *all[] = {"default", "low_latency", "throughput"};
+	for (unsigned i = 0; i < sizeof(all) / sizeof(all[0]); i++)
+		bench_serial_profile(device, baud, *Serial_Port::find_profile(all[i]), bursts, burst);
+
+	return 0;
+}
+
+// ------------------------------------------------------------------------------
+//   Transmit Scheduler
+// ------------------------------------------------------------------------------
+
+#define BENCH_TX_PRODUCERS 5
+
+/*
+ * Stands in for a serial port at a given baud rate: a write holds the port
+ * for as long as the frame takes on the wire, 10 bits a byte, as a blocking
+ * write() to a UART with a full FIFO does.
+ */
+class Bench_Paced_Port : public Generic_Port
+{
+
+public:
+	Bench_Paced_Port(int baud_) : baud(baud_), running(false) { pthread_mutex_init(&lock, NULL); };
+	~Bench_Paced_Port() { pthread_mutex_destroy(&lock); };
+
+	int read_message(mavlink_message_t &) { usleep(1000); return 0; };
+
+	int write_message(const mavlink_message_t &message)
+	{
+		uint8_t buf[FRAME_ENCODER_BUFFER_LEN];
+		return write_frame(buf, mavlink_msg_to_send_buffer(buf, &message));
+	};
+
+	int write_frame(uint8_t *, unsigned len)
+	{
+		pthread_mutex_lock(&lock);
+		uint64_t until = bench_now_usec() + (uint64_t)len * 10 * 1000000 / baud;
+		while (bench_now_usec() < until)
+			usleep(50);
+		pthread_mutex_unlock(&lock);
+		return (int)len;
+	};
+
+	bool is_running() { return running; };
+	void start() { running = true; };
+	void stop() { running = false; };
+
+private:
+	int baud;
+	bool running;
+	pthread_mutex_t lock;
+};
+
+struct Bench_Tx_Producer
+{
+	Generic_Port *port;
+	mavlink_message_t message;
+	uint32_t period_usec;	// 0 writes as fast as the port takes them
+	volatile bool *stop;
+	uint32_t written;
+	uint32_t refused;
+	Latency_Histogram latency; // of the write_message() call
+};
+
+static void *
+bench_tx_producer(void *args)
+{
+	Bench_Tx_Producer *producer = (Bench_Tx_Producer *)args;
+	uint64_t next = bench_now_usec();
+
+	while (!*producer->stop)
+	{
+		uint32_t stamp = latency_stamp();
+		int len = producer->port->write_message(producer->message);
+		producer->latency.record_since(stamp);
+
+		if (len > 0)
+			producer->written++;
+		else
+			producer->refused++;
+
+		if (producer->period_usec)
+		{
+			next += producer->period_usec;
+			uint64_t now = bench_now_usec();
+			if (next > now)
+				usleep(next - now);
+		}
+		else if (len <= 0)
+		{
+			// the bulk queue is full, as a parameter download would wait for it
+			usleep(1000);
+		}
+	}
+	return NULL;
+}
+
+static void
+bench_txsched_run(int baud, int seconds, bool schedule)
+{
+	Bench_Paced_Port paced(baud);
+	Tx_Scheduler *scheduler = NULL;
+	Generic_Port *port = &paced;
+	if (schedule)
+	{
+		scheduler = new Tx_Scheduler(&paced, baud);
+		port = scheduler;
+	}
+	port->start();
+
+	volatile bool stop = false;
+	uint8_t zero[MAVLINK_MAX_PAYLOAD_LEN];
+	memset(zero, 0, sizeof(zero));
+
+	// a parameter download flooding the link next to the periodic traffic
+	Bench_Tx_Producer producers[BENCH_TX_PRODUCERS];
+	mavlink_msg_file_transfer_protocol_encode(1, 1, &producers[0].message, (mavlink_file_transfer_protocol_t *)zero);
+	producers[0].period_usec = 0;
+	producers[0].latency.set_name("bulk (FTP)");
+	mavlink_msg_hil_gps_encode(1, 1, &producers[1].message, (mavlink_hil_gps_t *)zero);
+	producers[1].period_usec = 100000;
+	producers[1].latency.set_name("position (HIL_GPS)");
+	mavlink_msg_set_position_target_local_ned_encode(1, 1, &producers[2].message, (mavlink_set_position_target_local_ned_t *)zero);
+	producers[2].period_usec = 50000;
+	producers[2].latency.set_name("position (setpoint)");
+	mavlink_msg_battery_status_encode(1, 1, &producers[3].message, (mavlink_battery_status_t *)zero);
+	producers[3].period_usec = 200000;
+	producers[3].latency.set_name("telemetry (battery)");
+	mavlink_msg_heartbeat_encode(1, 1, &producers[4].message, (mavlink_heartbeat_t *)zero);
+	producers[4].period_usec = 1000000;
+	producers[4].latency.set_name("control (heartbeat)");
+
+	pthread_t tids[BENCH_TX_PRODUCERS];
+	for (int i = 0; i < BENCH_TX_PRODUCERS; i++)
+	{
+		producers[i].port = port;
+		producers[i].stop = &stop;
+		producers[i].written = 0;
+		producers[i].refused = 0;
+		int result = pthread_create(&tids[i], NULL, &bench_tx_producer, &producers[i]);
+		if (result)
+			throw result;
+	}
+
+	sleep(seconds);
+	stop = true;
+	for (int i = 0; i < BENCH_TX_PRODUCERS; i++)
+		pthread_join(tids[i], NULL);
+
+	char line[128];
+	printf("%s\n", schedule ? "scheduled" : "direct");
+	printf("%-24s %10s %14s %14s %14s %14s\n", "write call (us)", "count", "p50", "p99", "p99.9", "max");
+	for (int i = 0; i < BENCH_TX_PRODUCERS; i++)
+	{
+		producers[i].latency.format(line, sizeof(line));
+		fputs(line, stdout);
+	}
+	if (scheduler)
+	{
+		scheduler->stop();
+		scheduler->dump(stdout);
+		delete scheduler;
+	}
+	printf("\n");
+}
+
+int
+bench_txsched(int argc, char **argv)
+{
+	const char *usage = "usage: mavlink_bench txsched [-b <baudrate>] [-n <seconds>]";
+
+	int baud = 57600;
+	int seconds = 5;
+
+	for (int i = 2; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-b") == 0 && argc > i + 1)
+		{
+			baud = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "-n") == 0 && argc > i + 1)
+		{
+			seconds = atoi(argv[++i]);
+		}
+		else
+		{
+			printf("%s\n", usage);
+			return EXIT_FAILURE;
+		}
+	}
+	if (baud <= 0 || seconds <= 0)
+	{
+		printf("%s\n", usage);
+		return EXIT_FAILURE;
+	}
+
+	printf("FTP flood with HIL_GPS 10 Hz, setpoints 20 Hz, battery 5 Hz, heartbeat 1 Hz\n");
+	printf("for %d s at %d baud\n\n", seconds, baud);
+
+	// frames written straight to the port queue behind the flood on its lock
+	bench_txsched_run(baud, seconds, false);
+	bench_txsched_run(baud, seconds, true);
+
+	return 0;
+}
+
+// ------------------------------------------------------------------------------
+//   Encode Benchmark
+// ------------------------------------------------------------------------------
+int
+bench_encode(int argc, char **argv)
+{
+	const char *usage = "usage: mavlink_bench encode [-n <messages>]";
+
+	uint32_t count = 2000000;
+
+	for (int i = 2; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-n") == 0 && argc > i + 1)
+		{
+			count = strtoul(argv[++i], NULL, 10);
+		}
+		else
+		{
+			printf("%s\n", usage);
+			return EXIT_FAILURE;
+		}
+	}
+	if (count == 0)
+	{
+		printf("%s\n", usage);
+		return EXIT_FAILURE;
+	}
+
+	mavlink_hil_gps_t gps;
+	memset(&gps, 0, sizeof(gps));
+	gps.lat = 351523041;
+	gps.lon = 1369686962;
+	gps.alt = 12000;
+	gps.eph = 100;
+	gps.epv = 150;
+	gps.fix_type = 3;
+	gps.satellites_visible = 12;
+
+	mavlink_set_position_target_local_ned_t sp;
+	memset(&sp, 0, sizeof(sp));
+	sp.type_mask = 0x0dc7;
+	sp.coordinate_frame = MAV_FRAME_LOCAL_NED;
+	sp.target_system = 1;
+	sp.target_component = 1;
+
+	volatile uint64_t sink = 0;
+	uint64_t bytes;
+
+	// --------------------------------------------------------------------------
+	//   THROUGH A MAVLINK_MESSAGE_T
+	// --------------------------------------------------------------------------
+	bytes = 0;
+	uint64_t start = bench_now_usec();
+	for (uint32_t i = 0; i < count; i++)
+	{
+		mavlink_message_t message;
+		uint8_t buf[MAVLINK_MAX_PACKET_LEN];
+		gps.time_usec = i;
+		mavlink_msg_hil_gps_encode(1, 1, &message, &gps);
+		bytes += mavlink_msg_to_send_buffer(buf, &message);
+		sink = sink + buf[MAVLINK_NUM_HEADER_BYTES];
+	}
+	bench_report("hil_gps encode+copy", count, bytes, bench_now_usec() - start);
+
+	bytes = 0;
+	start = bench_now_usec();
+	for (uint32_t i = 0; i < count; i++)
+	{
+		mavlink_message_t message;
+		uint8_t buf[MAVLINK_MAX_PACKET_LEN];
+		sp.time_boot_ms = i;
+		mavlink_msg_set_position_target_local_ned_encode(1, 1, &message, &sp);
+		bytes += mavlink_msg_to_send_buffer(buf, &message);
+		sink = sink + buf[MAVLINK_NUM_HEADER_BYTES];
+	}
+	bench_report("setpoint encode+copy", count, bytes, bench_now_usec() - start);
+
+	// --------------------------------------------------------------------------
+	//   IN PLACE
+	// --------------------------------------------------------------------------
+	bytes = 0;
+	start = bench_now_usec();
+	for (uint32_t i = 0; i < count; i++)
+	{
+		uint8_t frame[FRAME_ENCODER_BUFFER_LEN];
+		gps.time_usec = i;
+		bytes += frame_encode(frame, 1, 1, MAVLINK_MSG_ID_HIL_GPS, gps);
+		sink = sink + frame[MAVLINK_NUM_HEADER_BYTES];
+	}
+	bench_report("hil_gps frame_encode", count, bytes, bench_now_usec() - start);
+
+	bytes = 0;
+	start = bench_now_usec();
+	for (uint32_t i = 0; i < count; i++)
+	{
+		uint8_t frame[FRAME_ENCODER_BUFFER_LEN];
+		sp.time_boot_ms = i;
+		bytes += frame_encode(frame, 1, 1, MAVLINK_MSG_ID_SET_POSITION_TARGET_LOCAL_NED, sp);
+		sink = sink + frame[MAVLINK_NUM_HEADER_BYTES];
+	}
+	bench_report("setpoint frame_encode", count, bytes, bench_now_usec() - start);
+
+	printf("  staging per frame: %u bytes of mavlink_message_t and send buffer, %u of frame buffer\n",
+		   (unsigned)(sizeof(mavlink_message_t) + MAVLINK_MAX_PACKET_LEN), (unsigned)FRAME_ENCODER_BUFFER_LEN);
+
+	// --------------------------------------------------------------------------
+	//   SAME BYTES
+	// --------------------------------------------------------------------------
+	// both number frames from the MAVLINK_COMM_0 sequence, one after the other
+	mavlink_message_t message;
+	uint8_t buf[MAVLINK_MAX_PACKET_LEN];
+	uint8_t frame[FRAME_ENCODER_BUFFER_LEN];
+
+	mavlink_status_t *status = mavlink_get_channel_status(MAVLINK_COMM_0);
+	uint8_t seq = status->current_tx_seq;
+	mavlink_msg_hil_gps_encode(1, 1, &message, &gps);
+	unsigned len = mavlink_msg_to_send_buffer(buf, &message);
+	status->current_tx_seq = seq;
+	unsigned frame_len = frame_encode(frame, 1, 1, MAVLINK_MSG_ID_HIL_GPS, gps);
+	bool same = len == frame_len && memcmp(buf, frame, len) == 0;
+
+	seq = status->current_tx_seq;
+	mavlink_msg_set_position_target_local_ned_encode(1, 1, &message, &sp);
+	len = mavlink_msg_to_send_buffer(buf, &message);
+	status->current_tx_seq = seq;
+	frame_len = frame_encode(frame, 1, 1, MAVLINK_MSG_ID_SET_POSITION_TARGET_LOCAL_NED, sp);
+	same = same && len == frame_len && memcmp(buf, frame, len) == 0;
+
+	printf("  frame_encode %s mavlink_msg_to_send_buffer, setpoint trimmed to %u bytes\n",
+		   same ? "matches" : "DIFFERS FROM", frame_len);
+
+	return same ? 0 : EXIT_FAILURE;
+}
+
+// ------------------------------------------------------------------------------
+//   Views Benchmark
+// ------------------------------------------------------------------------------
+/*
+ * What a handler pays to get at the fields it uses.  The frames differ
+ * from one to the next so nothing is hoisted out of the loop, and what is
+ * read is summed into a volatile so nothing is left out.
+ */
+int
+bench_views(int argc, char **argv)
+{
+	const char *usage = "usage: mavlink_bench views [-n <messages>]";
+
+	uint32_t count = 2000000;
+
+	for (int i = 2; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-n") == 0 && argc > i + 1)
+		{
+			count = strtoul(argv[++i], NULL, 10);
+		}
+		else
+		{
+			printf("%s\n", usage);
+			return EXIT_FAILURE;
+		}
+	}
+	if (count == 0)
+	{
+		printf("%s\n", usage);
+		return EXIT_FAILURE;
+	}
+
+	const int num_frames = 64;
+	mavlink_message_t imu[num_frames];
+	mavlink_message_t block[num_frames];
+	for (int i = 0; i < num_frames; i++)
+	{
+		mavlink_highres_imu_t fields;
+		memset(&fields, 0, sizeof(fields));
+		fields.time_usec = 1000000 + i;
+		fields.xacc = 0.01f * i;
+		fields.yacc = -0.02f * i;
+		fields.zacc = -9.81f;
+		fields.temperature = 25.0f;
+		fields.fields_updated = 0x1ff;
+		mavlink_msg_highres_imu_encode(1, 1, &imu[i], &fields);
+
+		mavlink_remote_log_data_block_t data;
+		data.target_system = 255;
+		data.target_component = 0;
+		data.seqno = i;
+		for (int j = 0; j < (int)sizeof(data.data); j++)
+			data.data[j] = (uint8_t)(i + j);
+		mavlink_msg_remote_log_data_block_encode(1, 1, &block[i], &data);
+	}
+
+	volatile uint64_t sink = 0;
+	uint64_t sum;
+
+	// --------------------------------------------------------------------------
+	//   HIGHRES_IMU, FOUR FIELDS
+	// --------------------------------------------------------------------------
+	sum = 0;
+	uint64_t start = bench_now_usec();
+	for (uint32_t i = 0; i < count; i++)
+	{
+		mavlink_highres_imu_t fields;
+		mavlink_msg_highres_imu_decode(&imu[i % num_frames], &fields);
+		sum += fields.time_usec + (int64_t)(fields.xacc + fields.yacc + fields.zacc);
+	}
+	bench_report("highres_imu decode", count, count * sizeof(mavlink_highres_imu_t), bench_now_usec() - start);
+	sink = sink + sum;
+
+	sum = 0;
+	start = bench_now_usec();
+	for (uint32_t i = 0; i < count; i++)
+	{
+		Highres_Imu_View fields(imu[i % num_frames]);
+		sum += fields.time_usec() + (int64_t)(fields.xacc() + fields.yacc() + fields.zacc());
+	}
+	bench_report("highres_imu view", count, count * 20, bench_now_usec() - start);
+	sink = sink + sum;
+
+	// --------------------------------------------------------------------------
+	//   REMOTE_LOG_DATA_BLOCK, SEQNO AND DATA
+	// --------------------------------------------------------------------------
+	// as Log_Receiver does, the data is handed on, here its ends are read
+	sum = 0;
+	start = bench_now_usec();
+	for (uint32_t i = 0; i < count; i++)
+	{
+		mavlink_remote_log_data_block_t data;
+		mavlink_msg_remote_log_data_block_decode(&block[i % num_frames], &data);
+		sum += data.seqno + data.data[0] + data.data[sizeof(data.data) - 1];
+	}
+	bench_report("log_data_block decode", count, count * sizeof(mavlink_remote_log_data_block_t), bench_now_usec() - start);
+	sink = sink + sum;
+
+	sum = 0;
+	start = bench_now_usec();
+	for (uint32_t i = 0; i < count; i++)
+	{
+		Remote_Log_Data_Block_View data(block[i % num_frames]);
+		const uint8_t *bytes = data.data();
+		sum += data.seqno() + bytes[0] + bytes[MAVLINK_MSG_REMOTE_LOG_DATA_BLOCK_FIELD_DATA_LEN - 1];
+	}
+	bench_report("log_data_block view", count, count * 6, bench_now_usec() - start);
+	sink = sink + sum;
+
+	// --------------------------------------------------------------------------
+	//   TRIMMED PAYLOAD
+	// --------------------------------------------------------------------------
+	// only time_usec and xacc set, MAVLink 2 drops the zeros behind them
+	mavlink_highres_imu_t fields;
+	memset(&fields, 0, sizeof(fields));
+	fields.time_usec = 0x0102030405060708ULL;
+	fields.xacc = 1.5f;
+	mavlink_message_t trimmed;
+	mavlink_msg_highres_imu_encode(1, 1, &trimmed, &fields);
+
+	mavlink_highres_imu_t decoded;
+	mavlink_msg_highres_imu_decode(&trimmed, &decoded);
+	Highres_Imu_View view(trimmed);
+	bool same = view.valid() &&
+				view.time_usec() == decoded.time_usec &&
+				view.xacc() == decoded.xacc &&
+				view.zacc() == decoded.zacc &&
+				view.temperature() == decoded.temperature &&
+				view.fields_updated() == decoded.fields_updated &&
+				view.id() == decoded.id;
+	printf("  trimmed HIGHRES_IMU, %u of %u bytes: view %s decode\n",
+		   trimmed.len, MAVLINK_MSG_ID_HIGHRES_IMU_LEN, same ? "reads as" : "DIFFERS FROM");
+
+	return same ? 0 : EXIT_FAILURE;
+}
+
+// ------------------------------------------------------------------------------
+//   Frame Pool Benchmark
+// ------------------------------------------------------------------------------
+
+// Takes anything, counts it
+class Bench_Null_Port : public Generic_Port
+{
+
+public:
+	Bench_Null_Port() : writes(0) {};
+
+	int read_message(mavlink_message_t &) { usleep(1000); return 0; };
+	int write_message(const mavlink_message_t &message)
+	{
+		writes.fetch_add(1, std::memory_order_relaxed);
+		return mavlink_msg_get_send_buffer_length(&message);
+	};
+
+	bool is_running() { return true; };
+	void start() {};
+	void stop() {};
+
+	std::atomic<uint32_t> writes;
+};
+
+int
+bench_pool(int argc, char **argv)
+{
+	const char *usage = "usage: mavlink_bench pool [-n <frames>] [-k <sinks>] [-f <pool frames>]";
+
+	uint32_t count = 1000000;
+	int sinks = 3;
+	int pool_frames = FRAME_POOL_DEFAULT_FRAMES;
+
+	for (int i = 2; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-n") == 0 && argc > i + 1)
+		{
+			count = strtoul(argv[++i], NULL, 10);
+		}
+		else if (strcmp(argv[i], "-k") == 0 && argc > i + 1)
+		{
+			sinks = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "-f") == 0 && argc > i + 1)
+		{
+			pool_frames = atoi(argv[++i]);
+		}
+		else
+		{
+			printf("%s\n", usage);
+			return EXIT_FAILURE;
+		}
+	}
+	if (count == 0 || sinks <= 0 || sinks > AUTOPILOT_MAX_FRAME_SINKS || pool_frames <= 0)
+	{
+		printf("%s\n", usage);
+		return EXIT_FAILURE;
+	}
+
+	mavlink_message_t mix[BENCH_MIX_LEN];
+	bench_make_mix(mix);
+
+	// --------------------------------------------------------------------------
+	//   FAN OUT BY COPY AND BY HANDLE, ONE THREAD
+	// --------------------------------------------------------------------------
+	// k rings as deep as a forwarder's queue, overwritten round and round
+	const int depth = FRAME_FORWARDER_DEFAULT_DEPTH;
+	mavlink_message_t *copies = new mavlink_message_t[sinks * depth];
+
+	uint64_t start = bench_now_usec();
+	for (uint32_t i = 0; i < count; i++)
+	{
+		mavlink_message_t message = mix[i % BENCH_MIX_LEN];
+		for (int k = 0; k < sinks; k++)
+			copies[k * depth + i % depth] = message;
+	}
+	bench_report("fan out by copy", count, (uint64_t)count * sinks * sizeof(mavlink_message_t), bench_now_usec() - start);
+	delete[] copies;
+
+	{
+		// every queued handle holds its frame, the pool covers them all
+		Frame_Pool pool(sinks * depth + 1);
+		Frame_Handle *handles = new Frame_Handle[sinks * depth];
+
+		start = bench_now_usec();
+		for (uint32_t i = 0; i < count; i++)
+		{
+			Frame_Handle frame = pool.alloc();
+			*frame.writable() = mix[i % BENCH_MIX_LEN];
+			for (int k = 0; k < sinks; k++)
+				handles[k * depth + i % depth] = frame;
+		}
+		bench_report("fan out by handle", count, (uint64_t)count * sinks * sizeof(Frame_Handle), bench_now_usec() - start);
+		delete[] handles;
+	}
+
+	// --------------------------------------------------------------------------
+	//   FORWARDERS ON THEIR THREADS
+	// --------------------------------------------------------------------------
+	Frame_Pool pool(pool_frames);
+	Bench_Null_Port ports[AUTOPILOT_MAX_FRAME_SINKS];
+	Frame_Forwarder *forwarders[AUTOPILOT_MAX_FRAME_SINKS];
+	for (int k = 0; k < sinks; k++)
+	{
+		forwarders[k] = new Frame_Forwarder(&ports[k], depth);
+		forwarders[k]->start();
+	}
+
+	// as read_messages() does, the frame is only replaced once a sink kept it
+	Frame_Handle frame;
+	uint32_t missed = 0;
+	start = bench_now_usec();
+	for (uint32_t i = 0; i < count; i++)
+	{
+		if (!frame.writable())
+			frame = pool.alloc();
+		if (!frame)
+		{
+			missed++;
+			sched_yield();
+			continue;
+		}
+		*frame.writable() = mix[i % BENCH_MIX_LEN];
+		frame.set_stamp(latency_stamp());
+		for (int k = 0; k < sinks; k++)
+			forwarders[k]->handle_frame(frame);
+	}
+	uint64_t elapsed = bench_now_usec() - start;
+	frame.reset();
+
+	for (int k = 0; k < sinks; k++)
+		forwarders[k]->stop();
+	bench_report("forwarders", count, 0, elapsed);
+
+	for (int k = 0; k < sinks; k++)
+	{
+		Frame_Forwarder_Stats stats = forwarders[k]->get_stats();
+		printf("  sink %d: %" PRIu32 " forwarded, %" PRIu32 " dropped with its queue full\n", k, stats.forwarded, stats.dropped);
+	}
+	printf("  %" PRIu32 " frames not read, pool exhausted\n", missed);
+	pool.dump(stdout);
+	for (int k = 0; k < sinks; k++)
+		delete forwarders[k];
+
+	printf("  RAM for %d sinks %d deep: %u bytes copied into queues, %u bytes of pool and handles\n",
+		   sinks, depth, (unsigned)(sinks * depth * sizeof(mavlink_message_t)),
+		   (unsigned)(pool_frames * sizeof(Pool_Frame) + sinks * depth * sizeof(Frame_Handle)));
+
+	Frame_Pool_Stats stats = pool.get_stats();
+	return stats.in_use == 0 ? 0 : EXIT_FAILURE;
+}
+
+// ------------------------------------------------------------------------------
+//   Topic Bus Benchmark
+// ------------------------------------------------------------------------------
+
+#define BENCH_TOPIC_QUEUE 8
+#define BENCH_TOPIC_MAX_READERS 8
+
+struct Bench_Topic_Sample
+{
+	uint32_t seq;
+	uint32_t stamp; // latency_stamp() at publish
+};
+
+typedef Topic<Bench_Topic_Sample, BENCH_TOPIC_QUEUE> bench_topic_t;
+
+struct Bench_Topic_Reader
+{
+	bench_topic_t *topic;
+	std::atomic<int> *ready;	// readers subscribed
+	std::atomic<bool> *done;	// the publisher is through
+	pthread_t tid;
+
+	uint32_t received;
+	uint32_t lost;
+	bool in_order;			// each sample is the one after those read and lost
+	Latency_Histogram latency;
+};
+
+static void *
+bench_topic_reader_thread(void *args)
+{
+	Bench_Topic_Reader *reader = (Bench_Topic_Reader *)args;
+	Topic_Subscriber<Bench_Topic_Sample, BENCH_TOPIC_QUEUE> sub(*reader->topic);
+	reader->ready->fetch_add(1);
+
+	Bench_Topic_Sample sample;
+	while (true)
+	{
+		// done is read before the last look, so nothing published is missed
+		bool last = reader->done->load();
+		if (!sub.wait(100) && last)
+			break;
+
+		while (sub.next(sample))
+		{
+			reader->latency.record_since(sample.stamp);
+			if (sample.seq != reader->received + sub.get_lost())
+				reader->in_order = false;
+			reader->received++;
+		}
+	}
+
+	reader->lost = sub.get_lost();
+	return NULL;
+}
+
+static bool
+bench_topic_check(const char *what, bool ok)
+{
+	printf("  %-52s %s\n", what, ok ? "ok" : "FAILED");
+	return ok;
+}
+
+int
+bench_topics(int argc, char **argv)
+{
+	const char *usage = "usage: mavlink_bench topics [-n <samples>] [-k <subscribers>]";
+
+	uint32_t count = 1000000;
+	int readers = 3;
+
+	for (int i = 2; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-n") == 0 && argc > i + 1)
+		{
+			count = strtoul(argv[++i], NULL, 10);
+		}
+		else if (strcmp(argv[i], "-k") == 0 && argc > i + 1)
+		{
+			readers = atoi(argv[++i]);
+		}
+		else
+		{
+			printf("%s\n", usage);
+			return EXIT_FAILURE;
+		}
+	}
+	if (count == 0 || readers < 1 || readers > BENCH_TOPIC_MAX_READERS)
+	{
+		printf("%s\n", usage);
+		return EXIT_FAILURE;
+	}
+
+	bool ok = true;
+
+	// --------------------------------------------------------------------------
+	//   LATEST SAMPLE, ON A TOPIC OF topics.h
+	// --------------------------------------------------------------------------
+	{
+		vehicle_attitude_subscriber_t attitude(topic_vehicle_attitude());
+		mavlink_attitude_t sample;
+		memset(&sample, 0, sizeof(sample));
+		ok &= bench_topic_check("nothing to copy before a publish", !attitude.updated() && !attitude.copy(sample));
+
+		for (uint32_t i = 1; i <= 3; i++)
+		{
+			sample.time_boot_ms = i;
+			topic_vehicle_attitude().publish(sample);
+		}
+		mavlink_attitude_t latest;
+		ok &= bench_topic_check("copy() takes the latest of three",
+								attitude.updated() && attitude.copy(latest) && latest.time_boot_ms == 3);
+		ok &= bench_topic_check("and then nothing until the next publish", !attitude.copy(latest));
+
+		vehicle_attitude_topic_t::Latest in_place(topic_vehicle_attitude());
+		ok &= bench_topic_check("Latest reads it in place", in_place.get() && in_place.get()->time_boot_ms == 3);
+	}
+
+	// --------------------------------------------------------------------------
+	//   QUEUED DELIVERY AND LOSS
+	// --------------------------------------------------------------------------
+	{
+		gps_fix_subscriber_t early(topic_gps_fix());
+		mavlink_hil_gps_t fix;
+		memset(&fix, 0, sizeof(fix));
+		fix.time_usec = 1;
+		topic_gps_fix().publish(fix);
+
+		// subscribers start after what was published before them
+		gps_fix_subscriber_t late(topic_gps_fix());
+		ok &= bench_topic_check("a new subscriber skips earlier samples", !late.updated());
+		ok &= bench_topic_check("subscribers counted", topic_gps_fix().get_subscribers() == 2);
+
+		const uint32_t over = 5;
+		for (uint32_t i = 2; i <= 8 + over; i++)
+		{
+			fix.time_usec = i;
+			topic_gps_fix().publish(fix);
+		}
+
+		// early is 8 + over behind, late 8 + over - 1
+		uint32_t first = 0, taken = 0;
+		bool in_order = true;
+		while (early.next(fix))
+		{
+			if (taken == 0)
+				first = (uint32_t)fix.time_usec;
+			else if (fix.time_usec != first + taken)
+				in_order = false;
+			taken++;
+		}
+		ok &= bench_topic_check("next() gives the 8 the queue keeps, in order",
+								in_order && taken == 8 && first == over + 1);
+		ok &= bench_topic_check("and counts the ones overwritten as lost", early.get_lost() == over);
+
+		taken = 0;
+		while (late.next(fix))
+			taken++;
+		ok &= bench_topic_check("each subscriber has its own position",
+								taken == 8 && late.get_lost() == over - 1);
+	}
+
+	// --------------------------------------------------------------------------
+	//   PUBLISH TO SUBSCRIBER THREADS
+	// --------------------------------------------------------------------------
+	bench_topic_t topic("bench");
+	std::atomic<int> ready(0);
+	std::atomic<bool> done(false);
+
+	Bench_Topic_Reader reader[BENCH_TOPIC_MAX_READERS];
+	for (int i = 0; i < readers; i++)
+	{
+		char name[LATENCY_NAME_LEN];
+		snprintf(name, sizeof(name), "subscriber %d", i);
+		reader[i].topic = &topic;
+		reader[i].ready = &ready;
+		reader[i].done = &done;
+		reader[i].received = 0;
+		reader[i].lost = 0;
+		reader[i].in_order = true;
+		reader[i].latency.set_name(name);
+		pthread_create(&reader[i].tid, NULL, &bench_topic_reader_thread, &reader[i]);
+	}
+	while (ready.load() < readers)
+		usleep(1000);
+
+	// publishing never waits for the subscribers, they lose what they miss
+	uint64_t start = bench_now_usec();
+	for (uint32_t i = 0; i < count; i++)
+	{
+		Bench_Topic_Sample sample = {i, latency_stamp()};
+		topic.publish(sample);
+	}
+	uint64_t elapsed = bench_now_usec() - start;
+	done.store(true);
+
+	for (int i = 0; i < readers; i++)
+		pthread_join(reader[i].tid, NULL);
+
+	bench_report("publish", count, count * sizeof(Bench_Topic_Sample), elapsed);
+
+	printf("%-24s %10s %10s %12s\n", "subscriber", "received", "lost", "order");
+	for (int i = 0; i < readers; i++)
+	{
+		printf("%-24d %10lu %10lu %12s\n", i, (unsigned long)reader[i].received,
+			   (unsigned long)reader[i].lost, reader[i].in_order ? "in order" : "OUT OF ORDER");
+		ok &= reader[i].in_order && reader[i].received + reader[i].lost == count;
+	}
+
+	printf("%-24s %10s %14s %14s %14s %14s\n", "publish to read (us)", "count", "p50", "p99", "p99.9", "max");
+	for (int i = 0; i < readers; i++)
+		bench_msgq_histogram(reader[i].latency);
+	ok &= bench_topic_check("every sample read or counted lost, in order", ok);
+
+	return ok ? 0 : EXIT_FAILURE;
+}
+
+// ------------------------------------------------------------------------------
+//   TOP
+// ------------------------------------------------------------------------------
+int
+bench_top(int argc, char **argv)
+{
+	const char *usage = "usage: mavlink_bench replay|loopback|signing|trace|msgq|serial|txsched|encode|views|pool|topics|msgs ...";
+
+	if (argc < 2)
+	{
+		printf("%s\n", usage);
+		return EXIT_FAILURE;
+	}
+
+	if (strcmp(argv[1], "replay") == 0)
+		return bench_replay(argc, argv);
+	if (strcmp(argv[1], "loopback") == 0)
+		return bench_loopback(argc, argv);
+	if (strcmp(argv[1], "signing") == 0)
+		return bench_signing(argc, argv);
+	if (strcmp(argv[1], "trace") == 0)
+		return bench_trace(argc, argv);
+	if (strcmp(argv[1], "msgq") == 0)
+		return bench_msgq(argc, argv);
+	if (strcmp(argv[1], "serial") == 0)
+		return bench_serial(argc, argv);
+	if (strcmp(argv[1], "txsched") == 0)
+		return bench_txsched(argc, argv);
+	if (strcmp(argv[1], "encode") == 0)
+		return bench_encode(argc, argv);
+	if (strcmp(argv[1], "views") == 0)
+		return bench_views(argc, argv);
+	if (strcmp(argv[1], "pool") == 0)
+		return bench_pool(argc, argv);
+	if (strcmp(argv[1], "topics") == 0)
+		return bench_topics(argc, argv);
+	if (strcmp(argv[1], "msgs") == 0)
+		return bench_msgs(argc, argv);
+
+	printf("%s\n", usage);
+	return EXIT_FAILURE;
+}
+
+// ------------------------------------------------------------------------------
+//   Main
+// ------------------------------------------------------------------------------
+int main(int argc, char **argv)
+{
+	// The classes under test use throw, wrap one big try/catch here
+	try
+	{
+		return bench_top(argc, argv);
+	}
+
+	catch (int error)
+	{
+		fprintf(stderr, "mavlink_bench threw exception %i \n", error);
+		return error;
+	}
+}
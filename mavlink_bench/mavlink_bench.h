@@ -0,0 +1,65 @@
+/**
+ * @file mavlink_bench.h
+ *
+ * @brief Hardware-free benchmarks of the MAVLink pipeline, definition
+ *
+ * Drives the c_uart_interface_example classes without a serial port or
+ * socket so their software cost can be measured on the target and on a
+ * host.
+ *
+ */
+
+#ifndef MAVLINK_BENCH_H_
+#define MAVLINK_BENCH_H_
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <cstdlib>
+#include <unistd.h>
+#include <string.h>
+#include <inttypes.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+
+#include "../c_uart_interface_example/autopilot_interface.h"
+#include "../c_uart_interface_example/replay_port.h"
+#include "../c_uart_interface_example/loopback_port.h"
+#include "../c_uart_interface_example/mavlink_signing.h"
+#include "../c_uart_interface_example/trace_drain.h"
+#include "../c_uart_interface_example/serial_port.h"
+#include "../c_uart_interface_example/tx_scheduler.h"
+#include "../c_uart_interface_example/frame_pool.h"
+#include "../c_uart_interface_example/frame_forwarder.h"
+#include "../include/mavlink/v2.0/spresense/mavlink_views.h"
+#include "../include/topics.h"
+
+#include "mavlink_msgbench.h"
+
+// ------------------------------------------------------------------------------
+//   Prototypes
+// ------------------------------------------------------------------------------
+
+extern "C" int main(int argc, char **argv);
+
+int bench_top(int argc, char **argv);
+
+uint64_t bench_now_usec();
+void bench_report(const char *name, uint64_t count, uint64_t bytes, uint64_t elapsed_usec);
+
+int bench_replay(int argc, char **argv);
+int bench_loopback(int argc, char **argv);
+int bench_signing(int argc, char **argv);
+int bench_trace(int argc, char **argv);
+int bench_msgq(int argc, char **argv);
+int bench_serial(int argc, char **argv);
+int bench_txsched(int argc, char **argv);
+int bench_encode(int argc, char **argv);
+int bench_views(int argc, char **argv);
+int bench_pool(int argc, char **argv);
+int bench_topics(int argc, char **argv);
+
+#endif // MAVLINK_BENCH_H_
@@ -0,0 +1,388 @@
+/**
+ * @file mavlink_msgbench.cpp
+ *
+ * @brief Throughput of every generated message
+ *
+ * usage: mavlink_bench msgs [-n <iterations>] [-d] [-f csv|json]
+ *
+ *   Times pack, encode, mavlink_msg_to_send_buffer(), mavlink_parse_char()
+ *   and decode for each message of the ardupilotmega dialect, filled with
+ *   the values of the mavgen testsuite.h, then parses streams of one frame
+ *   of each message back to back.  -d keeps to the messages compiled into
+ *   the spresense dialect, the ones this application puts on the link.
+ *
+ *   The results go to stdout as CSV, or as JSON with one object per line,
+ *   with the compiler and the MAVLink headers they came from, so runs
+ *   before and after a change to the library or the toolchain can be
+ *   compared line by line.
+ *
+ *   mavlink_msgbench_table.h is generated by config/mavlink_dialect.conf.
+ *   With a function per message it is the bulk of mavlink_bench, some
+ *   200 KB of text at -Os on x86_64; leave mavlink_bench out of
+ *   CONFIGURED_APPS for a flight image.
+ *
+ */
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include "mavlink_msgbench.h"
+
+#include <stdio.h>
+#include <cstdlib>
+#include <string.h>
+#include <inttypes.h>
+
+#include "../include/mavlink/v2.0/ardupilotmega/mavlink.h"
+
+// ------------------------------------------------------------------------------
+//   Defines
+// ------------------------------------------------------------------------------
+
+enum Msgbench_Op
+{
+	MSGBENCH_PACK,
+	MSGBENCH_ENCODE,
+	MSGBENCH_TO_SEND_BUFFER,
+	MSGBENCH_PARSE_CHAR,
+	MSGBENCH_DECODE,
+	MSGBENCH_OPS
+};
+
+static const char *msgbench_op_names[MSGBENCH_OPS] = {
+	"pack", "encode", "to_send_buffer", "parse_char", "decode"
+};
+
+// Msgbench_Entry flags
+#define MSGBENCH_DIALECT 1	// compiled into the spresense dialect
+
+// Parsed on a channel of its own
+#define MSGBENCH_CHAN MAVLINK_COMM_1
+
+// ------------------------------------------------------------------------------
+//   Data Structures
+// ------------------------------------------------------------------------------
+
+struct Msgbench_Run
+{
+	uint32_t count;			// iterations of each op
+	uint8_t system_id;
+	uint8_t component_id;
+	mavlink_message_t message;	// the last one packed or encoded
+	uint64_t usec[MSGBENCH_OPS];
+	bool decoded;			// decode gave back what was encoded
+};
+
+struct Msgbench_Entry
+{
+	uint32_t msgid;
+	const char *name;
+	uint8_t flags;
+	void (*run)(Msgbench_Run &run);
+};
+
+// ------------------------------------------------------------------------------
+//   Helpers
+// ------------------------------------------------------------------------------
+
+// Makes what p points to live, so the loops are not folded into one pass
+static inline void
+msgbench_keep(const void *p)
+{
+	__asm__ __volatile__("" : : "r"(p) : "memory");
+}
+
+#define MSGBENCH_LOOP(run, op, out, call) \
+	do \
+	{ \
+		uint64_t start_ = bench_now_usec(); \
+		for (uint32_t i_ = 0; i_ < (run).count; i_++) \
+		{ \
+			call; \
+			msgbench_keep(out); \
+		} \
+		(run).usec[op] = bench_now_usec() - start_; \
+	} while (0)
+
+#include "mavlink_msgbench_table.h"
+
+#define MSGBENCH_MESSAGES (sizeof(msgbench_entries) / sizeof(msgbench_entries[0]))
+
+static double
+msgbench_nsec(uint64_t usec, uint64_t count)
+{
+	return count ? usec * 1000.0 / count : 0.0;
+}
+
+static const char *
+msgbench_optimize()
+{
+#if defined(__OPTIMIZE_SIZE__)
+	return "Os";
+#elif defined(__OPTIMIZE__)
+	return "O";
+#else
+	return "O0";
+#endif
+}
+
+static const char *
+msgbench_arch()
+{
+#if defined(__arm__)
+	return "arm";
+#elif defined(__aarch64__)
+	return "aarch64";
+#elif defined(__x86_64__)
+	return "x86_64";
+#elif defined(__i386__)
+	return "i386";
+#else
+	return "unknown";
+#endif
+}
+
+/*
+ * Parses len bytes passes times over, returns the frames that came out
+ * whole and counts the ones that did not in bad.
+ */
+static uint32_t
+msgbench_parse(const uint8_t *buf, uint32_t len, uint32_t passes, uint32_t &bad)
+{
+	mavlink_message_t message;
+	mavlink_status_t status;
+	mavlink_reset_channel_status(MSGBENCH_CHAN);
+
+	uint32_t frames = 0;
+	bad = 0;
+	for (uint32_t pass = 0; pass < passes; pass++)
+	{
+		for (uint32_t i = 0; i < len; i++)
+		{
+			uint8_t result = mavlink_parse_char(MSGBENCH_CHAN, buf[i], &message, &status);
+			if (result == MAVLINK_FRAMING_OK)
+				frames++;
+			else if (result != MAVLINK_FRAMING_INCOMPLETE)
+				bad++;
+		}
+		msgbench_keep(&message);
+	}
+	return frames;
+}
+
+// ------------------------------------------------------------------------------
+//   Output
+// ------------------------------------------------------------------------------
+
+static void
+msgbench_print_meta(bool json, uint32_t messages, uint32_t count)
+{
+	if (json)
+	{
+		printf("{\"type\":\"meta\",\"bench\":\"msgs\",\"dialect\":\"ardupilotmega\","
+			   "\"mavlink_build_date\":\"%s\",\"compiler\":\"%s\",\"optimize\":\"%s\",\"arch\":\"%s\","
+			   "\"messages\":%" PRIu32 ",\"iterations\":%" PRIu32 "}\n",
+			   MAVLINK_BUILD_DATE, __VERSION__, msgbench_optimize(), msgbench_arch(), messages, count);
+		return;
+	}
+
+	printf("# mavlink_bench msgs, ardupilotmega of %s, %" PRIu32 " messages, %" PRIu32 " iterations\n",
+		   MAVLINK_BUILD_DATE, messages, count);
+	printf("# compiler %s, %s, %s\n", __VERSION__, msgbench_optimize(), msgbench_arch());
+	printf("msgid,name,dialect,bytes");
+	for (int op = 0; op < MSGBENCH_OPS; op++)
+		printf(",%s_ns", msgbench_op_names[op]);
+	printf(",ok\n");
+}
+
+static void
+msgbench_print_message(bool json, const Msgbench_Entry &entry, uint32_t bytes, const Msgbench_Run &run, bool ok)
+{
+	if (json)
+	{
+		printf("{\"type\":\"message\",\"msgid\":%" PRIu32 ",\"name\":\"%s\",\"dialect\":%s,\"bytes\":%" PRIu32,
+			   entry.msgid, entry.name, (entry.flags & MSGBENCH_DIALECT) ? "true" : "false", bytes);
+		for (int op = 0; op < MSGBENCH_OPS; op++)
+			printf(",\"%s_ns\":%.1f", msgbench_op_names[op], msgbench_nsec(run.usec[op], run.count));
+		printf(",\"ok\":%s}\n", ok ? "true" : "false");
+		return;
+	}
+
+	printf("%" PRIu32 ",%s,%d,%" PRIu32, entry.msgid, entry.name, (entry.flags & MSGBENCH_DIALECT) ? 1 : 0, bytes);
+	for (int op = 0; op < MSGBENCH_OPS; op++)
+		printf(",%.1f", msgbench_nsec(run.usec[op], run.count));
+	printf(",%d\n", ok ? 1 : 0);
+}
+
+static void
+msgbench_print_stream(bool json, bool first, const char *name, uint32_t frames, uint64_t bytes,
+					  uint64_t usec, uint32_t bad)
+{
+	double seconds = usec ? usec / 1e6 : 1e-6;
+
+	if (json)
+	{
+		printf("{\"type\":\"stream\",\"name\":\"%s\",\"frames\":%" PRIu32 ",\"bytes\":%" PRIu64 ","
+			   "\"mb_per_s\":%.2f,\"frames_per_s\":%.0f,\"ns_per_byte\":%.2f,\"bad\":%" PRIu32 "}\n",
+			   name, frames, bytes, bytes / seconds / 1e6, frames / seconds,
+			   bytes ? usec * 1000.0 / bytes : 0.0, bad);
+		return;
+	}
+
+	if (first)
+		printf("\nstream,frames,bytes,mb_per_s,frames_per_s,ns_per_byte,bad\n");
+	printf("%s,%" PRIu32 ",%" PRIu64 ",%.2f,%.0f,%.2f,%" PRIu32 "\n",
+		   name, frames, bytes, bytes / seconds / 1e6, frames / seconds,
+		   bytes ? usec * 1000.0 / bytes : 0.0, bad);
+}
+
+// ------------------------------------------------------------------------------
+//   Messages Benchmark
+// ------------------------------------------------------------------------------
+int
+bench_msgs(int argc, char **argv)
+{
+	const char *usage = "usage: mavlink_bench msgs [-n <iterations>] [-d] [-f csv|json]";
+
+	uint32_t count = 10000;
+	bool dialect_only = false;
+	bool json = false;
+
+	for (int i = 2; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-n") == 0 && argc > i + 1)
+		{
+			count = strtoul(argv[++i], NULL, 10);
+		}
+		else if (strcmp(argv[i], "-d") == 0)
+		{
+			dialect_only = true;
+		}
+		else if (strcmp(argv[i], "-f") == 0 && argc > i + 1)
+		{
+			const char *format = argv[++i];
+			if (strcmp(format, "json") == 0)
+				json = true;
+			else if (strcmp(format, "csv") != 0)
+				count = 0;
+		}
+		else
+		{
+			count = 0;
+		}
+	}
+	if (count == 0)
+	{
+		printf("%s\n", usage);
+		return EXIT_FAILURE;
+	}
+
+	// one frame of each message, back to back, and where the dialect ones end
+	uint32_t messages = 0;
+	uint32_t capacity = 0;
+	for (uint32_t m = 0; m < MSGBENCH_MESSAGES; m++)
+	{
+		const mavlink_msg_entry_t *entry = mavlink_get_msg_entry(msgbench_entries[m].msgid);
+		if (dialect_only && !(msgbench_entries[m].flags & MSGBENCH_DIALECT))
+			continue;
+		messages++;
+		capacity += (entry ? entry->max_msg_len : MAVLINK_MAX_PAYLOAD_LEN) + MAVLINK_NUM_NON_PAYLOAD_BYTES;
+	}
+	uint8_t *stream = new uint8_t[capacity];
+	uint8_t *dialect_stream = new uint8_t[capacity];
+	uint32_t stream_len = 0, dialect_len = 0;
+	uint32_t dialect_frames = 0;
+	uint32_t failed = 0;
+
+	msgbench_print_meta(json, messages, count);
+
+	// --------------------------------------------------------------------------
+	//   EACH MESSAGE
+	// --------------------------------------------------------------------------
+	for (uint32_t m = 0; m < MSGBENCH_MESSAGES; m++)
+	{
+		const Msgbench_Entry &entry = msgbench_entries[m];
+		if (dialect_only && !(entry.flags & MSGBENCH_DIALECT))
+			continue;
+
+		Msgbench_Run run;
+		memset(&run, 0, sizeof(run));
+		run.count = count;
+		run.system_id = 1;
+		run.component_id = 1;
+
+		// pack, encode and decode, leaves the encoded message in run
+		entry.run(run);
+
+		uint8_t buf[MAVLINK_MAX_PACKET_LEN];
+		uint16_t len = 0;
+		MSGBENCH_LOOP(run, MSGBENCH_TO_SEND_BUFFER, buf, len = mavlink_msg_to_send_buffer(buf, &run.message));
+
+		mavlink_message_t parsed;
+		mavlink_status_t status;
+		uint32_t frames = 0;
+		mavlink_reset_channel_status(MSGBENCH_CHAN);
+		MSGBENCH_LOOP(run, MSGBENCH_PARSE_CHAR, &parsed,
+			for (uint16_t j = 0; j < len; j++)
+				if (mavlink_parse_char(MSGBENCH_CHAN, buf[j], &parsed, &status) == MAVLINK_FRAMING_OK)
+					frames++);
+
+		bool ok = run.decoded && frames == count && parsed.msgid == entry.msgid &&
+				  memcmp(_MAV_PAYLOAD(&parsed), _MAV_PAYLOAD(&run.message), run.message.len) == 0;
+		if (!ok)
+			failed++;
+
+		msgbench_print_message(json, entry, len, run, ok);
+
+		memcpy(&stream[stream_len], buf, len);
+		stream_len += len;
+		if (entry.flags & MSGBENCH_DIALECT)
+		{
+			memcpy(&dialect_stream[dialect_len], buf, len);
+			dialect_len += len;
+			dialect_frames++;
+		}
+	}
+
+	// --------------------------------------------------------------------------
+	//   MIXED STREAMS
+	// --------------------------------------------------------------------------
+	struct
+	{
+		const char *name;
+		const uint8_t *buf;
+		uint32_t len;
+		uint32_t frames;
+	} streams[] = {
+		{ dialect_only ? "dialect" : "all", stream, stream_len, messages },
+		{ "dialect", dialect_stream, dialect_len, dialect_frames },
+	};
+	int num_streams = dialect_only ? 1 : 2;
+
+	for (int s = 0; s < num_streams; s++)
+	{
+		if (streams[s].frames == 0)
+			continue;
+
+		// about as many frames as each message was parsed alone
+		uint32_t passes = count / streams[s].frames + 1;
+		uint32_t bad = 0;
+
+		uint64_t start = bench_now_usec();
+		uint32_t frames = msgbench_parse(streams[s].buf, streams[s].len, passes, bad);
+		uint64_t elapsed = bench_now_usec() - start;
+
+		if (frames != streams[s].frames * passes || bad)
+			failed++;
+
+		msgbench_print_stream(json, s == 0, streams[s].name, frames, (uint64_t)streams[s].len * passes, elapsed, bad);
+	}
+
+	delete[] stream;
+	delete[] dialect_stream;
+
+	if (failed)
+		fprintf(stderr, "msgs: %" PRIu32 " failed\n", failed);
+	return failed ? EXIT_FAILURE : 0;
+}
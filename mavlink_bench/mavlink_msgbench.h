@@ -0,0 +1,29 @@
+/**
+ * @file mavlink_msgbench.h
+ *
+ * @brief Throughput of every generated message, definition
+ *
+ * mavlink_msgbench.cpp is compiled against the whole ardupilotmega dialect,
+ * which cannot share a translation unit with the pruned one the rest of
+ * mavlink_bench uses, so nothing MAVLink is declared here.
+ *
+ */
+
+#ifndef MAVLINK_MSGBENCH_H_
+#define MAVLINK_MSGBENCH_H_
+
+// ------------------------------------------------------------------------------
+//   Includes
+// ------------------------------------------------------------------------------
+
+#include <stdint.h>
+
+// ------------------------------------------------------------------------------
+//   Prototypes
+// ------------------------------------------------------------------------------
+
+uint64_t bench_now_usec();
+
+int bench_msgs(int argc, char **argv);
+
+#endif // MAVLINK_MSGBENCH_H_
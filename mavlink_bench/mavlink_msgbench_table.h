@@ -0,0 +1,7361 @@
+/** @file
+ *  @brief Throughput benchmark of every message of ardupilotmega.xml, one function each
+ *  Generated by config/mavlink_dialect.py from v2.0/ardupilotmega/testsuite.h
+ *  @see mavlink_bench/mavlink_msgbench.cpp
+ */
+#pragma once
+#ifndef MAVLINK_MSGBENCH_TABLE_H
+#define MAVLINK_MSGBENCH_TABLE_H
+
+static void
+msgbench_heartbeat(Msgbench_Run &run)
+{
+	mavlink_heartbeat_t packet_in = {
+		(uint32_t)963497464, (uint8_t)17, (uint8_t)84, (uint8_t)151, (uint8_t)218, (uint8_t)3
+	};
+	mavlink_heartbeat_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.custom_mode = packet_in.custom_mode;
+	packet1.type = packet_in.type;
+	packet1.autopilot = packet_in.autopilot;
+	packet1.base_mode = packet_in.base_mode;
+	packet1.system_status = packet_in.system_status;
+	packet1.mavlink_version = packet_in.mavlink_version;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_heartbeat_pack(run.system_id, run.component_id, &run.message, packet1.type , packet1.autopilot , packet1.base_mode , packet1.custom_mode , packet1.system_status));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_heartbeat_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_heartbeat_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_sys_status(Msgbench_Run &run)
+{
+	mavlink_sys_status_t packet_in = {
+		(uint32_t)963497464, (uint32_t)963497672, (uint32_t)963497880, (uint16_t)17859, (uint16_t)17963, (int16_t)18067, (uint16_t)18171, (uint16_t)18275, (uint16_t)18379, (uint16_t)18483, (uint16_t)18587, (uint16_t)18691, (int8_t)223, (uint32_t)963499076, (uint32_t)963499284, (uint32_t)963499492
+	};
+	mavlink_sys_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.onboard_control_sensors_present = packet_in.onboard_control_sensors_present;
+	packet1.onboard_control_sensors_enabled = packet_in.onboard_control_sensors_enabled;
+	packet1.onboard_control_sensors_health = packet_in.onboard_control_sensors_health;
+	packet1.load = packet_in.load;
+	packet1.voltage_battery = packet_in.voltage_battery;
+	packet1.current_battery = packet_in.current_battery;
+	packet1.drop_rate_comm = packet_in.drop_rate_comm;
+	packet1.errors_comm = packet_in.errors_comm;
+	packet1.errors_count1 = packet_in.errors_count1;
+	packet1.errors_count2 = packet_in.errors_count2;
+	packet1.errors_count3 = packet_in.errors_count3;
+	packet1.errors_count4 = packet_in.errors_count4;
+	packet1.battery_remaining = packet_in.battery_remaining;
+	packet1.onboard_control_sensors_present_extended = packet_in.onboard_control_sensors_present_extended;
+	packet1.onboard_control_sensors_enabled_extended = packet_in.onboard_control_sensors_enabled_extended;
+	packet1.onboard_control_sensors_health_extended = packet_in.onboard_control_sensors_health_extended;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_sys_status_pack(run.system_id, run.component_id, &run.message, packet1.onboard_control_sensors_present , packet1.onboard_control_sensors_enabled , packet1.onboard_control_sensors_health , packet1.load , packet1.voltage_battery , packet1.current_battery , packet1.battery_remaining , packet1.drop_rate_comm , packet1.errors_comm , packet1.errors_count1 , packet1.errors_count2 , packet1.errors_count3 , packet1.errors_count4 , packet1.onboard_control_sensors_present_extended , packet1.onboard_control_sensors_enabled_extended , packet1.onboard_control_sensors_health_extended));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_sys_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_sys_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_system_time(Msgbench_Run &run)
+{
+	mavlink_system_time_t packet_in = {
+		(uint64_t)93372036854775807ULL, (uint32_t)963497880
+	};
+	mavlink_system_time_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_unix_usec = packet_in.time_unix_usec;
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_system_time_pack(run.system_id, run.component_id, &run.message, packet1.time_unix_usec , packet1.time_boot_ms));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_system_time_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_system_time_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_ping(Msgbench_Run &run)
+{
+	mavlink_ping_t packet_in = {
+		(uint64_t)93372036854775807ULL, (uint32_t)963497880, (uint8_t)41, (uint8_t)108
+	};
+	mavlink_ping_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.seq = packet_in.seq;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_ping_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.seq , packet1.target_system , packet1.target_component));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_ping_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_ping_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_change_operator_control(Msgbench_Run &run)
+{
+	mavlink_change_operator_control_t packet_in = {
+		(uint8_t)5, (uint8_t)72, (uint8_t)139, "DEFGHIJKLMNOPQRSTUVWXYZA"
+	};
+	mavlink_change_operator_control_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.target_system = packet_in.target_system;
+	packet1.control_request = packet_in.control_request;
+	packet1.version = packet_in.version;
+	mav_array_memcpy(packet1.passkey, packet_in.passkey, sizeof(char)*25);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_change_operator_control_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.control_request , packet1.version , packet1.passkey));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_change_operator_control_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_change_operator_control_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_change_operator_control_ack(Msgbench_Run &run)
+{
+	mavlink_change_operator_control_ack_t packet_in = {
+		(uint8_t)5, (uint8_t)72, (uint8_t)139
+	};
+	mavlink_change_operator_control_ack_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.gcs_system_id = packet_in.gcs_system_id;
+	packet1.control_request = packet_in.control_request;
+	packet1.ack = packet_in.ack;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_change_operator_control_ack_pack(run.system_id, run.component_id, &run.message, packet1.gcs_system_id , packet1.control_request , packet1.ack));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_change_operator_control_ack_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_change_operator_control_ack_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_auth_key(Msgbench_Run &run)
+{
+	mavlink_auth_key_t packet_in = {
+		"ABCDEFGHIJKLMNOPQRSTUVWXYZABCDE"
+	};
+	mavlink_auth_key_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	mav_array_memcpy(packet1.key, packet_in.key, sizeof(char)*32);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_auth_key_pack(run.system_id, run.component_id, &run.message, packet1.key));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_auth_key_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_auth_key_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_link_node_status(Msgbench_Run &run)
+{
+	mavlink_link_node_status_t packet_in = {
+		(uint64_t)93372036854775807ULL, (uint32_t)963497880, (uint32_t)963498088, (uint32_t)963498296, (uint32_t)963498504, (uint32_t)963498712, (uint16_t)18691, (uint16_t)18795, (uint16_t)18899, (uint8_t)235, (uint8_t)46
+	};
+	mavlink_link_node_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.timestamp = packet_in.timestamp;
+	packet1.tx_rate = packet_in.tx_rate;
+	packet1.rx_rate = packet_in.rx_rate;
+	packet1.messages_sent = packet_in.messages_sent;
+	packet1.messages_received = packet_in.messages_received;
+	packet1.messages_lost = packet_in.messages_lost;
+	packet1.rx_parse_err = packet_in.rx_parse_err;
+	packet1.tx_overflows = packet_in.tx_overflows;
+	packet1.rx_overflows = packet_in.rx_overflows;
+	packet1.tx_buf = packet_in.tx_buf;
+	packet1.rx_buf = packet_in.rx_buf;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_link_node_status_pack(run.system_id, run.component_id, &run.message, packet1.timestamp , packet1.tx_buf , packet1.rx_buf , packet1.tx_rate , packet1.rx_rate , packet1.rx_parse_err , packet1.tx_overflows , packet1.rx_overflows , packet1.messages_sent , packet1.messages_received , packet1.messages_lost));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_link_node_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_link_node_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_set_mode(Msgbench_Run &run)
+{
+	mavlink_set_mode_t packet_in = {
+		(uint32_t)963497464, (uint8_t)17, (uint8_t)84
+	};
+	mavlink_set_mode_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.custom_mode = packet_in.custom_mode;
+	packet1.target_system = packet_in.target_system;
+	packet1.base_mode = packet_in.base_mode;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_set_mode_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.base_mode , packet1.custom_mode));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_set_mode_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_set_mode_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_param_request_read(Msgbench_Run &run)
+{
+	mavlink_param_request_read_t packet_in = {
+		(int16_t)17235, (uint8_t)139, (uint8_t)206, "EFGHIJKLMNOPQRS"
+	};
+	mavlink_param_request_read_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.param_index = packet_in.param_index;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	mav_array_memcpy(packet1.param_id, packet_in.param_id, sizeof(char)*16);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_param_request_read_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.param_id , packet1.param_index));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_param_request_read_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_param_request_read_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_param_request_list(Msgbench_Run &run)
+{
+	mavlink_param_request_list_t packet_in = {
+		(uint8_t)5, (uint8_t)72
+	};
+	mavlink_param_request_list_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_param_request_list_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_param_request_list_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_param_request_list_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_param_value(Msgbench_Run &run)
+{
+	mavlink_param_value_t packet_in = {
+		(float)17.0, (uint16_t)17443, (uint16_t)17547, "IJKLMNOPQRSTUVW", (uint8_t)77
+	};
+	mavlink_param_value_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.param_value = packet_in.param_value;
+	packet1.param_count = packet_in.param_count;
+	packet1.param_index = packet_in.param_index;
+	packet1.param_type = packet_in.param_type;
+	mav_array_memcpy(packet1.param_id, packet_in.param_id, sizeof(char)*16);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_param_value_pack(run.system_id, run.component_id, &run.message, packet1.param_id , packet1.param_value , packet1.param_type , packet1.param_count , packet1.param_index));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_param_value_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_param_value_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_param_set(Msgbench_Run &run)
+{
+	mavlink_param_set_t packet_in = {
+		(float)17.0, (uint8_t)17, (uint8_t)84, "GHIJKLMNOPQRSTU", (uint8_t)199
+	};
+	mavlink_param_set_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.param_value = packet_in.param_value;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.param_type = packet_in.param_type;
+	mav_array_memcpy(packet1.param_id, packet_in.param_id, sizeof(char)*16);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_param_set_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.param_id , packet1.param_value , packet1.param_type));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_param_set_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_param_set_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_gps_raw_int(Msgbench_Run &run)
+{
+	mavlink_gps_raw_int_t packet_in = {
+		(uint64_t)93372036854775807ULL, (int32_t)963497880, (int32_t)963498088, (int32_t)963498296, (uint16_t)18275, (uint16_t)18379, (uint16_t)18483, (uint16_t)18587, (uint8_t)89, (uint8_t)156, (int32_t)963499024, (uint32_t)963499232, (uint32_t)963499440, (uint32_t)963499648, (uint32_t)963499856, (uint16_t)19835
+	};
+	mavlink_gps_raw_int_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.lat = packet_in.lat;
+	packet1.lon = packet_in.lon;
+	packet1.alt = packet_in.alt;
+	packet1.eph = packet_in.eph;
+	packet1.epv = packet_in.epv;
+	packet1.vel = packet_in.vel;
+	packet1.cog = packet_in.cog;
+	packet1.fix_type = packet_in.fix_type;
+	packet1.satellites_visible = packet_in.satellites_visible;
+	packet1.alt_ellipsoid = packet_in.alt_ellipsoid;
+	packet1.h_acc = packet_in.h_acc;
+	packet1.v_acc = packet_in.v_acc;
+	packet1.vel_acc = packet_in.vel_acc;
+	packet1.hdg_acc = packet_in.hdg_acc;
+	packet1.yaw = packet_in.yaw;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_gps_raw_int_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.fix_type , packet1.lat , packet1.lon , packet1.alt , packet1.eph , packet1.epv , packet1.vel , packet1.cog , packet1.satellites_visible , packet1.alt_ellipsoid , packet1.h_acc , packet1.v_acc , packet1.vel_acc , packet1.hdg_acc , packet1.yaw));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_gps_raw_int_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_gps_raw_int_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_gps_status(Msgbench_Run &run)
+{
+	mavlink_gps_status_t packet_in = {
+		(uint8_t)5, { (uint8_t)72, (uint8_t)73, (uint8_t)74, (uint8_t)75, (uint8_t)76, (uint8_t)77, (uint8_t)78, (uint8_t)79, (uint8_t)80, (uint8_t)81, (uint8_t)82, (uint8_t)83, (uint8_t)84, (uint8_t)85, (uint8_t)86, (uint8_t)87, (uint8_t)88, (uint8_t)89, (uint8_t)90, (uint8_t)91 }, { (uint8_t)132, (uint8_t)133, (uint8_t)134, (uint8_t)135, (uint8_t)136, (uint8_t)137, (uint8_t)138, (uint8_t)139, (uint8_t)140, (uint8_t)141, (uint8_t)142, (uint8_t)143, (uint8_t)144, (uint8_t)145, (uint8_t)146, (uint8_t)147, (uint8_t)148, (uint8_t)149, (uint8_t)150, (uint8_t)151 }, { (uint8_t)192, (uint8_t)193, (uint8_t)194, (uint8_t)195, (uint8_t)196, (uint8_t)197, (uint8_t)198, (uint8_t)199, (uint8_t)200, (uint8_t)201, (uint8_t)202, (uint8_t)203, (uint8_t)204, (uint8_t)205, (uint8_t)206, (uint8_t)207, (uint8_t)208, (uint8_t)209, (uint8_t)210, (uint8_t)211 }, { (uint8_t)252, (uint8_t)253, (uint8_t)254, (uint8_t)255, (uint8_t)0, (uint8_t)1, (uint8_t)2, (uint8_t)3, (uint8_t)4, (uint8_t)5, (uint8_t)6, (uint8_t)7, (uint8_t)8, (uint8_t)9, (uint8_t)10, (uint8_t)11, (uint8_t)12, (uint8_t)13, (uint8_t)14, (uint8_t)15 }, { (uint8_t)56, (uint8_t)57, (uint8_t)58, (uint8_t)59, (uint8_t)60, (uint8_t)61, (uint8_t)62, (uint8_t)63, (uint8_t)64, (uint8_t)65, (uint8_t)66, (uint8_t)67, (uint8_t)68, (uint8_t)69, (uint8_t)70, (uint8_t)71, (uint8_t)72, (uint8_t)73, (uint8_t)74, (uint8_t)75 }
+	};
+	mavlink_gps_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.satellites_visible = packet_in.satellites_visible;
+	mav_array_memcpy(packet1.satellite_prn, packet_in.satellite_prn, sizeof(uint8_t)*20);
+	mav_array_memcpy(packet1.satellite_used, packet_in.satellite_used, sizeof(uint8_t)*20);
+	mav_array_memcpy(packet1.satellite_elevation, packet_in.satellite_elevation, sizeof(uint8_t)*20);
+	mav_array_memcpy(packet1.satellite_azimuth, packet_in.satellite_azimuth, sizeof(uint8_t)*20);
+	mav_array_memcpy(packet1.satellite_snr, packet_in.satellite_snr, sizeof(uint8_t)*20);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_gps_status_pack(run.system_id, run.component_id, &run.message, packet1.satellites_visible , packet1.satellite_prn , packet1.satellite_used , packet1.satellite_elevation , packet1.satellite_azimuth , packet1.satellite_snr));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_gps_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_gps_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_scaled_imu(Msgbench_Run &run)
+{
+	mavlink_scaled_imu_t packet_in = {
+		(uint32_t)963497464, (int16_t)17443, (int16_t)17547, (int16_t)17651, (int16_t)17755, (int16_t)17859, (int16_t)17963, (int16_t)18067, (int16_t)18171, (int16_t)18275, (int16_t)18379
+	};
+	mavlink_scaled_imu_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.xacc = packet_in.xacc;
+	packet1.yacc = packet_in.yacc;
+	packet1.zacc = packet_in.zacc;
+	packet1.xgyro = packet_in.xgyro;
+	packet1.ygyro = packet_in.ygyro;
+	packet1.zgyro = packet_in.zgyro;
+	packet1.xmag = packet_in.xmag;
+	packet1.ymag = packet_in.ymag;
+	packet1.zmag = packet_in.zmag;
+	packet1.temperature = packet_in.temperature;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_scaled_imu_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.xacc , packet1.yacc , packet1.zacc , packet1.xgyro , packet1.ygyro , packet1.zgyro , packet1.xmag , packet1.ymag , packet1.zmag , packet1.temperature));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_scaled_imu_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_scaled_imu_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_raw_imu(Msgbench_Run &run)
+{
+	mavlink_raw_imu_t packet_in = {
+		(uint64_t)93372036854775807ULL, (int16_t)17651, (int16_t)17755, (int16_t)17859, (int16_t)17963, (int16_t)18067, (int16_t)18171, (int16_t)18275, (int16_t)18379, (int16_t)18483, (uint8_t)211, (int16_t)18639
+	};
+	mavlink_raw_imu_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.xacc = packet_in.xacc;
+	packet1.yacc = packet_in.yacc;
+	packet1.zacc = packet_in.zacc;
+	packet1.xgyro = packet_in.xgyro;
+	packet1.ygyro = packet_in.ygyro;
+	packet1.zgyro = packet_in.zgyro;
+	packet1.xmag = packet_in.xmag;
+	packet1.ymag = packet_in.ymag;
+	packet1.zmag = packet_in.zmag;
+	packet1.id = packet_in.id;
+	packet1.temperature = packet_in.temperature;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_raw_imu_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.xacc , packet1.yacc , packet1.zacc , packet1.xgyro , packet1.ygyro , packet1.zgyro , packet1.xmag , packet1.ymag , packet1.zmag , packet1.id , packet1.temperature));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_raw_imu_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_raw_imu_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_raw_pressure(Msgbench_Run &run)
+{
+	mavlink_raw_pressure_t packet_in = {
+		(uint64_t)93372036854775807ULL, (int16_t)17651, (int16_t)17755, (int16_t)17859, (int16_t)17963
+	};
+	mavlink_raw_pressure_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.press_abs = packet_in.press_abs;
+	packet1.press_diff1 = packet_in.press_diff1;
+	packet1.press_diff2 = packet_in.press_diff2;
+	packet1.temperature = packet_in.temperature;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_raw_pressure_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.press_abs , packet1.press_diff1 , packet1.press_diff2 , packet1.temperature));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_raw_pressure_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_raw_pressure_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_scaled_pressure(Msgbench_Run &run)
+{
+	mavlink_scaled_pressure_t packet_in = {
+		(uint32_t)963497464, (float)45.0, (float)73.0, (int16_t)17859, (int16_t)17963
+	};
+	mavlink_scaled_pressure_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.press_abs = packet_in.press_abs;
+	packet1.press_diff = packet_in.press_diff;
+	packet1.temperature = packet_in.temperature;
+	packet1.temperature_press_diff = packet_in.temperature_press_diff;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_scaled_pressure_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.press_abs , packet1.press_diff , packet1.temperature , packet1.temperature_press_diff));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_scaled_pressure_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_scaled_pressure_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_attitude(Msgbench_Run &run)
+{
+	mavlink_attitude_t packet_in = {
+		(uint32_t)963497464, (float)45.0, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0
+	};
+	mavlink_attitude_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.roll = packet_in.roll;
+	packet1.pitch = packet_in.pitch;
+	packet1.yaw = packet_in.yaw;
+	packet1.rollspeed = packet_in.rollspeed;
+	packet1.pitchspeed = packet_in.pitchspeed;
+	packet1.yawspeed = packet_in.yawspeed;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_attitude_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.roll , packet1.pitch , packet1.yaw , packet1.rollspeed , packet1.pitchspeed , packet1.yawspeed));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_attitude_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_attitude_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_attitude_quaternion(Msgbench_Run &run)
+{
+	mavlink_attitude_quaternion_t packet_in = {
+		(uint32_t)963497464, (float)45.0, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, { (float)241.0, (float)242.0, (float)243.0, (float)244.0 }
+	};
+	mavlink_attitude_quaternion_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.q1 = packet_in.q1;
+	packet1.q2 = packet_in.q2;
+	packet1.q3 = packet_in.q3;
+	packet1.q4 = packet_in.q4;
+	packet1.rollspeed = packet_in.rollspeed;
+	packet1.pitchspeed = packet_in.pitchspeed;
+	packet1.yawspeed = packet_in.yawspeed;
+	mav_array_memcpy(packet1.repr_offset_q, packet_in.repr_offset_q, sizeof(float)*4);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_attitude_quaternion_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.q1 , packet1.q2 , packet1.q3 , packet1.q4 , packet1.rollspeed , packet1.pitchspeed , packet1.yawspeed , packet1.repr_offset_q));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_attitude_quaternion_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_attitude_quaternion_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_local_position_ned(Msgbench_Run &run)
+{
+	mavlink_local_position_ned_t packet_in = {
+		(uint32_t)963497464, (float)45.0, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0
+	};
+	mavlink_local_position_ned_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.x = packet_in.x;
+	packet1.y = packet_in.y;
+	packet1.z = packet_in.z;
+	packet1.vx = packet_in.vx;
+	packet1.vy = packet_in.vy;
+	packet1.vz = packet_in.vz;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_local_position_ned_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.x , packet1.y , packet1.z , packet1.vx , packet1.vy , packet1.vz));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_local_position_ned_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_local_position_ned_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_global_position_int(Msgbench_Run &run)
+{
+	mavlink_global_position_int_t packet_in = {
+		(uint32_t)963497464, (int32_t)963497672, (int32_t)963497880, (int32_t)963498088, (int32_t)963498296, (int16_t)18275, (int16_t)18379, (int16_t)18483, (uint16_t)18587
+	};
+	mavlink_global_position_int_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.lat = packet_in.lat;
+	packet1.lon = packet_in.lon;
+	packet1.alt = packet_in.alt;
+	packet1.relative_alt = packet_in.relative_alt;
+	packet1.vx = packet_in.vx;
+	packet1.vy = packet_in.vy;
+	packet1.vz = packet_in.vz;
+	packet1.hdg = packet_in.hdg;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_global_position_int_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.lat , packet1.lon , packet1.alt , packet1.relative_alt , packet1.vx , packet1.vy , packet1.vz , packet1.hdg));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_global_position_int_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_global_position_int_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_rc_channels_scaled(Msgbench_Run &run)
+{
+	mavlink_rc_channels_scaled_t packet_in = {
+		(uint32_t)963497464, (int16_t)17443, (int16_t)17547, (int16_t)17651, (int16_t)17755, (int16_t)17859, (int16_t)17963, (int16_t)18067, (int16_t)18171, (uint8_t)65, (uint8_t)132
+	};
+	mavlink_rc_channels_scaled_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.chan1_scaled = packet_in.chan1_scaled;
+	packet1.chan2_scaled = packet_in.chan2_scaled;
+	packet1.chan3_scaled = packet_in.chan3_scaled;
+	packet1.chan4_scaled = packet_in.chan4_scaled;
+	packet1.chan5_scaled = packet_in.chan5_scaled;
+	packet1.chan6_scaled = packet_in.chan6_scaled;
+	packet1.chan7_scaled = packet_in.chan7_scaled;
+	packet1.chan8_scaled = packet_in.chan8_scaled;
+	packet1.port = packet_in.port;
+	packet1.rssi = packet_in.rssi;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_rc_channels_scaled_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.port , packet1.chan1_scaled , packet1.chan2_scaled , packet1.chan3_scaled , packet1.chan4_scaled , packet1.chan5_scaled , packet1.chan6_scaled , packet1.chan7_scaled , packet1.chan8_scaled , packet1.rssi));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_rc_channels_scaled_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_rc_channels_scaled_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_rc_channels_raw(Msgbench_Run &run)
+{
+	mavlink_rc_channels_raw_t packet_in = {
+		(uint32_t)963497464, (uint16_t)17443, (uint16_t)17547, (uint16_t)17651, (uint16_t)17755, (uint16_t)17859, (uint16_t)17963, (uint16_t)18067, (uint16_t)18171, (uint8_t)65, (uint8_t)132
+	};
+	mavlink_rc_channels_raw_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.chan1_raw = packet_in.chan1_raw;
+	packet1.chan2_raw = packet_in.chan2_raw;
+	packet1.chan3_raw = packet_in.chan3_raw;
+	packet1.chan4_raw = packet_in.chan4_raw;
+	packet1.chan5_raw = packet_in.chan5_raw;
+	packet1.chan6_raw = packet_in.chan6_raw;
+	packet1.chan7_raw = packet_in.chan7_raw;
+	packet1.chan8_raw = packet_in.chan8_raw;
+	packet1.port = packet_in.port;
+	packet1.rssi = packet_in.rssi;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_rc_channels_raw_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.port , packet1.chan1_raw , packet1.chan2_raw , packet1.chan3_raw , packet1.chan4_raw , packet1.chan5_raw , packet1.chan6_raw , packet1.chan7_raw , packet1.chan8_raw , packet1.rssi));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_rc_channels_raw_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_rc_channels_raw_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_servo_output_raw(Msgbench_Run &run)
+{
+	mavlink_servo_output_raw_t packet_in = {
+		(uint32_t)963497464, (uint16_t)17443, (uint16_t)17547, (uint16_t)17651, (uint16_t)17755, (uint16_t)17859, (uint16_t)17963, (uint16_t)18067, (uint16_t)18171, (uint8_t)65, (uint16_t)18327, (uint16_t)18431, (uint16_t)18535, (uint16_t)18639, (uint16_t)18743, (uint16_t)18847, (uint16_t)18951, (uint16_t)19055
+	};
+	mavlink_servo_output_raw_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.servo1_raw = packet_in.servo1_raw;
+	packet1.servo2_raw = packet_in.servo2_raw;
+	packet1.servo3_raw = packet_in.servo3_raw;
+	packet1.servo4_raw = packet_in.servo4_raw;
+	packet1.servo5_raw = packet_in.servo5_raw;
+	packet1.servo6_raw = packet_in.servo6_raw;
+	packet1.servo7_raw = packet_in.servo7_raw;
+	packet1.servo8_raw = packet_in.servo8_raw;
+	packet1.port = packet_in.port;
+	packet1.servo9_raw = packet_in.servo9_raw;
+	packet1.servo10_raw = packet_in.servo10_raw;
+	packet1.servo11_raw = packet_in.servo11_raw;
+	packet1.servo12_raw = packet_in.servo12_raw;
+	packet1.servo13_raw = packet_in.servo13_raw;
+	packet1.servo14_raw = packet_in.servo14_raw;
+	packet1.servo15_raw = packet_in.servo15_raw;
+	packet1.servo16_raw = packet_in.servo16_raw;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_servo_output_raw_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.port , packet1.servo1_raw , packet1.servo2_raw , packet1.servo3_raw , packet1.servo4_raw , packet1.servo5_raw , packet1.servo6_raw , packet1.servo7_raw , packet1.servo8_raw , packet1.servo9_raw , packet1.servo10_raw , packet1.servo11_raw , packet1.servo12_raw , packet1.servo13_raw , packet1.servo14_raw , packet1.servo15_raw , packet1.servo16_raw));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_servo_output_raw_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_servo_output_raw_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_mission_request_partial_list(Msgbench_Run &run)
+{
+	mavlink_mission_request_partial_list_t packet_in = {
+		(int16_t)17235, (int16_t)17339, (uint8_t)17, (uint8_t)84, (uint8_t)151
+	};
+	mavlink_mission_request_partial_list_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.start_index = packet_in.start_index;
+	packet1.end_index = packet_in.end_index;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.mission_type = packet_in.mission_type;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_mission_request_partial_list_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.start_index , packet1.end_index , packet1.mission_type));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_mission_request_partial_list_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_mission_request_partial_list_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_mission_write_partial_list(Msgbench_Run &run)
+{
+	mavlink_mission_write_partial_list_t packet_in = {
+		(int16_t)17235, (int16_t)17339, (uint8_t)17, (uint8_t)84, (uint8_t)151
+	};
+	mavlink_mission_write_partial_list_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.start_index = packet_in.start_index;
+	packet1.end_index = packet_in.end_index;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.mission_type = packet_in.mission_type;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_mission_write_partial_list_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.start_index , packet1.end_index , packet1.mission_type));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_mission_write_partial_list_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_mission_write_partial_list_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_mission_item(Msgbench_Run &run)
+{
+	mavlink_mission_item_t packet_in = {
+		(float)17.0, (float)45.0, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (uint16_t)18691, (uint16_t)18795, (uint8_t)101, (uint8_t)168, (uint8_t)235, (uint8_t)46, (uint8_t)113, (uint8_t)180
+	};
+	mavlink_mission_item_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.param1 = packet_in.param1;
+	packet1.param2 = packet_in.param2;
+	packet1.param3 = packet_in.param3;
+	packet1.param4 = packet_in.param4;
+	packet1.x = packet_in.x;
+	packet1.y = packet_in.y;
+	packet1.z = packet_in.z;
+	packet1.seq = packet_in.seq;
+	packet1.command = packet_in.command;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.frame = packet_in.frame;
+	packet1.current = packet_in.current;
+	packet1.autocontinue = packet_in.autocontinue;
+	packet1.mission_type = packet_in.mission_type;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_mission_item_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.seq , packet1.frame , packet1.command , packet1.current , packet1.autocontinue , packet1.param1 , packet1.param2 , packet1.param3 , packet1.param4 , packet1.x , packet1.y , packet1.z , packet1.mission_type));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_mission_item_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_mission_item_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_mission_request(Msgbench_Run &run)
+{
+	mavlink_mission_request_t packet_in = {
+		(uint16_t)17235, (uint8_t)139, (uint8_t)206, (uint8_t)17
+	};
+	mavlink_mission_request_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.seq = packet_in.seq;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.mission_type = packet_in.mission_type;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_mission_request_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.seq , packet1.mission_type));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_mission_request_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_mission_request_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_mission_set_current(Msgbench_Run &run)
+{
+	mavlink_mission_set_current_t packet_in = {
+		(uint16_t)17235, (uint8_t)139, (uint8_t)206
+	};
+	mavlink_mission_set_current_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.seq = packet_in.seq;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_mission_set_current_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.seq));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_mission_set_current_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_mission_set_current_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_mission_current(Msgbench_Run &run)
+{
+	mavlink_mission_current_t packet_in = {
+		(uint16_t)17235, (uint16_t)17339, (uint8_t)17, (uint8_t)84, (uint32_t)963497776, (uint32_t)963497984, (uint32_t)963498192
+	};
+	mavlink_mission_current_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.seq = packet_in.seq;
+	packet1.total = packet_in.total;
+	packet1.mission_state = packet_in.mission_state;
+	packet1.mission_mode = packet_in.mission_mode;
+	packet1.mission_id = packet_in.mission_id;
+	packet1.fence_id = packet_in.fence_id;
+	packet1.rally_points_id = packet_in.rally_points_id;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_mission_current_pack(run.system_id, run.component_id, &run.message, packet1.seq , packet1.total , packet1.mission_state , packet1.mission_mode , packet1.mission_id , packet1.fence_id , packet1.rally_points_id));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_mission_current_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_mission_current_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_mission_request_list(Msgbench_Run &run)
+{
+	mavlink_mission_request_list_t packet_in = {
+		(uint8_t)5, (uint8_t)72, (uint8_t)139
+	};
+	mavlink_mission_request_list_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.mission_type = packet_in.mission_type;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_mission_request_list_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.mission_type));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_mission_request_list_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_mission_request_list_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_mission_count(Msgbench_Run &run)
+{
+	mavlink_mission_count_t packet_in = {
+		(uint16_t)17235, (uint8_t)139, (uint8_t)206, (uint8_t)17, (uint32_t)963497724
+	};
+	mavlink_mission_count_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.count = packet_in.count;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.mission_type = packet_in.mission_type;
+	packet1.opaque_id = packet_in.opaque_id;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_mission_count_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.count , packet1.mission_type , packet1.opaque_id));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_mission_count_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_mission_count_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_mission_clear_all(Msgbench_Run &run)
+{
+	mavlink_mission_clear_all_t packet_in = {
+		(uint8_t)5, (uint8_t)72, (uint8_t)139
+	};
+	mavlink_mission_clear_all_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.mission_type = packet_in.mission_type;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_mission_clear_all_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.mission_type));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_mission_clear_all_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_mission_clear_all_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_mission_item_reached(Msgbench_Run &run)
+{
+	mavlink_mission_item_reached_t packet_in = {
+		(uint16_t)17235
+	};
+	mavlink_mission_item_reached_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.seq = packet_in.seq;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_mission_item_reached_pack(run.system_id, run.component_id, &run.message, packet1.seq));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_mission_item_reached_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_mission_item_reached_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_mission_ack(Msgbench_Run &run)
+{
+	mavlink_mission_ack_t packet_in = {
+		(uint8_t)5, (uint8_t)72, (uint8_t)139, (uint8_t)206, (uint32_t)963497672
+	};
+	mavlink_mission_ack_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.type = packet_in.type;
+	packet1.mission_type = packet_in.mission_type;
+	packet1.opaque_id = packet_in.opaque_id;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_mission_ack_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.type , packet1.mission_type , packet1.opaque_id));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_mission_ack_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_mission_ack_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_set_gps_global_origin(Msgbench_Run &run)
+{
+	mavlink_set_gps_global_origin_t packet_in = {
+		(int32_t)963497464, (int32_t)963497672, (int32_t)963497880, (uint8_t)41, (uint64_t)93372036854776626ULL
+	};
+	mavlink_set_gps_global_origin_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.latitude = packet_in.latitude;
+	packet1.longitude = packet_in.longitude;
+	packet1.altitude = packet_in.altitude;
+	packet1.target_system = packet_in.target_system;
+	packet1.time_usec = packet_in.time_usec;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_set_gps_global_origin_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.latitude , packet1.longitude , packet1.altitude , packet1.time_usec));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_set_gps_global_origin_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_set_gps_global_origin_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_gps_global_origin(Msgbench_Run &run)
+{
+	mavlink_gps_global_origin_t packet_in = {
+		(int32_t)963497464, (int32_t)963497672, (int32_t)963497880, (uint64_t)93372036854776563ULL
+	};
+	mavlink_gps_global_origin_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.latitude = packet_in.latitude;
+	packet1.longitude = packet_in.longitude;
+	packet1.altitude = packet_in.altitude;
+	packet1.time_usec = packet_in.time_usec;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_gps_global_origin_pack(run.system_id, run.component_id, &run.message, packet1.latitude , packet1.longitude , packet1.altitude , packet1.time_usec));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_gps_global_origin_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_gps_global_origin_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_param_map_rc(Msgbench_Run &run)
+{
+	mavlink_param_map_rc_t packet_in = {
+		(float)17.0, (float)45.0, (float)73.0, (float)101.0, (int16_t)18067, (uint8_t)187, (uint8_t)254, "UVWXYZABCDEFGHI", (uint8_t)113
+	};
+	mavlink_param_map_rc_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.param_value0 = packet_in.param_value0;
+	packet1.scale = packet_in.scale;
+	packet1.param_value_min = packet_in.param_value_min;
+	packet1.param_value_max = packet_in.param_value_max;
+	packet1.param_index = packet_in.param_index;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.parameter_rc_channel_index = packet_in.parameter_rc_channel_index;
+	mav_array_memcpy(packet1.param_id, packet_in.param_id, sizeof(char)*16);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_param_map_rc_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.param_id , packet1.param_index , packet1.parameter_rc_channel_index , packet1.param_value0 , packet1.scale , packet1.param_value_min , packet1.param_value_max));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_param_map_rc_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_param_map_rc_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_mission_request_int(Msgbench_Run &run)
+{
+	mavlink_mission_request_int_t packet_in = {
+		(uint16_t)17235, (uint8_t)139, (uint8_t)206, (uint8_t)17
+	};
+	mavlink_mission_request_int_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.seq = packet_in.seq;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.mission_type = packet_in.mission_type;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_mission_request_int_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.seq , packet1.mission_type));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_mission_request_int_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_mission_request_int_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_safety_set_allowed_area(Msgbench_Run &run)
+{
+	mavlink_safety_set_allowed_area_t packet_in = {
+		(float)17.0, (float)45.0, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (uint8_t)77, (uint8_t)144, (uint8_t)211
+	};
+	mavlink_safety_set_allowed_area_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.p1x = packet_in.p1x;
+	packet1.p1y = packet_in.p1y;
+	packet1.p1z = packet_in.p1z;
+	packet1.p2x = packet_in.p2x;
+	packet1.p2y = packet_in.p2y;
+	packet1.p2z = packet_in.p2z;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.frame = packet_in.frame;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_safety_set_allowed_area_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.frame , packet1.p1x , packet1.p1y , packet1.p1z , packet1.p2x , packet1.p2y , packet1.p2z));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_safety_set_allowed_area_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_safety_set_allowed_area_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_safety_allowed_area(Msgbench_Run &run)
+{
+	mavlink_safety_allowed_area_t packet_in = {
+		(float)17.0, (float)45.0, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (uint8_t)77
+	};
+	mavlink_safety_allowed_area_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.p1x = packet_in.p1x;
+	packet1.p1y = packet_in.p1y;
+	packet1.p1z = packet_in.p1z;
+	packet1.p2x = packet_in.p2x;
+	packet1.p2y = packet_in.p2y;
+	packet1.p2z = packet_in.p2z;
+	packet1.frame = packet_in.frame;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_safety_allowed_area_pack(run.system_id, run.component_id, &run.message, packet1.frame , packet1.p1x , packet1.p1y , packet1.p1z , packet1.p2x , packet1.p2y , packet1.p2z));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_safety_allowed_area_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_safety_allowed_area_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_attitude_quaternion_cov(Msgbench_Run &run)
+{
+	mavlink_attitude_quaternion_cov_t packet_in = {
+		(uint64_t)93372036854775807ULL, { (float)73.0, (float)74.0, (float)75.0, (float)76.0 }, (float)185.0, (float)213.0, (float)241.0, { (float)269.0, (float)270.0, (float)271.0, (float)272.0, (float)273.0, (float)274.0, (float)275.0, (float)276.0, (float)277.0 }
+	};
+	mavlink_attitude_quaternion_cov_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.rollspeed = packet_in.rollspeed;
+	packet1.pitchspeed = packet_in.pitchspeed;
+	packet1.yawspeed = packet_in.yawspeed;
+	mav_array_memcpy(packet1.q, packet_in.q, sizeof(float)*4);
+	mav_array_memcpy(packet1.covariance, packet_in.covariance, sizeof(float)*9);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_attitude_quaternion_cov_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.q , packet1.rollspeed , packet1.pitchspeed , packet1.yawspeed , packet1.covariance));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_attitude_quaternion_cov_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_attitude_quaternion_cov_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_nav_controller_output(Msgbench_Run &run)
+{
+	mavlink_nav_controller_output_t packet_in = {
+		(float)17.0, (float)45.0, (float)73.0, (float)101.0, (float)129.0, (int16_t)18275, (int16_t)18379, (uint16_t)18483
+	};
+	mavlink_nav_controller_output_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.nav_roll = packet_in.nav_roll;
+	packet1.nav_pitch = packet_in.nav_pitch;
+	packet1.alt_error = packet_in.alt_error;
+	packet1.aspd_error = packet_in.aspd_error;
+	packet1.xtrack_error = packet_in.xtrack_error;
+	packet1.nav_bearing = packet_in.nav_bearing;
+	packet1.target_bearing = packet_in.target_bearing;
+	packet1.wp_dist = packet_in.wp_dist;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_nav_controller_output_pack(run.system_id, run.component_id, &run.message, packet1.nav_roll , packet1.nav_pitch , packet1.nav_bearing , packet1.target_bearing , packet1.wp_dist , packet1.alt_error , packet1.aspd_error , packet1.xtrack_error));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_nav_controller_output_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_nav_controller_output_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_global_position_int_cov(Msgbench_Run &run)
+{
+	mavlink_global_position_int_cov_t packet_in = {
+		(uint64_t)93372036854775807ULL, (int32_t)963497880, (int32_t)963498088, (int32_t)963498296, (int32_t)963498504, (float)185.0, (float)213.0, (float)241.0, { (float)269.0, (float)270.0, (float)271.0, (float)272.0, (float)273.0, (float)274.0, (float)275.0, (float)276.0, (float)277.0, (float)278.0, (float)279.0, (float)280.0, (float)281.0, (float)282.0, (float)283.0, (float)284.0, (float)285.0, (float)286.0, (float)287.0, (float)288.0, (float)289.0, (float)290.0, (float)291.0, (float)292.0, (float)293.0, (float)294.0, (float)295.0, (float)296.0, (float)297.0, (float)298.0, (float)299.0, (float)300.0, (float)301.0, (float)302.0, (float)303.0, (float)304.0 }, (uint8_t)33
+	};
+	mavlink_global_position_int_cov_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.lat = packet_in.lat;
+	packet1.lon = packet_in.lon;
+	packet1.alt = packet_in.alt;
+	packet1.relative_alt = packet_in.relative_alt;
+	packet1.vx = packet_in.vx;
+	packet1.vy = packet_in.vy;
+	packet1.vz = packet_in.vz;
+	packet1.estimator_type = packet_in.estimator_type;
+	mav_array_memcpy(packet1.covariance, packet_in.covariance, sizeof(float)*36);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_global_position_int_cov_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.estimator_type , packet1.lat , packet1.lon , packet1.alt , packet1.relative_alt , packet1.vx , packet1.vy , packet1.vz , packet1.covariance));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_global_position_int_cov_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_global_position_int_cov_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_local_position_ned_cov(Msgbench_Run &run)
+{
+	mavlink_local_position_ned_cov_t packet_in = {
+		(uint64_t)93372036854775807ULL, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, (float)241.0, (float)269.0, (float)297.0, { (float)325.0, (float)326.0, (float)327.0, (float)328.0, (float)329.0, (float)330.0, (float)331.0, (float)332.0, (float)333.0, (float)334.0, (float)335.0, (float)336.0, (float)337.0, (float)338.0, (float)339.0, (float)340.0, (float)341.0, (float)342.0, (float)343.0, (float)344.0, (float)345.0, (float)346.0, (float)347.0, (float)348.0, (float)349.0, (float)350.0, (float)351.0, (float)352.0, (float)353.0, (float)354.0, (float)355.0, (float)356.0, (float)357.0, (float)358.0, (float)359.0, (float)360.0, (float)361.0, (float)362.0, (float)363.0, (float)364.0, (float)365.0, (float)366.0, (float)367.0, (float)368.0, (float)369.0 }, (uint8_t)165
+	};
+	mavlink_local_position_ned_cov_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.x = packet_in.x;
+	packet1.y = packet_in.y;
+	packet1.z = packet_in.z;
+	packet1.vx = packet_in.vx;
+	packet1.vy = packet_in.vy;
+	packet1.vz = packet_in.vz;
+	packet1.ax = packet_in.ax;
+	packet1.ay = packet_in.ay;
+	packet1.az = packet_in.az;
+	packet1.estimator_type = packet_in.estimator_type;
+	mav_array_memcpy(packet1.covariance, packet_in.covariance, sizeof(float)*45);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_local_position_ned_cov_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.estimator_type , packet1.x , packet1.y , packet1.z , packet1.vx , packet1.vy , packet1.vz , packet1.ax , packet1.ay , packet1.az , packet1.covariance));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_local_position_ned_cov_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_local_position_ned_cov_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_rc_channels(Msgbench_Run &run)
+{
+	mavlink_rc_channels_t packet_in = {
+		(uint32_t)963497464, (uint16_t)17443, (uint16_t)17547, (uint16_t)17651, (uint16_t)17755, (uint16_t)17859, (uint16_t)17963, (uint16_t)18067, (uint16_t)18171, (uint16_t)18275, (uint16_t)18379, (uint16_t)18483, (uint16_t)18587, (uint16_t)18691, (uint16_t)18795, (uint16_t)18899, (uint16_t)19003, (uint16_t)19107, (uint16_t)19211, (uint8_t)125, (uint8_t)192
+	};
+	mavlink_rc_channels_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.chan1_raw = packet_in.chan1_raw;
+	packet1.chan2_raw = packet_in.chan2_raw;
+	packet1.chan3_raw = packet_in.chan3_raw;
+	packet1.chan4_raw = packet_in.chan4_raw;
+	packet1.chan5_raw = packet_in.chan5_raw;
+	packet1.chan6_raw = packet_in.chan6_raw;
+	packet1.chan7_raw = packet_in.chan7_raw;
+	packet1.chan8_raw = packet_in.chan8_raw;
+	packet1.chan9_raw = packet_in.chan9_raw;
+	packet1.chan10_raw = packet_in.chan10_raw;
+	packet1.chan11_raw = packet_in.chan11_raw;
+	packet1.chan12_raw = packet_in.chan12_raw;
+	packet1.chan13_raw = packet_in.chan13_raw;
+	packet1.chan14_raw = packet_in.chan14_raw;
+	packet1.chan15_raw = packet_in.chan15_raw;
+	packet1.chan16_raw = packet_in.chan16_raw;
+	packet1.chan17_raw = packet_in.chan17_raw;
+	packet1.chan18_raw = packet_in.chan18_raw;
+	packet1.chancount = packet_in.chancount;
+	packet1.rssi = packet_in.rssi;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_rc_channels_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.chancount , packet1.chan1_raw , packet1.chan2_raw , packet1.chan3_raw , packet1.chan4_raw , packet1.chan5_raw , packet1.chan6_raw , packet1.chan7_raw , packet1.chan8_raw , packet1.chan9_raw , packet1.chan10_raw , packet1.chan11_raw , packet1.chan12_raw , packet1.chan13_raw , packet1.chan14_raw , packet1.chan15_raw , packet1.chan16_raw , packet1.chan17_raw , packet1.chan18_raw , packet1.rssi));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_rc_channels_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_rc_channels_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_request_data_stream(Msgbench_Run &run)
+{
+	mavlink_request_data_stream_t packet_in = {
+		(uint16_t)17235, (uint8_t)139, (uint8_t)206, (uint8_t)17, (uint8_t)84
+	};
+	mavlink_request_data_stream_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.req_message_rate = packet_in.req_message_rate;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.req_stream_id = packet_in.req_stream_id;
+	packet1.start_stop = packet_in.start_stop;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_request_data_stream_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.req_stream_id , packet1.req_message_rate , packet1.start_stop));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_request_data_stream_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_request_data_stream_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_data_stream(Msgbench_Run &run)
+{
+	mavlink_data_stream_t packet_in = {
+		(uint16_t)17235, (uint8_t)139, (uint8_t)206
+	};
+	mavlink_data_stream_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.message_rate = packet_in.message_rate;
+	packet1.stream_id = packet_in.stream_id;
+	packet1.on_off = packet_in.on_off;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_data_stream_pack(run.system_id, run.component_id, &run.message, packet1.stream_id , packet1.message_rate , packet1.on_off));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_data_stream_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_data_stream_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_manual_control(Msgbench_Run &run)
+{
+	mavlink_manual_control_t packet_in = {
+		(int16_t)17235, (int16_t)17339, (int16_t)17443, (int16_t)17547, (uint16_t)17651, (uint8_t)163, (uint16_t)17807, (uint8_t)108, (int16_t)17963, (int16_t)18067, (int16_t)18171, (int16_t)18275, (int16_t)18379, (int16_t)18483, (int16_t)18587, (int16_t)18691
+	};
+	mavlink_manual_control_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.x = packet_in.x;
+	packet1.y = packet_in.y;
+	packet1.z = packet_in.z;
+	packet1.r = packet_in.r;
+	packet1.buttons = packet_in.buttons;
+	packet1.target = packet_in.target;
+	packet1.buttons2 = packet_in.buttons2;
+	packet1.enabled_extensions = packet_in.enabled_extensions;
+	packet1.s = packet_in.s;
+	packet1.t = packet_in.t;
+	packet1.aux1 = packet_in.aux1;
+	packet1.aux2 = packet_in.aux2;
+	packet1.aux3 = packet_in.aux3;
+	packet1.aux4 = packet_in.aux4;
+	packet1.aux5 = packet_in.aux5;
+	packet1.aux6 = packet_in.aux6;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_manual_control_pack(run.system_id, run.component_id, &run.message, packet1.target , packet1.x , packet1.y , packet1.z , packet1.r , packet1.buttons , packet1.buttons2 , packet1.enabled_extensions , packet1.s , packet1.t , packet1.aux1 , packet1.aux2 , packet1.aux3 , packet1.aux4 , packet1.aux5 , packet1.aux6));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_manual_control_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_manual_control_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_rc_channels_override(Msgbench_Run &run)
+{
+	mavlink_rc_channels_override_t packet_in = {
+		(uint16_t)17235, (uint16_t)17339, (uint16_t)17443, (uint16_t)17547, (uint16_t)17651, (uint16_t)17755, (uint16_t)17859, (uint16_t)17963, (uint8_t)53, (uint8_t)120, (uint16_t)18171, (uint16_t)18275, (uint16_t)18379, (uint16_t)18483, (uint16_t)18587, (uint16_t)18691, (uint16_t)18795, (uint16_t)18899, (uint16_t)19003, (uint16_t)19107
+	};
+	mavlink_rc_channels_override_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.chan1_raw = packet_in.chan1_raw;
+	packet1.chan2_raw = packet_in.chan2_raw;
+	packet1.chan3_raw = packet_in.chan3_raw;
+	packet1.chan4_raw = packet_in.chan4_raw;
+	packet1.chan5_raw = packet_in.chan5_raw;
+	packet1.chan6_raw = packet_in.chan6_raw;
+	packet1.chan7_raw = packet_in.chan7_raw;
+	packet1.chan8_raw = packet_in.chan8_raw;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.chan9_raw = packet_in.chan9_raw;
+	packet1.chan10_raw = packet_in.chan10_raw;
+	packet1.chan11_raw = packet_in.chan11_raw;
+	packet1.chan12_raw = packet_in.chan12_raw;
+	packet1.chan13_raw = packet_in.chan13_raw;
+	packet1.chan14_raw = packet_in.chan14_raw;
+	packet1.chan15_raw = packet_in.chan15_raw;
+	packet1.chan16_raw = packet_in.chan16_raw;
+	packet1.chan17_raw = packet_in.chan17_raw;
+	packet1.chan18_raw = packet_in.chan18_raw;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_rc_channels_override_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.chan1_raw , packet1.chan2_raw , packet1.chan3_raw , packet1.chan4_raw , packet1.chan5_raw , packet1.chan6_raw , packet1.chan7_raw , packet1.chan8_raw , packet1.chan9_raw , packet1.chan10_raw , packet1.chan11_raw , packet1.chan12_raw , packet1.chan13_raw , packet1.chan14_raw , packet1.chan15_raw , packet1.chan16_raw , packet1.chan17_raw , packet1.chan18_raw));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_rc_channels_override_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_rc_channels_override_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_mission_item_int(Msgbench_Run &run)
+{
+	mavlink_mission_item_int_t packet_in = {
+		(float)17.0, (float)45.0, (float)73.0, (float)101.0, (int32_t)963498296, (int32_t)963498504, (float)185.0, (uint16_t)18691, (uint16_t)18795, (uint8_t)101, (uint8_t)168, (uint8_t)235, (uint8_t)46, (uint8_t)113, (uint8_t)180
+	};
+	mavlink_mission_item_int_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.param1 = packet_in.param1;
+	packet1.param2 = packet_in.param2;
+	packet1.param3 = packet_in.param3;
+	packet1.param4 = packet_in.param4;
+	packet1.x = packet_in.x;
+	packet1.y = packet_in.y;
+	packet1.z = packet_in.z;
+	packet1.seq = packet_in.seq;
+	packet1.command = packet_in.command;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.frame = packet_in.frame;
+	packet1.current = packet_in.current;
+	packet1.autocontinue = packet_in.autocontinue;
+	packet1.mission_type = packet_in.mission_type;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_mission_item_int_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.seq , packet1.frame , packet1.command , packet1.current , packet1.autocontinue , packet1.param1 , packet1.param2 , packet1.param3 , packet1.param4 , packet1.x , packet1.y , packet1.z , packet1.mission_type));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_mission_item_int_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_mission_item_int_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_vfr_hud(Msgbench_Run &run)
+{
+	mavlink_vfr_hud_t packet_in = {
+		(float)17.0, (float)45.0, (float)73.0, (float)101.0, (int16_t)18067, (uint16_t)18171
+	};
+	mavlink_vfr_hud_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.airspeed = packet_in.airspeed;
+	packet1.groundspeed = packet_in.groundspeed;
+	packet1.alt = packet_in.alt;
+	packet1.climb = packet_in.climb;
+	packet1.heading = packet_in.heading;
+	packet1.throttle = packet_in.throttle;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_vfr_hud_pack(run.system_id, run.component_id, &run.message, packet1.airspeed , packet1.groundspeed , packet1.heading , packet1.throttle , packet1.alt , packet1.climb));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_vfr_hud_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_vfr_hud_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_command_int(Msgbench_Run &run)
+{
+	mavlink_command_int_t packet_in = {
+		(float)17.0, (float)45.0, (float)73.0, (float)101.0, (int32_t)963498296, (int32_t)963498504, (float)185.0, (uint16_t)18691, (uint8_t)223, (uint8_t)34, (uint8_t)101, (uint8_t)168, (uint8_t)235
+	};
+	mavlink_command_int_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.param1 = packet_in.param1;
+	packet1.param2 = packet_in.param2;
+	packet1.param3 = packet_in.param3;
+	packet1.param4 = packet_in.param4;
+	packet1.x = packet_in.x;
+	packet1.y = packet_in.y;
+	packet1.z = packet_in.z;
+	packet1.command = packet_in.command;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.frame = packet_in.frame;
+	packet1.current = packet_in.current;
+	packet1.autocontinue = packet_in.autocontinue;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_command_int_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.frame , packet1.command , packet1.current , packet1.autocontinue , packet1.param1 , packet1.param2 , packet1.param3 , packet1.param4 , packet1.x , packet1.y , packet1.z));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_command_int_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_command_int_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_command_long(Msgbench_Run &run)
+{
+	mavlink_command_long_t packet_in = {
+		(float)17.0, (float)45.0, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (uint16_t)18691, (uint8_t)223, (uint8_t)34, (uint8_t)101
+	};
+	mavlink_command_long_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.param1 = packet_in.param1;
+	packet1.param2 = packet_in.param2;
+	packet1.param3 = packet_in.param3;
+	packet1.param4 = packet_in.param4;
+	packet1.param5 = packet_in.param5;
+	packet1.param6 = packet_in.param6;
+	packet1.param7 = packet_in.param7;
+	packet1.command = packet_in.command;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.confirmation = packet_in.confirmation;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_command_long_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.command , packet1.confirmation , packet1.param1 , packet1.param2 , packet1.param3 , packet1.param4 , packet1.param5 , packet1.param6 , packet1.param7));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_command_long_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_command_long_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_command_ack(Msgbench_Run &run)
+{
+	mavlink_command_ack_t packet_in = {
+		(uint16_t)17235, (uint8_t)139, (uint8_t)206, (int32_t)963497672, (uint8_t)29, (uint8_t)96
+	};
+	mavlink_command_ack_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.command = packet_in.command;
+	packet1.result = packet_in.result;
+	packet1.progress = packet_in.progress;
+	packet1.result_param2 = packet_in.result_param2;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_command_ack_pack(run.system_id, run.component_id, &run.message, packet1.command , packet1.result , packet1.progress , packet1.result_param2 , packet1.target_system , packet1.target_component));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_command_ack_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_command_ack_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_command_cancel(Msgbench_Run &run)
+{
+	mavlink_command_cancel_t packet_in = {
+		(uint16_t)17235, (uint8_t)139, (uint8_t)206
+	};
+	mavlink_command_cancel_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.command = packet_in.command;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_command_cancel_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.command));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_command_cancel_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_command_cancel_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_manual_setpoint(Msgbench_Run &run)
+{
+	mavlink_manual_setpoint_t packet_in = {
+		(uint32_t)963497464, (float)45.0, (float)73.0, (float)101.0, (float)129.0, (uint8_t)65, (uint8_t)132
+	};
+	mavlink_manual_setpoint_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.roll = packet_in.roll;
+	packet1.pitch = packet_in.pitch;
+	packet1.yaw = packet_in.yaw;
+	packet1.thrust = packet_in.thrust;
+	packet1.mode_switch = packet_in.mode_switch;
+	packet1.manual_override_switch = packet_in.manual_override_switch;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_manual_setpoint_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.roll , packet1.pitch , packet1.yaw , packet1.thrust , packet1.mode_switch , packet1.manual_override_switch));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_manual_setpoint_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_manual_setpoint_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_set_attitude_target(Msgbench_Run &run)
+{
+	mavlink_set_attitude_target_t packet_in = {
+		(uint32_t)963497464, { (float)45.0, (float)46.0, (float)47.0, (float)48.0 }, (float)157.0, (float)185.0, (float)213.0, (float)241.0, (uint8_t)113, (uint8_t)180, (uint8_t)247, { (float)290.0, (float)291.0, (float)292.0 }
+	};
+	mavlink_set_attitude_target_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.body_roll_rate = packet_in.body_roll_rate;
+	packet1.body_pitch_rate = packet_in.body_pitch_rate;
+	packet1.body_yaw_rate = packet_in.body_yaw_rate;
+	packet1.thrust = packet_in.thrust;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.type_mask = packet_in.type_mask;
+	mav_array_memcpy(packet1.q, packet_in.q, sizeof(float)*4);
+	mav_array_memcpy(packet1.thrust_body, packet_in.thrust_body, sizeof(float)*3);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_set_attitude_target_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.target_system , packet1.target_component , packet1.type_mask , packet1.q , packet1.body_roll_rate , packet1.body_pitch_rate , packet1.body_yaw_rate , packet1.thrust , packet1.thrust_body));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_set_attitude_target_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_set_attitude_target_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_attitude_target(Msgbench_Run &run)
+{
+	mavlink_attitude_target_t packet_in = {
+		(uint32_t)963497464, { (float)45.0, (float)46.0, (float)47.0, (float)48.0 }, (float)157.0, (float)185.0, (float)213.0, (float)241.0, (uint8_t)113
+	};
+	mavlink_attitude_target_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.body_roll_rate = packet_in.body_roll_rate;
+	packet1.body_pitch_rate = packet_in.body_pitch_rate;
+	packet1.body_yaw_rate = packet_in.body_yaw_rate;
+	packet1.thrust = packet_in.thrust;
+	packet1.type_mask = packet_in.type_mask;
+	mav_array_memcpy(packet1.q, packet_in.q, sizeof(float)*4);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_attitude_target_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.type_mask , packet1.q , packet1.body_roll_rate , packet1.body_pitch_rate , packet1.body_yaw_rate , packet1.thrust));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_attitude_target_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_attitude_target_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_set_position_target_local_ned(Msgbench_Run &run)
+{
+	mavlink_set_position_target_local_ned_t packet_in = {
+		(uint32_t)963497464, (float)45.0, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, (float)241.0, (float)269.0, (float)297.0, (float)325.0, (uint16_t)19731, (uint8_t)27, (uint8_t)94, (uint8_t)161
+	};
+	mavlink_set_position_target_local_ned_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.x = packet_in.x;
+	packet1.y = packet_in.y;
+	packet1.z = packet_in.z;
+	packet1.vx = packet_in.vx;
+	packet1.vy = packet_in.vy;
+	packet1.vz = packet_in.vz;
+	packet1.afx = packet_in.afx;
+	packet1.afy = packet_in.afy;
+	packet1.afz = packet_in.afz;
+	packet1.yaw = packet_in.yaw;
+	packet1.yaw_rate = packet_in.yaw_rate;
+	packet1.type_mask = packet_in.type_mask;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.coordinate_frame = packet_in.coordinate_frame;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_set_position_target_local_ned_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.target_system , packet1.target_component , packet1.coordinate_frame , packet1.type_mask , packet1.x , packet1.y , packet1.z , packet1.vx , packet1.vy , packet1.vz , packet1.afx , packet1.afy , packet1.afz , packet1.yaw , packet1.yaw_rate));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_set_position_target_local_ned_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_set_position_target_local_ned_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_position_target_local_ned(Msgbench_Run &run)
+{
+	mavlink_position_target_local_ned_t packet_in = {
+		(uint32_t)963497464, (float)45.0, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, (float)241.0, (float)269.0, (float)297.0, (float)325.0, (uint16_t)19731, (uint8_t)27
+	};
+	mavlink_position_target_local_ned_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.x = packet_in.x;
+	packet1.y = packet_in.y;
+	packet1.z = packet_in.z;
+	packet1.vx = packet_in.vx;
+	packet1.vy = packet_in.vy;
+	packet1.vz = packet_in.vz;
+	packet1.afx = packet_in.afx;
+	packet1.afy = packet_in.afy;
+	packet1.afz = packet_in.afz;
+	packet1.yaw = packet_in.yaw;
+	packet1.yaw_rate = packet_in.yaw_rate;
+	packet1.type_mask = packet_in.type_mask;
+	packet1.coordinate_frame = packet_in.coordinate_frame;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_position_target_local_ned_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.coordinate_frame , packet1.type_mask , packet1.x , packet1.y , packet1.z , packet1.vx , packet1.vy , packet1.vz , packet1.afx , packet1.afy , packet1.afz , packet1.yaw , packet1.yaw_rate));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_position_target_local_ned_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_position_target_local_ned_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_set_position_target_global_int(Msgbench_Run &run)
+{
+	mavlink_set_position_target_global_int_t packet_in = {
+		(uint32_t)963497464, (int32_t)963497672, (int32_t)963497880, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, (float)241.0, (float)269.0, (float)297.0, (float)325.0, (uint16_t)19731, (uint8_t)27, (uint8_t)94, (uint8_t)161
+	};
+	mavlink_set_position_target_global_int_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.lat_int = packet_in.lat_int;
+	packet1.lon_int = packet_in.lon_int;
+	packet1.alt = packet_in.alt;
+	packet1.vx = packet_in.vx;
+	packet1.vy = packet_in.vy;
+	packet1.vz = packet_in.vz;
+	packet1.afx = packet_in.afx;
+	packet1.afy = packet_in.afy;
+	packet1.afz = packet_in.afz;
+	packet1.yaw = packet_in.yaw;
+	packet1.yaw_rate = packet_in.yaw_rate;
+	packet1.type_mask = packet_in.type_mask;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.coordinate_frame = packet_in.coordinate_frame;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_set_position_target_global_int_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.target_system , packet1.target_component , packet1.coordinate_frame , packet1.type_mask , packet1.lat_int , packet1.lon_int , packet1.alt , packet1.vx , packet1.vy , packet1.vz , packet1.afx , packet1.afy , packet1.afz , packet1.yaw , packet1.yaw_rate));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_set_position_target_global_int_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_set_position_target_global_int_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_position_target_global_int(Msgbench_Run &run)
+{
+	mavlink_position_target_global_int_t packet_in = {
+		(uint32_t)963497464, (int32_t)963497672, (int32_t)963497880, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, (float)241.0, (float)269.0, (float)297.0, (float)325.0, (uint16_t)19731, (uint8_t)27
+	};
+	mavlink_position_target_global_int_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.lat_int = packet_in.lat_int;
+	packet1.lon_int = packet_in.lon_int;
+	packet1.alt = packet_in.alt;
+	packet1.vx = packet_in.vx;
+	packet1.vy = packet_in.vy;
+	packet1.vz = packet_in.vz;
+	packet1.afx = packet_in.afx;
+	packet1.afy = packet_in.afy;
+	packet1.afz = packet_in.afz;
+	packet1.yaw = packet_in.yaw;
+	packet1.yaw_rate = packet_in.yaw_rate;
+	packet1.type_mask = packet_in.type_mask;
+	packet1.coordinate_frame = packet_in.coordinate_frame;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_position_target_global_int_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.coordinate_frame , packet1.type_mask , packet1.lat_int , packet1.lon_int , packet1.alt , packet1.vx , packet1.vy , packet1.vz , packet1.afx , packet1.afy , packet1.afz , packet1.yaw , packet1.yaw_rate));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_position_target_global_int_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_position_target_global_int_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_local_position_ned_system_global_offset(Msgbench_Run &run)
+{
+	mavlink_local_position_ned_system_global_offset_t packet_in = {
+		(uint32_t)963497464, (float)45.0, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0
+	};
+	mavlink_local_position_ned_system_global_offset_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.x = packet_in.x;
+	packet1.y = packet_in.y;
+	packet1.z = packet_in.z;
+	packet1.roll = packet_in.roll;
+	packet1.pitch = packet_in.pitch;
+	packet1.yaw = packet_in.yaw;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_local_position_ned_system_global_offset_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.x , packet1.y , packet1.z , packet1.roll , packet1.pitch , packet1.yaw));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_local_position_ned_system_global_offset_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_local_position_ned_system_global_offset_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_hil_state(Msgbench_Run &run)
+{
+	mavlink_hil_state_t packet_in = {
+		(uint64_t)93372036854775807ULL, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, (int32_t)963499128, (int32_t)963499336, (int32_t)963499544, (int16_t)19523, (int16_t)19627, (int16_t)19731, (int16_t)19835, (int16_t)19939, (int16_t)20043
+	};
+	mavlink_hil_state_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.roll = packet_in.roll;
+	packet1.pitch = packet_in.pitch;
+	packet1.yaw = packet_in.yaw;
+	packet1.rollspeed = packet_in.rollspeed;
+	packet1.pitchspeed = packet_in.pitchspeed;
+	packet1.yawspeed = packet_in.yawspeed;
+	packet1.lat = packet_in.lat;
+	packet1.lon = packet_in.lon;
+	packet1.alt = packet_in.alt;
+	packet1.vx = packet_in.vx;
+	packet1.vy = packet_in.vy;
+	packet1.vz = packet_in.vz;
+	packet1.xacc = packet_in.xacc;
+	packet1.yacc = packet_in.yacc;
+	packet1.zacc = packet_in.zacc;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_hil_state_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.roll , packet1.pitch , packet1.yaw , packet1.rollspeed , packet1.pitchspeed , packet1.yawspeed , packet1.lat , packet1.lon , packet1.alt , packet1.vx , packet1.vy , packet1.vz , packet1.xacc , packet1.yacc , packet1.zacc));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_hil_state_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_hil_state_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_hil_controls(Msgbench_Run &run)
+{
+	mavlink_hil_controls_t packet_in = {
+		(uint64_t)93372036854775807ULL, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, (float)241.0, (float)269.0, (uint8_t)125, (uint8_t)192
+	};
+	mavlink_hil_controls_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.roll_ailerons = packet_in.roll_ailerons;
+	packet1.pitch_elevator = packet_in.pitch_elevator;
+	packet1.yaw_rudder = packet_in.yaw_rudder;
+	packet1.throttle = packet_in.throttle;
+	packet1.aux1 = packet_in.aux1;
+	packet1.aux2 = packet_in.aux2;
+	packet1.aux3 = packet_in.aux3;
+	packet1.aux4 = packet_in.aux4;
+	packet1.mode = packet_in.mode;
+	packet1.nav_mode = packet_in.nav_mode;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_hil_controls_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.roll_ailerons , packet1.pitch_elevator , packet1.yaw_rudder , packet1.throttle , packet1.aux1 , packet1.aux2 , packet1.aux3 , packet1.aux4 , packet1.mode , packet1.nav_mode));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_hil_controls_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_hil_controls_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_hil_rc_inputs_raw(Msgbench_Run &run)
+{
+	mavlink_hil_rc_inputs_raw_t packet_in = {
+		(uint64_t)93372036854775807ULL, (uint16_t)17651, (uint16_t)17755, (uint16_t)17859, (uint16_t)17963, (uint16_t)18067, (uint16_t)18171, (uint16_t)18275, (uint16_t)18379, (uint16_t)18483, (uint16_t)18587, (uint16_t)18691, (uint16_t)18795, (uint8_t)101
+	};
+	mavlink_hil_rc_inputs_raw_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.chan1_raw = packet_in.chan1_raw;
+	packet1.chan2_raw = packet_in.chan2_raw;
+	packet1.chan3_raw = packet_in.chan3_raw;
+	packet1.chan4_raw = packet_in.chan4_raw;
+	packet1.chan5_raw = packet_in.chan5_raw;
+	packet1.chan6_raw = packet_in.chan6_raw;
+	packet1.chan7_raw = packet_in.chan7_raw;
+	packet1.chan8_raw = packet_in.chan8_raw;
+	packet1.chan9_raw = packet_in.chan9_raw;
+	packet1.chan10_raw = packet_in.chan10_raw;
+	packet1.chan11_raw = packet_in.chan11_raw;
+	packet1.chan12_raw = packet_in.chan12_raw;
+	packet1.rssi = packet_in.rssi;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_hil_rc_inputs_raw_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.chan1_raw , packet1.chan2_raw , packet1.chan3_raw , packet1.chan4_raw , packet1.chan5_raw , packet1.chan6_raw , packet1.chan7_raw , packet1.chan8_raw , packet1.chan9_raw , packet1.chan10_raw , packet1.chan11_raw , packet1.chan12_raw , packet1.rssi));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_hil_rc_inputs_raw_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_hil_rc_inputs_raw_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_hil_actuator_controls(Msgbench_Run &run)
+{
+	mavlink_hil_actuator_controls_t packet_in = {
+		(uint64_t)93372036854775807ULL, (uint64_t)93372036854776311ULL, { (float)129.0, (float)130.0, (float)131.0, (float)132.0, (float)133.0, (float)134.0, (float)135.0, (float)136.0, (float)137.0, (float)138.0, (float)139.0, (float)140.0, (float)141.0, (float)142.0, (float)143.0, (float)144.0 }, (uint8_t)245
+	};
+	mavlink_hil_actuator_controls_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.flags = packet_in.flags;
+	packet1.mode = packet_in.mode;
+	mav_array_memcpy(packet1.controls, packet_in.controls, sizeof(float)*16);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_hil_actuator_controls_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.controls , packet1.mode , packet1.flags));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_hil_actuator_controls_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_hil_actuator_controls_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_optical_flow(Msgbench_Run &run)
+{
+	mavlink_optical_flow_t packet_in = {
+		(uint64_t)93372036854775807ULL, (float)73.0, (float)101.0, (float)129.0, (int16_t)18275, (int16_t)18379, (uint8_t)77, (uint8_t)144, (float)199.0, (float)227.0
+	};
+	mavlink_optical_flow_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.flow_comp_m_x = packet_in.flow_comp_m_x;
+	packet1.flow_comp_m_y = packet_in.flow_comp_m_y;
+	packet1.ground_distance = packet_in.ground_distance;
+	packet1.flow_x = packet_in.flow_x;
+	packet1.flow_y = packet_in.flow_y;
+	packet1.sensor_id = packet_in.sensor_id;
+	packet1.quality = packet_in.quality;
+	packet1.flow_rate_x = packet_in.flow_rate_x;
+	packet1.flow_rate_y = packet_in.flow_rate_y;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_optical_flow_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.sensor_id , packet1.flow_x , packet1.flow_y , packet1.flow_comp_m_x , packet1.flow_comp_m_y , packet1.quality , packet1.ground_distance , packet1.flow_rate_x , packet1.flow_rate_y));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_optical_flow_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_optical_flow_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_global_vision_position_estimate(Msgbench_Run &run)
+{
+	mavlink_global_vision_position_estimate_t packet_in = {
+		(uint64_t)93372036854775807ULL, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, { (float)241.0, (float)242.0, (float)243.0, (float)244.0, (float)245.0, (float)246.0, (float)247.0, (float)248.0, (float)249.0, (float)250.0, (float)251.0, (float)252.0, (float)253.0, (float)254.0, (float)255.0, (float)256.0, (float)257.0, (float)258.0, (float)259.0, (float)260.0, (float)261.0 }, (uint8_t)97
+	};
+	mavlink_global_vision_position_estimate_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.usec = packet_in.usec;
+	packet1.x = packet_in.x;
+	packet1.y = packet_in.y;
+	packet1.z = packet_in.z;
+	packet1.roll = packet_in.roll;
+	packet1.pitch = packet_in.pitch;
+	packet1.yaw = packet_in.yaw;
+	packet1.reset_counter = packet_in.reset_counter;
+	mav_array_memcpy(packet1.covariance, packet_in.covariance, sizeof(float)*21);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_global_vision_position_estimate_pack(run.system_id, run.component_id, &run.message, packet1.usec , packet1.x , packet1.y , packet1.z , packet1.roll , packet1.pitch , packet1.yaw , packet1.covariance , packet1.reset_counter));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_global_vision_position_estimate_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_global_vision_position_estimate_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_vision_position_estimate(Msgbench_Run &run)
+{
+	mavlink_vision_position_estimate_t packet_in = {
+		(uint64_t)93372036854775807ULL, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, { (float)241.0, (float)242.0, (float)243.0, (float)244.0, (float)245.0, (float)246.0, (float)247.0, (float)248.0, (float)249.0, (float)250.0, (float)251.0, (float)252.0, (float)253.0, (float)254.0, (float)255.0, (float)256.0, (float)257.0, (float)258.0, (float)259.0, (float)260.0, (float)261.0 }, (uint8_t)97
+	};
+	mavlink_vision_position_estimate_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.usec = packet_in.usec;
+	packet1.x = packet_in.x;
+	packet1.y = packet_in.y;
+	packet1.z = packet_in.z;
+	packet1.roll = packet_in.roll;
+	packet1.pitch = packet_in.pitch;
+	packet1.yaw = packet_in.yaw;
+	packet1.reset_counter = packet_in.reset_counter;
+	mav_array_memcpy(packet1.covariance, packet_in.covariance, sizeof(float)*21);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_vision_position_estimate_pack(run.system_id, run.component_id, &run.message, packet1.usec , packet1.x , packet1.y , packet1.z , packet1.roll , packet1.pitch , packet1.yaw , packet1.covariance , packet1.reset_counter));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_vision_position_estimate_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_vision_position_estimate_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_vision_speed_estimate(Msgbench_Run &run)
+{
+	mavlink_vision_speed_estimate_t packet_in = {
+		(uint64_t)93372036854775807ULL, (float)73.0, (float)101.0, (float)129.0, { (float)157.0, (float)158.0, (float)159.0, (float)160.0, (float)161.0, (float)162.0, (float)163.0, (float)164.0, (float)165.0 }, (uint8_t)173
+	};
+	mavlink_vision_speed_estimate_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.usec = packet_in.usec;
+	packet1.x = packet_in.x;
+	packet1.y = packet_in.y;
+	packet1.z = packet_in.z;
+	packet1.reset_counter = packet_in.reset_counter;
+	mav_array_memcpy(packet1.covariance, packet_in.covariance, sizeof(float)*9);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_vision_speed_estimate_pack(run.system_id, run.component_id, &run.message, packet1.usec , packet1.x , packet1.y , packet1.z , packet1.covariance , packet1.reset_counter));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_vision_speed_estimate_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_vision_speed_estimate_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_vicon_position_estimate(Msgbench_Run &run)
+{
+	mavlink_vicon_position_estimate_t packet_in = {
+		(uint64_t)93372036854775807ULL, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, { (float)241.0, (float)242.0, (float)243.0, (float)244.0, (float)245.0, (float)246.0, (float)247.0, (float)248.0, (float)249.0, (float)250.0, (float)251.0, (float)252.0, (float)253.0, (float)254.0, (float)255.0, (float)256.0, (float)257.0, (float)258.0, (float)259.0, (float)260.0, (float)261.0 }
+	};
+	mavlink_vicon_position_estimate_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.usec = packet_in.usec;
+	packet1.x = packet_in.x;
+	packet1.y = packet_in.y;
+	packet1.z = packet_in.z;
+	packet1.roll = packet_in.roll;
+	packet1.pitch = packet_in.pitch;
+	packet1.yaw = packet_in.yaw;
+	mav_array_memcpy(packet1.covariance, packet_in.covariance, sizeof(float)*21);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_vicon_position_estimate_pack(run.system_id, run.component_id, &run.message, packet1.usec , packet1.x , packet1.y , packet1.z , packet1.roll , packet1.pitch , packet1.yaw , packet1.covariance));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_vicon_position_estimate_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_vicon_position_estimate_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_highres_imu(Msgbench_Run &run)
+{
+	mavlink_highres_imu_t packet_in = {
+		(uint64_t)93372036854775807ULL, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, (float)241.0, (float)269.0, (float)297.0, (float)325.0, (float)353.0, (float)381.0, (float)409.0, (uint16_t)20355, (uint8_t)63
+	};
+	mavlink_highres_imu_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.xacc = packet_in.xacc;
+	packet1.yacc = packet_in.yacc;
+	packet1.zacc = packet_in.zacc;
+	packet1.xgyro = packet_in.xgyro;
+	packet1.ygyro = packet_in.ygyro;
+	packet1.zgyro = packet_in.zgyro;
+	packet1.xmag = packet_in.xmag;
+	packet1.ymag = packet_in.ymag;
+	packet1.zmag = packet_in.zmag;
+	packet1.abs_pressure = packet_in.abs_pressure;
+	packet1.diff_pressure = packet_in.diff_pressure;
+	packet1.pressure_alt = packet_in.pressure_alt;
+	packet1.temperature = packet_in.temperature;
+	packet1.fields_updated = packet_in.fields_updated;
+	packet1.id = packet_in.id;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_highres_imu_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.xacc , packet1.yacc , packet1.zacc , packet1.xgyro , packet1.ygyro , packet1.zgyro , packet1.xmag , packet1.ymag , packet1.zmag , packet1.abs_pressure , packet1.diff_pressure , packet1.pressure_alt , packet1.temperature , packet1.fields_updated , packet1.id));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_highres_imu_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_highres_imu_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_optical_flow_rad(Msgbench_Run &run)
+{
+	mavlink_optical_flow_rad_t packet_in = {
+		(uint64_t)93372036854775807ULL, (uint32_t)963497880, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, (uint32_t)963499128, (float)269.0, (int16_t)19315, (uint8_t)3, (uint8_t)70
+	};
+	mavlink_optical_flow_rad_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.integration_time_us = packet_in.integration_time_us;
+	packet1.integrated_x = packet_in.integrated_x;
+	packet1.integrated_y = packet_in.integrated_y;
+	packet1.integrated_xgyro = packet_in.integrated_xgyro;
+	packet1.integrated_ygyro = packet_in.integrated_ygyro;
+	packet1.integrated_zgyro = packet_in.integrated_zgyro;
+	packet1.time_delta_distance_us = packet_in.time_delta_distance_us;
+	packet1.distance = packet_in.distance;
+	packet1.temperature = packet_in.temperature;
+	packet1.sensor_id = packet_in.sensor_id;
+	packet1.quality = packet_in.quality;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_optical_flow_rad_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.sensor_id , packet1.integration_time_us , packet1.integrated_x , packet1.integrated_y , packet1.integrated_xgyro , packet1.integrated_ygyro , packet1.integrated_zgyro , packet1.temperature , packet1.quality , packet1.time_delta_distance_us , packet1.distance));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_optical_flow_rad_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_optical_flow_rad_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_hil_sensor(Msgbench_Run &run)
+{
+	mavlink_hil_sensor_t packet_in = {
+		(uint64_t)93372036854775807ULL, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, (float)241.0, (float)269.0, (float)297.0, (float)325.0, (float)353.0, (float)381.0, (float)409.0, (uint32_t)963500584, (uint8_t)197
+	};
+	mavlink_hil_sensor_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.xacc = packet_in.xacc;
+	packet1.yacc = packet_in.yacc;
+	packet1.zacc = packet_in.zacc;
+	packet1.xgyro = packet_in.xgyro;
+	packet1.ygyro = packet_in.ygyro;
+	packet1.zgyro = packet_in.zgyro;
+	packet1.xmag = packet_in.xmag;
+	packet1.ymag = packet_in.ymag;
+	packet1.zmag = packet_in.zmag;
+	packet1.abs_pressure = packet_in.abs_pressure;
+	packet1.diff_pressure = packet_in.diff_pressure;
+	packet1.pressure_alt = packet_in.pressure_alt;
+	packet1.temperature = packet_in.temperature;
+	packet1.fields_updated = packet_in.fields_updated;
+	packet1.id = packet_in.id;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_hil_sensor_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.xacc , packet1.yacc , packet1.zacc , packet1.xgyro , packet1.ygyro , packet1.zgyro , packet1.xmag , packet1.ymag , packet1.zmag , packet1.abs_pressure , packet1.diff_pressure , packet1.pressure_alt , packet1.temperature , packet1.fields_updated , packet1.id));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_hil_sensor_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_hil_sensor_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_sim_state(Msgbench_Run &run)
+{
+	mavlink_sim_state_t packet_in = {
+		(float)17.0, (float)45.0, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, (float)241.0, (float)269.0, (float)297.0, (float)325.0, (float)353.0, (float)381.0, (float)409.0, (float)437.0, (float)465.0, (float)493.0, (float)521.0, (float)549.0, (float)577.0, (int32_t)963501832, (int32_t)963502040
+	};
+	mavlink_sim_state_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.q1 = packet_in.q1;
+	packet1.q2 = packet_in.q2;
+	packet1.q3 = packet_in.q3;
+	packet1.q4 = packet_in.q4;
+	packet1.roll = packet_in.roll;
+	packet1.pitch = packet_in.pitch;
+	packet1.yaw = packet_in.yaw;
+	packet1.xacc = packet_in.xacc;
+	packet1.yacc = packet_in.yacc;
+	packet1.zacc = packet_in.zacc;
+	packet1.xgyro = packet_in.xgyro;
+	packet1.ygyro = packet_in.ygyro;
+	packet1.zgyro = packet_in.zgyro;
+	packet1.lat = packet_in.lat;
+	packet1.lon = packet_in.lon;
+	packet1.alt = packet_in.alt;
+	packet1.std_dev_horz = packet_in.std_dev_horz;
+	packet1.std_dev_vert = packet_in.std_dev_vert;
+	packet1.vn = packet_in.vn;
+	packet1.ve = packet_in.ve;
+	packet1.vd = packet_in.vd;
+	packet1.lat_int = packet_in.lat_int;
+	packet1.lon_int = packet_in.lon_int;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_sim_state_pack(run.system_id, run.component_id, &run.message, packet1.q1 , packet1.q2 , packet1.q3 , packet1.q4 , packet1.roll , packet1.pitch , packet1.yaw , packet1.xacc , packet1.yacc , packet1.zacc , packet1.xgyro , packet1.ygyro , packet1.zgyro , packet1.lat , packet1.lon , packet1.alt , packet1.std_dev_horz , packet1.std_dev_vert , packet1.vn , packet1.ve , packet1.vd , packet1.lat_int , packet1.lon_int));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_sim_state_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_sim_state_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_radio_status(Msgbench_Run &run)
+{
+	mavlink_radio_status_t packet_in = {
+		(uint16_t)17235, (uint16_t)17339, (uint8_t)17, (uint8_t)84, (uint8_t)151, (uint8_t)218, (uint8_t)29
+	};
+	mavlink_radio_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.rxerrors = packet_in.rxerrors;
+	packet1.fixed = packet_in.fixed;
+	packet1.rssi = packet_in.rssi;
+	packet1.remrssi = packet_in.remrssi;
+	packet1.txbuf = packet_in.txbuf;
+	packet1.noise = packet_in.noise;
+	packet1.remnoise = packet_in.remnoise;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_radio_status_pack(run.system_id, run.component_id, &run.message, packet1.rssi , packet1.remrssi , packet1.txbuf , packet1.noise , packet1.remnoise , packet1.rxerrors , packet1.fixed));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_radio_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_radio_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_file_transfer_protocol(Msgbench_Run &run)
+{
+	mavlink_file_transfer_protocol_t packet_in = {
+		(uint8_t)5, (uint8_t)72, (uint8_t)139, { (uint8_t)206, (uint8_t)207, (uint8_t)208, (uint8_t)209, (uint8_t)210, (uint8_t)211, (uint8_t)212, (uint8_t)213, (uint8_t)214, (uint8_t)215, (uint8_t)216, (uint8_t)217, (uint8_t)218, (uint8_t)219, (uint8_t)220, (uint8_t)221, (uint8_t)222, (uint8_t)223, (uint8_t)224, (uint8_t)225, (uint8_t)226, (uint8_t)227, (uint8_t)228, (uint8_t)229, (uint8_t)230, (uint8_t)231, (uint8_t)232, (uint8_t)233, (uint8_t)234, (uint8_t)235, (uint8_t)236, (uint8_t)237, (uint8_t)238, (uint8_t)239, (uint8_t)240, (uint8_t)241, (uint8_t)242, (uint8_t)243, (uint8_t)244, (uint8_t)245, (uint8_t)246, (uint8_t)247, (uint8_t)248, (uint8_t)249, (uint8_t)250, (uint8_t)251, (uint8_t)252, (uint8_t)253, (uint8_t)254, (uint8_t)255, (uint8_t)0, (uint8_t)1, (uint8_t)2, (uint8_t)3, (uint8_t)4, (uint8_t)5, (uint8_t)6, (uint8_t)7, (uint8_t)8, (uint8_t)9, (uint8_t)10, (uint8_t)11, (uint8_t)12, (uint8_t)13, (uint8_t)14, (uint8_t)15, (uint8_t)16, (uint8_t)17, (uint8_t)18, (uint8_t)19, (uint8_t)20, (uint8_t)21, (uint8_t)22, (uint8_t)23, (uint8_t)24, (uint8_t)25, (uint8_t)26, (uint8_t)27, (uint8_t)28, (uint8_t)29, (uint8_t)30, (uint8_t)31, (uint8_t)32, (uint8_t)33, (uint8_t)34, (uint8_t)35, (uint8_t)36, (uint8_t)37, (uint8_t)38, (uint8_t)39, (uint8_t)40, (uint8_t)41, (uint8_t)42, (uint8_t)43, (uint8_t)44, (uint8_t)45, (uint8_t)46, (uint8_t)47, (uint8_t)48, (uint8_t)49, (uint8_t)50, (uint8_t)51, (uint8_t)52, (uint8_t)53, (uint8_t)54, (uint8_t)55, (uint8_t)56, (uint8_t)57, (uint8_t)58, (uint8_t)59, (uint8_t)60, (uint8_t)61, (uint8_t)62, (uint8_t)63, (uint8_t)64, (uint8_t)65, (uint8_t)66, (uint8_t)67, (uint8_t)68, (uint8_t)69, (uint8_t)70, (uint8_t)71, (uint8_t)72, (uint8_t)73, (uint8_t)74, (uint8_t)75, (uint8_t)76, (uint8_t)77, (uint8_t)78, (uint8_t)79, (uint8_t)80, (uint8_t)81, (uint8_t)82, (uint8_t)83, (uint8_t)84, (uint8_t)85, (uint8_t)86, (uint8_t)87, (uint8_t)88, (uint8_t)89, (uint8_t)90, (uint8_t)91, (uint8_t)92, (uint8_t)93, (uint8_t)94, (uint8_t)95, (uint8_t)96, (uint8_t)97, (uint8_t)98, (uint8_t)99, (uint8_t)100, (uint8_t)101, (uint8_t)102, (uint8_t)103, (uint8_t)104, (uint8_t)105, (uint8_t)106, (uint8_t)107, (uint8_t)108, (uint8_t)109, (uint8_t)110, (uint8_t)111, (uint8_t)112, (uint8_t)113, (uint8_t)114, (uint8_t)115, (uint8_t)116, (uint8_t)117, (uint8_t)118, (uint8_t)119, (uint8_t)120, (uint8_t)121, (uint8_t)122, (uint8_t)123, (uint8_t)124, (uint8_t)125, (uint8_t)126, (uint8_t)127, (uint8_t)128, (uint8_t)129, (uint8_t)130, (uint8_t)131, (uint8_t)132, (uint8_t)133, (uint8_t)134, (uint8_t)135, (uint8_t)136, (uint8_t)137, (uint8_t)138, (uint8_t)139, (uint8_t)140, (uint8_t)141, (uint8_t)142, (uint8_t)143, (uint8_t)144, (uint8_t)145, (uint8_t)146, (uint8_t)147, (uint8_t)148, (uint8_t)149, (uint8_t)150, (uint8_t)151, (uint8_t)152, (uint8_t)153, (uint8_t)154, (uint8_t)155, (uint8_t)156, (uint8_t)157, (uint8_t)158, (uint8_t)159, (uint8_t)160, (uint8_t)161, (uint8_t)162, (uint8_t)163, (uint8_t)164, (uint8_t)165, (uint8_t)166, (uint8_t)167, (uint8_t)168, (uint8_t)169, (uint8_t)170, (uint8_t)171, (uint8_t)172, (uint8_t)173, (uint8_t)174, (uint8_t)175, (uint8_t)176, (uint8_t)177, (uint8_t)178, (uint8_t)179, (uint8_t)180, (uint8_t)181, (uint8_t)182, (uint8_t)183, (uint8_t)184, (uint8_t)185, (uint8_t)186, (uint8_t)187, (uint8_t)188, (uint8_t)189, (uint8_t)190, (uint8_t)191, (uint8_t)192, (uint8_t)193, (uint8_t)194, (uint8_t)195, (uint8_t)196, (uint8_t)197, (uint8_t)198, (uint8_t)199, (uint8_t)200 }
+	};
+	mavlink_file_transfer_protocol_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.target_network = packet_in.target_network;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	mav_array_memcpy(packet1.payload, packet_in.payload, sizeof(uint8_t)*251);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_file_transfer_protocol_pack(run.system_id, run.component_id, &run.message, packet1.target_network , packet1.target_system , packet1.target_component , packet1.payload));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_file_transfer_protocol_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_file_transfer_protocol_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_timesync(Msgbench_Run &run)
+{
+	mavlink_timesync_t packet_in = {
+		(int64_t)93372036854775807LL, (int64_t)93372036854776311LL, (uint8_t)53, (uint8_t)120
+	};
+	mavlink_timesync_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.tc1 = packet_in.tc1;
+	packet1.ts1 = packet_in.ts1;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_timesync_pack(run.system_id, run.component_id, &run.message, packet1.tc1 , packet1.ts1 , packet1.target_system , packet1.target_component));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_timesync_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_timesync_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_camera_trigger(Msgbench_Run &run)
+{
+	mavlink_camera_trigger_t packet_in = {
+		(uint64_t)93372036854775807ULL, (uint32_t)963497880
+	};
+	mavlink_camera_trigger_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.seq = packet_in.seq;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_camera_trigger_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.seq));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_camera_trigger_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_camera_trigger_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_hil_gps(Msgbench_Run &run)
+{
+	mavlink_hil_gps_t packet_in = {
+		(uint64_t)93372036854775807ULL, (int32_t)963497880, (int32_t)963498088, (int32_t)963498296, (uint16_t)18275, (uint16_t)18379, (uint16_t)18483, (int16_t)18587, (int16_t)18691, (int16_t)18795, (uint16_t)18899, (uint8_t)235, (uint8_t)46, (uint8_t)113, (uint16_t)19159
+	};
+	mavlink_hil_gps_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.lat = packet_in.lat;
+	packet1.lon = packet_in.lon;
+	packet1.alt = packet_in.alt;
+	packet1.eph = packet_in.eph;
+	packet1.epv = packet_in.epv;
+	packet1.vel = packet_in.vel;
+	packet1.vn = packet_in.vn;
+	packet1.ve = packet_in.ve;
+	packet1.vd = packet_in.vd;
+	packet1.cog = packet_in.cog;
+	packet1.fix_type = packet_in.fix_type;
+	packet1.satellites_visible = packet_in.satellites_visible;
+	packet1.id = packet_in.id;
+	packet1.yaw = packet_in.yaw;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_hil_gps_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.fix_type , packet1.lat , packet1.lon , packet1.alt , packet1.eph , packet1.epv , packet1.vel , packet1.vn , packet1.ve , packet1.vd , packet1.cog , packet1.satellites_visible , packet1.id , packet1.yaw));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_hil_gps_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_hil_gps_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_hil_optical_flow(Msgbench_Run &run)
+{
+	mavlink_hil_optical_flow_t packet_in = {
+		(uint64_t)93372036854775807ULL, (uint32_t)963497880, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, (uint32_t)963499128, (float)269.0, (int16_t)19315, (uint8_t)3, (uint8_t)70
+	};
+	mavlink_hil_optical_flow_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.integration_time_us = packet_in.integration_time_us;
+	packet1.integrated_x = packet_in.integrated_x;
+	packet1.integrated_y = packet_in.integrated_y;
+	packet1.integrated_xgyro = packet_in.integrated_xgyro;
+	packet1.integrated_ygyro = packet_in.integrated_ygyro;
+	packet1.integrated_zgyro = packet_in.integrated_zgyro;
+	packet1.time_delta_distance_us = packet_in.time_delta_distance_us;
+	packet1.distance = packet_in.distance;
+	packet1.temperature = packet_in.temperature;
+	packet1.sensor_id = packet_in.sensor_id;
+	packet1.quality = packet_in.quality;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_hil_optical_flow_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.sensor_id , packet1.integration_time_us , packet1.integrated_x , packet1.integrated_y , packet1.integrated_xgyro , packet1.integrated_ygyro , packet1.integrated_zgyro , packet1.temperature , packet1.quality , packet1.time_delta_distance_us , packet1.distance));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_hil_optical_flow_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_hil_optical_flow_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_hil_state_quaternion(Msgbench_Run &run)
+{
+	mavlink_hil_state_quaternion_t packet_in = {
+		(uint64_t)93372036854775807ULL, { (float)73.0, (float)74.0, (float)75.0, (float)76.0 }, (float)185.0, (float)213.0, (float)241.0, (int32_t)963499336, (int32_t)963499544, (int32_t)963499752, (int16_t)19731, (int16_t)19835, (int16_t)19939, (uint16_t)20043, (uint16_t)20147, (int16_t)20251, (int16_t)20355, (int16_t)20459
+	};
+	mavlink_hil_state_quaternion_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.rollspeed = packet_in.rollspeed;
+	packet1.pitchspeed = packet_in.pitchspeed;
+	packet1.yawspeed = packet_in.yawspeed;
+	packet1.lat = packet_in.lat;
+	packet1.lon = packet_in.lon;
+	packet1.alt = packet_in.alt;
+	packet1.vx = packet_in.vx;
+	packet1.vy = packet_in.vy;
+	packet1.vz = packet_in.vz;
+	packet1.ind_airspeed = packet_in.ind_airspeed;
+	packet1.true_airspeed = packet_in.true_airspeed;
+	packet1.xacc = packet_in.xacc;
+	packet1.yacc = packet_in.yacc;
+	packet1.zacc = packet_in.zacc;
+	mav_array_memcpy(packet1.attitude_quaternion, packet_in.attitude_quaternion, sizeof(float)*4);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_hil_state_quaternion_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.attitude_quaternion , packet1.rollspeed , packet1.pitchspeed , packet1.yawspeed , packet1.lat , packet1.lon , packet1.alt , packet1.vx , packet1.vy , packet1.vz , packet1.ind_airspeed , packet1.true_airspeed , packet1.xacc , packet1.yacc , packet1.zacc));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_hil_state_quaternion_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_hil_state_quaternion_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_scaled_imu2(Msgbench_Run &run)
+{
+	mavlink_scaled_imu2_t packet_in = {
+		(uint32_t)963497464, (int16_t)17443, (int16_t)17547, (int16_t)17651, (int16_t)17755, (int16_t)17859, (int16_t)17963, (int16_t)18067, (int16_t)18171, (int16_t)18275, (int16_t)18379
+	};
+	mavlink_scaled_imu2_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.xacc = packet_in.xacc;
+	packet1.yacc = packet_in.yacc;
+	packet1.zacc = packet_in.zacc;
+	packet1.xgyro = packet_in.xgyro;
+	packet1.ygyro = packet_in.ygyro;
+	packet1.zgyro = packet_in.zgyro;
+	packet1.xmag = packet_in.xmag;
+	packet1.ymag = packet_in.ymag;
+	packet1.zmag = packet_in.zmag;
+	packet1.temperature = packet_in.temperature;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_scaled_imu2_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.xacc , packet1.yacc , packet1.zacc , packet1.xgyro , packet1.ygyro , packet1.zgyro , packet1.xmag , packet1.ymag , packet1.zmag , packet1.temperature));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_scaled_imu2_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_scaled_imu2_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_log_request_list(Msgbench_Run &run)
+{
+	mavlink_log_request_list_t packet_in = {
+		(uint16_t)17235, (uint16_t)17339, (uint8_t)17, (uint8_t)84
+	};
+	mavlink_log_request_list_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.start = packet_in.start;
+	packet1.end = packet_in.end;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_log_request_list_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.start , packet1.end));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_log_request_list_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_log_request_list_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_log_entry(Msgbench_Run &run)
+{
+	mavlink_log_entry_t packet_in = {
+		(uint32_t)963497464, (uint32_t)963497672, (uint16_t)17651, (uint16_t)17755, (uint16_t)17859
+	};
+	mavlink_log_entry_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_utc = packet_in.time_utc;
+	packet1.size = packet_in.size;
+	packet1.id = packet_in.id;
+	packet1.num_logs = packet_in.num_logs;
+	packet1.last_log_num = packet_in.last_log_num;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_log_entry_pack(run.system_id, run.component_id, &run.message, packet1.id , packet1.num_logs , packet1.last_log_num , packet1.time_utc , packet1.size));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_log_entry_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_log_entry_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_log_request_data(Msgbench_Run &run)
+{
+	mavlink_log_request_data_t packet_in = {
+		(uint32_t)963497464, (uint32_t)963497672, (uint16_t)17651, (uint8_t)163, (uint8_t)230
+	};
+	mavlink_log_request_data_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.ofs = packet_in.ofs;
+	packet1.count = packet_in.count;
+	packet1.id = packet_in.id;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_log_request_data_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.id , packet1.ofs , packet1.count));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_log_request_data_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_log_request_data_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_log_data(Msgbench_Run &run)
+{
+	mavlink_log_data_t packet_in = {
+		(uint32_t)963497464, (uint16_t)17443, (uint8_t)151, { (uint8_t)218, (uint8_t)219, (uint8_t)220, (uint8_t)221, (uint8_t)222, (uint8_t)223, (uint8_t)224, (uint8_t)225, (uint8_t)226, (uint8_t)227, (uint8_t)228, (uint8_t)229, (uint8_t)230, (uint8_t)231, (uint8_t)232, (uint8_t)233, (uint8_t)234, (uint8_t)235, (uint8_t)236, (uint8_t)237, (uint8_t)238, (uint8_t)239, (uint8_t)240, (uint8_t)241, (uint8_t)242, (uint8_t)243, (uint8_t)244, (uint8_t)245, (uint8_t)246, (uint8_t)247, (uint8_t)248, (uint8_t)249, (uint8_t)250, (uint8_t)251, (uint8_t)252, (uint8_t)253, (uint8_t)254, (uint8_t)255, (uint8_t)0, (uint8_t)1, (uint8_t)2, (uint8_t)3, (uint8_t)4, (uint8_t)5, (uint8_t)6, (uint8_t)7, (uint8_t)8, (uint8_t)9, (uint8_t)10, (uint8_t)11, (uint8_t)12, (uint8_t)13, (uint8_t)14, (uint8_t)15, (uint8_t)16, (uint8_t)17, (uint8_t)18, (uint8_t)19, (uint8_t)20, (uint8_t)21, (uint8_t)22, (uint8_t)23, (uint8_t)24, (uint8_t)25, (uint8_t)26, (uint8_t)27, (uint8_t)28, (uint8_t)29, (uint8_t)30, (uint8_t)31, (uint8_t)32, (uint8_t)33, (uint8_t)34, (uint8_t)35, (uint8_t)36, (uint8_t)37, (uint8_t)38, (uint8_t)39, (uint8_t)40, (uint8_t)41, (uint8_t)42, (uint8_t)43, (uint8_t)44, (uint8_t)45, (uint8_t)46, (uint8_t)47, (uint8_t)48, (uint8_t)49, (uint8_t)50, (uint8_t)51 }
+	};
+	mavlink_log_data_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.ofs = packet_in.ofs;
+	packet1.id = packet_in.id;
+	packet1.count = packet_in.count;
+	mav_array_memcpy(packet1.data, packet_in.data, sizeof(uint8_t)*90);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_log_data_pack(run.system_id, run.component_id, &run.message, packet1.id , packet1.ofs , packet1.count , packet1.data));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_log_data_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_log_data_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_log_erase(Msgbench_Run &run)
+{
+	mavlink_log_erase_t packet_in = {
+		(uint8_t)5, (uint8_t)72
+	};
+	mavlink_log_erase_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_log_erase_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_log_erase_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_log_erase_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_log_request_end(Msgbench_Run &run)
+{
+	mavlink_log_request_end_t packet_in = {
+		(uint8_t)5, (uint8_t)72
+	};
+	mavlink_log_request_end_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_log_request_end_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_log_request_end_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_log_request_end_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_gps_inject_data(Msgbench_Run &run)
+{
+	mavlink_gps_inject_data_t packet_in = {
+		(uint8_t)5, (uint8_t)72, (uint8_t)139, { (uint8_t)206, (uint8_t)207, (uint8_t)208, (uint8_t)209, (uint8_t)210, (uint8_t)211, (uint8_t)212, (uint8_t)213, (uint8_t)214, (uint8_t)215, (uint8_t)216, (uint8_t)217, (uint8_t)218, (uint8_t)219, (uint8_t)220, (uint8_t)221, (uint8_t)222, (uint8_t)223, (uint8_t)224, (uint8_t)225, (uint8_t)226, (uint8_t)227, (uint8_t)228, (uint8_t)229, (uint8_t)230, (uint8_t)231, (uint8_t)232, (uint8_t)233, (uint8_t)234, (uint8_t)235, (uint8_t)236, (uint8_t)237, (uint8_t)238, (uint8_t)239, (uint8_t)240, (uint8_t)241, (uint8_t)242, (uint8_t)243, (uint8_t)244, (uint8_t)245, (uint8_t)246, (uint8_t)247, (uint8_t)248, (uint8_t)249, (uint8_t)250, (uint8_t)251, (uint8_t)252, (uint8_t)253, (uint8_t)254, (uint8_t)255, (uint8_t)0, (uint8_t)1, (uint8_t)2, (uint8_t)3, (uint8_t)4, (uint8_t)5, (uint8_t)6, (uint8_t)7, (uint8_t)8, (uint8_t)9, (uint8_t)10, (uint8_t)11, (uint8_t)12, (uint8_t)13, (uint8_t)14, (uint8_t)15, (uint8_t)16, (uint8_t)17, (uint8_t)18, (uint8_t)19, (uint8_t)20, (uint8_t)21, (uint8_t)22, (uint8_t)23, (uint8_t)24, (uint8_t)25, (uint8_t)26, (uint8_t)27, (uint8_t)28, (uint8_t)29, (uint8_t)30, (uint8_t)31, (uint8_t)32, (uint8_t)33, (uint8_t)34, (uint8_t)35, (uint8_t)36, (uint8_t)37, (uint8_t)38, (uint8_t)39, (uint8_t)40, (uint8_t)41, (uint8_t)42, (uint8_t)43, (uint8_t)44, (uint8_t)45, (uint8_t)46, (uint8_t)47, (uint8_t)48, (uint8_t)49, (uint8_t)50, (uint8_t)51, (uint8_t)52, (uint8_t)53, (uint8_t)54, (uint8_t)55, (uint8_t)56, (uint8_t)57, (uint8_t)58, (uint8_t)59 }
+	};
+	mavlink_gps_inject_data_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.len = packet_in.len;
+	mav_array_memcpy(packet1.data, packet_in.data, sizeof(uint8_t)*110);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_gps_inject_data_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.len , packet1.data));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_gps_inject_data_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_gps_inject_data_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_gps2_raw(Msgbench_Run &run)
+{
+	mavlink_gps2_raw_t packet_in = {
+		(uint64_t)93372036854775807ULL, (int32_t)963497880, (int32_t)963498088, (int32_t)963498296, (uint32_t)963498504, (uint16_t)18483, (uint16_t)18587, (uint16_t)18691, (uint16_t)18795, (uint8_t)101, (uint8_t)168, (uint8_t)235, (uint16_t)19055, (int32_t)963499388, (uint32_t)963499596, (uint32_t)963499804, (uint32_t)963500012, (uint32_t)963500220
+	};
+	mavlink_gps2_raw_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.lat = packet_in.lat;
+	packet1.lon = packet_in.lon;
+	packet1.alt = packet_in.alt;
+	packet1.dgps_age = packet_in.dgps_age;
+	packet1.eph = packet_in.eph;
+	packet1.epv = packet_in.epv;
+	packet1.vel = packet_in.vel;
+	packet1.cog = packet_in.cog;
+	packet1.fix_type = packet_in.fix_type;
+	packet1.satellites_visible = packet_in.satellites_visible;
+	packet1.dgps_numch = packet_in.dgps_numch;
+	packet1.yaw = packet_in.yaw;
+	packet1.alt_ellipsoid = packet_in.alt_ellipsoid;
+	packet1.h_acc = packet_in.h_acc;
+	packet1.v_acc = packet_in.v_acc;
+	packet1.vel_acc = packet_in.vel_acc;
+	packet1.hdg_acc = packet_in.hdg_acc;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_gps2_raw_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.fix_type , packet1.lat , packet1.lon , packet1.alt , packet1.eph , packet1.epv , packet1.vel , packet1.cog , packet1.satellites_visible , packet1.dgps_numch , packet1.dgps_age , packet1.yaw , packet1.alt_ellipsoid , packet1.h_acc , packet1.v_acc , packet1.vel_acc , packet1.hdg_acc));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_gps2_raw_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_gps2_raw_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_power_status(Msgbench_Run &run)
+{
+	mavlink_power_status_t packet_in = {
+		(uint16_t)17235, (uint16_t)17339, (uint16_t)17443
+	};
+	mavlink_power_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.Vcc = packet_in.Vcc;
+	packet1.Vservo = packet_in.Vservo;
+	packet1.flags = packet_in.flags;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_power_status_pack(run.system_id, run.component_id, &run.message, packet1.Vcc , packet1.Vservo , packet1.flags));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_power_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_power_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_serial_control(Msgbench_Run &run)
+{
+	mavlink_serial_control_t packet_in = {
+		(uint32_t)963497464, (uint16_t)17443, (uint8_t)151, (uint8_t)218, (uint8_t)29, { (uint8_t)96, (uint8_t)97, (uint8_t)98, (uint8_t)99, (uint8_t)100, (uint8_t)101, (uint8_t)102, (uint8_t)103, (uint8_t)104, (uint8_t)105, (uint8_t)106, (uint8_t)107, (uint8_t)108, (uint8_t)109, (uint8_t)110, (uint8_t)111, (uint8_t)112, (uint8_t)113, (uint8_t)114, (uint8_t)115, (uint8_t)116, (uint8_t)117, (uint8_t)118, (uint8_t)119, (uint8_t)120, (uint8_t)121, (uint8_t)122, (uint8_t)123, (uint8_t)124, (uint8_t)125, (uint8_t)126, (uint8_t)127, (uint8_t)128, (uint8_t)129, (uint8_t)130, (uint8_t)131, (uint8_t)132, (uint8_t)133, (uint8_t)134, (uint8_t)135, (uint8_t)136, (uint8_t)137, (uint8_t)138, (uint8_t)139, (uint8_t)140, (uint8_t)141, (uint8_t)142, (uint8_t)143, (uint8_t)144, (uint8_t)145, (uint8_t)146, (uint8_t)147, (uint8_t)148, (uint8_t)149, (uint8_t)150, (uint8_t)151, (uint8_t)152, (uint8_t)153, (uint8_t)154, (uint8_t)155, (uint8_t)156, (uint8_t)157, (uint8_t)158, (uint8_t)159, (uint8_t)160, (uint8_t)161, (uint8_t)162, (uint8_t)163, (uint8_t)164, (uint8_t)165 }, (uint8_t)178, (uint8_t)245
+	};
+	mavlink_serial_control_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.baudrate = packet_in.baudrate;
+	packet1.timeout = packet_in.timeout;
+	packet1.device = packet_in.device;
+	packet1.flags = packet_in.flags;
+	packet1.count = packet_in.count;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	mav_array_memcpy(packet1.data, packet_in.data, sizeof(uint8_t)*70);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_serial_control_pack(run.system_id, run.component_id, &run.message, packet1.device , packet1.flags , packet1.timeout , packet1.baudrate , packet1.count , packet1.data , packet1.target_system , packet1.target_component));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_serial_control_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_serial_control_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_gps_rtk(Msgbench_Run &run)
+{
+	mavlink_gps_rtk_t packet_in = {
+		(uint32_t)963497464, (uint32_t)963497672, (int32_t)963497880, (int32_t)963498088, (int32_t)963498296, (uint32_t)963498504, (int32_t)963498712, (uint16_t)18691, (uint8_t)223, (uint8_t)34, (uint8_t)101, (uint8_t)168, (uint8_t)235
+	};
+	mavlink_gps_rtk_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_last_baseline_ms = packet_in.time_last_baseline_ms;
+	packet1.tow = packet_in.tow;
+	packet1.baseline_a_mm = packet_in.baseline_a_mm;
+	packet1.baseline_b_mm = packet_in.baseline_b_mm;
+	packet1.baseline_c_mm = packet_in.baseline_c_mm;
+	packet1.accuracy = packet_in.accuracy;
+	packet1.iar_num_hypotheses = packet_in.iar_num_hypotheses;
+	packet1.wn = packet_in.wn;
+	packet1.rtk_receiver_id = packet_in.rtk_receiver_id;
+	packet1.rtk_health = packet_in.rtk_health;
+	packet1.rtk_rate = packet_in.rtk_rate;
+	packet1.nsats = packet_in.nsats;
+	packet1.baseline_coords_type = packet_in.baseline_coords_type;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_gps_rtk_pack(run.system_id, run.component_id, &run.message, packet1.time_last_baseline_ms , packet1.rtk_receiver_id , packet1.wn , packet1.tow , packet1.rtk_health , packet1.rtk_rate , packet1.nsats , packet1.baseline_coords_type , packet1.baseline_a_mm , packet1.baseline_b_mm , packet1.baseline_c_mm , packet1.accuracy , packet1.iar_num_hypotheses));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_gps_rtk_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_gps_rtk_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_gps2_rtk(Msgbench_Run &run)
+{
+	mavlink_gps2_rtk_t packet_in = {
+		(uint32_t)963497464, (uint32_t)963497672, (int32_t)963497880, (int32_t)963498088, (int32_t)963498296, (uint32_t)963498504, (int32_t)963498712, (uint16_t)18691, (uint8_t)223, (uint8_t)34, (uint8_t)101, (uint8_t)168, (uint8_t)235
+	};
+	mavlink_gps2_rtk_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_last_baseline_ms = packet_in.time_last_baseline_ms;
+	packet1.tow = packet_in.tow;
+	packet1.baseline_a_mm = packet_in.baseline_a_mm;
+	packet1.baseline_b_mm = packet_in.baseline_b_mm;
+	packet1.baseline_c_mm = packet_in.baseline_c_mm;
+	packet1.accuracy = packet_in.accuracy;
+	packet1.iar_num_hypotheses = packet_in.iar_num_hypotheses;
+	packet1.wn = packet_in.wn;
+	packet1.rtk_receiver_id = packet_in.rtk_receiver_id;
+	packet1.rtk_health = packet_in.rtk_health;
+	packet1.rtk_rate = packet_in.rtk_rate;
+	packet1.nsats = packet_in.nsats;
+	packet1.baseline_coords_type = packet_in.baseline_coords_type;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_gps2_rtk_pack(run.system_id, run.component_id, &run.message, packet1.time_last_baseline_ms , packet1.rtk_receiver_id , packet1.wn , packet1.tow , packet1.rtk_health , packet1.rtk_rate , packet1.nsats , packet1.baseline_coords_type , packet1.baseline_a_mm , packet1.baseline_b_mm , packet1.baseline_c_mm , packet1.accuracy , packet1.iar_num_hypotheses));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_gps2_rtk_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_gps2_rtk_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_scaled_imu3(Msgbench_Run &run)
+{
+	mavlink_scaled_imu3_t packet_in = {
+		(uint32_t)963497464, (int16_t)17443, (int16_t)17547, (int16_t)17651, (int16_t)17755, (int16_t)17859, (int16_t)17963, (int16_t)18067, (int16_t)18171, (int16_t)18275, (int16_t)18379
+	};
+	mavlink_scaled_imu3_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.xacc = packet_in.xacc;
+	packet1.yacc = packet_in.yacc;
+	packet1.zacc = packet_in.zacc;
+	packet1.xgyro = packet_in.xgyro;
+	packet1.ygyro = packet_in.ygyro;
+	packet1.zgyro = packet_in.zgyro;
+	packet1.xmag = packet_in.xmag;
+	packet1.ymag = packet_in.ymag;
+	packet1.zmag = packet_in.zmag;
+	packet1.temperature = packet_in.temperature;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_scaled_imu3_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.xacc , packet1.yacc , packet1.zacc , packet1.xgyro , packet1.ygyro , packet1.zgyro , packet1.xmag , packet1.ymag , packet1.zmag , packet1.temperature));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_scaled_imu3_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_scaled_imu3_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_data_transmission_handshake(Msgbench_Run &run)
+{
+	mavlink_data_transmission_handshake_t packet_in = {
+		(uint32_t)963497464, (uint16_t)17443, (uint16_t)17547, (uint16_t)17651, (uint8_t)163, (uint8_t)230, (uint8_t)41
+	};
+	mavlink_data_transmission_handshake_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.size = packet_in.size;
+	packet1.width = packet_in.width;
+	packet1.height = packet_in.height;
+	packet1.packets = packet_in.packets;
+	packet1.type = packet_in.type;
+	packet1.payload = packet_in.payload;
+	packet1.jpg_quality = packet_in.jpg_quality;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_data_transmission_handshake_pack(run.system_id, run.component_id, &run.message, packet1.type , packet1.size , packet1.width , packet1.height , packet1.packets , packet1.payload , packet1.jpg_quality));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_data_transmission_handshake_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_data_transmission_handshake_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_encapsulated_data(Msgbench_Run &run)
+{
+	mavlink_encapsulated_data_t packet_in = {
+		(uint16_t)17235, { (uint8_t)139, (uint8_t)140, (uint8_t)141, (uint8_t)142, (uint8_t)143, (uint8_t)144, (uint8_t)145, (uint8_t)146, (uint8_t)147, (uint8_t)148, (uint8_t)149, (uint8_t)150, (uint8_t)151, (uint8_t)152, (uint8_t)153, (uint8_t)154, (uint8_t)155, (uint8_t)156, (uint8_t)157, (uint8_t)158, (uint8_t)159, (uint8_t)160, (uint8_t)161, (uint8_t)162, (uint8_t)163, (uint8_t)164, (uint8_t)165, (uint8_t)166, (uint8_t)167, (uint8_t)168, (uint8_t)169, (uint8_t)170, (uint8_t)171, (uint8_t)172, (uint8_t)173, (uint8_t)174, (uint8_t)175, (uint8_t)176, (uint8_t)177, (uint8_t)178, (uint8_t)179, (uint8_t)180, (uint8_t)181, (uint8_t)182, (uint8_t)183, (uint8_t)184, (uint8_t)185, (uint8_t)186, (uint8_t)187, (uint8_t)188, (uint8_t)189, (uint8_t)190, (uint8_t)191, (uint8_t)192, (uint8_t)193, (uint8_t)194, (uint8_t)195, (uint8_t)196, (uint8_t)197, (uint8_t)198, (uint8_t)199, (uint8_t)200, (uint8_t)201, (uint8_t)202, (uint8_t)203, (uint8_t)204, (uint8_t)205, (uint8_t)206, (uint8_t)207, (uint8_t)208, (uint8_t)209, (uint8_t)210, (uint8_t)211, (uint8_t)212, (uint8_t)213, (uint8_t)214, (uint8_t)215, (uint8_t)216, (uint8_t)217, (uint8_t)218, (uint8_t)219, (uint8_t)220, (uint8_t)221, (uint8_t)222, (uint8_t)223, (uint8_t)224, (uint8_t)225, (uint8_t)226, (uint8_t)227, (uint8_t)228, (uint8_t)229, (uint8_t)230, (uint8_t)231, (uint8_t)232, (uint8_t)233, (uint8_t)234, (uint8_t)235, (uint8_t)236, (uint8_t)237, (uint8_t)238, (uint8_t)239, (uint8_t)240, (uint8_t)241, (uint8_t)242, (uint8_t)243, (uint8_t)244, (uint8_t)245, (uint8_t)246, (uint8_t)247, (uint8_t)248, (uint8_t)249, (uint8_t)250, (uint8_t)251, (uint8_t)252, (uint8_t)253, (uint8_t)254, (uint8_t)255, (uint8_t)0, (uint8_t)1, (uint8_t)2, (uint8_t)3, (uint8_t)4, (uint8_t)5, (uint8_t)6, (uint8_t)7, (uint8_t)8, (uint8_t)9, (uint8_t)10, (uint8_t)11, (uint8_t)12, (uint8_t)13, (uint8_t)14, (uint8_t)15, (uint8_t)16, (uint8_t)17, (uint8_t)18, (uint8_t)19, (uint8_t)20, (uint8_t)21, (uint8_t)22, (uint8_t)23, (uint8_t)24, (uint8_t)25, (uint8_t)26, (uint8_t)27, (uint8_t)28, (uint8_t)29, (uint8_t)30, (uint8_t)31, (uint8_t)32, (uint8_t)33, (uint8_t)34, (uint8_t)35, (uint8_t)36, (uint8_t)37, (uint8_t)38, (uint8_t)39, (uint8_t)40, (uint8_t)41, (uint8_t)42, (uint8_t)43, (uint8_t)44, (uint8_t)45, (uint8_t)46, (uint8_t)47, (uint8_t)48, (uint8_t)49, (uint8_t)50, (uint8_t)51, (uint8_t)52, (uint8_t)53, (uint8_t)54, (uint8_t)55, (uint8_t)56, (uint8_t)57, (uint8_t)58, (uint8_t)59, (uint8_t)60, (uint8_t)61, (uint8_t)62, (uint8_t)63, (uint8_t)64, (uint8_t)65, (uint8_t)66, (uint8_t)67, (uint8_t)68, (uint8_t)69, (uint8_t)70, (uint8_t)71, (uint8_t)72, (uint8_t)73, (uint8_t)74, (uint8_t)75, (uint8_t)76, (uint8_t)77, (uint8_t)78, (uint8_t)79, (uint8_t)80, (uint8_t)81, (uint8_t)82, (uint8_t)83, (uint8_t)84, (uint8_t)85, (uint8_t)86, (uint8_t)87, (uint8_t)88, (uint8_t)89, (uint8_t)90, (uint8_t)91, (uint8_t)92, (uint8_t)93, (uint8_t)94, (uint8_t)95, (uint8_t)96, (uint8_t)97, (uint8_t)98, (uint8_t)99, (uint8_t)100, (uint8_t)101, (uint8_t)102, (uint8_t)103, (uint8_t)104, (uint8_t)105, (uint8_t)106, (uint8_t)107, (uint8_t)108, (uint8_t)109, (uint8_t)110, (uint8_t)111, (uint8_t)112, (uint8_t)113, (uint8_t)114, (uint8_t)115, (uint8_t)116, (uint8_t)117, (uint8_t)118, (uint8_t)119, (uint8_t)120, (uint8_t)121, (uint8_t)122, (uint8_t)123, (uint8_t)124, (uint8_t)125, (uint8_t)126, (uint8_t)127, (uint8_t)128, (uint8_t)129, (uint8_t)130, (uint8_t)131, (uint8_t)132, (uint8_t)133, (uint8_t)134, (uint8_t)135 }
+	};
+	mavlink_encapsulated_data_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.seqnr = packet_in.seqnr;
+	mav_array_memcpy(packet1.data, packet_in.data, sizeof(uint8_t)*253);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_encapsulated_data_pack(run.system_id, run.component_id, &run.message, packet1.seqnr , packet1.data));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_encapsulated_data_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_encapsulated_data_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_distance_sensor(Msgbench_Run &run)
+{
+	mavlink_distance_sensor_t packet_in = {
+		(uint32_t)963497464, (uint16_t)17443, (uint16_t)17547, (uint16_t)17651, (uint8_t)163, (uint8_t)230, (uint8_t)41, (uint8_t)108, (float)115.0, (float)143.0, { (float)171.0, (float)172.0, (float)173.0, (float)174.0 }, (uint8_t)247
+	};
+	mavlink_distance_sensor_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.min_distance = packet_in.min_distance;
+	packet1.max_distance = packet_in.max_distance;
+	packet1.current_distance = packet_in.current_distance;
+	packet1.type = packet_in.type;
+	packet1.id = packet_in.id;
+	packet1.orientation = packet_in.orientation;
+	packet1.covariance = packet_in.covariance;
+	packet1.horizontal_fov = packet_in.horizontal_fov;
+	packet1.vertical_fov = packet_in.vertical_fov;
+	packet1.signal_quality = packet_in.signal_quality;
+	mav_array_memcpy(packet1.quaternion, packet_in.quaternion, sizeof(float)*4);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_distance_sensor_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.min_distance , packet1.max_distance , packet1.current_distance , packet1.type , packet1.id , packet1.orientation , packet1.covariance , packet1.horizontal_fov , packet1.vertical_fov , packet1.quaternion , packet1.signal_quality));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_distance_sensor_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_distance_sensor_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_terrain_request(Msgbench_Run &run)
+{
+	mavlink_terrain_request_t packet_in = {
+		(uint64_t)93372036854775807ULL, (int32_t)963497880, (int32_t)963498088, (uint16_t)18067
+	};
+	mavlink_terrain_request_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.mask = packet_in.mask;
+	packet1.lat = packet_in.lat;
+	packet1.lon = packet_in.lon;
+	packet1.grid_spacing = packet_in.grid_spacing;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_terrain_request_pack(run.system_id, run.component_id, &run.message, packet1.lat , packet1.lon , packet1.grid_spacing , packet1.mask));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_terrain_request_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_terrain_request_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_terrain_data(Msgbench_Run &run)
+{
+	mavlink_terrain_data_t packet_in = {
+		(int32_t)963497464, (int32_t)963497672, (uint16_t)17651, { (int16_t)17755, (int16_t)17756, (int16_t)17757, (int16_t)17758, (int16_t)17759, (int16_t)17760, (int16_t)17761, (int16_t)17762, (int16_t)17763, (int16_t)17764, (int16_t)17765, (int16_t)17766, (int16_t)17767, (int16_t)17768, (int16_t)17769, (int16_t)17770 }, (uint8_t)3
+	};
+	mavlink_terrain_data_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.lat = packet_in.lat;
+	packet1.lon = packet_in.lon;
+	packet1.grid_spacing = packet_in.grid_spacing;
+	packet1.gridbit = packet_in.gridbit;
+	mav_array_memcpy(packet1.data, packet_in.data, sizeof(int16_t)*16);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_terrain_data_pack(run.system_id, run.component_id, &run.message, packet1.lat , packet1.lon , packet1.grid_spacing , packet1.gridbit , packet1.data));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_terrain_data_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_terrain_data_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_terrain_check(Msgbench_Run &run)
+{
+	mavlink_terrain_check_t packet_in = {
+		(int32_t)963497464, (int32_t)963497672
+	};
+	mavlink_terrain_check_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.lat = packet_in.lat;
+	packet1.lon = packet_in.lon;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_terrain_check_pack(run.system_id, run.component_id, &run.message, packet1.lat , packet1.lon));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_terrain_check_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_terrain_check_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_terrain_report(Msgbench_Run &run)
+{
+	mavlink_terrain_report_t packet_in = {
+		(int32_t)963497464, (int32_t)963497672, (float)73.0, (float)101.0, (uint16_t)18067, (uint16_t)18171, (uint16_t)18275
+	};
+	mavlink_terrain_report_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.lat = packet_in.lat;
+	packet1.lon = packet_in.lon;
+	packet1.terrain_height = packet_in.terrain_height;
+	packet1.current_height = packet_in.current_height;
+	packet1.spacing = packet_in.spacing;
+	packet1.pending = packet_in.pending;
+	packet1.loaded = packet_in.loaded;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_terrain_report_pack(run.system_id, run.component_id, &run.message, packet1.lat , packet1.lon , packet1.spacing , packet1.terrain_height , packet1.current_height , packet1.pending , packet1.loaded));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_terrain_report_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_terrain_report_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_scaled_pressure2(Msgbench_Run &run)
+{
+	mavlink_scaled_pressure2_t packet_in = {
+		(uint32_t)963497464, (float)45.0, (float)73.0, (int16_t)17859, (int16_t)17963
+	};
+	mavlink_scaled_pressure2_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.press_abs = packet_in.press_abs;
+	packet1.press_diff = packet_in.press_diff;
+	packet1.temperature = packet_in.temperature;
+	packet1.temperature_press_diff = packet_in.temperature_press_diff;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_scaled_pressure2_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.press_abs , packet1.press_diff , packet1.temperature , packet1.temperature_press_diff));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_scaled_pressure2_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_scaled_pressure2_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_att_pos_mocap(Msgbench_Run &run)
+{
+	mavlink_att_pos_mocap_t packet_in = {
+		(uint64_t)93372036854775807ULL, { (float)73.0, (float)74.0, (float)75.0, (float)76.0 }, (float)185.0, (float)213.0, (float)241.0, { (float)269.0, (float)270.0, (float)271.0, (float)272.0, (float)273.0, (float)274.0, (float)275.0, (float)276.0, (float)277.0, (float)278.0, (float)279.0, (float)280.0, (float)281.0, (float)282.0, (float)283.0, (float)284.0, (float)285.0, (float)286.0, (float)287.0, (float)288.0, (float)289.0 }
+	};
+	mavlink_att_pos_mocap_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.x = packet_in.x;
+	packet1.y = packet_in.y;
+	packet1.z = packet_in.z;
+	mav_array_memcpy(packet1.q, packet_in.q, sizeof(float)*4);
+	mav_array_memcpy(packet1.covariance, packet_in.covariance, sizeof(float)*21);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_att_pos_mocap_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.q , packet1.x , packet1.y , packet1.z , packet1.covariance));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_att_pos_mocap_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_att_pos_mocap_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_set_actuator_control_target(Msgbench_Run &run)
+{
+	mavlink_set_actuator_control_target_t packet_in = {
+		(uint64_t)93372036854775807ULL, { (float)73.0, (float)74.0, (float)75.0, (float)76.0, (float)77.0, (float)78.0, (float)79.0, (float)80.0 }, (uint8_t)125, (uint8_t)192, (uint8_t)3
+	};
+	mavlink_set_actuator_control_target_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.group_mlx = packet_in.group_mlx;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	mav_array_memcpy(packet1.controls, packet_in.controls, sizeof(float)*8);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_set_actuator_control_target_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.group_mlx , packet1.target_system , packet1.target_component , packet1.controls));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_set_actuator_control_target_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_set_actuator_control_target_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_actuator_control_target(Msgbench_Run &run)
+{
+	mavlink_actuator_control_target_t packet_in = {
+		(uint64_t)93372036854775807ULL, { (float)73.0, (float)74.0, (float)75.0, (float)76.0, (float)77.0, (float)78.0, (float)79.0, (float)80.0 }, (uint8_t)125
+	};
+	mavlink_actuator_control_target_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.group_mlx = packet_in.group_mlx;
+	mav_array_memcpy(packet1.controls, packet_in.controls, sizeof(float)*8);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_actuator_control_target_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.group_mlx , packet1.controls));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_actuator_control_target_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_actuator_control_target_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_altitude(Msgbench_Run &run)
+{
+	mavlink_altitude_t packet_in = {
+		(uint64_t)93372036854775807ULL, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0
+	};
+	mavlink_altitude_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.altitude_monotonic = packet_in.altitude_monotonic;
+	packet1.altitude_amsl = packet_in.altitude_amsl;
+	packet1.altitude_local = packet_in.altitude_local;
+	packet1.altitude_relative = packet_in.altitude_relative;
+	packet1.altitude_terrain = packet_in.altitude_terrain;
+	packet1.bottom_clearance = packet_in.bottom_clearance;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_altitude_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.altitude_monotonic , packet1.altitude_amsl , packet1.altitude_local , packet1.altitude_relative , packet1.altitude_terrain , packet1.bottom_clearance));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_altitude_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_altitude_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_resource_request(Msgbench_Run &run)
+{
+	mavlink_resource_request_t packet_in = {
+		(uint8_t)5, (uint8_t)72, { (uint8_t)139, (uint8_t)140, (uint8_t)141, (uint8_t)142, (uint8_t)143, (uint8_t)144, (uint8_t)145, (uint8_t)146, (uint8_t)147, (uint8_t)148, (uint8_t)149, (uint8_t)150, (uint8_t)151, (uint8_t)152, (uint8_t)153, (uint8_t)154, (uint8_t)155, (uint8_t)156, (uint8_t)157, (uint8_t)158, (uint8_t)159, (uint8_t)160, (uint8_t)161, (uint8_t)162, (uint8_t)163, (uint8_t)164, (uint8_t)165, (uint8_t)166, (uint8_t)167, (uint8_t)168, (uint8_t)169, (uint8_t)170, (uint8_t)171, (uint8_t)172, (uint8_t)173, (uint8_t)174, (uint8_t)175, (uint8_t)176, (uint8_t)177, (uint8_t)178, (uint8_t)179, (uint8_t)180, (uint8_t)181, (uint8_t)182, (uint8_t)183, (uint8_t)184, (uint8_t)185, (uint8_t)186, (uint8_t)187, (uint8_t)188, (uint8_t)189, (uint8_t)190, (uint8_t)191, (uint8_t)192, (uint8_t)193, (uint8_t)194, (uint8_t)195, (uint8_t)196, (uint8_t)197, (uint8_t)198, (uint8_t)199, (uint8_t)200, (uint8_t)201, (uint8_t)202, (uint8_t)203, (uint8_t)204, (uint8_t)205, (uint8_t)206, (uint8_t)207, (uint8_t)208, (uint8_t)209, (uint8_t)210, (uint8_t)211, (uint8_t)212, (uint8_t)213, (uint8_t)214, (uint8_t)215, (uint8_t)216, (uint8_t)217, (uint8_t)218, (uint8_t)219, (uint8_t)220, (uint8_t)221, (uint8_t)222, (uint8_t)223, (uint8_t)224, (uint8_t)225, (uint8_t)226, (uint8_t)227, (uint8_t)228, (uint8_t)229, (uint8_t)230, (uint8_t)231, (uint8_t)232, (uint8_t)233, (uint8_t)234, (uint8_t)235, (uint8_t)236, (uint8_t)237, (uint8_t)238, (uint8_t)239, (uint8_t)240, (uint8_t)241, (uint8_t)242, (uint8_t)243, (uint8_t)244, (uint8_t)245, (uint8_t)246, (uint8_t)247, (uint8_t)248, (uint8_t)249, (uint8_t)250, (uint8_t)251, (uint8_t)252, (uint8_t)253, (uint8_t)254, (uint8_t)255, (uint8_t)0, (uint8_t)1, (uint8_t)2 }, (uint8_t)243, { (uint8_t)54, (uint8_t)55, (uint8_t)56, (uint8_t)57, (uint8_t)58, (uint8_t)59, (uint8_t)60, (uint8_t)61, (uint8_t)62, (uint8_t)63, (uint8_t)64, (uint8_t)65, (uint8_t)66, (uint8_t)67, (uint8_t)68, (uint8_t)69, (uint8_t)70, (uint8_t)71, (uint8_t)72, (uint8_t)73, (uint8_t)74, (uint8_t)75, (uint8_t)76, (uint8_t)77, (uint8_t)78, (uint8_t)79, (uint8_t)80, (uint8_t)81, (uint8_t)82, (uint8_t)83, (uint8_t)84, (uint8_t)85, (uint8_t)86, (uint8_t)87, (uint8_t)88, (uint8_t)89, (uint8_t)90, (uint8_t)91, (uint8_t)92, (uint8_t)93, (uint8_t)94, (uint8_t)95, (uint8_t)96, (uint8_t)97, (uint8_t)98, (uint8_t)99, (uint8_t)100, (uint8_t)101, (uint8_t)102, (uint8_t)103, (uint8_t)104, (uint8_t)105, (uint8_t)106, (uint8_t)107, (uint8_t)108, (uint8_t)109, (uint8_t)110, (uint8_t)111, (uint8_t)112, (uint8_t)113, (uint8_t)114, (uint8_t)115, (uint8_t)116, (uint8_t)117, (uint8_t)118, (uint8_t)119, (uint8_t)120, (uint8_t)121, (uint8_t)122, (uint8_t)123, (uint8_t)124, (uint8_t)125, (uint8_t)126, (uint8_t)127, (uint8_t)128, (uint8_t)129, (uint8_t)130, (uint8_t)131, (uint8_t)132, (uint8_t)133, (uint8_t)134, (uint8_t)135, (uint8_t)136, (uint8_t)137, (uint8_t)138, (uint8_t)139, (uint8_t)140, (uint8_t)141, (uint8_t)142, (uint8_t)143, (uint8_t)144, (uint8_t)145, (uint8_t)146, (uint8_t)147, (uint8_t)148, (uint8_t)149, (uint8_t)150, (uint8_t)151, (uint8_t)152, (uint8_t)153, (uint8_t)154, (uint8_t)155, (uint8_t)156, (uint8_t)157, (uint8_t)158, (uint8_t)159, (uint8_t)160, (uint8_t)161, (uint8_t)162, (uint8_t)163, (uint8_t)164, (uint8_t)165, (uint8_t)166, (uint8_t)167, (uint8_t)168, (uint8_t)169, (uint8_t)170, (uint8_t)171, (uint8_t)172, (uint8_t)173 }
+	};
+	mavlink_resource_request_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.request_id = packet_in.request_id;
+	packet1.uri_type = packet_in.uri_type;
+	packet1.transfer_type = packet_in.transfer_type;
+	mav_array_memcpy(packet1.uri, packet_in.uri, sizeof(uint8_t)*120);
+	mav_array_memcpy(packet1.storage, packet_in.storage, sizeof(uint8_t)*120);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_resource_request_pack(run.system_id, run.component_id, &run.message, packet1.request_id , packet1.uri_type , packet1.uri , packet1.transfer_type , packet1.storage));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_resource_request_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_resource_request_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_scaled_pressure3(Msgbench_Run &run)
+{
+	mavlink_scaled_pressure3_t packet_in = {
+		(uint32_t)963497464, (float)45.0, (float)73.0, (int16_t)17859, (int16_t)17963
+	};
+	mavlink_scaled_pressure3_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.press_abs = packet_in.press_abs;
+	packet1.press_diff = packet_in.press_diff;
+	packet1.temperature = packet_in.temperature;
+	packet1.temperature_press_diff = packet_in.temperature_press_diff;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_scaled_pressure3_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.press_abs , packet1.press_diff , packet1.temperature , packet1.temperature_press_diff));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_scaled_pressure3_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_scaled_pressure3_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_follow_target(Msgbench_Run &run)
+{
+	mavlink_follow_target_t packet_in = {
+		(uint64_t)93372036854775807ULL, (uint64_t)93372036854776311ULL, (int32_t)963498296, (int32_t)963498504, (float)185.0, { (float)213.0, (float)214.0, (float)215.0 }, { (float)297.0, (float)298.0, (float)299.0 }, { (float)381.0, (float)382.0, (float)383.0, (float)384.0 }, { (float)493.0, (float)494.0, (float)495.0 }, { (float)577.0, (float)578.0, (float)579.0 }, (uint8_t)25
+	};
+	mavlink_follow_target_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.timestamp = packet_in.timestamp;
+	packet1.custom_state = packet_in.custom_state;
+	packet1.lat = packet_in.lat;
+	packet1.lon = packet_in.lon;
+	packet1.alt = packet_in.alt;
+	packet1.est_capabilities = packet_in.est_capabilities;
+	mav_array_memcpy(packet1.vel, packet_in.vel, sizeof(float)*3);
+	mav_array_memcpy(packet1.acc, packet_in.acc, sizeof(float)*3);
+	mav_array_memcpy(packet1.attitude_q, packet_in.attitude_q, sizeof(float)*4);
+	mav_array_memcpy(packet1.rates, packet_in.rates, sizeof(float)*3);
+	mav_array_memcpy(packet1.position_cov, packet_in.position_cov, sizeof(float)*3);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_follow_target_pack(run.system_id, run.component_id, &run.message, packet1.timestamp , packet1.est_capabilities , packet1.lat , packet1.lon , packet1.alt , packet1.vel , packet1.acc , packet1.attitude_q , packet1.rates , packet1.position_cov , packet1.custom_state));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_follow_target_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_follow_target_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_control_system_state(Msgbench_Run &run)
+{
+	mavlink_control_system_state_t packet_in = {
+		(uint64_t)93372036854775807ULL, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, (float)241.0, (float)269.0, (float)297.0, (float)325.0, { (float)353.0, (float)354.0, (float)355.0 }, { (float)437.0, (float)438.0, (float)439.0 }, { (float)521.0, (float)522.0, (float)523.0, (float)524.0 }, (float)633.0, (float)661.0, (float)689.0
+	};
+	mavlink_control_system_state_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.x_acc = packet_in.x_acc;
+	packet1.y_acc = packet_in.y_acc;
+	packet1.z_acc = packet_in.z_acc;
+	packet1.x_vel = packet_in.x_vel;
+	packet1.y_vel = packet_in.y_vel;
+	packet1.z_vel = packet_in.z_vel;
+	packet1.x_pos = packet_in.x_pos;
+	packet1.y_pos = packet_in.y_pos;
+	packet1.z_pos = packet_in.z_pos;
+	packet1.airspeed = packet_in.airspeed;
+	packet1.roll_rate = packet_in.roll_rate;
+	packet1.pitch_rate = packet_in.pitch_rate;
+	packet1.yaw_rate = packet_in.yaw_rate;
+	mav_array_memcpy(packet1.vel_variance, packet_in.vel_variance, sizeof(float)*3);
+	mav_array_memcpy(packet1.pos_variance, packet_in.pos_variance, sizeof(float)*3);
+	mav_array_memcpy(packet1.q, packet_in.q, sizeof(float)*4);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_control_system_state_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.x_acc , packet1.y_acc , packet1.z_acc , packet1.x_vel , packet1.y_vel , packet1.z_vel , packet1.x_pos , packet1.y_pos , packet1.z_pos , packet1.airspeed , packet1.vel_variance , packet1.pos_variance , packet1.q , packet1.roll_rate , packet1.pitch_rate , packet1.yaw_rate));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_control_system_state_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_control_system_state_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_battery_status(Msgbench_Run &run)
+{
+	mavlink_battery_status_t packet_in = {
+		(int32_t)963497464, (int32_t)963497672, (int16_t)17651, { (uint16_t)17755, (uint16_t)17756, (uint16_t)17757, (uint16_t)17758, (uint16_t)17759, (uint16_t)17760, (uint16_t)17761, (uint16_t)17762, (uint16_t)17763, (uint16_t)17764 }, (int16_t)18795, (uint8_t)101, (uint8_t)168, (uint8_t)235, (int8_t)46, (int32_t)963499336, (uint8_t)125, { (uint16_t)19367, (uint16_t)19368, (uint16_t)19369, (uint16_t)19370 }, (uint8_t)216, (uint32_t)963500064
+	};
+	mavlink_battery_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.current_consumed = packet_in.current_consumed;
+	packet1.energy_consumed = packet_in.energy_consumed;
+	packet1.temperature = packet_in.temperature;
+	packet1.current_battery = packet_in.current_battery;
+	packet1.id = packet_in.id;
+	packet1.battery_function = packet_in.battery_function;
+	packet1.type = packet_in.type;
+	packet1.battery_remaining = packet_in.battery_remaining;
+	packet1.time_remaining = packet_in.time_remaining;
+	packet1.charge_state = packet_in.charge_state;
+	packet1.mode = packet_in.mode;
+	packet1.fault_bitmask = packet_in.fault_bitmask;
+	mav_array_memcpy(packet1.voltages, packet_in.voltages, sizeof(uint16_t)*10);
+	mav_array_memcpy(packet1.voltages_ext, packet_in.voltages_ext, sizeof(uint16_t)*4);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_battery_status_pack(run.system_id, run.component_id, &run.message, packet1.id , packet1.battery_function , packet1.type , packet1.temperature , packet1.voltages , packet1.current_battery , packet1.current_consumed , packet1.energy_consumed , packet1.battery_remaining , packet1.time_remaining , packet1.charge_state , packet1.voltages_ext , packet1.mode , packet1.fault_bitmask));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_battery_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_battery_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_autopilot_version(Msgbench_Run &run)
+{
+	mavlink_autopilot_version_t packet_in = {
+		(uint64_t)93372036854775807ULL, (uint64_t)93372036854776311ULL, (uint32_t)963498296, (uint32_t)963498504, (uint32_t)963498712, (uint32_t)963498920, (uint16_t)18899, (uint16_t)19003, { (uint8_t)113, (uint8_t)114, (uint8_t)115, (uint8_t)116, (uint8_t)117, (uint8_t)118, (uint8_t)119, (uint8_t)120 }, { (uint8_t)137, (uint8_t)138, (uint8_t)139, (uint8_t)140, (uint8_t)141, (uint8_t)142, (uint8_t)143, (uint8_t)144 }, { (uint8_t)161, (uint8_t)162, (uint8_t)163, (uint8_t)164, (uint8_t)165, (uint8_t)166, (uint8_t)167, (uint8_t)168 }, { (uint8_t)185, (uint8_t)186, (uint8_t)187, (uint8_t)188, (uint8_t)189, (uint8_t)190, (uint8_t)191, (uint8_t)192, (uint8_t)193, (uint8_t)194, (uint8_t)195, (uint8_t)196, (uint8_t)197, (uint8_t)198, (uint8_t)199, (uint8_t)200, (uint8_t)201, (uint8_t)202 }
+	};
+	mavlink_autopilot_version_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.capabilities = packet_in.capabilities;
+	packet1.uid = packet_in.uid;
+	packet1.flight_sw_version = packet_in.flight_sw_version;
+	packet1.middleware_sw_version = packet_in.middleware_sw_version;
+	packet1.os_sw_version = packet_in.os_sw_version;
+	packet1.board_version = packet_in.board_version;
+	packet1.vendor_id = packet_in.vendor_id;
+	packet1.product_id = packet_in.product_id;
+	mav_array_memcpy(packet1.flight_custom_version, packet_in.flight_custom_version, sizeof(uint8_t)*8);
+	mav_array_memcpy(packet1.middleware_custom_version, packet_in.middleware_custom_version, sizeof(uint8_t)*8);
+	mav_array_memcpy(packet1.os_custom_version, packet_in.os_custom_version, sizeof(uint8_t)*8);
+	mav_array_memcpy(packet1.uid2, packet_in.uid2, sizeof(uint8_t)*18);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_autopilot_version_pack(run.system_id, run.component_id, &run.message, packet1.capabilities , packet1.flight_sw_version , packet1.middleware_sw_version , packet1.os_sw_version , packet1.board_version , packet1.flight_custom_version , packet1.middleware_custom_version , packet1.os_custom_version , packet1.vendor_id , packet1.product_id , packet1.uid , packet1.uid2));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_autopilot_version_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_autopilot_version_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_landing_target(Msgbench_Run &run)
+{
+	mavlink_landing_target_t packet_in = {
+		(uint64_t)93372036854775807ULL, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (uint8_t)89, (uint8_t)156, (float)227.0, (float)255.0, (float)283.0, { (float)311.0, (float)312.0, (float)313.0, (float)314.0 }, (uint8_t)51, (uint8_t)118
+	};
+	mavlink_landing_target_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.angle_x = packet_in.angle_x;
+	packet1.angle_y = packet_in.angle_y;
+	packet1.distance = packet_in.distance;
+	packet1.size_x = packet_in.size_x;
+	packet1.size_y = packet_in.size_y;
+	packet1.target_num = packet_in.target_num;
+	packet1.frame = packet_in.frame;
+	packet1.x = packet_in.x;
+	packet1.y = packet_in.y;
+	packet1.z = packet_in.z;
+	packet1.type = packet_in.type;
+	packet1.position_valid = packet_in.position_valid;
+	mav_array_memcpy(packet1.q, packet_in.q, sizeof(float)*4);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_landing_target_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.target_num , packet1.frame , packet1.angle_x , packet1.angle_y , packet1.distance , packet1.size_x , packet1.size_y , packet1.x , packet1.y , packet1.z , packet1.q , packet1.type , packet1.position_valid));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_landing_target_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_landing_target_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_sensor_offsets(Msgbench_Run &run)
+{
+	mavlink_sensor_offsets_t packet_in = {
+		(float)17.0, (int32_t)963497672, (int32_t)963497880, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, (float)241.0, (int16_t)19107, (int16_t)19211, (int16_t)19315
+	};
+	mavlink_sensor_offsets_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.mag_declination = packet_in.mag_declination;
+	packet1.raw_press = packet_in.raw_press;
+	packet1.raw_temp = packet_in.raw_temp;
+	packet1.gyro_cal_x = packet_in.gyro_cal_x;
+	packet1.gyro_cal_y = packet_in.gyro_cal_y;
+	packet1.gyro_cal_z = packet_in.gyro_cal_z;
+	packet1.accel_cal_x = packet_in.accel_cal_x;
+	packet1.accel_cal_y = packet_in.accel_cal_y;
+	packet1.accel_cal_z = packet_in.accel_cal_z;
+	packet1.mag_ofs_x = packet_in.mag_ofs_x;
+	packet1.mag_ofs_y = packet_in.mag_ofs_y;
+	packet1.mag_ofs_z = packet_in.mag_ofs_z;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_sensor_offsets_pack(run.system_id, run.component_id, &run.message, packet1.mag_ofs_x , packet1.mag_ofs_y , packet1.mag_ofs_z , packet1.mag_declination , packet1.raw_press , packet1.raw_temp , packet1.gyro_cal_x , packet1.gyro_cal_y , packet1.gyro_cal_z , packet1.accel_cal_x , packet1.accel_cal_y , packet1.accel_cal_z));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_sensor_offsets_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_sensor_offsets_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_set_mag_offsets(Msgbench_Run &run)
+{
+	mavlink_set_mag_offsets_t packet_in = {
+		(int16_t)17235, (int16_t)17339, (int16_t)17443, (uint8_t)151, (uint8_t)218
+	};
+	mavlink_set_mag_offsets_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.mag_ofs_x = packet_in.mag_ofs_x;
+	packet1.mag_ofs_y = packet_in.mag_ofs_y;
+	packet1.mag_ofs_z = packet_in.mag_ofs_z;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_set_mag_offsets_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.mag_ofs_x , packet1.mag_ofs_y , packet1.mag_ofs_z));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_set_mag_offsets_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_set_mag_offsets_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_meminfo(Msgbench_Run &run)
+{
+	mavlink_meminfo_t packet_in = {
+		(uint16_t)17235, (uint16_t)17339, (uint32_t)963497672
+	};
+	mavlink_meminfo_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.brkval = packet_in.brkval;
+	packet1.freemem = packet_in.freemem;
+	packet1.freemem32 = packet_in.freemem32;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_meminfo_pack(run.system_id, run.component_id, &run.message, packet1.brkval , packet1.freemem , packet1.freemem32));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_meminfo_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_meminfo_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_ap_adc(Msgbench_Run &run)
+{
+	mavlink_ap_adc_t packet_in = {
+		(uint16_t)17235, (uint16_t)17339, (uint16_t)17443, (uint16_t)17547, (uint16_t)17651, (uint16_t)17755
+	};
+	mavlink_ap_adc_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.adc1 = packet_in.adc1;
+	packet1.adc2 = packet_in.adc2;
+	packet1.adc3 = packet_in.adc3;
+	packet1.adc4 = packet_in.adc4;
+	packet1.adc5 = packet_in.adc5;
+	packet1.adc6 = packet_in.adc6;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_ap_adc_pack(run.system_id, run.component_id, &run.message, packet1.adc1 , packet1.adc2 , packet1.adc3 , packet1.adc4 , packet1.adc5 , packet1.adc6));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_ap_adc_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_ap_adc_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_digicam_configure(Msgbench_Run &run)
+{
+	mavlink_digicam_configure_t packet_in = {
+		(float)17.0, (uint16_t)17443, (uint8_t)151, (uint8_t)218, (uint8_t)29, (uint8_t)96, (uint8_t)163, (uint8_t)230, (uint8_t)41, (uint8_t)108, (uint8_t)175
+	};
+	mavlink_digicam_configure_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.extra_value = packet_in.extra_value;
+	packet1.shutter_speed = packet_in.shutter_speed;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.mode = packet_in.mode;
+	packet1.aperture = packet_in.aperture;
+	packet1.iso = packet_in.iso;
+	packet1.exposure_type = packet_in.exposure_type;
+	packet1.command_id = packet_in.command_id;
+	packet1.engine_cut_off = packet_in.engine_cut_off;
+	packet1.extra_param = packet_in.extra_param;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_digicam_configure_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.mode , packet1.shutter_speed , packet1.aperture , packet1.iso , packet1.exposure_type , packet1.command_id , packet1.engine_cut_off , packet1.extra_param , packet1.extra_value));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_digicam_configure_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_digicam_configure_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_digicam_control(Msgbench_Run &run)
+{
+	mavlink_digicam_control_t packet_in = {
+		(float)17.0, (uint8_t)17, (uint8_t)84, (uint8_t)151, (uint8_t)218, (int8_t)29, (uint8_t)96, (uint8_t)163, (uint8_t)230, (uint8_t)41
+	};
+	mavlink_digicam_control_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.extra_value = packet_in.extra_value;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.session = packet_in.session;
+	packet1.zoom_pos = packet_in.zoom_pos;
+	packet1.zoom_step = packet_in.zoom_step;
+	packet1.focus_lock = packet_in.focus_lock;
+	packet1.shot = packet_in.shot;
+	packet1.command_id = packet_in.command_id;
+	packet1.extra_param = packet_in.extra_param;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_digicam_control_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.session , packet1.zoom_pos , packet1.zoom_step , packet1.focus_lock , packet1.shot , packet1.command_id , packet1.extra_param , packet1.extra_value));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_digicam_control_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_digicam_control_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_mount_configure(Msgbench_Run &run)
+{
+	mavlink_mount_configure_t packet_in = {
+		(uint8_t)5, (uint8_t)72, (uint8_t)139, (uint8_t)206, (uint8_t)17, (uint8_t)84
+	};
+	mavlink_mount_configure_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.mount_mode = packet_in.mount_mode;
+	packet1.stab_roll = packet_in.stab_roll;
+	packet1.stab_pitch = packet_in.stab_pitch;
+	packet1.stab_yaw = packet_in.stab_yaw;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_mount_configure_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.mount_mode , packet1.stab_roll , packet1.stab_pitch , packet1.stab_yaw));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_mount_configure_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_mount_configure_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_mount_control(Msgbench_Run &run)
+{
+	mavlink_mount_control_t packet_in = {
+		(int32_t)963497464, (int32_t)963497672, (int32_t)963497880, (uint8_t)41, (uint8_t)108, (uint8_t)175
+	};
+	mavlink_mount_control_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.input_a = packet_in.input_a;
+	packet1.input_b = packet_in.input_b;
+	packet1.input_c = packet_in.input_c;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.save_position = packet_in.save_position;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_mount_control_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.input_a , packet1.input_b , packet1.input_c , packet1.save_position));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_mount_control_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_mount_control_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_mount_status(Msgbench_Run &run)
+{
+	mavlink_mount_status_t packet_in = {
+		(int32_t)963497464, (int32_t)963497672, (int32_t)963497880, (uint8_t)41, (uint8_t)108, (uint8_t)175
+	};
+	mavlink_mount_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.pointing_a = packet_in.pointing_a;
+	packet1.pointing_b = packet_in.pointing_b;
+	packet1.pointing_c = packet_in.pointing_c;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.mount_mode = packet_in.mount_mode;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_mount_status_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.pointing_a , packet1.pointing_b , packet1.pointing_c , packet1.mount_mode));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_mount_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_mount_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_fence_point(Msgbench_Run &run)
+{
+	mavlink_fence_point_t packet_in = {
+		(float)17.0, (float)45.0, (uint8_t)29, (uint8_t)96, (uint8_t)163, (uint8_t)230
+	};
+	mavlink_fence_point_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.lat = packet_in.lat;
+	packet1.lng = packet_in.lng;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.idx = packet_in.idx;
+	packet1.count = packet_in.count;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_fence_point_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.idx , packet1.count , packet1.lat , packet1.lng));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_fence_point_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_fence_point_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_fence_fetch_point(Msgbench_Run &run)
+{
+	mavlink_fence_fetch_point_t packet_in = {
+		(uint8_t)5, (uint8_t)72, (uint8_t)139
+	};
+	mavlink_fence_fetch_point_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.idx = packet_in.idx;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_fence_fetch_point_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.idx));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_fence_fetch_point_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_fence_fetch_point_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_fence_status(Msgbench_Run &run)
+{
+	mavlink_fence_status_t packet_in = {
+		(uint32_t)963497464, (uint16_t)17443, (uint8_t)151, (uint8_t)218, (uint8_t)29
+	};
+	mavlink_fence_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.breach_time = packet_in.breach_time;
+	packet1.breach_count = packet_in.breach_count;
+	packet1.breach_status = packet_in.breach_status;
+	packet1.breach_type = packet_in.breach_type;
+	packet1.breach_mitigation = packet_in.breach_mitigation;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_fence_status_pack(run.system_id, run.component_id, &run.message, packet1.breach_status , packet1.breach_count , packet1.breach_type , packet1.breach_time , packet1.breach_mitigation));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_fence_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_fence_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_ahrs(Msgbench_Run &run)
+{
+	mavlink_ahrs_t packet_in = {
+		(float)17.0, (float)45.0, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0
+	};
+	mavlink_ahrs_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.omegaIx = packet_in.omegaIx;
+	packet1.omegaIy = packet_in.omegaIy;
+	packet1.omegaIz = packet_in.omegaIz;
+	packet1.accel_weight = packet_in.accel_weight;
+	packet1.renorm_val = packet_in.renorm_val;
+	packet1.error_rp = packet_in.error_rp;
+	packet1.error_yaw = packet_in.error_yaw;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_ahrs_pack(run.system_id, run.component_id, &run.message, packet1.omegaIx , packet1.omegaIy , packet1.omegaIz , packet1.accel_weight , packet1.renorm_val , packet1.error_rp , packet1.error_yaw));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_ahrs_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_ahrs_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_simstate(Msgbench_Run &run)
+{
+	mavlink_simstate_t packet_in = {
+		(float)17.0, (float)45.0, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, (float)241.0, (int32_t)963499336, (int32_t)963499544
+	};
+	mavlink_simstate_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.roll = packet_in.roll;
+	packet1.pitch = packet_in.pitch;
+	packet1.yaw = packet_in.yaw;
+	packet1.xacc = packet_in.xacc;
+	packet1.yacc = packet_in.yacc;
+	packet1.zacc = packet_in.zacc;
+	packet1.xgyro = packet_in.xgyro;
+	packet1.ygyro = packet_in.ygyro;
+	packet1.zgyro = packet_in.zgyro;
+	packet1.lat = packet_in.lat;
+	packet1.lng = packet_in.lng;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_simstate_pack(run.system_id, run.component_id, &run.message, packet1.roll , packet1.pitch , packet1.yaw , packet1.xacc , packet1.yacc , packet1.zacc , packet1.xgyro , packet1.ygyro , packet1.zgyro , packet1.lat , packet1.lng));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_simstate_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_simstate_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_hwstatus(Msgbench_Run &run)
+{
+	mavlink_hwstatus_t packet_in = {
+		(uint16_t)17235, (uint8_t)139
+	};
+	mavlink_hwstatus_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.Vcc = packet_in.Vcc;
+	packet1.I2Cerr = packet_in.I2Cerr;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_hwstatus_pack(run.system_id, run.component_id, &run.message, packet1.Vcc , packet1.I2Cerr));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_hwstatus_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_hwstatus_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_radio(Msgbench_Run &run)
+{
+	mavlink_radio_t packet_in = {
+		(uint16_t)17235, (uint16_t)17339, (uint8_t)17, (uint8_t)84, (uint8_t)151, (uint8_t)218, (uint8_t)29
+	};
+	mavlink_radio_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.rxerrors = packet_in.rxerrors;
+	packet1.fixed = packet_in.fixed;
+	packet1.rssi = packet_in.rssi;
+	packet1.remrssi = packet_in.remrssi;
+	packet1.txbuf = packet_in.txbuf;
+	packet1.noise = packet_in.noise;
+	packet1.remnoise = packet_in.remnoise;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_radio_pack(run.system_id, run.component_id, &run.message, packet1.rssi , packet1.remrssi , packet1.txbuf , packet1.noise , packet1.remnoise , packet1.rxerrors , packet1.fixed));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_radio_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_radio_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_limits_status(Msgbench_Run &run)
+{
+	mavlink_limits_status_t packet_in = {
+		(uint32_t)963497464, (uint32_t)963497672, (uint32_t)963497880, (uint32_t)963498088, (uint16_t)18067, (uint8_t)187, (uint8_t)254, (uint8_t)65, (uint8_t)132
+	};
+	mavlink_limits_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.last_trigger = packet_in.last_trigger;
+	packet1.last_action = packet_in.last_action;
+	packet1.last_recovery = packet_in.last_recovery;
+	packet1.last_clear = packet_in.last_clear;
+	packet1.breach_count = packet_in.breach_count;
+	packet1.limits_state = packet_in.limits_state;
+	packet1.mods_enabled = packet_in.mods_enabled;
+	packet1.mods_required = packet_in.mods_required;
+	packet1.mods_triggered = packet_in.mods_triggered;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_limits_status_pack(run.system_id, run.component_id, &run.message, packet1.limits_state , packet1.last_trigger , packet1.last_action , packet1.last_recovery , packet1.last_clear , packet1.breach_count , packet1.mods_enabled , packet1.mods_required , packet1.mods_triggered));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_limits_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_limits_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_wind(Msgbench_Run &run)
+{
+	mavlink_wind_t packet_in = {
+		(float)17.0, (float)45.0, (float)73.0
+	};
+	mavlink_wind_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.direction = packet_in.direction;
+	packet1.speed = packet_in.speed;
+	packet1.speed_z = packet_in.speed_z;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_wind_pack(run.system_id, run.component_id, &run.message, packet1.direction , packet1.speed , packet1.speed_z));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_wind_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_wind_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_data16(Msgbench_Run &run)
+{
+	mavlink_data16_t packet_in = {
+		(uint8_t)5, (uint8_t)72, { (uint8_t)139, (uint8_t)140, (uint8_t)141, (uint8_t)142, (uint8_t)143, (uint8_t)144, (uint8_t)145, (uint8_t)146, (uint8_t)147, (uint8_t)148, (uint8_t)149, (uint8_t)150, (uint8_t)151, (uint8_t)152, (uint8_t)153, (uint8_t)154 }
+	};
+	mavlink_data16_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.type = packet_in.type;
+	packet1.len = packet_in.len;
+	mav_array_memcpy(packet1.data, packet_in.data, sizeof(uint8_t)*16);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_data16_pack(run.system_id, run.component_id, &run.message, packet1.type , packet1.len , packet1.data));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_data16_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_data16_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_data32(Msgbench_Run &run)
+{
+	mavlink_data32_t packet_in = {
+		(uint8_t)5, (uint8_t)72, { (uint8_t)139, (uint8_t)140, (uint8_t)141, (uint8_t)142, (uint8_t)143, (uint8_t)144, (uint8_t)145, (uint8_t)146, (uint8_t)147, (uint8_t)148, (uint8_t)149, (uint8_t)150, (uint8_t)151, (uint8_t)152, (uint8_t)153, (uint8_t)154, (uint8_t)155, (uint8_t)156, (uint8_t)157, (uint8_t)158, (uint8_t)159, (uint8_t)160, (uint8_t)161, (uint8_t)162, (uint8_t)163, (uint8_t)164, (uint8_t)165, (uint8_t)166, (uint8_t)167, (uint8_t)168, (uint8_t)169, (uint8_t)170 }
+	};
+	mavlink_data32_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.type = packet_in.type;
+	packet1.len = packet_in.len;
+	mav_array_memcpy(packet1.data, packet_in.data, sizeof(uint8_t)*32);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_data32_pack(run.system_id, run.component_id, &run.message, packet1.type , packet1.len , packet1.data));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_data32_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_data32_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_data64(Msgbench_Run &run)
+{
+	mavlink_data64_t packet_in = {
+		(uint8_t)5, (uint8_t)72, { (uint8_t)139, (uint8_t)140, (uint8_t)141, (uint8_t)142, (uint8_t)143, (uint8_t)144, (uint8_t)145, (uint8_t)146, (uint8_t)147, (uint8_t)148, (uint8_t)149, (uint8_t)150, (uint8_t)151, (uint8_t)152, (uint8_t)153, (uint8_t)154, (uint8_t)155, (uint8_t)156, (uint8_t)157, (uint8_t)158, (uint8_t)159, (uint8_t)160, (uint8_t)161, (uint8_t)162, (uint8_t)163, (uint8_t)164, (uint8_t)165, (uint8_t)166, (uint8_t)167, (uint8_t)168, (uint8_t)169, (uint8_t)170, (uint8_t)171, (uint8_t)172, (uint8_t)173, (uint8_t)174, (uint8_t)175, (uint8_t)176, (uint8_t)177, (uint8_t)178, (uint8_t)179, (uint8_t)180, (uint8_t)181, (uint8_t)182, (uint8_t)183, (uint8_t)184, (uint8_t)185, (uint8_t)186, (uint8_t)187, (uint8_t)188, (uint8_t)189, (uint8_t)190, (uint8_t)191, (uint8_t)192, (uint8_t)193, (uint8_t)194, (uint8_t)195, (uint8_t)196, (uint8_t)197, (uint8_t)198, (uint8_t)199, (uint8_t)200, (uint8_t)201, (uint8_t)202 }
+	};
+	mavlink_data64_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.type = packet_in.type;
+	packet1.len = packet_in.len;
+	mav_array_memcpy(packet1.data, packet_in.data, sizeof(uint8_t)*64);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_data64_pack(run.system_id, run.component_id, &run.message, packet1.type , packet1.len , packet1.data));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_data64_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_data64_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_data96(Msgbench_Run &run)
+{
+	mavlink_data96_t packet_in = {
+		(uint8_t)5, (uint8_t)72, { (uint8_t)139, (uint8_t)140, (uint8_t)141, (uint8_t)142, (uint8_t)143, (uint8_t)144, (uint8_t)145, (uint8_t)146, (uint8_t)147, (uint8_t)148, (uint8_t)149, (uint8_t)150, (uint8_t)151, (uint8_t)152, (uint8_t)153, (uint8_t)154, (uint8_t)155, (uint8_t)156, (uint8_t)157, (uint8_t)158, (uint8_t)159, (uint8_t)160, (uint8_t)161, (uint8_t)162, (uint8_t)163, (uint8_t)164, (uint8_t)165, (uint8_t)166, (uint8_t)167, (uint8_t)168, (uint8_t)169, (uint8_t)170, (uint8_t)171, (uint8_t)172, (uint8_t)173, (uint8_t)174, (uint8_t)175, (uint8_t)176, (uint8_t)177, (uint8_t)178, (uint8_t)179, (uint8_t)180, (uint8_t)181, (uint8_t)182, (uint8_t)183, (uint8_t)184, (uint8_t)185, (uint8_t)186, (uint8_t)187, (uint8_t)188, (uint8_t)189, (uint8_t)190, (uint8_t)191, (uint8_t)192, (uint8_t)193, (uint8_t)194, (uint8_t)195, (uint8_t)196, (uint8_t)197, (uint8_t)198, (uint8_t)199, (uint8_t)200, (uint8_t)201, (uint8_t)202, (uint8_t)203, (uint8_t)204, (uint8_t)205, (uint8_t)206, (uint8_t)207, (uint8_t)208, (uint8_t)209, (uint8_t)210, (uint8_t)211, (uint8_t)212, (uint8_t)213, (uint8_t)214, (uint8_t)215, (uint8_t)216, (uint8_t)217, (uint8_t)218, (uint8_t)219, (uint8_t)220, (uint8_t)221, (uint8_t)222, (uint8_t)223, (uint8_t)224, (uint8_t)225, (uint8_t)226, (uint8_t)227, (uint8_t)228, (uint8_t)229, (uint8_t)230, (uint8_t)231, (uint8_t)232, (uint8_t)233, (uint8_t)234 }
+	};
+	mavlink_data96_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.type = packet_in.type;
+	packet1.len = packet_in.len;
+	mav_array_memcpy(packet1.data, packet_in.data, sizeof(uint8_t)*96);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_data96_pack(run.system_id, run.component_id, &run.message, packet1.type , packet1.len , packet1.data));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_data96_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_data96_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_rangefinder(Msgbench_Run &run)
+{
+	mavlink_rangefinder_t packet_in = {
+		(float)17.0, (float)45.0
+	};
+	mavlink_rangefinder_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.distance = packet_in.distance;
+	packet1.voltage = packet_in.voltage;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_rangefinder_pack(run.system_id, run.component_id, &run.message, packet1.distance , packet1.voltage));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_rangefinder_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_rangefinder_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_airspeed_autocal(Msgbench_Run &run)
+{
+	mavlink_airspeed_autocal_t packet_in = {
+		(float)17.0, (float)45.0, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, (float)241.0, (float)269.0, (float)297.0, (float)325.0
+	};
+	mavlink_airspeed_autocal_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.vx = packet_in.vx;
+	packet1.vy = packet_in.vy;
+	packet1.vz = packet_in.vz;
+	packet1.diff_pressure = packet_in.diff_pressure;
+	packet1.EAS2TAS = packet_in.EAS2TAS;
+	packet1.ratio = packet_in.ratio;
+	packet1.state_x = packet_in.state_x;
+	packet1.state_y = packet_in.state_y;
+	packet1.state_z = packet_in.state_z;
+	packet1.Pax = packet_in.Pax;
+	packet1.Pby = packet_in.Pby;
+	packet1.Pcz = packet_in.Pcz;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_airspeed_autocal_pack(run.system_id, run.component_id, &run.message, packet1.vx , packet1.vy , packet1.vz , packet1.diff_pressure , packet1.EAS2TAS , packet1.ratio , packet1.state_x , packet1.state_y , packet1.state_z , packet1.Pax , packet1.Pby , packet1.Pcz));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_airspeed_autocal_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_airspeed_autocal_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_rally_point(Msgbench_Run &run)
+{
+	mavlink_rally_point_t packet_in = {
+		(int32_t)963497464, (int32_t)963497672, (int16_t)17651, (int16_t)17755, (uint16_t)17859, (uint8_t)175, (uint8_t)242, (uint8_t)53, (uint8_t)120, (uint8_t)187
+	};
+	mavlink_rally_point_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.lat = packet_in.lat;
+	packet1.lng = packet_in.lng;
+	packet1.alt = packet_in.alt;
+	packet1.break_alt = packet_in.break_alt;
+	packet1.land_dir = packet_in.land_dir;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.idx = packet_in.idx;
+	packet1.count = packet_in.count;
+	packet1.flags = packet_in.flags;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_rally_point_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.idx , packet1.count , packet1.lat , packet1.lng , packet1.alt , packet1.break_alt , packet1.land_dir , packet1.flags));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_rally_point_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_rally_point_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_rally_fetch_point(Msgbench_Run &run)
+{
+	mavlink_rally_fetch_point_t packet_in = {
+		(uint8_t)5, (uint8_t)72, (uint8_t)139
+	};
+	mavlink_rally_fetch_point_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.idx = packet_in.idx;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_rally_fetch_point_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.idx));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_rally_fetch_point_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_rally_fetch_point_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_compassmot_status(Msgbench_Run &run)
+{
+	mavlink_compassmot_status_t packet_in = {
+		(float)17.0, (float)45.0, (float)73.0, (float)101.0, (uint16_t)18067, (uint16_t)18171
+	};
+	mavlink_compassmot_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.current = packet_in.current;
+	packet1.CompensationX = packet_in.CompensationX;
+	packet1.CompensationY = packet_in.CompensationY;
+	packet1.CompensationZ = packet_in.CompensationZ;
+	packet1.throttle = packet_in.throttle;
+	packet1.interference = packet_in.interference;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_compassmot_status_pack(run.system_id, run.component_id, &run.message, packet1.throttle , packet1.current , packet1.interference , packet1.CompensationX , packet1.CompensationY , packet1.CompensationZ));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_compassmot_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_compassmot_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_ahrs2(Msgbench_Run &run)
+{
+	mavlink_ahrs2_t packet_in = {
+		(float)17.0, (float)45.0, (float)73.0, (float)101.0, (int32_t)963498296, (int32_t)963498504
+	};
+	mavlink_ahrs2_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.roll = packet_in.roll;
+	packet1.pitch = packet_in.pitch;
+	packet1.yaw = packet_in.yaw;
+	packet1.altitude = packet_in.altitude;
+	packet1.lat = packet_in.lat;
+	packet1.lng = packet_in.lng;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_ahrs2_pack(run.system_id, run.component_id, &run.message, packet1.roll , packet1.pitch , packet1.yaw , packet1.altitude , packet1.lat , packet1.lng));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_ahrs2_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_ahrs2_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_camera_status(Msgbench_Run &run)
+{
+	mavlink_camera_status_t packet_in = {
+		(uint64_t)93372036854775807ULL, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (uint16_t)18483, (uint8_t)211, (uint8_t)22, (uint8_t)89
+	};
+	mavlink_camera_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.p1 = packet_in.p1;
+	packet1.p2 = packet_in.p2;
+	packet1.p3 = packet_in.p3;
+	packet1.p4 = packet_in.p4;
+	packet1.img_idx = packet_in.img_idx;
+	packet1.target_system = packet_in.target_system;
+	packet1.cam_idx = packet_in.cam_idx;
+	packet1.event_id = packet_in.event_id;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_camera_status_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.target_system , packet1.cam_idx , packet1.img_idx , packet1.event_id , packet1.p1 , packet1.p2 , packet1.p3 , packet1.p4));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_camera_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_camera_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_camera_feedback(Msgbench_Run &run)
+{
+	mavlink_camera_feedback_t packet_in = {
+		(uint64_t)93372036854775807ULL, (int32_t)963497880, (int32_t)963498088, (float)129.0, (float)157.0, (float)185.0, (float)213.0, (float)241.0, (float)269.0, (uint16_t)19315, (uint8_t)3, (uint8_t)70, (uint8_t)137, (uint16_t)19575
+	};
+	mavlink_camera_feedback_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.lat = packet_in.lat;
+	packet1.lng = packet_in.lng;
+	packet1.alt_msl = packet_in.alt_msl;
+	packet1.alt_rel = packet_in.alt_rel;
+	packet1.roll = packet_in.roll;
+	packet1.pitch = packet_in.pitch;
+	packet1.yaw = packet_in.yaw;
+	packet1.foc_len = packet_in.foc_len;
+	packet1.img_idx = packet_in.img_idx;
+	packet1.target_system = packet_in.target_system;
+	packet1.cam_idx = packet_in.cam_idx;
+	packet1.flags = packet_in.flags;
+	packet1.completed_captures = packet_in.completed_captures;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_camera_feedback_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.target_system , packet1.cam_idx , packet1.img_idx , packet1.lat , packet1.lng , packet1.alt_msl , packet1.alt_rel , packet1.roll , packet1.pitch , packet1.yaw , packet1.foc_len , packet1.flags , packet1.completed_captures));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_camera_feedback_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_camera_feedback_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_battery2(Msgbench_Run &run)
+{
+	mavlink_battery2_t packet_in = {
+		(uint16_t)17235, (int16_t)17339
+	};
+	mavlink_battery2_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.voltage = packet_in.voltage;
+	packet1.current_battery = packet_in.current_battery;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_battery2_pack(run.system_id, run.component_id, &run.message, packet1.voltage , packet1.current_battery));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_battery2_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_battery2_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_ahrs3(Msgbench_Run &run)
+{
+	mavlink_ahrs3_t packet_in = {
+		(float)17.0, (float)45.0, (float)73.0, (float)101.0, (int32_t)963498296, (int32_t)963498504, (float)185.0, (float)213.0, (float)241.0, (float)269.0
+	};
+	mavlink_ahrs3_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.roll = packet_in.roll;
+	packet1.pitch = packet_in.pitch;
+	packet1.yaw = packet_in.yaw;
+	packet1.altitude = packet_in.altitude;
+	packet1.lat = packet_in.lat;
+	packet1.lng = packet_in.lng;
+	packet1.v1 = packet_in.v1;
+	packet1.v2 = packet_in.v2;
+	packet1.v3 = packet_in.v3;
+	packet1.v4 = packet_in.v4;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_ahrs3_pack(run.system_id, run.component_id, &run.message, packet1.roll , packet1.pitch , packet1.yaw , packet1.altitude , packet1.lat , packet1.lng , packet1.v1 , packet1.v2 , packet1.v3 , packet1.v4));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_ahrs3_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_ahrs3_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_autopilot_version_request(Msgbench_Run &run)
+{
+	mavlink_autopilot_version_request_t packet_in = {
+		(uint8_t)5, (uint8_t)72
+	};
+	mavlink_autopilot_version_request_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_autopilot_version_request_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_autopilot_version_request_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_autopilot_version_request_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_remote_log_data_block(Msgbench_Run &run)
+{
+	mavlink_remote_log_data_block_t packet_in = {
+		(uint32_t)963497464, (uint8_t)17, (uint8_t)84, { (uint8_t)151, (uint8_t)152, (uint8_t)153, (uint8_t)154, (uint8_t)155, (uint8_t)156, (uint8_t)157, (uint8_t)158, (uint8_t)159, (uint8_t)160, (uint8_t)161, (uint8_t)162, (uint8_t)163, (uint8_t)164, (uint8_t)165, (uint8_t)166, (uint8_t)167, (uint8_t)168, (uint8_t)169, (uint8_t)170, (uint8_t)171, (uint8_t)172, (uint8_t)173, (uint8_t)174, (uint8_t)175, (uint8_t)176, (uint8_t)177, (uint8_t)178, (uint8_t)179, (uint8_t)180, (uint8_t)181, (uint8_t)182, (uint8_t)183, (uint8_t)184, (uint8_t)185, (uint8_t)186, (uint8_t)187, (uint8_t)188, (uint8_t)189, (uint8_t)190, (uint8_t)191, (uint8_t)192, (uint8_t)193, (uint8_t)194, (uint8_t)195, (uint8_t)196, (uint8_t)197, (uint8_t)198, (uint8_t)199, (uint8_t)200, (uint8_t)201, (uint8_t)202, (uint8_t)203, (uint8_t)204, (uint8_t)205, (uint8_t)206, (uint8_t)207, (uint8_t)208, (uint8_t)209, (uint8_t)210, (uint8_t)211, (uint8_t)212, (uint8_t)213, (uint8_t)214, (uint8_t)215, (uint8_t)216, (uint8_t)217, (uint8_t)218, (uint8_t)219, (uint8_t)220, (uint8_t)221, (uint8_t)222, (uint8_t)223, (uint8_t)224, (uint8_t)225, (uint8_t)226, (uint8_t)227, (uint8_t)228, (uint8_t)229, (uint8_t)230, (uint8_t)231, (uint8_t)232, (uint8_t)233, (uint8_t)234, (uint8_t)235, (uint8_t)236, (uint8_t)237, (uint8_t)238, (uint8_t)239, (uint8_t)240, (uint8_t)241, (uint8_t)242, (uint8_t)243, (uint8_t)244, (uint8_t)245, (uint8_t)246, (uint8_t)247, (uint8_t)248, (uint8_t)249, (uint8_t)250, (uint8_t)251, (uint8_t)252, (uint8_t)253, (uint8_t)254, (uint8_t)255, (uint8_t)0, (uint8_t)1, (uint8_t)2, (uint8_t)3, (uint8_t)4, (uint8_t)5, (uint8_t)6, (uint8_t)7, (uint8_t)8, (uint8_t)9, (uint8_t)10, (uint8_t)11, (uint8_t)12, (uint8_t)13, (uint8_t)14, (uint8_t)15, (uint8_t)16, (uint8_t)17, (uint8_t)18, (uint8_t)19, (uint8_t)20, (uint8_t)21, (uint8_t)22, (uint8_t)23, (uint8_t)24, (uint8_t)25, (uint8_t)26, (uint8_t)27, (uint8_t)28, (uint8_t)29, (uint8_t)30, (uint8_t)31, (uint8_t)32, (uint8_t)33, (uint8_t)34, (uint8_t)35, (uint8_t)36, (uint8_t)37, (uint8_t)38, (uint8_t)39, (uint8_t)40, (uint8_t)41, (uint8_t)42, (uint8_t)43, (uint8_t)44, (uint8_t)45, (uint8_t)46, (uint8_t)47, (uint8_t)48, (uint8_t)49, (uint8_t)50, (uint8_t)51, (uint8_t)52, (uint8_t)53, (uint8_t)54, (uint8_t)55, (uint8_t)56, (uint8_t)57, (uint8_t)58, (uint8_t)59, (uint8_t)60, (uint8_t)61, (uint8_t)62, (uint8_t)63, (uint8_t)64, (uint8_t)65, (uint8_t)66, (uint8_t)67, (uint8_t)68, (uint8_t)69, (uint8_t)70, (uint8_t)71, (uint8_t)72, (uint8_t)73, (uint8_t)74, (uint8_t)75, (uint8_t)76, (uint8_t)77, (uint8_t)78, (uint8_t)79, (uint8_t)80, (uint8_t)81, (uint8_t)82, (uint8_t)83, (uint8_t)84, (uint8_t)85, (uint8_t)86, (uint8_t)87, (uint8_t)88, (uint8_t)89, (uint8_t)90, (uint8_t)91, (uint8_t)92, (uint8_t)93, (uint8_t)94 }
+	};
+	mavlink_remote_log_data_block_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.seqno = packet_in.seqno;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	mav_array_memcpy(packet1.data, packet_in.data, sizeof(uint8_t)*200);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_remote_log_data_block_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.seqno , packet1.data));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_remote_log_data_block_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_remote_log_data_block_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_remote_log_block_status(Msgbench_Run &run)
+{
+	mavlink_remote_log_block_status_t packet_in = {
+		(uint32_t)963497464, (uint8_t)17, (uint8_t)84, (uint8_t)151
+	};
+	mavlink_remote_log_block_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.seqno = packet_in.seqno;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.status = packet_in.status;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_remote_log_block_status_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.seqno , packet1.status));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_remote_log_block_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_remote_log_block_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_led_control(Msgbench_Run &run)
+{
+	mavlink_led_control_t packet_in = {
+		(uint8_t)5, (uint8_t)72, (uint8_t)139, (uint8_t)206, (uint8_t)17, { (uint8_t)84, (uint8_t)85, (uint8_t)86, (uint8_t)87, (uint8_t)88, (uint8_t)89, (uint8_t)90, (uint8_t)91, (uint8_t)92, (uint8_t)93, (uint8_t)94, (uint8_t)95, (uint8_t)96, (uint8_t)97, (uint8_t)98, (uint8_t)99, (uint8_t)100, (uint8_t)101, (uint8_t)102, (uint8_t)103, (uint8_t)104, (uint8_t)105, (uint8_t)106, (uint8_t)107 }
+	};
+	mavlink_led_control_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.instance = packet_in.instance;
+	packet1.pattern = packet_in.pattern;
+	packet1.custom_len = packet_in.custom_len;
+	mav_array_memcpy(packet1.custom_bytes, packet_in.custom_bytes, sizeof(uint8_t)*24);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_led_control_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.instance , packet1.pattern , packet1.custom_len , packet1.custom_bytes));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_led_control_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_led_control_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_mag_cal_progress(Msgbench_Run &run)
+{
+	mavlink_mag_cal_progress_t packet_in = {
+		(float)17.0, (float)45.0, (float)73.0, (uint8_t)41, (uint8_t)108, (uint8_t)175, (uint8_t)242, (uint8_t)53, { (uint8_t)120, (uint8_t)121, (uint8_t)122, (uint8_t)123, (uint8_t)124, (uint8_t)125, (uint8_t)126, (uint8_t)127, (uint8_t)128, (uint8_t)129 }
+	};
+	mavlink_mag_cal_progress_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.direction_x = packet_in.direction_x;
+	packet1.direction_y = packet_in.direction_y;
+	packet1.direction_z = packet_in.direction_z;
+	packet1.compass_id = packet_in.compass_id;
+	packet1.cal_mask = packet_in.cal_mask;
+	packet1.cal_status = packet_in.cal_status;
+	packet1.attempt = packet_in.attempt;
+	packet1.completion_pct = packet_in.completion_pct;
+	mav_array_memcpy(packet1.completion_mask, packet_in.completion_mask, sizeof(uint8_t)*10);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_mag_cal_progress_pack(run.system_id, run.component_id, &run.message, packet1.compass_id , packet1.cal_mask , packet1.cal_status , packet1.attempt , packet1.completion_pct , packet1.completion_mask , packet1.direction_x , packet1.direction_y , packet1.direction_z));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_mag_cal_progress_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_mag_cal_progress_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_mag_cal_report(Msgbench_Run &run)
+{
+	mavlink_mag_cal_report_t packet_in = {
+		(float)17.0, (float)45.0, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, (float)241.0, (float)269.0, (uint8_t)125, (uint8_t)192, (uint8_t)3, (uint8_t)70, (float)325.0, (uint8_t)149, (uint8_t)216, (float)367.0
+	};
+	mavlink_mag_cal_report_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.fitness = packet_in.fitness;
+	packet1.ofs_x = packet_in.ofs_x;
+	packet1.ofs_y = packet_in.ofs_y;
+	packet1.ofs_z = packet_in.ofs_z;
+	packet1.diag_x = packet_in.diag_x;
+	packet1.diag_y = packet_in.diag_y;
+	packet1.diag_z = packet_in.diag_z;
+	packet1.offdiag_x = packet_in.offdiag_x;
+	packet1.offdiag_y = packet_in.offdiag_y;
+	packet1.offdiag_z = packet_in.offdiag_z;
+	packet1.compass_id = packet_in.compass_id;
+	packet1.cal_mask = packet_in.cal_mask;
+	packet1.cal_status = packet_in.cal_status;
+	packet1.autosaved = packet_in.autosaved;
+	packet1.orientation_confidence = packet_in.orientation_confidence;
+	packet1.old_orientation = packet_in.old_orientation;
+	packet1.new_orientation = packet_in.new_orientation;
+	packet1.scale_factor = packet_in.scale_factor;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_mag_cal_report_pack(run.system_id, run.component_id, &run.message, packet1.compass_id , packet1.cal_mask , packet1.cal_status , packet1.autosaved , packet1.fitness , packet1.ofs_x , packet1.ofs_y , packet1.ofs_z , packet1.diag_x , packet1.diag_y , packet1.diag_z , packet1.offdiag_x , packet1.offdiag_y , packet1.offdiag_z , packet1.orientation_confidence , packet1.old_orientation , packet1.new_orientation , packet1.scale_factor));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_mag_cal_report_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_mag_cal_report_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_ekf_status_report(Msgbench_Run &run)
+{
+	mavlink_ekf_status_report_t packet_in = {
+		(float)17.0, (float)45.0, (float)73.0, (float)101.0, (float)129.0, (uint16_t)18275, (float)171.0
+	};
+	mavlink_ekf_status_report_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.velocity_variance = packet_in.velocity_variance;
+	packet1.pos_horiz_variance = packet_in.pos_horiz_variance;
+	packet1.pos_vert_variance = packet_in.pos_vert_variance;
+	packet1.compass_variance = packet_in.compass_variance;
+	packet1.terrain_alt_variance = packet_in.terrain_alt_variance;
+	packet1.flags = packet_in.flags;
+	packet1.airspeed_variance = packet_in.airspeed_variance;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_ekf_status_report_pack(run.system_id, run.component_id, &run.message, packet1.flags , packet1.velocity_variance , packet1.pos_horiz_variance , packet1.pos_vert_variance , packet1.compass_variance , packet1.terrain_alt_variance , packet1.airspeed_variance));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_ekf_status_report_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_ekf_status_report_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_pid_tuning(Msgbench_Run &run)
+{
+	mavlink_pid_tuning_t packet_in = {
+		(float)17.0, (float)45.0, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (uint8_t)77, (float)192.0, (float)220.0
+	};
+	mavlink_pid_tuning_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.desired = packet_in.desired;
+	packet1.achieved = packet_in.achieved;
+	packet1.FF = packet_in.FF;
+	packet1.P = packet_in.P;
+	packet1.I = packet_in.I;
+	packet1.D = packet_in.D;
+	packet1.axis = packet_in.axis;
+	packet1.SRate = packet_in.SRate;
+	packet1.PDmod = packet_in.PDmod;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_pid_tuning_pack(run.system_id, run.component_id, &run.message, packet1.axis , packet1.desired , packet1.achieved , packet1.FF , packet1.P , packet1.I , packet1.D , packet1.SRate , packet1.PDmod));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_pid_tuning_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_pid_tuning_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_deepstall(Msgbench_Run &run)
+{
+	mavlink_deepstall_t packet_in = {
+		(int32_t)963497464, (int32_t)963497672, (int32_t)963497880, (int32_t)963498088, (int32_t)963498296, (int32_t)963498504, (float)185.0, (float)213.0, (float)241.0, (uint8_t)113
+	};
+	mavlink_deepstall_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.landing_lat = packet_in.landing_lat;
+	packet1.landing_lon = packet_in.landing_lon;
+	packet1.path_lat = packet_in.path_lat;
+	packet1.path_lon = packet_in.path_lon;
+	packet1.arc_entry_lat = packet_in.arc_entry_lat;
+	packet1.arc_entry_lon = packet_in.arc_entry_lon;
+	packet1.altitude = packet_in.altitude;
+	packet1.expected_travel_distance = packet_in.expected_travel_distance;
+	packet1.cross_track_error = packet_in.cross_track_error;
+	packet1.stage = packet_in.stage;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_deepstall_pack(run.system_id, run.component_id, &run.message, packet1.landing_lat , packet1.landing_lon , packet1.path_lat , packet1.path_lon , packet1.arc_entry_lat , packet1.arc_entry_lon , packet1.altitude , packet1.expected_travel_distance , packet1.cross_track_error , packet1.stage));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_deepstall_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_deepstall_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_gimbal_report(Msgbench_Run &run)
+{
+	mavlink_gimbal_report_t packet_in = {
+		(float)17.0, (float)45.0, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, (float)241.0, (float)269.0, (uint8_t)125, (uint8_t)192
+	};
+	mavlink_gimbal_report_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.delta_time = packet_in.delta_time;
+	packet1.delta_angle_x = packet_in.delta_angle_x;
+	packet1.delta_angle_y = packet_in.delta_angle_y;
+	packet1.delta_angle_z = packet_in.delta_angle_z;
+	packet1.delta_velocity_x = packet_in.delta_velocity_x;
+	packet1.delta_velocity_y = packet_in.delta_velocity_y;
+	packet1.delta_velocity_z = packet_in.delta_velocity_z;
+	packet1.joint_roll = packet_in.joint_roll;
+	packet1.joint_el = packet_in.joint_el;
+	packet1.joint_az = packet_in.joint_az;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_gimbal_report_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.delta_time , packet1.delta_angle_x , packet1.delta_angle_y , packet1.delta_angle_z , packet1.delta_velocity_x , packet1.delta_velocity_y , packet1.delta_velocity_z , packet1.joint_roll , packet1.joint_el , packet1.joint_az));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_gimbal_report_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_gimbal_report_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_gimbal_control(Msgbench_Run &run)
+{
+	mavlink_gimbal_control_t packet_in = {
+		(float)17.0, (float)45.0, (float)73.0, (uint8_t)41, (uint8_t)108
+	};
+	mavlink_gimbal_control_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.demanded_rate_x = packet_in.demanded_rate_x;
+	packet1.demanded_rate_y = packet_in.demanded_rate_y;
+	packet1.demanded_rate_z = packet_in.demanded_rate_z;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_gimbal_control_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.demanded_rate_x , packet1.demanded_rate_y , packet1.demanded_rate_z));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_gimbal_control_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_gimbal_control_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_gimbal_torque_cmd_report(Msgbench_Run &run)
+{
+	mavlink_gimbal_torque_cmd_report_t packet_in = {
+		(int16_t)17235, (int16_t)17339, (int16_t)17443, (uint8_t)151, (uint8_t)218
+	};
+	mavlink_gimbal_torque_cmd_report_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.rl_torque_cmd = packet_in.rl_torque_cmd;
+	packet1.el_torque_cmd = packet_in.el_torque_cmd;
+	packet1.az_torque_cmd = packet_in.az_torque_cmd;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_gimbal_torque_cmd_report_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.rl_torque_cmd , packet1.el_torque_cmd , packet1.az_torque_cmd));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_gimbal_torque_cmd_report_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_gimbal_torque_cmd_report_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_gopro_heartbeat(Msgbench_Run &run)
+{
+	mavlink_gopro_heartbeat_t packet_in = {
+		(uint8_t)5, (uint8_t)72, (uint8_t)139
+	};
+	mavlink_gopro_heartbeat_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.status = packet_in.status;
+	packet1.capture_mode = packet_in.capture_mode;
+	packet1.flags = packet_in.flags;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_gopro_heartbeat_pack(run.system_id, run.component_id, &run.message, packet1.status , packet1.capture_mode , packet1.flags));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_gopro_heartbeat_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_gopro_heartbeat_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_gopro_get_request(Msgbench_Run &run)
+{
+	mavlink_gopro_get_request_t packet_in = {
+		(uint8_t)5, (uint8_t)72, (uint8_t)139
+	};
+	mavlink_gopro_get_request_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.cmd_id = packet_in.cmd_id;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_gopro_get_request_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.cmd_id));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_gopro_get_request_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_gopro_get_request_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_gopro_get_response(Msgbench_Run &run)
+{
+	mavlink_gopro_get_response_t packet_in = {
+		(uint8_t)5, (uint8_t)72, { (uint8_t)139, (uint8_t)140, (uint8_t)141, (uint8_t)142 }
+	};
+	mavlink_gopro_get_response_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.cmd_id = packet_in.cmd_id;
+	packet1.status = packet_in.status;
+	mav_array_memcpy(packet1.value, packet_in.value, sizeof(uint8_t)*4);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_gopro_get_response_pack(run.system_id, run.component_id, &run.message, packet1.cmd_id , packet1.status , packet1.value));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_gopro_get_response_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_gopro_get_response_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_gopro_set_request(Msgbench_Run &run)
+{
+	mavlink_gopro_set_request_t packet_in = {
+		(uint8_t)5, (uint8_t)72, (uint8_t)139, { (uint8_t)206, (uint8_t)207, (uint8_t)208, (uint8_t)209 }
+	};
+	mavlink_gopro_set_request_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.cmd_id = packet_in.cmd_id;
+	mav_array_memcpy(packet1.value, packet_in.value, sizeof(uint8_t)*4);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_gopro_set_request_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.cmd_id , packet1.value));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_gopro_set_request_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_gopro_set_request_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_gopro_set_response(Msgbench_Run &run)
+{
+	mavlink_gopro_set_response_t packet_in = {
+		(uint8_t)5, (uint8_t)72
+	};
+	mavlink_gopro_set_response_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.cmd_id = packet_in.cmd_id;
+	packet1.status = packet_in.status;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_gopro_set_response_pack(run.system_id, run.component_id, &run.message, packet1.cmd_id , packet1.status));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_gopro_set_response_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_gopro_set_response_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_efi_status(Msgbench_Run &run)
+{
+	mavlink_efi_status_t packet_in = {
+		(float)17.0, (float)45.0, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, (float)241.0, (float)269.0, (float)297.0, (float)325.0, (float)353.0, (float)381.0, (float)409.0, (float)437.0, (uint8_t)197, (float)472.0, (float)500.0
+	};
+	mavlink_efi_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.ecu_index = packet_in.ecu_index;
+	packet1.rpm = packet_in.rpm;
+	packet1.fuel_consumed = packet_in.fuel_consumed;
+	packet1.fuel_flow = packet_in.fuel_flow;
+	packet1.engine_load = packet_in.engine_load;
+	packet1.throttle_position = packet_in.throttle_position;
+	packet1.spark_dwell_time = packet_in.spark_dwell_time;
+	packet1.barometric_pressure = packet_in.barometric_pressure;
+	packet1.intake_manifold_pressure = packet_in.intake_manifold_pressure;
+	packet1.intake_manifold_temperature = packet_in.intake_manifold_temperature;
+	packet1.cylinder_head_temperature = packet_in.cylinder_head_temperature;
+	packet1.ignition_timing = packet_in.ignition_timing;
+	packet1.injection_time = packet_in.injection_time;
+	packet1.exhaust_gas_temperature = packet_in.exhaust_gas_temperature;
+	packet1.throttle_out = packet_in.throttle_out;
+	packet1.pt_compensation = packet_in.pt_compensation;
+	packet1.health = packet_in.health;
+	packet1.ignition_voltage = packet_in.ignition_voltage;
+	packet1.fuel_pressure = packet_in.fuel_pressure;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_efi_status_pack(run.system_id, run.component_id, &run.message, packet1.health , packet1.ecu_index , packet1.rpm , packet1.fuel_consumed , packet1.fuel_flow , packet1.engine_load , packet1.throttle_position , packet1.spark_dwell_time , packet1.barometric_pressure , packet1.intake_manifold_pressure , packet1.intake_manifold_temperature , packet1.cylinder_head_temperature , packet1.ignition_timing , packet1.injection_time , packet1.exhaust_gas_temperature , packet1.throttle_out , packet1.pt_compensation , packet1.ignition_voltage , packet1.fuel_pressure));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_efi_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_efi_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_rpm(Msgbench_Run &run)
+{
+	mavlink_rpm_t packet_in = {
+		(float)17.0, (float)45.0
+	};
+	mavlink_rpm_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.rpm1 = packet_in.rpm1;
+	packet1.rpm2 = packet_in.rpm2;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_rpm_pack(run.system_id, run.component_id, &run.message, packet1.rpm1 , packet1.rpm2));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_rpm_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_rpm_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_estimator_status(Msgbench_Run &run)
+{
+	mavlink_estimator_status_t packet_in = {
+		(uint64_t)93372036854775807ULL, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, (float)241.0, (float)269.0, (uint16_t)19315
+	};
+	mavlink_estimator_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.vel_ratio = packet_in.vel_ratio;
+	packet1.pos_horiz_ratio = packet_in.pos_horiz_ratio;
+	packet1.pos_vert_ratio = packet_in.pos_vert_ratio;
+	packet1.mag_ratio = packet_in.mag_ratio;
+	packet1.hagl_ratio = packet_in.hagl_ratio;
+	packet1.tas_ratio = packet_in.tas_ratio;
+	packet1.pos_horiz_accuracy = packet_in.pos_horiz_accuracy;
+	packet1.pos_vert_accuracy = packet_in.pos_vert_accuracy;
+	packet1.flags = packet_in.flags;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_estimator_status_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.flags , packet1.vel_ratio , packet1.pos_horiz_ratio , packet1.pos_vert_ratio , packet1.mag_ratio , packet1.hagl_ratio , packet1.tas_ratio , packet1.pos_horiz_accuracy , packet1.pos_vert_accuracy));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_estimator_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_estimator_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_wind_cov(Msgbench_Run &run)
+{
+	mavlink_wind_cov_t packet_in = {
+		(uint64_t)93372036854775807ULL, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, (float)241.0, (float)269.0
+	};
+	mavlink_wind_cov_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.wind_x = packet_in.wind_x;
+	packet1.wind_y = packet_in.wind_y;
+	packet1.wind_z = packet_in.wind_z;
+	packet1.var_horiz = packet_in.var_horiz;
+	packet1.var_vert = packet_in.var_vert;
+	packet1.wind_alt = packet_in.wind_alt;
+	packet1.horiz_accuracy = packet_in.horiz_accuracy;
+	packet1.vert_accuracy = packet_in.vert_accuracy;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_wind_cov_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.wind_x , packet1.wind_y , packet1.wind_z , packet1.var_horiz , packet1.var_vert , packet1.wind_alt , packet1.horiz_accuracy , packet1.vert_accuracy));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_wind_cov_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_wind_cov_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_gps_input(Msgbench_Run &run)
+{
+	mavlink_gps_input_t packet_in = {
+		(uint64_t)93372036854775807ULL, (uint32_t)963497880, (int32_t)963498088, (int32_t)963498296, (float)157.0, (float)185.0, (float)213.0, (float)241.0, (float)269.0, (float)297.0, (float)325.0, (float)353.0, (float)381.0, (uint16_t)20147, (uint16_t)20251, (uint8_t)185, (uint8_t)252, (uint8_t)63, (uint16_t)20511
+	};
+	mavlink_gps_input_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.time_week_ms = packet_in.time_week_ms;
+	packet1.lat = packet_in.lat;
+	packet1.lon = packet_in.lon;
+	packet1.alt = packet_in.alt;
+	packet1.hdop = packet_in.hdop;
+	packet1.vdop = packet_in.vdop;
+	packet1.vn = packet_in.vn;
+	packet1.ve = packet_in.ve;
+	packet1.vd = packet_in.vd;
+	packet1.speed_accuracy = packet_in.speed_accuracy;
+	packet1.horiz_accuracy = packet_in.horiz_accuracy;
+	packet1.vert_accuracy = packet_in.vert_accuracy;
+	packet1.ignore_flags = packet_in.ignore_flags;
+	packet1.time_week = packet_in.time_week;
+	packet1.gps_id = packet_in.gps_id;
+	packet1.fix_type = packet_in.fix_type;
+	packet1.satellites_visible = packet_in.satellites_visible;
+	packet1.yaw = packet_in.yaw;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_gps_input_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.gps_id , packet1.ignore_flags , packet1.time_week_ms , packet1.time_week , packet1.fix_type , packet1.lat , packet1.lon , packet1.alt , packet1.hdop , packet1.vdop , packet1.vn , packet1.ve , packet1.vd , packet1.speed_accuracy , packet1.horiz_accuracy , packet1.vert_accuracy , packet1.satellites_visible , packet1.yaw));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_gps_input_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_gps_input_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_gps_rtcm_data(Msgbench_Run &run)
+{
+	mavlink_gps_rtcm_data_t packet_in = {
+		(uint8_t)5, (uint8_t)72, { (uint8_t)139, (uint8_t)140, (uint8_t)141, (uint8_t)142, (uint8_t)143, (uint8_t)144, (uint8_t)145, (uint8_t)146, (uint8_t)147, (uint8_t)148, (uint8_t)149, (uint8_t)150, (uint8_t)151, (uint8_t)152, (uint8_t)153, (uint8_t)154, (uint8_t)155, (uint8_t)156, (uint8_t)157, (uint8_t)158, (uint8_t)159, (uint8_t)160, (uint8_t)161, (uint8_t)162, (uint8_t)163, (uint8_t)164, (uint8_t)165, (uint8_t)166, (uint8_t)167, (uint8_t)168, (uint8_t)169, (uint8_t)170, (uint8_t)171, (uint8_t)172, (uint8_t)173, (uint8_t)174, (uint8_t)175, (uint8_t)176, (uint8_t)177, (uint8_t)178, (uint8_t)179, (uint8_t)180, (uint8_t)181, (uint8_t)182, (uint8_t)183, (uint8_t)184, (uint8_t)185, (uint8_t)186, (uint8_t)187, (uint8_t)188, (uint8_t)189, (uint8_t)190, (uint8_t)191, (uint8_t)192, (uint8_t)193, (uint8_t)194, (uint8_t)195, (uint8_t)196, (uint8_t)197, (uint8_t)198, (uint8_t)199, (uint8_t)200, (uint8_t)201, (uint8_t)202, (uint8_t)203, (uint8_t)204, (uint8_t)205, (uint8_t)206, (uint8_t)207, (uint8_t)208, (uint8_t)209, (uint8_t)210, (uint8_t)211, (uint8_t)212, (uint8_t)213, (uint8_t)214, (uint8_t)215, (uint8_t)216, (uint8_t)217, (uint8_t)218, (uint8_t)219, (uint8_t)220, (uint8_t)221, (uint8_t)222, (uint8_t)223, (uint8_t)224, (uint8_t)225, (uint8_t)226, (uint8_t)227, (uint8_t)228, (uint8_t)229, (uint8_t)230, (uint8_t)231, (uint8_t)232, (uint8_t)233, (uint8_t)234, (uint8_t)235, (uint8_t)236, (uint8_t)237, (uint8_t)238, (uint8_t)239, (uint8_t)240, (uint8_t)241, (uint8_t)242, (uint8_t)243, (uint8_t)244, (uint8_t)245, (uint8_t)246, (uint8_t)247, (uint8_t)248, (uint8_t)249, (uint8_t)250, (uint8_t)251, (uint8_t)252, (uint8_t)253, (uint8_t)254, (uint8_t)255, (uint8_t)0, (uint8_t)1, (uint8_t)2, (uint8_t)3, (uint8_t)4, (uint8_t)5, (uint8_t)6, (uint8_t)7, (uint8_t)8, (uint8_t)9, (uint8_t)10, (uint8_t)11, (uint8_t)12, (uint8_t)13, (uint8_t)14, (uint8_t)15, (uint8_t)16, (uint8_t)17, (uint8_t)18, (uint8_t)19, (uint8_t)20, (uint8_t)21, (uint8_t)22, (uint8_t)23, (uint8_t)24, (uint8_t)25, (uint8_t)26, (uint8_t)27, (uint8_t)28, (uint8_t)29, (uint8_t)30, (uint8_t)31, (uint8_t)32, (uint8_t)33, (uint8_t)34, (uint8_t)35, (uint8_t)36, (uint8_t)37, (uint8_t)38, (uint8_t)39, (uint8_t)40, (uint8_t)41, (uint8_t)42, (uint8_t)43, (uint8_t)44, (uint8_t)45, (uint8_t)46, (uint8_t)47, (uint8_t)48, (uint8_t)49, (uint8_t)50, (uint8_t)51, (uint8_t)52, (uint8_t)53, (uint8_t)54, (uint8_t)55, (uint8_t)56, (uint8_t)57, (uint8_t)58, (uint8_t)59, (uint8_t)60, (uint8_t)61, (uint8_t)62 }
+	};
+	mavlink_gps_rtcm_data_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.flags = packet_in.flags;
+	packet1.len = packet_in.len;
+	mav_array_memcpy(packet1.data, packet_in.data, sizeof(uint8_t)*180);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_gps_rtcm_data_pack(run.system_id, run.component_id, &run.message, packet1.flags , packet1.len , packet1.data));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_gps_rtcm_data_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_gps_rtcm_data_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_high_latency(Msgbench_Run &run)
+{
+	mavlink_high_latency_t packet_in = {
+		(uint32_t)963497464, (int32_t)963497672, (int32_t)963497880, (int16_t)17859, (int16_t)17963, (uint16_t)18067, (int16_t)18171, (int16_t)18275, (int16_t)18379, (uint16_t)18483, (uint8_t)211, (uint8_t)22, (int8_t)89, (uint8_t)156, (uint8_t)223, (uint8_t)34, (int8_t)101, (uint8_t)168, (uint8_t)235, (uint8_t)46, (int8_t)113, (int8_t)180, (uint8_t)247, (uint8_t)58
+	};
+	mavlink_high_latency_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.custom_mode = packet_in.custom_mode;
+	packet1.latitude = packet_in.latitude;
+	packet1.longitude = packet_in.longitude;
+	packet1.roll = packet_in.roll;
+	packet1.pitch = packet_in.pitch;
+	packet1.heading = packet_in.heading;
+	packet1.heading_sp = packet_in.heading_sp;
+	packet1.altitude_amsl = packet_in.altitude_amsl;
+	packet1.altitude_sp = packet_in.altitude_sp;
+	packet1.wp_distance = packet_in.wp_distance;
+	packet1.base_mode = packet_in.base_mode;
+	packet1.landed_state = packet_in.landed_state;
+	packet1.throttle = packet_in.throttle;
+	packet1.airspeed = packet_in.airspeed;
+	packet1.airspeed_sp = packet_in.airspeed_sp;
+	packet1.groundspeed = packet_in.groundspeed;
+	packet1.climb_rate = packet_in.climb_rate;
+	packet1.gps_nsat = packet_in.gps_nsat;
+	packet1.gps_fix_type = packet_in.gps_fix_type;
+	packet1.battery_remaining = packet_in.battery_remaining;
+	packet1.temperature = packet_in.temperature;
+	packet1.temperature_air = packet_in.temperature_air;
+	packet1.failsafe = packet_in.failsafe;
+	packet1.wp_num = packet_in.wp_num;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_high_latency_pack(run.system_id, run.component_id, &run.message, packet1.base_mode , packet1.custom_mode , packet1.landed_state , packet1.roll , packet1.pitch , packet1.heading , packet1.throttle , packet1.heading_sp , packet1.latitude , packet1.longitude , packet1.altitude_amsl , packet1.altitude_sp , packet1.airspeed , packet1.airspeed_sp , packet1.groundspeed , packet1.climb_rate , packet1.gps_nsat , packet1.gps_fix_type , packet1.battery_remaining , packet1.temperature , packet1.temperature_air , packet1.failsafe , packet1.wp_num , packet1.wp_distance));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_high_latency_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_high_latency_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_high_latency2(Msgbench_Run &run)
+{
+	mavlink_high_latency2_t packet_in = {
+		(uint32_t)963497464, (int32_t)963497672, (int32_t)963497880, (uint16_t)17859, (int16_t)17963, (int16_t)18067, (uint16_t)18171, (uint16_t)18275, (uint16_t)18379, (uint8_t)77, (uint8_t)144, (uint8_t)211, (uint8_t)22, (uint8_t)89, (uint8_t)156, (uint8_t)223, (uint8_t)34, (uint8_t)101, (uint8_t)168, (uint8_t)235, (uint8_t)46, (int8_t)113, (int8_t)180, (int8_t)247, (int8_t)58, (int8_t)125, (int8_t)192
+	};
+	mavlink_high_latency2_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.timestamp = packet_in.timestamp;
+	packet1.latitude = packet_in.latitude;
+	packet1.longitude = packet_in.longitude;
+	packet1.custom_mode = packet_in.custom_mode;
+	packet1.altitude = packet_in.altitude;
+	packet1.target_altitude = packet_in.target_altitude;
+	packet1.target_distance = packet_in.target_distance;
+	packet1.wp_num = packet_in.wp_num;
+	packet1.failure_flags = packet_in.failure_flags;
+	packet1.type = packet_in.type;
+	packet1.autopilot = packet_in.autopilot;
+	packet1.heading = packet_in.heading;
+	packet1.target_heading = packet_in.target_heading;
+	packet1.throttle = packet_in.throttle;
+	packet1.airspeed = packet_in.airspeed;
+	packet1.airspeed_sp = packet_in.airspeed_sp;
+	packet1.groundspeed = packet_in.groundspeed;
+	packet1.windspeed = packet_in.windspeed;
+	packet1.wind_heading = packet_in.wind_heading;
+	packet1.eph = packet_in.eph;
+	packet1.epv = packet_in.epv;
+	packet1.temperature_air = packet_in.temperature_air;
+	packet1.climb_rate = packet_in.climb_rate;
+	packet1.battery = packet_in.battery;
+	packet1.custom0 = packet_in.custom0;
+	packet1.custom1 = packet_in.custom1;
+	packet1.custom2 = packet_in.custom2;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_high_latency2_pack(run.system_id, run.component_id, &run.message, packet1.timestamp , packet1.type , packet1.autopilot , packet1.custom_mode , packet1.latitude , packet1.longitude , packet1.altitude , packet1.target_altitude , packet1.heading , packet1.target_heading , packet1.target_distance , packet1.throttle , packet1.airspeed , packet1.airspeed_sp , packet1.groundspeed , packet1.windspeed , packet1.wind_heading , packet1.eph , packet1.epv , packet1.temperature_air , packet1.climb_rate , packet1.battery , packet1.wp_num , packet1.failure_flags , packet1.custom0 , packet1.custom1 , packet1.custom2));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_high_latency2_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_high_latency2_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_vibration(Msgbench_Run &run)
+{
+	mavlink_vibration_t packet_in = {
+		(uint64_t)93372036854775807ULL, (float)73.0, (float)101.0, (float)129.0, (uint32_t)963498504, (uint32_t)963498712, (uint32_t)963498920
+	};
+	mavlink_vibration_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.vibration_x = packet_in.vibration_x;
+	packet1.vibration_y = packet_in.vibration_y;
+	packet1.vibration_z = packet_in.vibration_z;
+	packet1.clipping_0 = packet_in.clipping_0;
+	packet1.clipping_1 = packet_in.clipping_1;
+	packet1.clipping_2 = packet_in.clipping_2;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_vibration_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.vibration_x , packet1.vibration_y , packet1.vibration_z , packet1.clipping_0 , packet1.clipping_1 , packet1.clipping_2));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_vibration_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_vibration_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_home_position(Msgbench_Run &run)
+{
+	mavlink_home_position_t packet_in = {
+		(int32_t)963497464, (int32_t)963497672, (int32_t)963497880, (float)101.0, (float)129.0, (float)157.0, { (float)185.0, (float)186.0, (float)187.0, (float)188.0 }, (float)297.0, (float)325.0, (float)353.0, (uint64_t)93372036854779083ULL
+	};
+	mavlink_home_position_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.latitude = packet_in.latitude;
+	packet1.longitude = packet_in.longitude;
+	packet1.altitude = packet_in.altitude;
+	packet1.x = packet_in.x;
+	packet1.y = packet_in.y;
+	packet1.z = packet_in.z;
+	packet1.approach_x = packet_in.approach_x;
+	packet1.approach_y = packet_in.approach_y;
+	packet1.approach_z = packet_in.approach_z;
+	packet1.time_usec = packet_in.time_usec;
+	mav_array_memcpy(packet1.q, packet_in.q, sizeof(float)*4);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_home_position_pack(run.system_id, run.component_id, &run.message, packet1.latitude , packet1.longitude , packet1.altitude , packet1.x , packet1.y , packet1.z , packet1.q , packet1.approach_x , packet1.approach_y , packet1.approach_z , packet1.time_usec));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_home_position_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_home_position_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_set_home_position(Msgbench_Run &run)
+{
+	mavlink_set_home_position_t packet_in = {
+		(int32_t)963497464, (int32_t)963497672, (int32_t)963497880, (float)101.0, (float)129.0, (float)157.0, { (float)185.0, (float)186.0, (float)187.0, (float)188.0 }, (float)297.0, (float)325.0, (float)353.0, (uint8_t)161, (uint64_t)93372036854779146ULL
+	};
+	mavlink_set_home_position_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.latitude = packet_in.latitude;
+	packet1.longitude = packet_in.longitude;
+	packet1.altitude = packet_in.altitude;
+	packet1.x = packet_in.x;
+	packet1.y = packet_in.y;
+	packet1.z = packet_in.z;
+	packet1.approach_x = packet_in.approach_x;
+	packet1.approach_y = packet_in.approach_y;
+	packet1.approach_z = packet_in.approach_z;
+	packet1.target_system = packet_in.target_system;
+	packet1.time_usec = packet_in.time_usec;
+	mav_array_memcpy(packet1.q, packet_in.q, sizeof(float)*4);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_set_home_position_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.latitude , packet1.longitude , packet1.altitude , packet1.x , packet1.y , packet1.z , packet1.q , packet1.approach_x , packet1.approach_y , packet1.approach_z , packet1.time_usec));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_set_home_position_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_set_home_position_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_message_interval(Msgbench_Run &run)
+{
+	mavlink_message_interval_t packet_in = {
+		(int32_t)963497464, (uint16_t)17443
+	};
+	mavlink_message_interval_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.interval_us = packet_in.interval_us;
+	packet1.message_id = packet_in.message_id;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_message_interval_pack(run.system_id, run.component_id, &run.message, packet1.message_id , packet1.interval_us));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_message_interval_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_message_interval_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_extended_sys_state(Msgbench_Run &run)
+{
+	mavlink_extended_sys_state_t packet_in = {
+		(uint8_t)5, (uint8_t)72
+	};
+	mavlink_extended_sys_state_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.vtol_state = packet_in.vtol_state;
+	packet1.landed_state = packet_in.landed_state;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_extended_sys_state_pack(run.system_id, run.component_id, &run.message, packet1.vtol_state , packet1.landed_state));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_extended_sys_state_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_extended_sys_state_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_adsb_vehicle(Msgbench_Run &run)
+{
+	mavlink_adsb_vehicle_t packet_in = {
+		(uint32_t)963497464, (int32_t)963497672, (int32_t)963497880, (int32_t)963498088, (uint16_t)18067, (uint16_t)18171, (int16_t)18275, (uint16_t)18379, (uint16_t)18483, (uint8_t)211, "BCDEFGHI", (uint8_t)113, (uint8_t)180
+	};
+	mavlink_adsb_vehicle_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.ICAO_address = packet_in.ICAO_address;
+	packet1.lat = packet_in.lat;
+	packet1.lon = packet_in.lon;
+	packet1.altitude = packet_in.altitude;
+	packet1.heading = packet_in.heading;
+	packet1.hor_velocity = packet_in.hor_velocity;
+	packet1.ver_velocity = packet_in.ver_velocity;
+	packet1.flags = packet_in.flags;
+	packet1.squawk = packet_in.squawk;
+	packet1.altitude_type = packet_in.altitude_type;
+	packet1.emitter_type = packet_in.emitter_type;
+	packet1.tslc = packet_in.tslc;
+	mav_array_memcpy(packet1.callsign, packet_in.callsign, sizeof(char)*9);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_adsb_vehicle_pack(run.system_id, run.component_id, &run.message, packet1.ICAO_address , packet1.lat , packet1.lon , packet1.altitude_type , packet1.altitude , packet1.heading , packet1.hor_velocity , packet1.ver_velocity , packet1.callsign , packet1.emitter_type , packet1.tslc , packet1.flags , packet1.squawk));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_adsb_vehicle_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_adsb_vehicle_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_collision(Msgbench_Run &run)
+{
+	mavlink_collision_t packet_in = {
+		(uint32_t)963497464, (float)45.0, (float)73.0, (float)101.0, (uint8_t)53, (uint8_t)120, (uint8_t)187
+	};
+	mavlink_collision_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.id = packet_in.id;
+	packet1.time_to_minimum_delta = packet_in.time_to_minimum_delta;
+	packet1.altitude_minimum_delta = packet_in.altitude_minimum_delta;
+	packet1.horizontal_minimum_delta = packet_in.horizontal_minimum_delta;
+	packet1.src = packet_in.src;
+	packet1.action = packet_in.action;
+	packet1.threat_level = packet_in.threat_level;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_collision_pack(run.system_id, run.component_id, &run.message, packet1.src , packet1.id , packet1.action , packet1.threat_level , packet1.time_to_minimum_delta , packet1.altitude_minimum_delta , packet1.horizontal_minimum_delta));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_collision_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_collision_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_v2_extension(Msgbench_Run &run)
+{
+	mavlink_v2_extension_t packet_in = {
+		(uint16_t)17235, (uint8_t)139, (uint8_t)206, (uint8_t)17, { (uint8_t)84, (uint8_t)85, (uint8_t)86, (uint8_t)87, (uint8_t)88, (uint8_t)89, (uint8_t)90, (uint8_t)91, (uint8_t)92, (uint8_t)93, (uint8_t)94, (uint8_t)95, (uint8_t)96, (uint8_t)97, (uint8_t)98, (uint8_t)99, (uint8_t)100, (uint8_t)101, (uint8_t)102, (uint8_t)103, (uint8_t)104, (uint8_t)105, (uint8_t)106, (uint8_t)107, (uint8_t)108, (uint8_t)109, (uint8_t)110, (uint8_t)111, (uint8_t)112, (uint8_t)113, (uint8_t)114, (uint8_t)115, (uint8_t)116, (uint8_t)117, (uint8_t)118, (uint8_t)119, (uint8_t)120, (uint8_t)121, (uint8_t)122, (uint8_t)123, (uint8_t)124, (uint8_t)125, (uint8_t)126, (uint8_t)127, (uint8_t)128, (uint8_t)129, (uint8_t)130, (uint8_t)131, (uint8_t)132, (uint8_t)133, (uint8_t)134, (uint8_t)135, (uint8_t)136, (uint8_t)137, (uint8_t)138, (uint8_t)139, (uint8_t)140, (uint8_t)141, (uint8_t)142, (uint8_t)143, (uint8_t)144, (uint8_t)145, (uint8_t)146, (uint8_t)147, (uint8_t)148, (uint8_t)149, (uint8_t)150, (uint8_t)151, (uint8_t)152, (uint8_t)153, (uint8_t)154, (uint8_t)155, (uint8_t)156, (uint8_t)157, (uint8_t)158, (uint8_t)159, (uint8_t)160, (uint8_t)161, (uint8_t)162, (uint8_t)163, (uint8_t)164, (uint8_t)165, (uint8_t)166, (uint8_t)167, (uint8_t)168, (uint8_t)169, (uint8_t)170, (uint8_t)171, (uint8_t)172, (uint8_t)173, (uint8_t)174, (uint8_t)175, (uint8_t)176, (uint8_t)177, (uint8_t)178, (uint8_t)179, (uint8_t)180, (uint8_t)181, (uint8_t)182, (uint8_t)183, (uint8_t)184, (uint8_t)185, (uint8_t)186, (uint8_t)187, (uint8_t)188, (uint8_t)189, (uint8_t)190, (uint8_t)191, (uint8_t)192, (uint8_t)193, (uint8_t)194, (uint8_t)195, (uint8_t)196, (uint8_t)197, (uint8_t)198, (uint8_t)199, (uint8_t)200, (uint8_t)201, (uint8_t)202, (uint8_t)203, (uint8_t)204, (uint8_t)205, (uint8_t)206, (uint8_t)207, (uint8_t)208, (uint8_t)209, (uint8_t)210, (uint8_t)211, (uint8_t)212, (uint8_t)213, (uint8_t)214, (uint8_t)215, (uint8_t)216, (uint8_t)217, (uint8_t)218, (uint8_t)219, (uint8_t)220, (uint8_t)221, (uint8_t)222, (uint8_t)223, (uint8_t)224, (uint8_t)225, (uint8_t)226, (uint8_t)227, (uint8_t)228, (uint8_t)229, (uint8_t)230, (uint8_t)231, (uint8_t)232, (uint8_t)233, (uint8_t)234, (uint8_t)235, (uint8_t)236, (uint8_t)237, (uint8_t)238, (uint8_t)239, (uint8_t)240, (uint8_t)241, (uint8_t)242, (uint8_t)243, (uint8_t)244, (uint8_t)245, (uint8_t)246, (uint8_t)247, (uint8_t)248, (uint8_t)249, (uint8_t)250, (uint8_t)251, (uint8_t)252, (uint8_t)253, (uint8_t)254, (uint8_t)255, (uint8_t)0, (uint8_t)1, (uint8_t)2, (uint8_t)3, (uint8_t)4, (uint8_t)5, (uint8_t)6, (uint8_t)7, (uint8_t)8, (uint8_t)9, (uint8_t)10, (uint8_t)11, (uint8_t)12, (uint8_t)13, (uint8_t)14, (uint8_t)15, (uint8_t)16, (uint8_t)17, (uint8_t)18, (uint8_t)19, (uint8_t)20, (uint8_t)21, (uint8_t)22, (uint8_t)23, (uint8_t)24, (uint8_t)25, (uint8_t)26, (uint8_t)27, (uint8_t)28, (uint8_t)29, (uint8_t)30, (uint8_t)31, (uint8_t)32, (uint8_t)33, (uint8_t)34, (uint8_t)35, (uint8_t)36, (uint8_t)37, (uint8_t)38, (uint8_t)39, (uint8_t)40, (uint8_t)41, (uint8_t)42, (uint8_t)43, (uint8_t)44, (uint8_t)45, (uint8_t)46, (uint8_t)47, (uint8_t)48, (uint8_t)49, (uint8_t)50, (uint8_t)51, (uint8_t)52, (uint8_t)53, (uint8_t)54, (uint8_t)55, (uint8_t)56, (uint8_t)57, (uint8_t)58, (uint8_t)59, (uint8_t)60, (uint8_t)61, (uint8_t)62, (uint8_t)63, (uint8_t)64, (uint8_t)65, (uint8_t)66, (uint8_t)67, (uint8_t)68, (uint8_t)69, (uint8_t)70, (uint8_t)71, (uint8_t)72, (uint8_t)73, (uint8_t)74, (uint8_t)75, (uint8_t)76 }
+	};
+	mavlink_v2_extension_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.message_type = packet_in.message_type;
+	packet1.target_network = packet_in.target_network;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	mav_array_memcpy(packet1.payload, packet_in.payload, sizeof(uint8_t)*249);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_v2_extension_pack(run.system_id, run.component_id, &run.message, packet1.target_network , packet1.target_system , packet1.target_component , packet1.message_type , packet1.payload));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_v2_extension_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_v2_extension_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_memory_vect(Msgbench_Run &run)
+{
+	mavlink_memory_vect_t packet_in = {
+		(uint16_t)17235, (uint8_t)139, (uint8_t)206, { (int8_t)17, (int8_t)18, (int8_t)19, (int8_t)20, (int8_t)21, (int8_t)22, (int8_t)23, (int8_t)24, (int8_t)25, (int8_t)26, (int8_t)27, (int8_t)28, (int8_t)29, (int8_t)30, (int8_t)31, (int8_t)32, (int8_t)33, (int8_t)34, (int8_t)35, (int8_t)36, (int8_t)37, (int8_t)38, (int8_t)39, (int8_t)40, (int8_t)41, (int8_t)42, (int8_t)43, (int8_t)44, (int8_t)45, (int8_t)46, (int8_t)47, (int8_t)48 }
+	};
+	mavlink_memory_vect_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.address = packet_in.address;
+	packet1.ver = packet_in.ver;
+	packet1.type = packet_in.type;
+	mav_array_memcpy(packet1.value, packet_in.value, sizeof(int8_t)*32);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_memory_vect_pack(run.system_id, run.component_id, &run.message, packet1.address , packet1.ver , packet1.type , packet1.value));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_memory_vect_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_memory_vect_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_debug_vect(Msgbench_Run &run)
+{
+	mavlink_debug_vect_t packet_in = {
+		(uint64_t)93372036854775807ULL, (float)73.0, (float)101.0, (float)129.0, "UVWXYZABC"
+	};
+	mavlink_debug_vect_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.x = packet_in.x;
+	packet1.y = packet_in.y;
+	packet1.z = packet_in.z;
+	mav_array_memcpy(packet1.name, packet_in.name, sizeof(char)*10);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_debug_vect_pack(run.system_id, run.component_id, &run.message, packet1.name , packet1.time_usec , packet1.x , packet1.y , packet1.z));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_debug_vect_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_debug_vect_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_named_value_float(Msgbench_Run &run)
+{
+	mavlink_named_value_float_t packet_in = {
+		(uint32_t)963497464, (float)45.0, "IJKLMNOPQ"
+	};
+	mavlink_named_value_float_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.value = packet_in.value;
+	mav_array_memcpy(packet1.name, packet_in.name, sizeof(char)*10);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_named_value_float_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.name , packet1.value));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_named_value_float_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_named_value_float_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_named_value_int(Msgbench_Run &run)
+{
+	mavlink_named_value_int_t packet_in = {
+		(uint32_t)963497464, (int32_t)963497672, "IJKLMNOPQ"
+	};
+	mavlink_named_value_int_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.value = packet_in.value;
+	mav_array_memcpy(packet1.name, packet_in.name, sizeof(char)*10);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_named_value_int_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.name , packet1.value));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_named_value_int_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_named_value_int_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_statustext(Msgbench_Run &run)
+{
+	mavlink_statustext_t packet_in = {
+		(uint8_t)5, "BCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWX", (uint16_t)19887, (uint8_t)228
+	};
+	mavlink_statustext_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.severity = packet_in.severity;
+	packet1.id = packet_in.id;
+	packet1.chunk_seq = packet_in.chunk_seq;
+	mav_array_memcpy(packet1.text, packet_in.text, sizeof(char)*50);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_statustext_pack(run.system_id, run.component_id, &run.message, packet1.severity , packet1.text , packet1.id , packet1.chunk_seq));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_statustext_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_statustext_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_debug(Msgbench_Run &run)
+{
+	mavlink_debug_t packet_in = {
+		(uint32_t)963497464, (float)45.0, (uint8_t)29
+	};
+	mavlink_debug_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.value = packet_in.value;
+	packet1.ind = packet_in.ind;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_debug_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.ind , packet1.value));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_debug_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_debug_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_setup_signing(Msgbench_Run &run)
+{
+	mavlink_setup_signing_t packet_in = {
+		(uint64_t)93372036854775807ULL, (uint8_t)29, (uint8_t)96, { (uint8_t)163, (uint8_t)164, (uint8_t)165, (uint8_t)166, (uint8_t)167, (uint8_t)168, (uint8_t)169, (uint8_t)170, (uint8_t)171, (uint8_t)172, (uint8_t)173, (uint8_t)174, (uint8_t)175, (uint8_t)176, (uint8_t)177, (uint8_t)178, (uint8_t)179, (uint8_t)180, (uint8_t)181, (uint8_t)182, (uint8_t)183, (uint8_t)184, (uint8_t)185, (uint8_t)186, (uint8_t)187, (uint8_t)188, (uint8_t)189, (uint8_t)190, (uint8_t)191, (uint8_t)192, (uint8_t)193, (uint8_t)194 }
+	};
+	mavlink_setup_signing_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.initial_timestamp = packet_in.initial_timestamp;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	mav_array_memcpy(packet1.secret_key, packet_in.secret_key, sizeof(uint8_t)*32);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_setup_signing_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.secret_key , packet1.initial_timestamp));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_setup_signing_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_setup_signing_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_button_change(Msgbench_Run &run)
+{
+	mavlink_button_change_t packet_in = {
+		(uint32_t)963497464, (uint32_t)963497672, (uint8_t)29
+	};
+	mavlink_button_change_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.last_change_ms = packet_in.last_change_ms;
+	packet1.state = packet_in.state;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_button_change_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.last_change_ms , packet1.state));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_button_change_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_button_change_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_play_tune(Msgbench_Run &run)
+{
+	mavlink_play_tune_t packet_in = {
+		(uint8_t)5, (uint8_t)72, "CDEFGHIJKLMNOPQRSTUVWXYZABCDE", "GHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVW"
+	};
+	mavlink_play_tune_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	mav_array_memcpy(packet1.tune, packet_in.tune, sizeof(char)*30);
+	mav_array_memcpy(packet1.tune2, packet_in.tune2, sizeof(char)*200);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_play_tune_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.tune , packet1.tune2));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_play_tune_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_play_tune_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_camera_information(Msgbench_Run &run)
+{
+	mavlink_camera_information_t packet_in = {
+		(uint32_t)963497464, (uint32_t)963497672, (float)73.0, (float)101.0, (float)129.0, (uint32_t)963498504, (uint16_t)18483, (uint16_t)18587, (uint16_t)18691, { (uint8_t)223, (uint8_t)224, (uint8_t)225, (uint8_t)226, (uint8_t)227, (uint8_t)228, (uint8_t)229, (uint8_t)230, (uint8_t)231, (uint8_t)232, (uint8_t)233, (uint8_t)234, (uint8_t)235, (uint8_t)236, (uint8_t)237, (uint8_t)238, (uint8_t)239, (uint8_t)240, (uint8_t)241, (uint8_t)242, (uint8_t)243, (uint8_t)244, (uint8_t)245, (uint8_t)246, (uint8_t)247, (uint8_t)248, (uint8_t)249, (uint8_t)250, (uint8_t)251, (uint8_t)252, (uint8_t)253, (uint8_t)254 }, { (uint8_t)63, (uint8_t)64, (uint8_t)65, (uint8_t)66, (uint8_t)67, (uint8_t)68, (uint8_t)69, (uint8_t)70, (uint8_t)71, (uint8_t)72, (uint8_t)73, (uint8_t)74, (uint8_t)75, (uint8_t)76, (uint8_t)77, (uint8_t)78, (uint8_t)79, (uint8_t)80, (uint8_t)81, (uint8_t)82, (uint8_t)83, (uint8_t)84, (uint8_t)85, (uint8_t)86, (uint8_t)87, (uint8_t)88, (uint8_t)89, (uint8_t)90, (uint8_t)91, (uint8_t)92, (uint8_t)93, (uint8_t)94 }, (uint8_t)159, "RSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZ", (uint8_t)134
+	};
+	mavlink_camera_information_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.firmware_version = packet_in.firmware_version;
+	packet1.focal_length = packet_in.focal_length;
+	packet1.sensor_size_h = packet_in.sensor_size_h;
+	packet1.sensor_size_v = packet_in.sensor_size_v;
+	packet1.flags = packet_in.flags;
+	packet1.resolution_h = packet_in.resolution_h;
+	packet1.resolution_v = packet_in.resolution_v;
+	packet1.cam_definition_version = packet_in.cam_definition_version;
+	packet1.lens_id = packet_in.lens_id;
+	packet1.gimbal_device_id = packet_in.gimbal_device_id;
+	mav_array_memcpy(packet1.vendor_name, packet_in.vendor_name, sizeof(uint8_t)*32);
+	mav_array_memcpy(packet1.model_name, packet_in.model_name, sizeof(uint8_t)*32);
+	mav_array_memcpy(packet1.cam_definition_uri, packet_in.cam_definition_uri, sizeof(char)*140);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_camera_information_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.vendor_name , packet1.model_name , packet1.firmware_version , packet1.focal_length , packet1.sensor_size_h , packet1.sensor_size_v , packet1.resolution_h , packet1.resolution_v , packet1.lens_id , packet1.flags , packet1.cam_definition_version , packet1.cam_definition_uri , packet1.gimbal_device_id));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_camera_information_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_camera_information_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_camera_settings(Msgbench_Run &run)
+{
+	mavlink_camera_settings_t packet_in = {
+		(uint32_t)963497464, (uint8_t)17, (float)52.0, (float)80.0
+	};
+	mavlink_camera_settings_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.mode_id = packet_in.mode_id;
+	packet1.zoomLevel = packet_in.zoomLevel;
+	packet1.focusLevel = packet_in.focusLevel;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_camera_settings_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.mode_id , packet1.zoomLevel , packet1.focusLevel));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_camera_settings_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_camera_settings_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_storage_information(Msgbench_Run &run)
+{
+	mavlink_storage_information_t packet_in = {
+		(uint32_t)963497464, (float)45.0, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (uint8_t)77, (uint8_t)144, (uint8_t)211, (uint8_t)22, "CDEFGHIJKLMNOPQRSTUVWXYZABCDEFG", (uint8_t)185
+	};
+	mavlink_storage_information_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.total_capacity = packet_in.total_capacity;
+	packet1.used_capacity = packet_in.used_capacity;
+	packet1.available_capacity = packet_in.available_capacity;
+	packet1.read_speed = packet_in.read_speed;
+	packet1.write_speed = packet_in.write_speed;
+	packet1.storage_id = packet_in.storage_id;
+	packet1.storage_count = packet_in.storage_count;
+	packet1.status = packet_in.status;
+	packet1.type = packet_in.type;
+	packet1.storage_usage = packet_in.storage_usage;
+	mav_array_memcpy(packet1.name, packet_in.name, sizeof(char)*32);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_storage_information_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.storage_id , packet1.storage_count , packet1.status , packet1.total_capacity , packet1.used_capacity , packet1.available_capacity , packet1.read_speed , packet1.write_speed , packet1.type , packet1.name , packet1.storage_usage));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_storage_information_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_storage_information_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_camera_capture_status(Msgbench_Run &run)
+{
+	mavlink_camera_capture_status_t packet_in = {
+		(uint32_t)963497464, (float)45.0, (uint32_t)963497880, (float)101.0, (uint8_t)53, (uint8_t)120, (int32_t)963498400
+	};
+	mavlink_camera_capture_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.image_interval = packet_in.image_interval;
+	packet1.recording_time_ms = packet_in.recording_time_ms;
+	packet1.available_capacity = packet_in.available_capacity;
+	packet1.image_status = packet_in.image_status;
+	packet1.video_status = packet_in.video_status;
+	packet1.image_count = packet_in.image_count;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_camera_capture_status_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.image_status , packet1.video_status , packet1.image_interval , packet1.recording_time_ms , packet1.available_capacity , packet1.image_count));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_camera_capture_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_camera_capture_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_camera_image_captured(Msgbench_Run &run)
+{
+	mavlink_camera_image_captured_t packet_in = {
+		(uint64_t)93372036854775807ULL, (uint32_t)963497880, (int32_t)963498088, (int32_t)963498296, (int32_t)963498504, (int32_t)963498712, { (float)213.0, (float)214.0, (float)215.0, (float)216.0 }, (int32_t)963499752, (uint8_t)149, (int8_t)216, "YZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRST"
+	};
+	mavlink_camera_image_captured_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_utc = packet_in.time_utc;
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.lat = packet_in.lat;
+	packet1.lon = packet_in.lon;
+	packet1.alt = packet_in.alt;
+	packet1.relative_alt = packet_in.relative_alt;
+	packet1.image_index = packet_in.image_index;
+	packet1.camera_id = packet_in.camera_id;
+	packet1.capture_result = packet_in.capture_result;
+	mav_array_memcpy(packet1.q, packet_in.q, sizeof(float)*4);
+	mav_array_memcpy(packet1.file_url, packet_in.file_url, sizeof(char)*205);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_camera_image_captured_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.time_utc , packet1.camera_id , packet1.lat , packet1.lon , packet1.alt , packet1.relative_alt , packet1.q , packet1.image_index , packet1.capture_result , packet1.file_url));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_camera_image_captured_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_camera_image_captured_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_flight_information(Msgbench_Run &run)
+{
+	mavlink_flight_information_t packet_in = {
+		(uint64_t)93372036854775807ULL, (uint64_t)93372036854776311ULL, (uint64_t)93372036854776815ULL, (uint32_t)963498712
+	};
+	mavlink_flight_information_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.arming_time_utc = packet_in.arming_time_utc;
+	packet1.takeoff_time_utc = packet_in.takeoff_time_utc;
+	packet1.flight_uuid = packet_in.flight_uuid;
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_flight_information_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.arming_time_utc , packet1.takeoff_time_utc , packet1.flight_uuid));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_flight_information_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_flight_information_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_mount_orientation(Msgbench_Run &run)
+{
+	mavlink_mount_orientation_t packet_in = {
+		(uint32_t)963497464, (float)45.0, (float)73.0, (float)101.0, (float)129.0
+	};
+	mavlink_mount_orientation_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.roll = packet_in.roll;
+	packet1.pitch = packet_in.pitch;
+	packet1.yaw = packet_in.yaw;
+	packet1.yaw_absolute = packet_in.yaw_absolute;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_mount_orientation_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.roll , packet1.pitch , packet1.yaw , packet1.yaw_absolute));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_mount_orientation_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_mount_orientation_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_logging_data(Msgbench_Run &run)
+{
+	mavlink_logging_data_t packet_in = {
+		(uint16_t)17235, (uint8_t)139, (uint8_t)206, (uint8_t)17, (uint8_t)84, { (uint8_t)151, (uint8_t)152, (uint8_t)153, (uint8_t)154, (uint8_t)155, (uint8_t)156, (uint8_t)157, (uint8_t)158, (uint8_t)159, (uint8_t)160, (uint8_t)161, (uint8_t)162, (uint8_t)163, (uint8_t)164, (uint8_t)165, (uint8_t)166, (uint8_t)167, (uint8_t)168, (uint8_t)169, (uint8_t)170, (uint8_t)171, (uint8_t)172, (uint8_t)173, (uint8_t)174, (uint8_t)175, (uint8_t)176, (uint8_t)177, (uint8_t)178, (uint8_t)179, (uint8_t)180, (uint8_t)181, (uint8_t)182, (uint8_t)183, (uint8_t)184, (uint8_t)185, (uint8_t)186, (uint8_t)187, (uint8_t)188, (uint8_t)189, (uint8_t)190, (uint8_t)191, (uint8_t)192, (uint8_t)193, (uint8_t)194, (uint8_t)195, (uint8_t)196, (uint8_t)197, (uint8_t)198, (uint8_t)199, (uint8_t)200, (uint8_t)201, (uint8_t)202, (uint8_t)203, (uint8_t)204, (uint8_t)205, (uint8_t)206, (uint8_t)207, (uint8_t)208, (uint8_t)209, (uint8_t)210, (uint8_t)211, (uint8_t)212, (uint8_t)213, (uint8_t)214, (uint8_t)215, (uint8_t)216, (uint8_t)217, (uint8_t)218, (uint8_t)219, (uint8_t)220, (uint8_t)221, (uint8_t)222, (uint8_t)223, (uint8_t)224, (uint8_t)225, (uint8_t)226, (uint8_t)227, (uint8_t)228, (uint8_t)229, (uint8_t)230, (uint8_t)231, (uint8_t)232, (uint8_t)233, (uint8_t)234, (uint8_t)235, (uint8_t)236, (uint8_t)237, (uint8_t)238, (uint8_t)239, (uint8_t)240, (uint8_t)241, (uint8_t)242, (uint8_t)243, (uint8_t)244, (uint8_t)245, (uint8_t)246, (uint8_t)247, (uint8_t)248, (uint8_t)249, (uint8_t)250, (uint8_t)251, (uint8_t)252, (uint8_t)253, (uint8_t)254, (uint8_t)255, (uint8_t)0, (uint8_t)1, (uint8_t)2, (uint8_t)3, (uint8_t)4, (uint8_t)5, (uint8_t)6, (uint8_t)7, (uint8_t)8, (uint8_t)9, (uint8_t)10, (uint8_t)11, (uint8_t)12, (uint8_t)13, (uint8_t)14, (uint8_t)15, (uint8_t)16, (uint8_t)17, (uint8_t)18, (uint8_t)19, (uint8_t)20, (uint8_t)21, (uint8_t)22, (uint8_t)23, (uint8_t)24, (uint8_t)25, (uint8_t)26, (uint8_t)27, (uint8_t)28, (uint8_t)29, (uint8_t)30, (uint8_t)31, (uint8_t)32, (uint8_t)33, (uint8_t)34, (uint8_t)35, (uint8_t)36, (uint8_t)37, (uint8_t)38, (uint8_t)39, (uint8_t)40, (uint8_t)41, (uint8_t)42, (uint8_t)43, (uint8_t)44, (uint8_t)45, (uint8_t)46, (uint8_t)47, (uint8_t)48, (uint8_t)49, (uint8_t)50, (uint8_t)51, (uint8_t)52, (uint8_t)53, (uint8_t)54, (uint8_t)55, (uint8_t)56, (uint8_t)57, (uint8_t)58, (uint8_t)59, (uint8_t)60, (uint8_t)61, (uint8_t)62, (uint8_t)63, (uint8_t)64, (uint8_t)65, (uint8_t)66, (uint8_t)67, (uint8_t)68, (uint8_t)69, (uint8_t)70, (uint8_t)71, (uint8_t)72, (uint8_t)73, (uint8_t)74, (uint8_t)75, (uint8_t)76, (uint8_t)77, (uint8_t)78, (uint8_t)79, (uint8_t)80, (uint8_t)81, (uint8_t)82, (uint8_t)83, (uint8_t)84, (uint8_t)85, (uint8_t)86, (uint8_t)87, (uint8_t)88, (uint8_t)89, (uint8_t)90, (uint8_t)91, (uint8_t)92, (uint8_t)93, (uint8_t)94, (uint8_t)95, (uint8_t)96, (uint8_t)97, (uint8_t)98, (uint8_t)99, (uint8_t)100, (uint8_t)101, (uint8_t)102, (uint8_t)103, (uint8_t)104, (uint8_t)105, (uint8_t)106, (uint8_t)107, (uint8_t)108, (uint8_t)109, (uint8_t)110, (uint8_t)111, (uint8_t)112, (uint8_t)113, (uint8_t)114, (uint8_t)115, (uint8_t)116, (uint8_t)117, (uint8_t)118, (uint8_t)119, (uint8_t)120, (uint8_t)121, (uint8_t)122, (uint8_t)123, (uint8_t)124, (uint8_t)125, (uint8_t)126, (uint8_t)127, (uint8_t)128, (uint8_t)129, (uint8_t)130, (uint8_t)131, (uint8_t)132, (uint8_t)133, (uint8_t)134, (uint8_t)135, (uint8_t)136, (uint8_t)137, (uint8_t)138, (uint8_t)139, (uint8_t)140, (uint8_t)141, (uint8_t)142, (uint8_t)143 }
+	};
+	mavlink_logging_data_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.sequence = packet_in.sequence;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.length = packet_in.length;
+	packet1.first_message_offset = packet_in.first_message_offset;
+	mav_array_memcpy(packet1.data, packet_in.data, sizeof(uint8_t)*249);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_logging_data_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.sequence , packet1.length , packet1.first_message_offset , packet1.data));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_logging_data_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_logging_data_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_logging_data_acked(Msgbench_Run &run)
+{
+	mavlink_logging_data_acked_t packet_in = {
+		(uint16_t)17235, (uint8_t)139, (uint8_t)206, (uint8_t)17, (uint8_t)84, { (uint8_t)151, (uint8_t)152, (uint8_t)153, (uint8_t)154, (uint8_t)155, (uint8_t)156, (uint8_t)157, (uint8_t)158, (uint8_t)159, (uint8_t)160, (uint8_t)161, (uint8_t)162, (uint8_t)163, (uint8_t)164, (uint8_t)165, (uint8_t)166, (uint8_t)167, (uint8_t)168, (uint8_t)169, (uint8_t)170, (uint8_t)171, (uint8_t)172, (uint8_t)173, (uint8_t)174, (uint8_t)175, (uint8_t)176, (uint8_t)177, (uint8_t)178, (uint8_t)179, (uint8_t)180, (uint8_t)181, (uint8_t)182, (uint8_t)183, (uint8_t)184, (uint8_t)185, (uint8_t)186, (uint8_t)187, (uint8_t)188, (uint8_t)189, (uint8_t)190, (uint8_t)191, (uint8_t)192, (uint8_t)193, (uint8_t)194, (uint8_t)195, (uint8_t)196, (uint8_t)197, (uint8_t)198, (uint8_t)199, (uint8_t)200, (uint8_t)201, (uint8_t)202, (uint8_t)203, (uint8_t)204, (uint8_t)205, (uint8_t)206, (uint8_t)207, (uint8_t)208, (uint8_t)209, (uint8_t)210, (uint8_t)211, (uint8_t)212, (uint8_t)213, (uint8_t)214, (uint8_t)215, (uint8_t)216, (uint8_t)217, (uint8_t)218, (uint8_t)219, (uint8_t)220, (uint8_t)221, (uint8_t)222, (uint8_t)223, (uint8_t)224, (uint8_t)225, (uint8_t)226, (uint8_t)227, (uint8_t)228, (uint8_t)229, (uint8_t)230, (uint8_t)231, (uint8_t)232, (uint8_t)233, (uint8_t)234, (uint8_t)235, (uint8_t)236, (uint8_t)237, (uint8_t)238, (uint8_t)239, (uint8_t)240, (uint8_t)241, (uint8_t)242, (uint8_t)243, (uint8_t)244, (uint8_t)245, (uint8_t)246, (uint8_t)247, (uint8_t)248, (uint8_t)249, (uint8_t)250, (uint8_t)251, (uint8_t)252, (uint8_t)253, (uint8_t)254, (uint8_t)255, (uint8_t)0, (uint8_t)1, (uint8_t)2, (uint8_t)3, (uint8_t)4, (uint8_t)5, (uint8_t)6, (uint8_t)7, (uint8_t)8, (uint8_t)9, (uint8_t)10, (uint8_t)11, (uint8_t)12, (uint8_t)13, (uint8_t)14, (uint8_t)15, (uint8_t)16, (uint8_t)17, (uint8_t)18, (uint8_t)19, (uint8_t)20, (uint8_t)21, (uint8_t)22, (uint8_t)23, (uint8_t)24, (uint8_t)25, (uint8_t)26, (uint8_t)27, (uint8_t)28, (uint8_t)29, (uint8_t)30, (uint8_t)31, (uint8_t)32, (uint8_t)33, (uint8_t)34, (uint8_t)35, (uint8_t)36, (uint8_t)37, (uint8_t)38, (uint8_t)39, (uint8_t)40, (uint8_t)41, (uint8_t)42, (uint8_t)43, (uint8_t)44, (uint8_t)45, (uint8_t)46, (uint8_t)47, (uint8_t)48, (uint8_t)49, (uint8_t)50, (uint8_t)51, (uint8_t)52, (uint8_t)53, (uint8_t)54, (uint8_t)55, (uint8_t)56, (uint8_t)57, (uint8_t)58, (uint8_t)59, (uint8_t)60, (uint8_t)61, (uint8_t)62, (uint8_t)63, (uint8_t)64, (uint8_t)65, (uint8_t)66, (uint8_t)67, (uint8_t)68, (uint8_t)69, (uint8_t)70, (uint8_t)71, (uint8_t)72, (uint8_t)73, (uint8_t)74, (uint8_t)75, (uint8_t)76, (uint8_t)77, (uint8_t)78, (uint8_t)79, (uint8_t)80, (uint8_t)81, (uint8_t)82, (uint8_t)83, (uint8_t)84, (uint8_t)85, (uint8_t)86, (uint8_t)87, (uint8_t)88, (uint8_t)89, (uint8_t)90, (uint8_t)91, (uint8_t)92, (uint8_t)93, (uint8_t)94, (uint8_t)95, (uint8_t)96, (uint8_t)97, (uint8_t)98, (uint8_t)99, (uint8_t)100, (uint8_t)101, (uint8_t)102, (uint8_t)103, (uint8_t)104, (uint8_t)105, (uint8_t)106, (uint8_t)107, (uint8_t)108, (uint8_t)109, (uint8_t)110, (uint8_t)111, (uint8_t)112, (uint8_t)113, (uint8_t)114, (uint8_t)115, (uint8_t)116, (uint8_t)117, (uint8_t)118, (uint8_t)119, (uint8_t)120, (uint8_t)121, (uint8_t)122, (uint8_t)123, (uint8_t)124, (uint8_t)125, (uint8_t)126, (uint8_t)127, (uint8_t)128, (uint8_t)129, (uint8_t)130, (uint8_t)131, (uint8_t)132, (uint8_t)133, (uint8_t)134, (uint8_t)135, (uint8_t)136, (uint8_t)137, (uint8_t)138, (uint8_t)139, (uint8_t)140, (uint8_t)141, (uint8_t)142, (uint8_t)143 }
+	};
+	mavlink_logging_data_acked_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.sequence = packet_in.sequence;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.length = packet_in.length;
+	packet1.first_message_offset = packet_in.first_message_offset;
+	mav_array_memcpy(packet1.data, packet_in.data, sizeof(uint8_t)*249);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_logging_data_acked_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.sequence , packet1.length , packet1.first_message_offset , packet1.data));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_logging_data_acked_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_logging_data_acked_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_logging_ack(Msgbench_Run &run)
+{
+	mavlink_logging_ack_t packet_in = {
+		(uint16_t)17235, (uint8_t)139, (uint8_t)206
+	};
+	mavlink_logging_ack_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.sequence = packet_in.sequence;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_logging_ack_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.sequence));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_logging_ack_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_logging_ack_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_video_stream_information(Msgbench_Run &run)
+{
+	mavlink_video_stream_information_t packet_in = {
+		(float)17.0, (uint32_t)963497672, (uint16_t)17651, (uint16_t)17755, (uint16_t)17859, (uint16_t)17963, (uint16_t)18067, (uint8_t)187, (uint8_t)254, (uint8_t)65, "VWXYZABCDEFGHIJKLMNOPQRSTUVWXYZ", "BCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCD"
+	};
+	mavlink_video_stream_information_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.framerate = packet_in.framerate;
+	packet1.bitrate = packet_in.bitrate;
+	packet1.flags = packet_in.flags;
+	packet1.resolution_h = packet_in.resolution_h;
+	packet1.resolution_v = packet_in.resolution_v;
+	packet1.rotation = packet_in.rotation;
+	packet1.hfov = packet_in.hfov;
+	packet1.stream_id = packet_in.stream_id;
+	packet1.count = packet_in.count;
+	packet1.type = packet_in.type;
+	mav_array_memcpy(packet1.name, packet_in.name, sizeof(char)*32);
+	mav_array_memcpy(packet1.uri, packet_in.uri, sizeof(char)*160);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_video_stream_information_pack(run.system_id, run.component_id, &run.message, packet1.stream_id , packet1.count , packet1.type , packet1.flags , packet1.framerate , packet1.resolution_h , packet1.resolution_v , packet1.bitrate , packet1.rotation , packet1.hfov , packet1.name , packet1.uri));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_video_stream_information_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_video_stream_information_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_video_stream_status(Msgbench_Run &run)
+{
+	mavlink_video_stream_status_t packet_in = {
+		(float)17.0, (uint32_t)963497672, (uint16_t)17651, (uint16_t)17755, (uint16_t)17859, (uint16_t)17963, (uint16_t)18067, (uint8_t)187
+	};
+	mavlink_video_stream_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.framerate = packet_in.framerate;
+	packet1.bitrate = packet_in.bitrate;
+	packet1.flags = packet_in.flags;
+	packet1.resolution_h = packet_in.resolution_h;
+	packet1.resolution_v = packet_in.resolution_v;
+	packet1.rotation = packet_in.rotation;
+	packet1.hfov = packet_in.hfov;
+	packet1.stream_id = packet_in.stream_id;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_video_stream_status_pack(run.system_id, run.component_id, &run.message, packet1.stream_id , packet1.flags , packet1.framerate , packet1.resolution_h , packet1.resolution_v , packet1.bitrate , packet1.rotation , packet1.hfov));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_video_stream_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_video_stream_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_camera_fov_status(Msgbench_Run &run)
+{
+	mavlink_camera_fov_status_t packet_in = {
+		(uint32_t)963497464, (int32_t)963497672, (int32_t)963497880, (int32_t)963498088, (int32_t)963498296, (int32_t)963498504, (int32_t)963498712, { (float)213.0, (float)214.0, (float)215.0, (float)216.0 }, (float)325.0, (float)353.0
+	};
+	mavlink_camera_fov_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.lat_camera = packet_in.lat_camera;
+	packet1.lon_camera = packet_in.lon_camera;
+	packet1.alt_camera = packet_in.alt_camera;
+	packet1.lat_image = packet_in.lat_image;
+	packet1.lon_image = packet_in.lon_image;
+	packet1.alt_image = packet_in.alt_image;
+	packet1.hfov = packet_in.hfov;
+	packet1.vfov = packet_in.vfov;
+	mav_array_memcpy(packet1.q, packet_in.q, sizeof(float)*4);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_camera_fov_status_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.lat_camera , packet1.lon_camera , packet1.alt_camera , packet1.lat_image , packet1.lon_image , packet1.alt_image , packet1.q , packet1.hfov , packet1.vfov));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_camera_fov_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_camera_fov_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_camera_tracking_image_status(Msgbench_Run &run)
+{
+	mavlink_camera_tracking_image_status_t packet_in = {
+		(float)17.0, (float)45.0, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (uint8_t)89, (uint8_t)156, (uint8_t)223
+	};
+	mavlink_camera_tracking_image_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.point_x = packet_in.point_x;
+	packet1.point_y = packet_in.point_y;
+	packet1.radius = packet_in.radius;
+	packet1.rec_top_x = packet_in.rec_top_x;
+	packet1.rec_top_y = packet_in.rec_top_y;
+	packet1.rec_bottom_x = packet_in.rec_bottom_x;
+	packet1.rec_bottom_y = packet_in.rec_bottom_y;
+	packet1.tracking_status = packet_in.tracking_status;
+	packet1.tracking_mode = packet_in.tracking_mode;
+	packet1.target_data = packet_in.target_data;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_camera_tracking_image_status_pack(run.system_id, run.component_id, &run.message, packet1.tracking_status , packet1.tracking_mode , packet1.target_data , packet1.point_x , packet1.point_y , packet1.radius , packet1.rec_top_x , packet1.rec_top_y , packet1.rec_bottom_x , packet1.rec_bottom_y));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_camera_tracking_image_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_camera_tracking_image_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_camera_tracking_geo_status(Msgbench_Run &run)
+{
+	mavlink_camera_tracking_geo_status_t packet_in = {
+		(int32_t)963497464, (int32_t)963497672, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, (float)241.0, (float)269.0, (float)297.0, (float)325.0, (uint8_t)149
+	};
+	mavlink_camera_tracking_geo_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.lat = packet_in.lat;
+	packet1.lon = packet_in.lon;
+	packet1.alt = packet_in.alt;
+	packet1.h_acc = packet_in.h_acc;
+	packet1.v_acc = packet_in.v_acc;
+	packet1.vel_n = packet_in.vel_n;
+	packet1.vel_e = packet_in.vel_e;
+	packet1.vel_d = packet_in.vel_d;
+	packet1.vel_acc = packet_in.vel_acc;
+	packet1.dist = packet_in.dist;
+	packet1.hdg = packet_in.hdg;
+	packet1.hdg_acc = packet_in.hdg_acc;
+	packet1.tracking_status = packet_in.tracking_status;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_camera_tracking_geo_status_pack(run.system_id, run.component_id, &run.message, packet1.tracking_status , packet1.lat , packet1.lon , packet1.alt , packet1.h_acc , packet1.v_acc , packet1.vel_n , packet1.vel_e , packet1.vel_d , packet1.vel_acc , packet1.dist , packet1.hdg , packet1.hdg_acc));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_camera_tracking_geo_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_camera_tracking_geo_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_gimbal_manager_information(Msgbench_Run &run)
+{
+	mavlink_gimbal_manager_information_t packet_in = {
+		(uint32_t)963497464, (uint32_t)963497672, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, (uint8_t)101
+	};
+	mavlink_gimbal_manager_information_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.cap_flags = packet_in.cap_flags;
+	packet1.roll_min = packet_in.roll_min;
+	packet1.roll_max = packet_in.roll_max;
+	packet1.pitch_min = packet_in.pitch_min;
+	packet1.pitch_max = packet_in.pitch_max;
+	packet1.yaw_min = packet_in.yaw_min;
+	packet1.yaw_max = packet_in.yaw_max;
+	packet1.gimbal_device_id = packet_in.gimbal_device_id;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_gimbal_manager_information_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.cap_flags , packet1.gimbal_device_id , packet1.roll_min , packet1.roll_max , packet1.pitch_min , packet1.pitch_max , packet1.yaw_min , packet1.yaw_max));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_gimbal_manager_information_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_gimbal_manager_information_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_gimbal_manager_status(Msgbench_Run &run)
+{
+	mavlink_gimbal_manager_status_t packet_in = {
+		(uint32_t)963497464, (uint32_t)963497672, (uint8_t)29, (uint8_t)96, (uint8_t)163, (uint8_t)230, (uint8_t)41
+	};
+	mavlink_gimbal_manager_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.flags = packet_in.flags;
+	packet1.gimbal_device_id = packet_in.gimbal_device_id;
+	packet1.primary_control_sysid = packet_in.primary_control_sysid;
+	packet1.primary_control_compid = packet_in.primary_control_compid;
+	packet1.secondary_control_sysid = packet_in.secondary_control_sysid;
+	packet1.secondary_control_compid = packet_in.secondary_control_compid;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_gimbal_manager_status_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.flags , packet1.gimbal_device_id , packet1.primary_control_sysid , packet1.primary_control_compid , packet1.secondary_control_sysid , packet1.secondary_control_compid));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_gimbal_manager_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_gimbal_manager_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_gimbal_manager_set_attitude(Msgbench_Run &run)
+{
+	mavlink_gimbal_manager_set_attitude_t packet_in = {
+		(uint32_t)963497464, { (float)45.0, (float)46.0, (float)47.0, (float)48.0 }, (float)157.0, (float)185.0, (float)213.0, (uint8_t)101, (uint8_t)168, (uint8_t)235
+	};
+	mavlink_gimbal_manager_set_attitude_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.flags = packet_in.flags;
+	packet1.angular_velocity_x = packet_in.angular_velocity_x;
+	packet1.angular_velocity_y = packet_in.angular_velocity_y;
+	packet1.angular_velocity_z = packet_in.angular_velocity_z;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.gimbal_device_id = packet_in.gimbal_device_id;
+	mav_array_memcpy(packet1.q, packet_in.q, sizeof(float)*4);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_gimbal_manager_set_attitude_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.flags , packet1.gimbal_device_id , packet1.q , packet1.angular_velocity_x , packet1.angular_velocity_y , packet1.angular_velocity_z));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_gimbal_manager_set_attitude_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_gimbal_manager_set_attitude_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_gimbal_device_information(Msgbench_Run &run)
+{
+	mavlink_gimbal_device_information_t packet_in = {
+		(uint64_t)93372036854775807ULL, (uint32_t)963497880, (uint32_t)963498088, (uint32_t)963498296, (float)157.0, (float)185.0, (float)213.0, (float)241.0, (float)269.0, (float)297.0, (uint16_t)19523, (uint16_t)19627, "WXYZABCDEFGHIJKLMNOPQRSTUVWXYZA", "CDEFGHIJKLMNOPQRSTUVWXYZABCDEFG", "IJKLMNOPQRSTUVWXYZABCDEFGHIJKLM", (uint8_t)181
+	};
+	mavlink_gimbal_device_information_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.uid = packet_in.uid;
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.firmware_version = packet_in.firmware_version;
+	packet1.hardware_version = packet_in.hardware_version;
+	packet1.roll_min = packet_in.roll_min;
+	packet1.roll_max = packet_in.roll_max;
+	packet1.pitch_min = packet_in.pitch_min;
+	packet1.pitch_max = packet_in.pitch_max;
+	packet1.yaw_min = packet_in.yaw_min;
+	packet1.yaw_max = packet_in.yaw_max;
+	packet1.cap_flags = packet_in.cap_flags;
+	packet1.custom_cap_flags = packet_in.custom_cap_flags;
+	packet1.gimbal_device_id = packet_in.gimbal_device_id;
+	mav_array_memcpy(packet1.vendor_name, packet_in.vendor_name, sizeof(char)*32);
+	mav_array_memcpy(packet1.model_name, packet_in.model_name, sizeof(char)*32);
+	mav_array_memcpy(packet1.custom_name, packet_in.custom_name, sizeof(char)*32);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_gimbal_device_information_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.vendor_name , packet1.model_name , packet1.custom_name , packet1.firmware_version , packet1.hardware_version , packet1.uid , packet1.cap_flags , packet1.custom_cap_flags , packet1.roll_min , packet1.roll_max , packet1.pitch_min , packet1.pitch_max , packet1.yaw_min , packet1.yaw_max , packet1.gimbal_device_id));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_gimbal_device_information_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_gimbal_device_information_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_gimbal_device_set_attitude(Msgbench_Run &run)
+{
+	mavlink_gimbal_device_set_attitude_t packet_in = {
+		{ (float)17.0, (float)18.0, (float)19.0, (float)20.0 }, (float)129.0, (float)157.0, (float)185.0, (uint16_t)18691, (uint8_t)223, (uint8_t)34
+	};
+	mavlink_gimbal_device_set_attitude_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.angular_velocity_x = packet_in.angular_velocity_x;
+	packet1.angular_velocity_y = packet_in.angular_velocity_y;
+	packet1.angular_velocity_z = packet_in.angular_velocity_z;
+	packet1.flags = packet_in.flags;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	mav_array_memcpy(packet1.q, packet_in.q, sizeof(float)*4);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_gimbal_device_set_attitude_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.flags , packet1.q , packet1.angular_velocity_x , packet1.angular_velocity_y , packet1.angular_velocity_z));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_gimbal_device_set_attitude_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_gimbal_device_set_attitude_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_gimbal_device_attitude_status(Msgbench_Run &run)
+{
+	mavlink_gimbal_device_attitude_status_t packet_in = {
+		(uint32_t)963497464, { (float)45.0, (float)46.0, (float)47.0, (float)48.0 }, (float)157.0, (float)185.0, (float)213.0, (uint32_t)963499128, (uint16_t)19107, (uint8_t)247, (uint8_t)58, (float)297.0, (float)325.0, (uint8_t)149
+	};
+	mavlink_gimbal_device_attitude_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.angular_velocity_x = packet_in.angular_velocity_x;
+	packet1.angular_velocity_y = packet_in.angular_velocity_y;
+	packet1.angular_velocity_z = packet_in.angular_velocity_z;
+	packet1.failure_flags = packet_in.failure_flags;
+	packet1.flags = packet_in.flags;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.delta_yaw = packet_in.delta_yaw;
+	packet1.delta_yaw_velocity = packet_in.delta_yaw_velocity;
+	packet1.gimbal_device_id = packet_in.gimbal_device_id;
+	mav_array_memcpy(packet1.q, packet_in.q, sizeof(float)*4);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_gimbal_device_attitude_status_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.time_boot_ms , packet1.flags , packet1.q , packet1.angular_velocity_x , packet1.angular_velocity_y , packet1.angular_velocity_z , packet1.failure_flags , packet1.delta_yaw , packet1.delta_yaw_velocity , packet1.gimbal_device_id));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_gimbal_device_attitude_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_gimbal_device_attitude_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_autopilot_state_for_gimbal_device(Msgbench_Run &run)
+{
+	mavlink_autopilot_state_for_gimbal_device_t packet_in = {
+		(uint64_t)93372036854775807ULL, { (float)73.0, (float)74.0, (float)75.0, (float)76.0 }, (uint32_t)963498712, (float)213.0, (float)241.0, (float)269.0, (uint32_t)963499544, (float)325.0, (uint16_t)19731, (uint8_t)27, (uint8_t)94, (uint8_t)161, (float)388.0
+	};
+	mavlink_autopilot_state_for_gimbal_device_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_us = packet_in.time_boot_us;
+	packet1.q_estimated_delay_us = packet_in.q_estimated_delay_us;
+	packet1.vx = packet_in.vx;
+	packet1.vy = packet_in.vy;
+	packet1.vz = packet_in.vz;
+	packet1.v_estimated_delay_us = packet_in.v_estimated_delay_us;
+	packet1.feed_forward_angular_velocity_z = packet_in.feed_forward_angular_velocity_z;
+	packet1.estimator_status = packet_in.estimator_status;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.landed_state = packet_in.landed_state;
+	packet1.angular_velocity_z = packet_in.angular_velocity_z;
+	mav_array_memcpy(packet1.q, packet_in.q, sizeof(float)*4);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_autopilot_state_for_gimbal_device_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.time_boot_us , packet1.q , packet1.q_estimated_delay_us , packet1.vx , packet1.vy , packet1.vz , packet1.v_estimated_delay_us , packet1.feed_forward_angular_velocity_z , packet1.estimator_status , packet1.landed_state , packet1.angular_velocity_z));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_autopilot_state_for_gimbal_device_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_autopilot_state_for_gimbal_device_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_gimbal_manager_set_pitchyaw(Msgbench_Run &run)
+{
+	mavlink_gimbal_manager_set_pitchyaw_t packet_in = {
+		(uint32_t)963497464, (float)45.0, (float)73.0, (float)101.0, (float)129.0, (uint8_t)65, (uint8_t)132, (uint8_t)199
+	};
+	mavlink_gimbal_manager_set_pitchyaw_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.flags = packet_in.flags;
+	packet1.pitch = packet_in.pitch;
+	packet1.yaw = packet_in.yaw;
+	packet1.pitch_rate = packet_in.pitch_rate;
+	packet1.yaw_rate = packet_in.yaw_rate;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.gimbal_device_id = packet_in.gimbal_device_id;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_gimbal_manager_set_pitchyaw_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.flags , packet1.gimbal_device_id , packet1.pitch , packet1.yaw , packet1.pitch_rate , packet1.yaw_rate));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_gimbal_manager_set_pitchyaw_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_gimbal_manager_set_pitchyaw_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_gimbal_manager_set_manual_control(Msgbench_Run &run)
+{
+	mavlink_gimbal_manager_set_manual_control_t packet_in = {
+		(uint32_t)963497464, (float)45.0, (float)73.0, (float)101.0, (float)129.0, (uint8_t)65, (uint8_t)132, (uint8_t)199
+	};
+	mavlink_gimbal_manager_set_manual_control_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.flags = packet_in.flags;
+	packet1.pitch = packet_in.pitch;
+	packet1.yaw = packet_in.yaw;
+	packet1.pitch_rate = packet_in.pitch_rate;
+	packet1.yaw_rate = packet_in.yaw_rate;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.gimbal_device_id = packet_in.gimbal_device_id;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_gimbal_manager_set_manual_control_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.flags , packet1.gimbal_device_id , packet1.pitch , packet1.yaw , packet1.pitch_rate , packet1.yaw_rate));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_gimbal_manager_set_manual_control_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_gimbal_manager_set_manual_control_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_esc_info(Msgbench_Run &run)
+{
+	mavlink_esc_info_t packet_in = {
+		(uint64_t)93372036854775807ULL, { (uint32_t)963497880, (uint32_t)963497881, (uint32_t)963497882, (uint32_t)963497883 }, (uint16_t)18483, { (uint16_t)18587, (uint16_t)18588, (uint16_t)18589, (uint16_t)18590 }, { (int16_t)19003, (int16_t)19004, (int16_t)19005, (int16_t)19006 }, (uint8_t)3, (uint8_t)70, (uint8_t)137, (uint8_t)204
+	};
+	mavlink_esc_info_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.counter = packet_in.counter;
+	packet1.index = packet_in.index;
+	packet1.count = packet_in.count;
+	packet1.connection_type = packet_in.connection_type;
+	packet1.info = packet_in.info;
+	mav_array_memcpy(packet1.error_count, packet_in.error_count, sizeof(uint32_t)*4);
+	mav_array_memcpy(packet1.failure_flags, packet_in.failure_flags, sizeof(uint16_t)*4);
+	mav_array_memcpy(packet1.temperature, packet_in.temperature, sizeof(int16_t)*4);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_esc_info_pack(run.system_id, run.component_id, &run.message, packet1.index , packet1.time_usec , packet1.counter , packet1.count , packet1.connection_type , packet1.info , packet1.failure_flags , packet1.error_count , packet1.temperature));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_esc_info_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_esc_info_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_esc_status(Msgbench_Run &run)
+{
+	mavlink_esc_status_t packet_in = {
+		(uint64_t)93372036854775807ULL, { (int32_t)963497880, (int32_t)963497881, (int32_t)963497882, (int32_t)963497883 }, { (float)185.0, (float)186.0, (float)187.0, (float)188.0 }, { (float)297.0, (float)298.0, (float)299.0, (float)300.0 }, (uint8_t)173
+	};
+	mavlink_esc_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.index = packet_in.index;
+	mav_array_memcpy(packet1.rpm, packet_in.rpm, sizeof(int32_t)*4);
+	mav_array_memcpy(packet1.voltage, packet_in.voltage, sizeof(float)*4);
+	mav_array_memcpy(packet1.current, packet_in.current, sizeof(float)*4);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_esc_status_pack(run.system_id, run.component_id, &run.message, packet1.index , packet1.time_usec , packet1.rpm , packet1.voltage , packet1.current));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_esc_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_esc_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_wifi_config_ap(Msgbench_Run &run)
+{
+	mavlink_wifi_config_ap_t packet_in = {
+		"ABCDEFGHIJKLMNOPQRSTUVWXYZABCDE", "GHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQ", (int8_t)37, (int8_t)104
+	};
+	mavlink_wifi_config_ap_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.mode = packet_in.mode;
+	packet1.response = packet_in.response;
+	mav_array_memcpy(packet1.ssid, packet_in.ssid, sizeof(char)*32);
+	mav_array_memcpy(packet1.password, packet_in.password, sizeof(char)*64);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_wifi_config_ap_pack(run.system_id, run.component_id, &run.message, packet1.ssid , packet1.password , packet1.mode , packet1.response));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_wifi_config_ap_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_wifi_config_ap_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_protocol_version(Msgbench_Run &run)
+{
+	mavlink_protocol_version_t packet_in = {
+		(uint16_t)17235, (uint16_t)17339, (uint16_t)17443, { (uint8_t)151, (uint8_t)152, (uint8_t)153, (uint8_t)154, (uint8_t)155, (uint8_t)156, (uint8_t)157, (uint8_t)158 }, { (uint8_t)175, (uint8_t)176, (uint8_t)177, (uint8_t)178, (uint8_t)179, (uint8_t)180, (uint8_t)181, (uint8_t)182 }
+	};
+	mavlink_protocol_version_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.version = packet_in.version;
+	packet1.min_version = packet_in.min_version;
+	packet1.max_version = packet_in.max_version;
+	mav_array_memcpy(packet1.spec_version_hash, packet_in.spec_version_hash, sizeof(uint8_t)*8);
+	mav_array_memcpy(packet1.library_version_hash, packet_in.library_version_hash, sizeof(uint8_t)*8);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_protocol_version_pack(run.system_id, run.component_id, &run.message, packet1.version , packet1.min_version , packet1.max_version , packet1.spec_version_hash , packet1.library_version_hash));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_protocol_version_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_protocol_version_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_ais_vessel(Msgbench_Run &run)
+{
+	mavlink_ais_vessel_t packet_in = {
+		(uint32_t)963497464, (int32_t)963497672, (int32_t)963497880, (uint16_t)17859, (uint16_t)17963, (uint16_t)18067, (uint16_t)18171, (uint16_t)18275, (uint16_t)18379, (uint16_t)18483, (int8_t)211, (uint8_t)22, (uint8_t)89, (uint8_t)156, (uint8_t)223, "FGHIJK", "MNOPQRSTUVWXYZABCDE"
+	};
+	mavlink_ais_vessel_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.MMSI = packet_in.MMSI;
+	packet1.lat = packet_in.lat;
+	packet1.lon = packet_in.lon;
+	packet1.COG = packet_in.COG;
+	packet1.heading = packet_in.heading;
+	packet1.velocity = packet_in.velocity;
+	packet1.dimension_bow = packet_in.dimension_bow;
+	packet1.dimension_stern = packet_in.dimension_stern;
+	packet1.tslc = packet_in.tslc;
+	packet1.flags = packet_in.flags;
+	packet1.turn_rate = packet_in.turn_rate;
+	packet1.navigational_status = packet_in.navigational_status;
+	packet1.type = packet_in.type;
+	packet1.dimension_port = packet_in.dimension_port;
+	packet1.dimension_starboard = packet_in.dimension_starboard;
+	mav_array_memcpy(packet1.callsign, packet_in.callsign, sizeof(char)*7);
+	mav_array_memcpy(packet1.name, packet_in.name, sizeof(char)*20);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_ais_vessel_pack(run.system_id, run.component_id, &run.message, packet1.MMSI , packet1.lat , packet1.lon , packet1.COG , packet1.heading , packet1.velocity , packet1.turn_rate , packet1.navigational_status , packet1.type , packet1.dimension_bow , packet1.dimension_stern , packet1.dimension_port , packet1.dimension_starboard , packet1.callsign , packet1.name , packet1.tslc , packet1.flags));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_ais_vessel_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_ais_vessel_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_uavcan_node_status(Msgbench_Run &run)
+{
+	mavlink_uavcan_node_status_t packet_in = {
+		(uint64_t)93372036854775807ULL, (uint32_t)963497880, (uint16_t)17859, (uint8_t)175, (uint8_t)242, (uint8_t)53
+	};
+	mavlink_uavcan_node_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.uptime_sec = packet_in.uptime_sec;
+	packet1.vendor_specific_status_code = packet_in.vendor_specific_status_code;
+	packet1.health = packet_in.health;
+	packet1.mode = packet_in.mode;
+	packet1.sub_mode = packet_in.sub_mode;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_uavcan_node_status_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.uptime_sec , packet1.health , packet1.mode , packet1.sub_mode , packet1.vendor_specific_status_code));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_uavcan_node_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_uavcan_node_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_uavcan_node_info(Msgbench_Run &run)
+{
+	mavlink_uavcan_node_info_t packet_in = {
+		(uint64_t)93372036854775807ULL, (uint32_t)963497880, (uint32_t)963498088, "QRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQ", (uint8_t)37, (uint8_t)104, { (uint8_t)171, (uint8_t)172, (uint8_t)173, (uint8_t)174, (uint8_t)175, (uint8_t)176, (uint8_t)177, (uint8_t)178, (uint8_t)179, (uint8_t)180, (uint8_t)181, (uint8_t)182, (uint8_t)183, (uint8_t)184, (uint8_t)185, (uint8_t)186 }, (uint8_t)219, (uint8_t)30
+	};
+	mavlink_uavcan_node_info_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.uptime_sec = packet_in.uptime_sec;
+	packet1.sw_vcs_commit = packet_in.sw_vcs_commit;
+	packet1.hw_version_major = packet_in.hw_version_major;
+	packet1.hw_version_minor = packet_in.hw_version_minor;
+	packet1.sw_version_major = packet_in.sw_version_major;
+	packet1.sw_version_minor = packet_in.sw_version_minor;
+	mav_array_memcpy(packet1.name, packet_in.name, sizeof(char)*80);
+	mav_array_memcpy(packet1.hw_unique_id, packet_in.hw_unique_id, sizeof(uint8_t)*16);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_uavcan_node_info_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.uptime_sec , packet1.name , packet1.hw_version_major , packet1.hw_version_minor , packet1.hw_unique_id , packet1.sw_version_major , packet1.sw_version_minor , packet1.sw_vcs_commit));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_uavcan_node_info_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_uavcan_node_info_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_param_ext_request_read(Msgbench_Run &run)
+{
+	mavlink_param_ext_request_read_t packet_in = {
+		(int16_t)17235, (uint8_t)139, (uint8_t)206, "EFGHIJKLMNOPQRS"
+	};
+	mavlink_param_ext_request_read_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.param_index = packet_in.param_index;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	mav_array_memcpy(packet1.param_id, packet_in.param_id, sizeof(char)*16);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_param_ext_request_read_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.param_id , packet1.param_index));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_param_ext_request_read_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_param_ext_request_read_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_param_ext_request_list(Msgbench_Run &run)
+{
+	mavlink_param_ext_request_list_t packet_in = {
+		(uint8_t)5, (uint8_t)72
+	};
+	mavlink_param_ext_request_list_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_param_ext_request_list_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_param_ext_request_list_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_param_ext_request_list_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_param_ext_value(Msgbench_Run &run)
+{
+	mavlink_param_ext_value_t packet_in = {
+		(uint16_t)17235, (uint16_t)17339, "EFGHIJKLMNOPQRS", "UVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQ", (uint8_t)193
+	};
+	mavlink_param_ext_value_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.param_count = packet_in.param_count;
+	packet1.param_index = packet_in.param_index;
+	packet1.param_type = packet_in.param_type;
+	mav_array_memcpy(packet1.param_id, packet_in.param_id, sizeof(char)*16);
+	mav_array_memcpy(packet1.param_value, packet_in.param_value, sizeof(char)*128);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_param_ext_value_pack(run.system_id, run.component_id, &run.message, packet1.param_id , packet1.param_value , packet1.param_type , packet1.param_count , packet1.param_index));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_param_ext_value_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_param_ext_value_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_param_ext_set(Msgbench_Run &run)
+{
+	mavlink_param_ext_set_t packet_in = {
+		(uint8_t)5, (uint8_t)72, "CDEFGHIJKLMNOPQ", "STUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNO", (uint8_t)59
+	};
+	mavlink_param_ext_set_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.param_type = packet_in.param_type;
+	mav_array_memcpy(packet1.param_id, packet_in.param_id, sizeof(char)*16);
+	mav_array_memcpy(packet1.param_value, packet_in.param_value, sizeof(char)*128);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_param_ext_set_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.param_id , packet1.param_value , packet1.param_type));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_param_ext_set_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_param_ext_set_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_param_ext_ack(Msgbench_Run &run)
+{
+	mavlink_param_ext_ack_t packet_in = {
+		"ABCDEFGHIJKLMNO", "QRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLM", (uint8_t)181, (uint8_t)248
+	};
+	mavlink_param_ext_ack_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.param_type = packet_in.param_type;
+	packet1.param_result = packet_in.param_result;
+	mav_array_memcpy(packet1.param_id, packet_in.param_id, sizeof(char)*16);
+	mav_array_memcpy(packet1.param_value, packet_in.param_value, sizeof(char)*128);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_param_ext_ack_pack(run.system_id, run.component_id, &run.message, packet1.param_id , packet1.param_value , packet1.param_type , packet1.param_result));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_param_ext_ack_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_param_ext_ack_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_obstacle_distance(Msgbench_Run &run)
+{
+	mavlink_obstacle_distance_t packet_in = {
+		(uint64_t)93372036854775807ULL, { (uint16_t)17651, (uint16_t)17652, (uint16_t)17653, (uint16_t)17654, (uint16_t)17655, (uint16_t)17656, (uint16_t)17657, (uint16_t)17658, (uint16_t)17659, (uint16_t)17660, (uint16_t)17661, (uint16_t)17662, (uint16_t)17663, (uint16_t)17664, (uint16_t)17665, (uint16_t)17666, (uint16_t)17667, (uint16_t)17668, (uint16_t)17669, (uint16_t)17670, (uint16_t)17671, (uint16_t)17672, (uint16_t)17673, (uint16_t)17674, (uint16_t)17675, (uint16_t)17676, (uint16_t)17677, (uint16_t)17678, (uint16_t)17679, (uint16_t)17680, (uint16_t)17681, (uint16_t)17682, (uint16_t)17683, (uint16_t)17684, (uint16_t)17685, (uint16_t)17686, (uint16_t)17687, (uint16_t)17688, (uint16_t)17689, (uint16_t)17690, (uint16_t)17691, (uint16_t)17692, (uint16_t)17693, (uint16_t)17694, (uint16_t)17695, (uint16_t)17696, (uint16_t)17697, (uint16_t)17698, (uint16_t)17699, (uint16_t)17700, (uint16_t)17701, (uint16_t)17702, (uint16_t)17703, (uint16_t)17704, (uint16_t)17705, (uint16_t)17706, (uint16_t)17707, (uint16_t)17708, (uint16_t)17709, (uint16_t)17710, (uint16_t)17711, (uint16_t)17712, (uint16_t)17713, (uint16_t)17714, (uint16_t)17715, (uint16_t)17716, (uint16_t)17717, (uint16_t)17718, (uint16_t)17719, (uint16_t)17720, (uint16_t)17721, (uint16_t)17722 }, (uint16_t)25139, (uint16_t)25243, (uint8_t)217, (uint8_t)28, (float)1123.0, (float)1151.0, (uint8_t)119
+	};
+	mavlink_obstacle_distance_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.min_distance = packet_in.min_distance;
+	packet1.max_distance = packet_in.max_distance;
+	packet1.sensor_type = packet_in.sensor_type;
+	packet1.increment = packet_in.increment;
+	packet1.increment_f = packet_in.increment_f;
+	packet1.angle_offset = packet_in.angle_offset;
+	packet1.frame = packet_in.frame;
+	mav_array_memcpy(packet1.distances, packet_in.distances, sizeof(uint16_t)*72);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_obstacle_distance_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.sensor_type , packet1.distances , packet1.increment , packet1.min_distance , packet1.max_distance , packet1.increment_f , packet1.angle_offset , packet1.frame));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_obstacle_distance_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_obstacle_distance_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_odometry(Msgbench_Run &run)
+{
+	mavlink_odometry_t packet_in = {
+		(uint64_t)93372036854775807ULL, (float)73.0, (float)101.0, (float)129.0, { (float)157.0, (float)158.0, (float)159.0, (float)160.0 }, (float)269.0, (float)297.0, (float)325.0, (float)353.0, (float)381.0, (float)409.0, { (float)437.0, (float)438.0, (float)439.0, (float)440.0, (float)441.0, (float)442.0, (float)443.0, (float)444.0, (float)445.0, (float)446.0, (float)447.0, (float)448.0, (float)449.0, (float)450.0, (float)451.0, (float)452.0, (float)453.0, (float)454.0, (float)455.0, (float)456.0, (float)457.0 }, { (float)1025.0, (float)1026.0, (float)1027.0, (float)1028.0, (float)1029.0, (float)1030.0, (float)1031.0, (float)1032.0, (float)1033.0, (float)1034.0, (float)1035.0, (float)1036.0, (float)1037.0, (float)1038.0, (float)1039.0, (float)1040.0, (float)1041.0, (float)1042.0, (float)1043.0, (float)1044.0, (float)1045.0 }, (uint8_t)177, (uint8_t)244, (uint8_t)55, (uint8_t)122, (int8_t)189
+	};
+	mavlink_odometry_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.x = packet_in.x;
+	packet1.y = packet_in.y;
+	packet1.z = packet_in.z;
+	packet1.vx = packet_in.vx;
+	packet1.vy = packet_in.vy;
+	packet1.vz = packet_in.vz;
+	packet1.rollspeed = packet_in.rollspeed;
+	packet1.pitchspeed = packet_in.pitchspeed;
+	packet1.yawspeed = packet_in.yawspeed;
+	packet1.frame_id = packet_in.frame_id;
+	packet1.child_frame_id = packet_in.child_frame_id;
+	packet1.reset_counter = packet_in.reset_counter;
+	packet1.estimator_type = packet_in.estimator_type;
+	packet1.quality = packet_in.quality;
+	mav_array_memcpy(packet1.q, packet_in.q, sizeof(float)*4);
+	mav_array_memcpy(packet1.pose_covariance, packet_in.pose_covariance, sizeof(float)*21);
+	mav_array_memcpy(packet1.velocity_covariance, packet_in.velocity_covariance, sizeof(float)*21);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_odometry_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.frame_id , packet1.child_frame_id , packet1.x , packet1.y , packet1.z , packet1.q , packet1.vx , packet1.vy , packet1.vz , packet1.rollspeed , packet1.pitchspeed , packet1.yawspeed , packet1.pose_covariance , packet1.velocity_covariance , packet1.reset_counter , packet1.estimator_type , packet1.quality));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_odometry_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_odometry_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_trajectory_representation_waypoints(Msgbench_Run &run)
+{
+	mavlink_trajectory_representation_waypoints_t packet_in = {
+		(uint64_t)93372036854775807ULL, { (float)73.0, (float)74.0, (float)75.0, (float)76.0, (float)77.0 }, { (float)213.0, (float)214.0, (float)215.0, (float)216.0, (float)217.0 }, { (float)353.0, (float)354.0, (float)355.0, (float)356.0, (float)357.0 }, { (float)493.0, (float)494.0, (float)495.0, (float)496.0, (float)497.0 }, { (float)633.0, (float)634.0, (float)635.0, (float)636.0, (float)637.0 }, { (float)773.0, (float)774.0, (float)775.0, (float)776.0, (float)777.0 }, { (float)913.0, (float)914.0, (float)915.0, (float)916.0, (float)917.0 }, { (float)1053.0, (float)1054.0, (float)1055.0, (float)1056.0, (float)1057.0 }, { (float)1193.0, (float)1194.0, (float)1195.0, (float)1196.0, (float)1197.0 }, { (float)1333.0, (float)1334.0, (float)1335.0, (float)1336.0, (float)1337.0 }, { (float)1473.0, (float)1474.0, (float)1475.0, (float)1476.0, (float)1477.0 }, { (uint16_t)29091, (uint16_t)29092, (uint16_t)29093, (uint16_t)29094, (uint16_t)29095 }, (uint8_t)79
+	};
+	mavlink_trajectory_representation_waypoints_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.valid_points = packet_in.valid_points;
+	mav_array_memcpy(packet1.pos_x, packet_in.pos_x, sizeof(float)*5);
+	mav_array_memcpy(packet1.pos_y, packet_in.pos_y, sizeof(float)*5);
+	mav_array_memcpy(packet1.pos_z, packet_in.pos_z, sizeof(float)*5);
+	mav_array_memcpy(packet1.vel_x, packet_in.vel_x, sizeof(float)*5);
+	mav_array_memcpy(packet1.vel_y, packet_in.vel_y, sizeof(float)*5);
+	mav_array_memcpy(packet1.vel_z, packet_in.vel_z, sizeof(float)*5);
+	mav_array_memcpy(packet1.acc_x, packet_in.acc_x, sizeof(float)*5);
+	mav_array_memcpy(packet1.acc_y, packet_in.acc_y, sizeof(float)*5);
+	mav_array_memcpy(packet1.acc_z, packet_in.acc_z, sizeof(float)*5);
+	mav_array_memcpy(packet1.pos_yaw, packet_in.pos_yaw, sizeof(float)*5);
+	mav_array_memcpy(packet1.vel_yaw, packet_in.vel_yaw, sizeof(float)*5);
+	mav_array_memcpy(packet1.command, packet_in.command, sizeof(uint16_t)*5);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_trajectory_representation_waypoints_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.valid_points , packet1.pos_x , packet1.pos_y , packet1.pos_z , packet1.vel_x , packet1.vel_y , packet1.vel_z , packet1.acc_x , packet1.acc_y , packet1.acc_z , packet1.pos_yaw , packet1.vel_yaw , packet1.command));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_trajectory_representation_waypoints_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_trajectory_representation_waypoints_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_trajectory_representation_bezier(Msgbench_Run &run)
+{
+	mavlink_trajectory_representation_bezier_t packet_in = {
+		(uint64_t)93372036854775807ULL, { (float)73.0, (float)74.0, (float)75.0, (float)76.0, (float)77.0 }, { (float)213.0, (float)214.0, (float)215.0, (float)216.0, (float)217.0 }, { (float)353.0, (float)354.0, (float)355.0, (float)356.0, (float)357.0 }, { (float)493.0, (float)494.0, (float)495.0, (float)496.0, (float)497.0 }, { (float)633.0, (float)634.0, (float)635.0, (float)636.0, (float)637.0 }, (uint8_t)73
+	};
+	mavlink_trajectory_representation_bezier_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.valid_points = packet_in.valid_points;
+	mav_array_memcpy(packet1.pos_x, packet_in.pos_x, sizeof(float)*5);
+	mav_array_memcpy(packet1.pos_y, packet_in.pos_y, sizeof(float)*5);
+	mav_array_memcpy(packet1.pos_z, packet_in.pos_z, sizeof(float)*5);
+	mav_array_memcpy(packet1.delta, packet_in.delta, sizeof(float)*5);
+	mav_array_memcpy(packet1.pos_yaw, packet_in.pos_yaw, sizeof(float)*5);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_trajectory_representation_bezier_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.valid_points , packet1.pos_x , packet1.pos_y , packet1.pos_z , packet1.delta , packet1.pos_yaw));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_trajectory_representation_bezier_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_trajectory_representation_bezier_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_cellular_status(Msgbench_Run &run)
+{
+	mavlink_cellular_status_t packet_in = {
+		(uint16_t)17235, (uint16_t)17339, (uint16_t)17443, (uint8_t)151, (uint8_t)218, (uint8_t)29, (uint8_t)96
+	};
+	mavlink_cellular_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.mcc = packet_in.mcc;
+	packet1.mnc = packet_in.mnc;
+	packet1.lac = packet_in.lac;
+	packet1.status = packet_in.status;
+	packet1.failure_reason = packet_in.failure_reason;
+	packet1.type = packet_in.type;
+	packet1.quality = packet_in.quality;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_cellular_status_pack(run.system_id, run.component_id, &run.message, packet1.status , packet1.failure_reason , packet1.type , packet1.quality , packet1.mcc , packet1.mnc , packet1.lac));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_cellular_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_cellular_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_isbd_link_status(Msgbench_Run &run)
+{
+	mavlink_isbd_link_status_t packet_in = {
+		(uint64_t)93372036854775807ULL, (uint64_t)93372036854776311ULL, (uint16_t)18067, (uint16_t)18171, (uint8_t)65, (uint8_t)132, (uint8_t)199, (uint8_t)10
+	};
+	mavlink_isbd_link_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.timestamp = packet_in.timestamp;
+	packet1.last_heartbeat = packet_in.last_heartbeat;
+	packet1.failed_sessions = packet_in.failed_sessions;
+	packet1.successful_sessions = packet_in.successful_sessions;
+	packet1.signal_quality = packet_in.signal_quality;
+	packet1.ring_pending = packet_in.ring_pending;
+	packet1.tx_session_pending = packet_in.tx_session_pending;
+	packet1.rx_session_pending = packet_in.rx_session_pending;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_isbd_link_status_pack(run.system_id, run.component_id, &run.message, packet1.timestamp , packet1.last_heartbeat , packet1.failed_sessions , packet1.successful_sessions , packet1.signal_quality , packet1.ring_pending , packet1.tx_session_pending , packet1.rx_session_pending));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_isbd_link_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_isbd_link_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_cellular_config(Msgbench_Run &run)
+{
+	mavlink_cellular_config_t packet_in = {
+		(uint8_t)5, (uint8_t)72, "CDEFGHIJKLMNOPQ", "STUVWXYZABCDEFG", "IJKLMNOPQRSTUVWXYZABCDEFGHIJKLM", "OPQRSTUVWXYZABC", (uint8_t)123, (uint8_t)190
+	};
+	mavlink_cellular_config_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.enable_lte = packet_in.enable_lte;
+	packet1.enable_pin = packet_in.enable_pin;
+	packet1.roaming = packet_in.roaming;
+	packet1.response = packet_in.response;
+	mav_array_memcpy(packet1.pin, packet_in.pin, sizeof(char)*16);
+	mav_array_memcpy(packet1.new_pin, packet_in.new_pin, sizeof(char)*16);
+	mav_array_memcpy(packet1.apn, packet_in.apn, sizeof(char)*32);
+	mav_array_memcpy(packet1.puk, packet_in.puk, sizeof(char)*16);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_cellular_config_pack(run.system_id, run.component_id, &run.message, packet1.enable_lte , packet1.enable_pin , packet1.pin , packet1.new_pin , packet1.apn , packet1.puk , packet1.roaming , packet1.response));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_cellular_config_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_cellular_config_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_raw_rpm(Msgbench_Run &run)
+{
+	mavlink_raw_rpm_t packet_in = {
+		(float)17.0, (uint8_t)17
+	};
+	mavlink_raw_rpm_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.frequency = packet_in.frequency;
+	packet1.index = packet_in.index;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_raw_rpm_pack(run.system_id, run.component_id, &run.message, packet1.index , packet1.frequency));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_raw_rpm_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_raw_rpm_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_utm_global_position(Msgbench_Run &run)
+{
+	mavlink_utm_global_position_t packet_in = {
+		(uint64_t)93372036854775807ULL, (int32_t)963497880, (int32_t)963498088, (int32_t)963498296, (int32_t)963498504, (int32_t)963498712, (int32_t)963498920, (int32_t)963499128, (int16_t)19107, (int16_t)19211, (int16_t)19315, (uint16_t)19419, (uint16_t)19523, (uint16_t)19627, (uint16_t)19731, { (uint8_t)27, (uint8_t)28, (uint8_t)29, (uint8_t)30, (uint8_t)31, (uint8_t)32, (uint8_t)33, (uint8_t)34, (uint8_t)35, (uint8_t)36, (uint8_t)37, (uint8_t)38, (uint8_t)39, (uint8_t)40, (uint8_t)41, (uint8_t)42, (uint8_t)43, (uint8_t)44 }, (uint8_t)209, (uint8_t)20
+	};
+	mavlink_utm_global_position_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time = packet_in.time;
+	packet1.lat = packet_in.lat;
+	packet1.lon = packet_in.lon;
+	packet1.alt = packet_in.alt;
+	packet1.relative_alt = packet_in.relative_alt;
+	packet1.next_lat = packet_in.next_lat;
+	packet1.next_lon = packet_in.next_lon;
+	packet1.next_alt = packet_in.next_alt;
+	packet1.vx = packet_in.vx;
+	packet1.vy = packet_in.vy;
+	packet1.vz = packet_in.vz;
+	packet1.h_acc = packet_in.h_acc;
+	packet1.v_acc = packet_in.v_acc;
+	packet1.vel_acc = packet_in.vel_acc;
+	packet1.update_rate = packet_in.update_rate;
+	packet1.flight_state = packet_in.flight_state;
+	packet1.flags = packet_in.flags;
+	mav_array_memcpy(packet1.uas_id, packet_in.uas_id, sizeof(uint8_t)*18);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_utm_global_position_pack(run.system_id, run.component_id, &run.message, packet1.time , packet1.uas_id , packet1.lat , packet1.lon , packet1.alt , packet1.relative_alt , packet1.vx , packet1.vy , packet1.vz , packet1.h_acc , packet1.v_acc , packet1.vel_acc , packet1.next_lat , packet1.next_lon , packet1.next_alt , packet1.update_rate , packet1.flight_state , packet1.flags));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_utm_global_position_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_utm_global_position_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_debug_float_array(Msgbench_Run &run)
+{
+	mavlink_debug_float_array_t packet_in = {
+		(uint64_t)93372036854775807ULL, (uint16_t)17651, "KLMNOPQRS", { (float)157.0, (float)158.0, (float)159.0, (float)160.0, (float)161.0, (float)162.0, (float)163.0, (float)164.0, (float)165.0, (float)166.0, (float)167.0, (float)168.0, (float)169.0, (float)170.0, (float)171.0, (float)172.0, (float)173.0, (float)174.0, (float)175.0, (float)176.0, (float)177.0, (float)178.0, (float)179.0, (float)180.0, (float)181.0, (float)182.0, (float)183.0, (float)184.0, (float)185.0, (float)186.0, (float)187.0, (float)188.0, (float)189.0, (float)190.0, (float)191.0, (float)192.0, (float)193.0, (float)194.0, (float)195.0, (float)196.0, (float)197.0, (float)198.0, (float)199.0, (float)200.0, (float)201.0, (float)202.0, (float)203.0, (float)204.0, (float)205.0, (float)206.0, (float)207.0, (float)208.0, (float)209.0, (float)210.0, (float)211.0, (float)212.0, (float)213.0, (float)214.0 }
+	};
+	mavlink_debug_float_array_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.array_id = packet_in.array_id;
+	mav_array_memcpy(packet1.name, packet_in.name, sizeof(char)*10);
+	mav_array_memcpy(packet1.data, packet_in.data, sizeof(float)*58);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_debug_float_array_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.name , packet1.array_id , packet1.data));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_debug_float_array_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_debug_float_array_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_orbit_execution_status(Msgbench_Run &run)
+{
+	mavlink_orbit_execution_status_t packet_in = {
+		(uint64_t)93372036854775807ULL, (float)73.0, (int32_t)963498088, (int32_t)963498296, (float)157.0, (uint8_t)77
+	};
+	mavlink_orbit_execution_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.radius = packet_in.radius;
+	packet1.x = packet_in.x;
+	packet1.y = packet_in.y;
+	packet1.z = packet_in.z;
+	packet1.frame = packet_in.frame;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_orbit_execution_status_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.radius , packet1.frame , packet1.x , packet1.y , packet1.z));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_orbit_execution_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_orbit_execution_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_smart_battery_info(Msgbench_Run &run)
+{
+	mavlink_smart_battery_info_t packet_in = {
+		(int32_t)963497464, (int32_t)963497672, (uint16_t)17651, (uint16_t)17755, (uint16_t)17859, (uint16_t)17963, (uint16_t)18067, (uint8_t)187, (uint8_t)254, (uint8_t)65, "VWXYZABCDEFGHIJ", "LMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGH", (uint16_t)21759, (uint8_t)80, (uint32_t)963502144, (uint32_t)963502352, "UVWXYZABCD"
+	};
+	mavlink_smart_battery_info_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.capacity_full_specification = packet_in.capacity_full_specification;
+	packet1.capacity_full = packet_in.capacity_full;
+	packet1.cycle_count = packet_in.cycle_count;
+	packet1.weight = packet_in.weight;
+	packet1.discharge_minimum_voltage = packet_in.discharge_minimum_voltage;
+	packet1.charging_minimum_voltage = packet_in.charging_minimum_voltage;
+	packet1.resting_minimum_voltage = packet_in.resting_minimum_voltage;
+	packet1.id = packet_in.id;
+	packet1.battery_function = packet_in.battery_function;
+	packet1.type = packet_in.type;
+	packet1.charging_maximum_voltage = packet_in.charging_maximum_voltage;
+	packet1.cells_in_series = packet_in.cells_in_series;
+	packet1.discharge_maximum_current = packet_in.discharge_maximum_current;
+	packet1.discharge_maximum_burst_current = packet_in.discharge_maximum_burst_current;
+	mav_array_memcpy(packet1.serial_number, packet_in.serial_number, sizeof(char)*16);
+	mav_array_memcpy(packet1.device_name, packet_in.device_name, sizeof(char)*50);
+	mav_array_memcpy(packet1.manufacture_date, packet_in.manufacture_date, sizeof(char)*11);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_smart_battery_info_pack(run.system_id, run.component_id, &run.message, packet1.id , packet1.battery_function , packet1.type , packet1.capacity_full_specification , packet1.capacity_full , packet1.cycle_count , packet1.serial_number , packet1.device_name , packet1.weight , packet1.discharge_minimum_voltage , packet1.charging_minimum_voltage , packet1.resting_minimum_voltage , packet1.charging_maximum_voltage , packet1.cells_in_series , packet1.discharge_maximum_current , packet1.discharge_maximum_burst_current , packet1.manufacture_date));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_smart_battery_info_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_smart_battery_info_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_generator_status(Msgbench_Run &run)
+{
+	mavlink_generator_status_t packet_in = {
+		(uint64_t)93372036854775807ULL, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (uint32_t)963498920, (int32_t)963499128, (uint16_t)19107, (int16_t)19211, (int16_t)19315
+	};
+	mavlink_generator_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.status = packet_in.status;
+	packet1.battery_current = packet_in.battery_current;
+	packet1.load_current = packet_in.load_current;
+	packet1.power_generated = packet_in.power_generated;
+	packet1.bus_voltage = packet_in.bus_voltage;
+	packet1.bat_current_setpoint = packet_in.bat_current_setpoint;
+	packet1.runtime = packet_in.runtime;
+	packet1.time_until_maintenance = packet_in.time_until_maintenance;
+	packet1.generator_speed = packet_in.generator_speed;
+	packet1.rectifier_temperature = packet_in.rectifier_temperature;
+	packet1.generator_temperature = packet_in.generator_temperature;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_generator_status_pack(run.system_id, run.component_id, &run.message, packet1.status , packet1.generator_speed , packet1.battery_current , packet1.load_current , packet1.power_generated , packet1.bus_voltage , packet1.rectifier_temperature , packet1.bat_current_setpoint , packet1.generator_temperature , packet1.runtime , packet1.time_until_maintenance));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_generator_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_generator_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_actuator_output_status(Msgbench_Run &run)
+{
+	mavlink_actuator_output_status_t packet_in = {
+		(uint64_t)93372036854775807ULL, (uint32_t)963497880, { (float)101.0, (float)102.0, (float)103.0, (float)104.0, (float)105.0, (float)106.0, (float)107.0, (float)108.0, (float)109.0, (float)110.0, (float)111.0, (float)112.0, (float)113.0, (float)114.0, (float)115.0, (float)116.0, (float)117.0, (float)118.0, (float)119.0, (float)120.0, (float)121.0, (float)122.0, (float)123.0, (float)124.0, (float)125.0, (float)126.0, (float)127.0, (float)128.0, (float)129.0, (float)130.0, (float)131.0, (float)132.0 }
+	};
+	mavlink_actuator_output_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.active = packet_in.active;
+	mav_array_memcpy(packet1.actuator, packet_in.actuator, sizeof(float)*32);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_actuator_output_status_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.active , packet1.actuator));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_actuator_output_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_actuator_output_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_time_estimate_to_target(Msgbench_Run &run)
+{
+	mavlink_time_estimate_to_target_t packet_in = {
+		(int32_t)963497464, (int32_t)963497672, (int32_t)963497880, (int32_t)963498088, (int32_t)963498296
+	};
+	mavlink_time_estimate_to_target_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.safe_return = packet_in.safe_return;
+	packet1.land = packet_in.land;
+	packet1.mission_next_item = packet_in.mission_next_item;
+	packet1.mission_end = packet_in.mission_end;
+	packet1.commanded_action = packet_in.commanded_action;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_time_estimate_to_target_pack(run.system_id, run.component_id, &run.message, packet1.safe_return , packet1.land , packet1.mission_next_item , packet1.mission_end , packet1.commanded_action));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_time_estimate_to_target_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_time_estimate_to_target_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_tunnel(Msgbench_Run &run)
+{
+	mavlink_tunnel_t packet_in = {
+		(uint16_t)17235, (uint8_t)139, (uint8_t)206, (uint8_t)17, { (uint8_t)84, (uint8_t)85, (uint8_t)86, (uint8_t)87, (uint8_t)88, (uint8_t)89, (uint8_t)90, (uint8_t)91, (uint8_t)92, (uint8_t)93, (uint8_t)94, (uint8_t)95, (uint8_t)96, (uint8_t)97, (uint8_t)98, (uint8_t)99, (uint8_t)100, (uint8_t)101, (uint8_t)102, (uint8_t)103, (uint8_t)104, (uint8_t)105, (uint8_t)106, (uint8_t)107, (uint8_t)108, (uint8_t)109, (uint8_t)110, (uint8_t)111, (uint8_t)112, (uint8_t)113, (uint8_t)114, (uint8_t)115, (uint8_t)116, (uint8_t)117, (uint8_t)118, (uint8_t)119, (uint8_t)120, (uint8_t)121, (uint8_t)122, (uint8_t)123, (uint8_t)124, (uint8_t)125, (uint8_t)126, (uint8_t)127, (uint8_t)128, (uint8_t)129, (uint8_t)130, (uint8_t)131, (uint8_t)132, (uint8_t)133, (uint8_t)134, (uint8_t)135, (uint8_t)136, (uint8_t)137, (uint8_t)138, (uint8_t)139, (uint8_t)140, (uint8_t)141, (uint8_t)142, (uint8_t)143, (uint8_t)144, (uint8_t)145, (uint8_t)146, (uint8_t)147, (uint8_t)148, (uint8_t)149, (uint8_t)150, (uint8_t)151, (uint8_t)152, (uint8_t)153, (uint8_t)154, (uint8_t)155, (uint8_t)156, (uint8_t)157, (uint8_t)158, (uint8_t)159, (uint8_t)160, (uint8_t)161, (uint8_t)162, (uint8_t)163, (uint8_t)164, (uint8_t)165, (uint8_t)166, (uint8_t)167, (uint8_t)168, (uint8_t)169, (uint8_t)170, (uint8_t)171, (uint8_t)172, (uint8_t)173, (uint8_t)174, (uint8_t)175, (uint8_t)176, (uint8_t)177, (uint8_t)178, (uint8_t)179, (uint8_t)180, (uint8_t)181, (uint8_t)182, (uint8_t)183, (uint8_t)184, (uint8_t)185, (uint8_t)186, (uint8_t)187, (uint8_t)188, (uint8_t)189, (uint8_t)190, (uint8_t)191, (uint8_t)192, (uint8_t)193, (uint8_t)194, (uint8_t)195, (uint8_t)196, (uint8_t)197, (uint8_t)198, (uint8_t)199, (uint8_t)200, (uint8_t)201, (uint8_t)202, (uint8_t)203, (uint8_t)204, (uint8_t)205, (uint8_t)206, (uint8_t)207, (uint8_t)208, (uint8_t)209, (uint8_t)210, (uint8_t)211 }
+	};
+	mavlink_tunnel_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.payload_type = packet_in.payload_type;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.payload_length = packet_in.payload_length;
+	mav_array_memcpy(packet1.payload, packet_in.payload, sizeof(uint8_t)*128);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_tunnel_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.payload_type , packet1.payload_length , packet1.payload));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_tunnel_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_tunnel_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_can_frame(Msgbench_Run &run)
+{
+	mavlink_can_frame_t packet_in = {
+		(uint32_t)963497464, (uint8_t)17, (uint8_t)84, (uint8_t)151, (uint8_t)218, { (uint8_t)29, (uint8_t)30, (uint8_t)31, (uint8_t)32, (uint8_t)33, (uint8_t)34, (uint8_t)35, (uint8_t)36 }
+	};
+	mavlink_can_frame_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.id = packet_in.id;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.bus = packet_in.bus;
+	packet1.len = packet_in.len;
+	mav_array_memcpy(packet1.data, packet_in.data, sizeof(uint8_t)*8);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_can_frame_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.bus , packet1.len , packet1.id , packet1.data));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_can_frame_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_can_frame_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_canfd_frame(Msgbench_Run &run)
+{
+	mavlink_canfd_frame_t packet_in = {
+		(uint32_t)963497464, (uint8_t)17, (uint8_t)84, (uint8_t)151, (uint8_t)218, { (uint8_t)29, (uint8_t)30, (uint8_t)31, (uint8_t)32, (uint8_t)33, (uint8_t)34, (uint8_t)35, (uint8_t)36, (uint8_t)37, (uint8_t)38, (uint8_t)39, (uint8_t)40, (uint8_t)41, (uint8_t)42, (uint8_t)43, (uint8_t)44, (uint8_t)45, (uint8_t)46, (uint8_t)47, (uint8_t)48, (uint8_t)49, (uint8_t)50, (uint8_t)51, (uint8_t)52, (uint8_t)53, (uint8_t)54, (uint8_t)55, (uint8_t)56, (uint8_t)57, (uint8_t)58, (uint8_t)59, (uint8_t)60, (uint8_t)61, (uint8_t)62, (uint8_t)63, (uint8_t)64, (uint8_t)65, (uint8_t)66, (uint8_t)67, (uint8_t)68, (uint8_t)69, (uint8_t)70, (uint8_t)71, (uint8_t)72, (uint8_t)73, (uint8_t)74, (uint8_t)75, (uint8_t)76, (uint8_t)77, (uint8_t)78, (uint8_t)79, (uint8_t)80, (uint8_t)81, (uint8_t)82, (uint8_t)83, (uint8_t)84, (uint8_t)85, (uint8_t)86, (uint8_t)87, (uint8_t)88, (uint8_t)89, (uint8_t)90, (uint8_t)91, (uint8_t)92 }
+	};
+	mavlink_canfd_frame_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.id = packet_in.id;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.bus = packet_in.bus;
+	packet1.len = packet_in.len;
+	mav_array_memcpy(packet1.data, packet_in.data, sizeof(uint8_t)*64);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_canfd_frame_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.bus , packet1.len , packet1.id , packet1.data));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_canfd_frame_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_canfd_frame_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_can_filter_modify(Msgbench_Run &run)
+{
+	mavlink_can_filter_modify_t packet_in = {
+		{ (uint16_t)17235, (uint16_t)17236, (uint16_t)17237, (uint16_t)17238, (uint16_t)17239, (uint16_t)17240, (uint16_t)17241, (uint16_t)17242, (uint16_t)17243, (uint16_t)17244, (uint16_t)17245, (uint16_t)17246, (uint16_t)17247, (uint16_t)17248, (uint16_t)17249, (uint16_t)17250 }, (uint8_t)101, (uint8_t)168, (uint8_t)235, (uint8_t)46, (uint8_t)113
+	};
+	mavlink_can_filter_modify_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.bus = packet_in.bus;
+	packet1.operation = packet_in.operation;
+	packet1.num_ids = packet_in.num_ids;
+	mav_array_memcpy(packet1.ids, packet_in.ids, sizeof(uint16_t)*16);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_can_filter_modify_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.bus , packet1.operation , packet1.num_ids , packet1.ids));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_can_filter_modify_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_can_filter_modify_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_onboard_computer_status(Msgbench_Run &run)
+{
+	mavlink_onboard_computer_status_t packet_in = {
+		(uint64_t)93372036854775807ULL, (uint32_t)963497880, (uint32_t)963498088, (uint32_t)963498296, { (uint32_t)963498504, (uint32_t)963498505, (uint32_t)963498506, (uint32_t)963498507 }, { (uint32_t)963499336, (uint32_t)963499337, (uint32_t)963499338, (uint32_t)963499339 }, { (uint32_t)963500168, (uint32_t)963500169, (uint32_t)963500170, (uint32_t)963500171 }, { (uint32_t)963501000, (uint32_t)963501001, (uint32_t)963501002, (uint32_t)963501003, (uint32_t)963501004, (uint32_t)963501005 }, { (uint32_t)963502248, (uint32_t)963502249, (uint32_t)963502250, (uint32_t)963502251, (uint32_t)963502252, (uint32_t)963502253 }, { (uint32_t)963503496, (uint32_t)963503497, (uint32_t)963503498, (uint32_t)963503499, (uint32_t)963503500, (uint32_t)963503501 }, { (uint32_t)963504744, (uint32_t)963504745, (uint32_t)963504746, (uint32_t)963504747, (uint32_t)963504748, (uint32_t)963504749 }, { (uint32_t)963505992, (uint32_t)963505993, (uint32_t)963505994, (uint32_t)963505995, (uint32_t)963505996, (uint32_t)963505997 }, { (int16_t)27011, (int16_t)27012, (int16_t)27013, (int16_t)27014 }, (uint8_t)81, { (uint8_t)148, (uint8_t)149, (uint8_t)150, (uint8_t)151, (uint8_t)152, (uint8_t)153, (uint8_t)154, (uint8_t)155 }, { (uint8_t)172, (uint8_t)173, (uint8_t)174, (uint8_t)175, (uint8_t)176, (uint8_t)177, (uint8_t)178, (uint8_t)179, (uint8_t)180, (uint8_t)181 }, { (uint8_t)74, (uint8_t)75, (uint8_t)76, (uint8_t)77 }, { (uint8_t)86, (uint8_t)87, (uint8_t)88, (uint8_t)89, (uint8_t)90, (uint8_t)91, (uint8_t)92, (uint8_t)93, (uint8_t)94, (uint8_t)95 }, (int8_t)244, { (int8_t)55, (int8_t)56, (int8_t)57, (int8_t)58, (int8_t)59, (int8_t)60, (int8_t)61, (int8_t)62 }
+	};
+	mavlink_onboard_computer_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.uptime = packet_in.uptime;
+	packet1.ram_usage = packet_in.ram_usage;
+	packet1.ram_total = packet_in.ram_total;
+	packet1.type = packet_in.type;
+	packet1.temperature_board = packet_in.temperature_board;
+	mav_array_memcpy(packet1.storage_type, packet_in.storage_type, sizeof(uint32_t)*4);
+	mav_array_memcpy(packet1.storage_usage, packet_in.storage_usage, sizeof(uint32_t)*4);
+	mav_array_memcpy(packet1.storage_total, packet_in.storage_total, sizeof(uint32_t)*4);
+	mav_array_memcpy(packet1.link_type, packet_in.link_type, sizeof(uint32_t)*6);
+	mav_array_memcpy(packet1.link_tx_rate, packet_in.link_tx_rate, sizeof(uint32_t)*6);
+	mav_array_memcpy(packet1.link_rx_rate, packet_in.link_rx_rate, sizeof(uint32_t)*6);
+	mav_array_memcpy(packet1.link_tx_max, packet_in.link_tx_max, sizeof(uint32_t)*6);
+	mav_array_memcpy(packet1.link_rx_max, packet_in.link_rx_max, sizeof(uint32_t)*6);
+	mav_array_memcpy(packet1.fan_speed, packet_in.fan_speed, sizeof(int16_t)*4);
+	mav_array_memcpy(packet1.cpu_cores, packet_in.cpu_cores, sizeof(uint8_t)*8);
+	mav_array_memcpy(packet1.cpu_combined, packet_in.cpu_combined, sizeof(uint8_t)*10);
+	mav_array_memcpy(packet1.gpu_cores, packet_in.gpu_cores, sizeof(uint8_t)*4);
+	mav_array_memcpy(packet1.gpu_combined, packet_in.gpu_combined, sizeof(uint8_t)*10);
+	mav_array_memcpy(packet1.temperature_core, packet_in.temperature_core, sizeof(int8_t)*8);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_onboard_computer_status_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.uptime , packet1.type , packet1.cpu_cores , packet1.cpu_combined , packet1.gpu_cores , packet1.gpu_combined , packet1.temperature_board , packet1.temperature_core , packet1.fan_speed , packet1.ram_usage , packet1.ram_total , packet1.storage_type , packet1.storage_usage , packet1.storage_total , packet1.link_type , packet1.link_tx_rate , packet1.link_rx_rate , packet1.link_tx_max , packet1.link_rx_max));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_onboard_computer_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_onboard_computer_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_component_information(Msgbench_Run &run)
+{
+	mavlink_component_information_t packet_in = {
+		(uint32_t)963497464, (uint32_t)963497672, (uint32_t)963497880, "MNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFG", "IJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABC"
+	};
+	mavlink_component_information_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.general_metadata_file_crc = packet_in.general_metadata_file_crc;
+	packet1.peripherals_metadata_file_crc = packet_in.peripherals_metadata_file_crc;
+	mav_array_memcpy(packet1.general_metadata_uri, packet_in.general_metadata_uri, sizeof(char)*100);
+	mav_array_memcpy(packet1.peripherals_metadata_uri, packet_in.peripherals_metadata_uri, sizeof(char)*100);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_component_information_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.general_metadata_file_crc , packet1.general_metadata_uri , packet1.peripherals_metadata_file_crc , packet1.peripherals_metadata_uri));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_component_information_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_component_information_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_component_metadata(Msgbench_Run &run)
+{
+	mavlink_component_metadata_t packet_in = {
+		(uint32_t)963497464, (uint32_t)963497672, "IJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABC"
+	};
+	mavlink_component_metadata_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.file_crc = packet_in.file_crc;
+	mav_array_memcpy(packet1.uri, packet_in.uri, sizeof(char)*100);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_component_metadata_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.file_crc , packet1.uri));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_component_metadata_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_component_metadata_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_play_tune_v2(Msgbench_Run &run)
+{
+	mavlink_play_tune_v2_t packet_in = {
+		(uint32_t)963497464, (uint8_t)17, (uint8_t)84, "GHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRS"
+	};
+	mavlink_play_tune_v2_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.format = packet_in.format;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	mav_array_memcpy(packet1.tune, packet_in.tune, sizeof(char)*248);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_play_tune_v2_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.format , packet1.tune));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_play_tune_v2_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_play_tune_v2_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_supported_tunes(Msgbench_Run &run)
+{
+	mavlink_supported_tunes_t packet_in = {
+		(uint32_t)963497464, (uint8_t)17, (uint8_t)84
+	};
+	mavlink_supported_tunes_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.format = packet_in.format;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_supported_tunes_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.format));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_supported_tunes_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_supported_tunes_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_event(Msgbench_Run &run)
+{
+	mavlink_event_t packet_in = {
+		(uint32_t)963497464, (uint32_t)963497672, (uint16_t)17651, (uint8_t)163, (uint8_t)230, (uint8_t)41, { (uint8_t)108, (uint8_t)109, (uint8_t)110, (uint8_t)111, (uint8_t)112, (uint8_t)113, (uint8_t)114, (uint8_t)115, (uint8_t)116, (uint8_t)117, (uint8_t)118, (uint8_t)119, (uint8_t)120, (uint8_t)121, (uint8_t)122, (uint8_t)123, (uint8_t)124, (uint8_t)125, (uint8_t)126, (uint8_t)127, (uint8_t)128, (uint8_t)129, (uint8_t)130, (uint8_t)131, (uint8_t)132, (uint8_t)133, (uint8_t)134, (uint8_t)135, (uint8_t)136, (uint8_t)137, (uint8_t)138, (uint8_t)139, (uint8_t)140, (uint8_t)141, (uint8_t)142, (uint8_t)143, (uint8_t)144, (uint8_t)145, (uint8_t)146, (uint8_t)147 }
+	};
+	mavlink_event_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.id = packet_in.id;
+	packet1.event_time_boot_ms = packet_in.event_time_boot_ms;
+	packet1.sequence = packet_in.sequence;
+	packet1.destination_component = packet_in.destination_component;
+	packet1.destination_system = packet_in.destination_system;
+	packet1.log_levels = packet_in.log_levels;
+	mav_array_memcpy(packet1.arguments, packet_in.arguments, sizeof(uint8_t)*40);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_event_pack(run.system_id, run.component_id, &run.message, packet1.destination_component , packet1.destination_system , packet1.id , packet1.event_time_boot_ms , packet1.sequence , packet1.log_levels , packet1.arguments));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_event_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_event_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_current_event_sequence(Msgbench_Run &run)
+{
+	mavlink_current_event_sequence_t packet_in = {
+		(uint16_t)17235, (uint8_t)139
+	};
+	mavlink_current_event_sequence_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.sequence = packet_in.sequence;
+	packet1.flags = packet_in.flags;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_current_event_sequence_pack(run.system_id, run.component_id, &run.message, packet1.sequence , packet1.flags));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_current_event_sequence_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_current_event_sequence_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_request_event(Msgbench_Run &run)
+{
+	mavlink_request_event_t packet_in = {
+		(uint16_t)17235, (uint16_t)17339, (uint8_t)17, (uint8_t)84
+	};
+	mavlink_request_event_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.first_sequence = packet_in.first_sequence;
+	packet1.last_sequence = packet_in.last_sequence;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_request_event_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.first_sequence , packet1.last_sequence));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_request_event_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_request_event_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_response_event_error(Msgbench_Run &run)
+{
+	mavlink_response_event_error_t packet_in = {
+		(uint16_t)17235, (uint16_t)17339, (uint8_t)17, (uint8_t)84, (uint8_t)151
+	};
+	mavlink_response_event_error_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.sequence = packet_in.sequence;
+	packet1.sequence_oldest_available = packet_in.sequence_oldest_available;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.reason = packet_in.reason;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_response_event_error_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.sequence , packet1.sequence_oldest_available , packet1.reason));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_response_event_error_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_response_event_error_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_wheel_distance(Msgbench_Run &run)
+{
+	mavlink_wheel_distance_t packet_in = {
+		(uint64_t)93372036854775807ULL, { (double)179.0, (double)180.0, (double)181.0, (double)182.0, (double)183.0, (double)184.0, (double)185.0, (double)186.0, (double)187.0, (double)188.0, (double)189.0, (double)190.0, (double)191.0, (double)192.0, (double)193.0, (double)194.0 }, (uint8_t)157
+	};
+	mavlink_wheel_distance_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.count = packet_in.count;
+	mav_array_memcpy(packet1.distance, packet_in.distance, sizeof(double)*16);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_wheel_distance_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.count , packet1.distance));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_wheel_distance_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_wheel_distance_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_winch_status(Msgbench_Run &run)
+{
+	mavlink_winch_status_t packet_in = {
+		(uint64_t)93372036854775807ULL, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (uint32_t)963498920, (int16_t)18899
+	};
+	mavlink_winch_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.line_length = packet_in.line_length;
+	packet1.speed = packet_in.speed;
+	packet1.tension = packet_in.tension;
+	packet1.voltage = packet_in.voltage;
+	packet1.current = packet_in.current;
+	packet1.status = packet_in.status;
+	packet1.temperature = packet_in.temperature;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_winch_status_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.line_length , packet1.speed , packet1.tension , packet1.voltage , packet1.current , packet1.temperature , packet1.status));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_winch_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_winch_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_uavionix_adsb_out_cfg(Msgbench_Run &run)
+{
+	mavlink_uavionix_adsb_out_cfg_t packet_in = {
+		(uint32_t)963497464, (uint16_t)17443, "GHIJKLMN", (uint8_t)242, (uint8_t)53, (uint8_t)120, (uint8_t)187, (uint8_t)254
+	};
+	mavlink_uavionix_adsb_out_cfg_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.ICAO = packet_in.ICAO;
+	packet1.stallSpeed = packet_in.stallSpeed;
+	packet1.emitterType = packet_in.emitterType;
+	packet1.aircraftSize = packet_in.aircraftSize;
+	packet1.gpsOffsetLat = packet_in.gpsOffsetLat;
+	packet1.gpsOffsetLon = packet_in.gpsOffsetLon;
+	packet1.rfSelect = packet_in.rfSelect;
+	mav_array_memcpy(packet1.callsign, packet_in.callsign, sizeof(char)*9);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_uavionix_adsb_out_cfg_pack(run.system_id, run.component_id, &run.message, packet1.ICAO , packet1.callsign , packet1.emitterType , packet1.aircraftSize , packet1.gpsOffsetLat , packet1.gpsOffsetLon , packet1.stallSpeed , packet1.rfSelect));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_uavionix_adsb_out_cfg_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_uavionix_adsb_out_cfg_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_uavionix_adsb_out_dynamic(Msgbench_Run &run)
+{
+	mavlink_uavionix_adsb_out_dynamic_t packet_in = {
+		(uint32_t)963497464, (int32_t)963497672, (int32_t)963497880, (int32_t)963498088, (int32_t)963498296, (uint32_t)963498504, (uint16_t)18483, (uint16_t)18587, (int16_t)18691, (int16_t)18795, (int16_t)18899, (uint16_t)19003, (uint16_t)19107, (uint8_t)247, (uint8_t)58, (uint8_t)125
+	};
+	mavlink_uavionix_adsb_out_dynamic_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.utcTime = packet_in.utcTime;
+	packet1.gpsLat = packet_in.gpsLat;
+	packet1.gpsLon = packet_in.gpsLon;
+	packet1.gpsAlt = packet_in.gpsAlt;
+	packet1.baroAltMSL = packet_in.baroAltMSL;
+	packet1.accuracyHor = packet_in.accuracyHor;
+	packet1.accuracyVert = packet_in.accuracyVert;
+	packet1.accuracyVel = packet_in.accuracyVel;
+	packet1.velVert = packet_in.velVert;
+	packet1.velNS = packet_in.velNS;
+	packet1.VelEW = packet_in.VelEW;
+	packet1.state = packet_in.state;
+	packet1.squawk = packet_in.squawk;
+	packet1.gpsFix = packet_in.gpsFix;
+	packet1.numSats = packet_in.numSats;
+	packet1.emergencyStatus = packet_in.emergencyStatus;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_uavionix_adsb_out_dynamic_pack(run.system_id, run.component_id, &run.message, packet1.utcTime , packet1.gpsLat , packet1.gpsLon , packet1.gpsAlt , packet1.gpsFix , packet1.numSats , packet1.baroAltMSL , packet1.accuracyHor , packet1.accuracyVert , packet1.accuracyVel , packet1.velVert , packet1.velNS , packet1.VelEW , packet1.emergencyStatus , packet1.state , packet1.squawk));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_uavionix_adsb_out_dynamic_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_uavionix_adsb_out_dynamic_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_uavionix_adsb_transceiver_health_report(Msgbench_Run &run)
+{
+	mavlink_uavionix_adsb_transceiver_health_report_t packet_in = {
+		(uint8_t)5
+	};
+	mavlink_uavionix_adsb_transceiver_health_report_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.rfHealth = packet_in.rfHealth;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_uavionix_adsb_transceiver_health_report_pack(run.system_id, run.component_id, &run.message, packet1.rfHealth));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_uavionix_adsb_transceiver_health_report_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_uavionix_adsb_transceiver_health_report_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_device_op_read(Msgbench_Run &run)
+{
+	mavlink_device_op_read_t packet_in = {
+		(uint32_t)963497464, (uint8_t)17, (uint8_t)84, (uint8_t)151, (uint8_t)218, (uint8_t)29, "JKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUV", (uint8_t)216, (uint8_t)27, (uint8_t)94
+	};
+	mavlink_device_op_read_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.request_id = packet_in.request_id;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.bustype = packet_in.bustype;
+	packet1.bus = packet_in.bus;
+	packet1.address = packet_in.address;
+	packet1.regstart = packet_in.regstart;
+	packet1.count = packet_in.count;
+	packet1.bank = packet_in.bank;
+	mav_array_memcpy(packet1.busname, packet_in.busname, sizeof(char)*40);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_device_op_read_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.request_id , packet1.bustype , packet1.bus , packet1.address , packet1.busname , packet1.regstart , packet1.count , packet1.bank));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_device_op_read_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_device_op_read_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_device_op_read_reply(Msgbench_Run &run)
+{
+	mavlink_device_op_read_reply_t packet_in = {
+		(uint32_t)963497464, (uint8_t)17, (uint8_t)84, (uint8_t)151, { (uint8_t)218, (uint8_t)219, (uint8_t)220, (uint8_t)221, (uint8_t)222, (uint8_t)223, (uint8_t)224, (uint8_t)225, (uint8_t)226, (uint8_t)227, (uint8_t)228, (uint8_t)229, (uint8_t)230, (uint8_t)231, (uint8_t)232, (uint8_t)233, (uint8_t)234, (uint8_t)235, (uint8_t)236, (uint8_t)237, (uint8_t)238, (uint8_t)239, (uint8_t)240, (uint8_t)241, (uint8_t)242, (uint8_t)243, (uint8_t)244, (uint8_t)245, (uint8_t)246, (uint8_t)247, (uint8_t)248, (uint8_t)249, (uint8_t)250, (uint8_t)251, (uint8_t)252, (uint8_t)253, (uint8_t)254, (uint8_t)255, (uint8_t)0, (uint8_t)1, (uint8_t)2, (uint8_t)3, (uint8_t)4, (uint8_t)5, (uint8_t)6, (uint8_t)7, (uint8_t)8, (uint8_t)9, (uint8_t)10, (uint8_t)11, (uint8_t)12, (uint8_t)13, (uint8_t)14, (uint8_t)15, (uint8_t)16, (uint8_t)17, (uint8_t)18, (uint8_t)19, (uint8_t)20, (uint8_t)21, (uint8_t)22, (uint8_t)23, (uint8_t)24, (uint8_t)25, (uint8_t)26, (uint8_t)27, (uint8_t)28, (uint8_t)29, (uint8_t)30, (uint8_t)31, (uint8_t)32, (uint8_t)33, (uint8_t)34, (uint8_t)35, (uint8_t)36, (uint8_t)37, (uint8_t)38, (uint8_t)39, (uint8_t)40, (uint8_t)41, (uint8_t)42, (uint8_t)43, (uint8_t)44, (uint8_t)45, (uint8_t)46, (uint8_t)47, (uint8_t)48, (uint8_t)49, (uint8_t)50, (uint8_t)51, (uint8_t)52, (uint8_t)53, (uint8_t)54, (uint8_t)55, (uint8_t)56, (uint8_t)57, (uint8_t)58, (uint8_t)59, (uint8_t)60, (uint8_t)61, (uint8_t)62, (uint8_t)63, (uint8_t)64, (uint8_t)65, (uint8_t)66, (uint8_t)67, (uint8_t)68, (uint8_t)69, (uint8_t)70, (uint8_t)71, (uint8_t)72, (uint8_t)73, (uint8_t)74, (uint8_t)75, (uint8_t)76, (uint8_t)77, (uint8_t)78, (uint8_t)79, (uint8_t)80, (uint8_t)81, (uint8_t)82, (uint8_t)83, (uint8_t)84, (uint8_t)85, (uint8_t)86, (uint8_t)87, (uint8_t)88, (uint8_t)89 }, (uint8_t)90
+	};
+	mavlink_device_op_read_reply_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.request_id = packet_in.request_id;
+	packet1.result = packet_in.result;
+	packet1.regstart = packet_in.regstart;
+	packet1.count = packet_in.count;
+	packet1.bank = packet_in.bank;
+	mav_array_memcpy(packet1.data, packet_in.data, sizeof(uint8_t)*128);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_device_op_read_reply_pack(run.system_id, run.component_id, &run.message, packet1.request_id , packet1.result , packet1.regstart , packet1.count , packet1.data , packet1.bank));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_device_op_read_reply_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_device_op_read_reply_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_device_op_write(Msgbench_Run &run)
+{
+	mavlink_device_op_write_t packet_in = {
+		(uint32_t)963497464, (uint8_t)17, (uint8_t)84, (uint8_t)151, (uint8_t)218, (uint8_t)29, "JKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUV", (uint8_t)216, (uint8_t)27, { (uint8_t)94, (uint8_t)95, (uint8_t)96, (uint8_t)97, (uint8_t)98, (uint8_t)99, (uint8_t)100, (uint8_t)101, (uint8_t)102, (uint8_t)103, (uint8_t)104, (uint8_t)105, (uint8_t)106, (uint8_t)107, (uint8_t)108, (uint8_t)109, (uint8_t)110, (uint8_t)111, (uint8_t)112, (uint8_t)113, (uint8_t)114, (uint8_t)115, (uint8_t)116, (uint8_t)117, (uint8_t)118, (uint8_t)119, (uint8_t)120, (uint8_t)121, (uint8_t)122, (uint8_t)123, (uint8_t)124, (uint8_t)125, (uint8_t)126, (uint8_t)127, (uint8_t)128, (uint8_t)129, (uint8_t)130, (uint8_t)131, (uint8_t)132, (uint8_t)133, (uint8_t)134, (uint8_t)135, (uint8_t)136, (uint8_t)137, (uint8_t)138, (uint8_t)139, (uint8_t)140, (uint8_t)141, (uint8_t)142, (uint8_t)143, (uint8_t)144, (uint8_t)145, (uint8_t)146, (uint8_t)147, (uint8_t)148, (uint8_t)149, (uint8_t)150, (uint8_t)151, (uint8_t)152, (uint8_t)153, (uint8_t)154, (uint8_t)155, (uint8_t)156, (uint8_t)157, (uint8_t)158, (uint8_t)159, (uint8_t)160, (uint8_t)161, (uint8_t)162, (uint8_t)163, (uint8_t)164, (uint8_t)165, (uint8_t)166, (uint8_t)167, (uint8_t)168, (uint8_t)169, (uint8_t)170, (uint8_t)171, (uint8_t)172, (uint8_t)173, (uint8_t)174, (uint8_t)175, (uint8_t)176, (uint8_t)177, (uint8_t)178, (uint8_t)179, (uint8_t)180, (uint8_t)181, (uint8_t)182, (uint8_t)183, (uint8_t)184, (uint8_t)185, (uint8_t)186, (uint8_t)187, (uint8_t)188, (uint8_t)189, (uint8_t)190, (uint8_t)191, (uint8_t)192, (uint8_t)193, (uint8_t)194, (uint8_t)195, (uint8_t)196, (uint8_t)197, (uint8_t)198, (uint8_t)199, (uint8_t)200, (uint8_t)201, (uint8_t)202, (uint8_t)203, (uint8_t)204, (uint8_t)205, (uint8_t)206, (uint8_t)207, (uint8_t)208, (uint8_t)209, (uint8_t)210, (uint8_t)211, (uint8_t)212, (uint8_t)213, (uint8_t)214, (uint8_t)215, (uint8_t)216, (uint8_t)217, (uint8_t)218, (uint8_t)219, (uint8_t)220, (uint8_t)221 }, (uint8_t)222
+	};
+	mavlink_device_op_write_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.request_id = packet_in.request_id;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.bustype = packet_in.bustype;
+	packet1.bus = packet_in.bus;
+	packet1.address = packet_in.address;
+	packet1.regstart = packet_in.regstart;
+	packet1.count = packet_in.count;
+	packet1.bank = packet_in.bank;
+	mav_array_memcpy(packet1.busname, packet_in.busname, sizeof(char)*40);
+	mav_array_memcpy(packet1.data, packet_in.data, sizeof(uint8_t)*128);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_device_op_write_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.request_id , packet1.bustype , packet1.bus , packet1.address , packet1.busname , packet1.regstart , packet1.count , packet1.data , packet1.bank));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_device_op_write_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_device_op_write_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_device_op_write_reply(Msgbench_Run &run)
+{
+	mavlink_device_op_write_reply_t packet_in = {
+		(uint32_t)963497464, (uint8_t)17
+	};
+	mavlink_device_op_write_reply_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.request_id = packet_in.request_id;
+	packet1.result = packet_in.result;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_device_op_write_reply_pack(run.system_id, run.component_id, &run.message, packet1.request_id , packet1.result));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_device_op_write_reply_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_device_op_write_reply_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_adap_tuning(Msgbench_Run &run)
+{
+	mavlink_adap_tuning_t packet_in = {
+		(float)17.0, (float)45.0, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, (float)241.0, (float)269.0, (float)297.0, (float)325.0, (uint8_t)149
+	};
+	mavlink_adap_tuning_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.desired = packet_in.desired;
+	packet1.achieved = packet_in.achieved;
+	packet1.error = packet_in.error;
+	packet1.theta = packet_in.theta;
+	packet1.omega = packet_in.omega;
+	packet1.sigma = packet_in.sigma;
+	packet1.theta_dot = packet_in.theta_dot;
+	packet1.omega_dot = packet_in.omega_dot;
+	packet1.sigma_dot = packet_in.sigma_dot;
+	packet1.f = packet_in.f;
+	packet1.f_dot = packet_in.f_dot;
+	packet1.u = packet_in.u;
+	packet1.axis = packet_in.axis;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_adap_tuning_pack(run.system_id, run.component_id, &run.message, packet1.axis , packet1.desired , packet1.achieved , packet1.error , packet1.theta , packet1.omega , packet1.sigma , packet1.theta_dot , packet1.omega_dot , packet1.sigma_dot , packet1.f , packet1.f_dot , packet1.u));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_adap_tuning_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_adap_tuning_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_vision_position_delta(Msgbench_Run &run)
+{
+	mavlink_vision_position_delta_t packet_in = {
+		(uint64_t)93372036854775807ULL, (uint64_t)93372036854776311ULL, { (float)129.0, (float)130.0, (float)131.0 }, { (float)213.0, (float)214.0, (float)215.0 }, (float)297.0
+	};
+	mavlink_vision_position_delta_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.time_delta_usec = packet_in.time_delta_usec;
+	packet1.confidence = packet_in.confidence;
+	mav_array_memcpy(packet1.angle_delta, packet_in.angle_delta, sizeof(float)*3);
+	mav_array_memcpy(packet1.position_delta, packet_in.position_delta, sizeof(float)*3);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_vision_position_delta_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.time_delta_usec , packet1.angle_delta , packet1.position_delta , packet1.confidence));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_vision_position_delta_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_vision_position_delta_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_aoa_ssa(Msgbench_Run &run)
+{
+	mavlink_aoa_ssa_t packet_in = {
+		(uint64_t)93372036854775807ULL, (float)73.0, (float)101.0
+	};
+	mavlink_aoa_ssa_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_usec = packet_in.time_usec;
+	packet1.AOA = packet_in.AOA;
+	packet1.SSA = packet_in.SSA;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_aoa_ssa_pack(run.system_id, run.component_id, &run.message, packet1.time_usec , packet1.AOA , packet1.SSA));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_aoa_ssa_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_aoa_ssa_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_esc_telemetry_1_to_4(Msgbench_Run &run)
+{
+	mavlink_esc_telemetry_1_to_4_t packet_in = {
+		{ (uint16_t)17235, (uint16_t)17236, (uint16_t)17237, (uint16_t)17238 }, { (uint16_t)17651, (uint16_t)17652, (uint16_t)17653, (uint16_t)17654 }, { (uint16_t)18067, (uint16_t)18068, (uint16_t)18069, (uint16_t)18070 }, { (uint16_t)18483, (uint16_t)18484, (uint16_t)18485, (uint16_t)18486 }, { (uint16_t)18899, (uint16_t)18900, (uint16_t)18901, (uint16_t)18902 }, { (uint8_t)125, (uint8_t)126, (uint8_t)127, (uint8_t)128 }
+	};
+	mavlink_esc_telemetry_1_to_4_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	mav_array_memcpy(packet1.voltage, packet_in.voltage, sizeof(uint16_t)*4);
+	mav_array_memcpy(packet1.current, packet_in.current, sizeof(uint16_t)*4);
+	mav_array_memcpy(packet1.totalcurrent, packet_in.totalcurrent, sizeof(uint16_t)*4);
+	mav_array_memcpy(packet1.rpm, packet_in.rpm, sizeof(uint16_t)*4);
+	mav_array_memcpy(packet1.count, packet_in.count, sizeof(uint16_t)*4);
+	mav_array_memcpy(packet1.temperature, packet_in.temperature, sizeof(uint8_t)*4);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_esc_telemetry_1_to_4_pack(run.system_id, run.component_id, &run.message, packet1.temperature , packet1.voltage , packet1.current , packet1.totalcurrent , packet1.rpm , packet1.count));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_esc_telemetry_1_to_4_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_esc_telemetry_1_to_4_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_esc_telemetry_5_to_8(Msgbench_Run &run)
+{
+	mavlink_esc_telemetry_5_to_8_t packet_in = {
+		{ (uint16_t)17235, (uint16_t)17236, (uint16_t)17237, (uint16_t)17238 }, { (uint16_t)17651, (uint16_t)17652, (uint16_t)17653, (uint16_t)17654 }, { (uint16_t)18067, (uint16_t)18068, (uint16_t)18069, (uint16_t)18070 }, { (uint16_t)18483, (uint16_t)18484, (uint16_t)18485, (uint16_t)18486 }, { (uint16_t)18899, (uint16_t)18900, (uint16_t)18901, (uint16_t)18902 }, { (uint8_t)125, (uint8_t)126, (uint8_t)127, (uint8_t)128 }
+	};
+	mavlink_esc_telemetry_5_to_8_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	mav_array_memcpy(packet1.voltage, packet_in.voltage, sizeof(uint16_t)*4);
+	mav_array_memcpy(packet1.current, packet_in.current, sizeof(uint16_t)*4);
+	mav_array_memcpy(packet1.totalcurrent, packet_in.totalcurrent, sizeof(uint16_t)*4);
+	mav_array_memcpy(packet1.rpm, packet_in.rpm, sizeof(uint16_t)*4);
+	mav_array_memcpy(packet1.count, packet_in.count, sizeof(uint16_t)*4);
+	mav_array_memcpy(packet1.temperature, packet_in.temperature, sizeof(uint8_t)*4);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_esc_telemetry_5_to_8_pack(run.system_id, run.component_id, &run.message, packet1.temperature , packet1.voltage , packet1.current , packet1.totalcurrent , packet1.rpm , packet1.count));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_esc_telemetry_5_to_8_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_esc_telemetry_5_to_8_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_esc_telemetry_9_to_12(Msgbench_Run &run)
+{
+	mavlink_esc_telemetry_9_to_12_t packet_in = {
+		{ (uint16_t)17235, (uint16_t)17236, (uint16_t)17237, (uint16_t)17238 }, { (uint16_t)17651, (uint16_t)17652, (uint16_t)17653, (uint16_t)17654 }, { (uint16_t)18067, (uint16_t)18068, (uint16_t)18069, (uint16_t)18070 }, { (uint16_t)18483, (uint16_t)18484, (uint16_t)18485, (uint16_t)18486 }, { (uint16_t)18899, (uint16_t)18900, (uint16_t)18901, (uint16_t)18902 }, { (uint8_t)125, (uint8_t)126, (uint8_t)127, (uint8_t)128 }
+	};
+	mavlink_esc_telemetry_9_to_12_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	mav_array_memcpy(packet1.voltage, packet_in.voltage, sizeof(uint16_t)*4);
+	mav_array_memcpy(packet1.current, packet_in.current, sizeof(uint16_t)*4);
+	mav_array_memcpy(packet1.totalcurrent, packet_in.totalcurrent, sizeof(uint16_t)*4);
+	mav_array_memcpy(packet1.rpm, packet_in.rpm, sizeof(uint16_t)*4);
+	mav_array_memcpy(packet1.count, packet_in.count, sizeof(uint16_t)*4);
+	mav_array_memcpy(packet1.temperature, packet_in.temperature, sizeof(uint8_t)*4);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_esc_telemetry_9_to_12_pack(run.system_id, run.component_id, &run.message, packet1.temperature , packet1.voltage , packet1.current , packet1.totalcurrent , packet1.rpm , packet1.count));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_esc_telemetry_9_to_12_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_esc_telemetry_9_to_12_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_osd_param_config(Msgbench_Run &run)
+{
+	mavlink_osd_param_config_t packet_in = {
+		(uint32_t)963497464, (float)45.0, (float)73.0, (float)101.0, (uint8_t)53, (uint8_t)120, (uint8_t)187, (uint8_t)254, "UVWXYZABCDEFGHI", (uint8_t)113
+	};
+	mavlink_osd_param_config_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.request_id = packet_in.request_id;
+	packet1.min_value = packet_in.min_value;
+	packet1.max_value = packet_in.max_value;
+	packet1.increment = packet_in.increment;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.osd_screen = packet_in.osd_screen;
+	packet1.osd_index = packet_in.osd_index;
+	packet1.config_type = packet_in.config_type;
+	mav_array_memcpy(packet1.param_id, packet_in.param_id, sizeof(char)*16);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_osd_param_config_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.request_id , packet1.osd_screen , packet1.osd_index , packet1.param_id , packet1.config_type , packet1.min_value , packet1.max_value , packet1.increment));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_osd_param_config_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_osd_param_config_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_osd_param_config_reply(Msgbench_Run &run)
+{
+	mavlink_osd_param_config_reply_t packet_in = {
+		(uint32_t)963497464, (uint8_t)17
+	};
+	mavlink_osd_param_config_reply_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.request_id = packet_in.request_id;
+	packet1.result = packet_in.result;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_osd_param_config_reply_pack(run.system_id, run.component_id, &run.message, packet1.request_id , packet1.result));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_osd_param_config_reply_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_osd_param_config_reply_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_osd_param_show_config(Msgbench_Run &run)
+{
+	mavlink_osd_param_show_config_t packet_in = {
+		(uint32_t)963497464, (uint8_t)17, (uint8_t)84, (uint8_t)151, (uint8_t)218
+	};
+	mavlink_osd_param_show_config_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.request_id = packet_in.request_id;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.osd_screen = packet_in.osd_screen;
+	packet1.osd_index = packet_in.osd_index;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_osd_param_show_config_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.request_id , packet1.osd_screen , packet1.osd_index));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_osd_param_show_config_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_osd_param_show_config_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_osd_param_show_config_reply(Msgbench_Run &run)
+{
+	mavlink_osd_param_show_config_reply_t packet_in = {
+		(uint32_t)963497464, (float)45.0, (float)73.0, (float)101.0, (uint8_t)53, "RSTUVWXYZABCDEF", (uint8_t)168
+	};
+	mavlink_osd_param_show_config_reply_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.request_id = packet_in.request_id;
+	packet1.min_value = packet_in.min_value;
+	packet1.max_value = packet_in.max_value;
+	packet1.increment = packet_in.increment;
+	packet1.result = packet_in.result;
+	packet1.config_type = packet_in.config_type;
+	mav_array_memcpy(packet1.param_id, packet_in.param_id, sizeof(char)*16);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_osd_param_show_config_reply_pack(run.system_id, run.component_id, &run.message, packet1.request_id , packet1.result , packet1.param_id , packet1.config_type , packet1.min_value , packet1.max_value , packet1.increment));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_osd_param_show_config_reply_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_osd_param_show_config_reply_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_obstacle_distance_3d(Msgbench_Run &run)
+{
+	mavlink_obstacle_distance_3d_t packet_in = {
+		(uint32_t)963497464, (float)45.0, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (uint16_t)18483, (uint8_t)211, (uint8_t)22
+	};
+	mavlink_obstacle_distance_3d_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.x = packet_in.x;
+	packet1.y = packet_in.y;
+	packet1.z = packet_in.z;
+	packet1.min_distance = packet_in.min_distance;
+	packet1.max_distance = packet_in.max_distance;
+	packet1.obstacle_id = packet_in.obstacle_id;
+	packet1.sensor_type = packet_in.sensor_type;
+	packet1.frame = packet_in.frame;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_obstacle_distance_3d_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.sensor_type , packet1.frame , packet1.obstacle_id , packet1.x , packet1.y , packet1.z , packet1.min_distance , packet1.max_distance));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_obstacle_distance_3d_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_obstacle_distance_3d_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_water_depth(Msgbench_Run &run)
+{
+	mavlink_water_depth_t packet_in = {
+		(uint32_t)963497464, (int32_t)963497672, (int32_t)963497880, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, (float)241.0, (uint8_t)113, (uint8_t)180
+	};
+	mavlink_water_depth_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.time_boot_ms = packet_in.time_boot_ms;
+	packet1.lat = packet_in.lat;
+	packet1.lng = packet_in.lng;
+	packet1.alt = packet_in.alt;
+	packet1.roll = packet_in.roll;
+	packet1.pitch = packet_in.pitch;
+	packet1.yaw = packet_in.yaw;
+	packet1.distance = packet_in.distance;
+	packet1.temperature = packet_in.temperature;
+	packet1.id = packet_in.id;
+	packet1.healthy = packet_in.healthy;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_water_depth_pack(run.system_id, run.component_id, &run.message, packet1.time_boot_ms , packet1.id , packet1.healthy , packet1.lat , packet1.lng , packet1.alt , packet1.roll , packet1.pitch , packet1.yaw , packet1.distance , packet1.temperature));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_water_depth_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_water_depth_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_mcu_status(Msgbench_Run &run)
+{
+	mavlink_mcu_status_t packet_in = {
+		(int16_t)17235, (uint16_t)17339, (uint16_t)17443, (uint16_t)17547, (uint8_t)29
+	};
+	mavlink_mcu_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.MCU_temperature = packet_in.MCU_temperature;
+	packet1.MCU_voltage = packet_in.MCU_voltage;
+	packet1.MCU_voltage_min = packet_in.MCU_voltage_min;
+	packet1.MCU_voltage_max = packet_in.MCU_voltage_max;
+	packet1.id = packet_in.id;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_mcu_status_pack(run.system_id, run.component_id, &run.message, packet1.id , packet1.MCU_temperature , packet1.MCU_voltage , packet1.MCU_voltage_min , packet1.MCU_voltage_max));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_mcu_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_mcu_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_open_drone_id_basic_id(Msgbench_Run &run)
+{
+	mavlink_open_drone_id_basic_id_t packet_in = {
+		(uint8_t)5, (uint8_t)72, { (uint8_t)139, (uint8_t)140, (uint8_t)141, (uint8_t)142, (uint8_t)143, (uint8_t)144, (uint8_t)145, (uint8_t)146, (uint8_t)147, (uint8_t)148, (uint8_t)149, (uint8_t)150, (uint8_t)151, (uint8_t)152, (uint8_t)153, (uint8_t)154, (uint8_t)155, (uint8_t)156, (uint8_t)157, (uint8_t)158 }, (uint8_t)199, (uint8_t)10, { (uint8_t)77, (uint8_t)78, (uint8_t)79, (uint8_t)80, (uint8_t)81, (uint8_t)82, (uint8_t)83, (uint8_t)84, (uint8_t)85, (uint8_t)86, (uint8_t)87, (uint8_t)88, (uint8_t)89, (uint8_t)90, (uint8_t)91, (uint8_t)92, (uint8_t)93, (uint8_t)94, (uint8_t)95, (uint8_t)96 }
+	};
+	mavlink_open_drone_id_basic_id_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.id_type = packet_in.id_type;
+	packet1.ua_type = packet_in.ua_type;
+	mav_array_memcpy(packet1.id_or_mac, packet_in.id_or_mac, sizeof(uint8_t)*20);
+	mav_array_memcpy(packet1.uas_id, packet_in.uas_id, sizeof(uint8_t)*20);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_open_drone_id_basic_id_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.id_or_mac , packet1.id_type , packet1.ua_type , packet1.uas_id));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_open_drone_id_basic_id_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_open_drone_id_basic_id_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_open_drone_id_location(Msgbench_Run &run)
+{
+	mavlink_open_drone_id_location_t packet_in = {
+		(int32_t)963497464, (int32_t)963497672, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (uint16_t)18483, (uint16_t)18587, (int16_t)18691, (uint8_t)223, (uint8_t)34, { (uint8_t)101, (uint8_t)102, (uint8_t)103, (uint8_t)104, (uint8_t)105, (uint8_t)106, (uint8_t)107, (uint8_t)108, (uint8_t)109, (uint8_t)110, (uint8_t)111, (uint8_t)112, (uint8_t)113, (uint8_t)114, (uint8_t)115, (uint8_t)116, (uint8_t)117, (uint8_t)118, (uint8_t)119, (uint8_t)120 }, (uint8_t)161, (uint8_t)228, (uint8_t)39, (uint8_t)106, (uint8_t)173, (uint8_t)240, (uint8_t)51
+	};
+	mavlink_open_drone_id_location_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.latitude = packet_in.latitude;
+	packet1.longitude = packet_in.longitude;
+	packet1.altitude_barometric = packet_in.altitude_barometric;
+	packet1.altitude_geodetic = packet_in.altitude_geodetic;
+	packet1.height = packet_in.height;
+	packet1.timestamp = packet_in.timestamp;
+	packet1.direction = packet_in.direction;
+	packet1.speed_horizontal = packet_in.speed_horizontal;
+	packet1.speed_vertical = packet_in.speed_vertical;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.status = packet_in.status;
+	packet1.height_reference = packet_in.height_reference;
+	packet1.horizontal_accuracy = packet_in.horizontal_accuracy;
+	packet1.vertical_accuracy = packet_in.vertical_accuracy;
+	packet1.barometer_accuracy = packet_in.barometer_accuracy;
+	packet1.speed_accuracy = packet_in.speed_accuracy;
+	packet1.timestamp_accuracy = packet_in.timestamp_accuracy;
+	mav_array_memcpy(packet1.id_or_mac, packet_in.id_or_mac, sizeof(uint8_t)*20);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_open_drone_id_location_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.id_or_mac , packet1.status , packet1.direction , packet1.speed_horizontal , packet1.speed_vertical , packet1.latitude , packet1.longitude , packet1.altitude_barometric , packet1.altitude_geodetic , packet1.height_reference , packet1.height , packet1.horizontal_accuracy , packet1.vertical_accuracy , packet1.barometer_accuracy , packet1.speed_accuracy , packet1.timestamp , packet1.timestamp_accuracy));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_open_drone_id_location_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_open_drone_id_location_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_open_drone_id_authentication(Msgbench_Run &run)
+{
+	mavlink_open_drone_id_authentication_t packet_in = {
+		(uint32_t)963497464, (uint8_t)17, (uint8_t)84, { (uint8_t)151, (uint8_t)152, (uint8_t)153, (uint8_t)154, (uint8_t)155, (uint8_t)156, (uint8_t)157, (uint8_t)158, (uint8_t)159, (uint8_t)160, (uint8_t)161, (uint8_t)162, (uint8_t)163, (uint8_t)164, (uint8_t)165, (uint8_t)166, (uint8_t)167, (uint8_t)168, (uint8_t)169, (uint8_t)170 }, (uint8_t)211, (uint8_t)22, (uint8_t)89, (uint8_t)156, { (uint8_t)223, (uint8_t)224, (uint8_t)225, (uint8_t)226, (uint8_t)227, (uint8_t)228, (uint8_t)229, (uint8_t)230, (uint8_t)231, (uint8_t)232, (uint8_t)233, (uint8_t)234, (uint8_t)235, (uint8_t)236, (uint8_t)237, (uint8_t)238, (uint8_t)239, (uint8_t)240, (uint8_t)241, (uint8_t)242, (uint8_t)243, (uint8_t)244, (uint8_t)245 }
+	};
+	mavlink_open_drone_id_authentication_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.timestamp = packet_in.timestamp;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.authentication_type = packet_in.authentication_type;
+	packet1.data_page = packet_in.data_page;
+	packet1.last_page_index = packet_in.last_page_index;
+	packet1.length = packet_in.length;
+	mav_array_memcpy(packet1.id_or_mac, packet_in.id_or_mac, sizeof(uint8_t)*20);
+	mav_array_memcpy(packet1.authentication_data, packet_in.authentication_data, sizeof(uint8_t)*23);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_open_drone_id_authentication_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.id_or_mac , packet1.authentication_type , packet1.data_page , packet1.last_page_index , packet1.length , packet1.timestamp , packet1.authentication_data));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_open_drone_id_authentication_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_open_drone_id_authentication_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_open_drone_id_self_id(Msgbench_Run &run)
+{
+	mavlink_open_drone_id_self_id_t packet_in = {
+		(uint8_t)5, (uint8_t)72, { (uint8_t)139, (uint8_t)140, (uint8_t)141, (uint8_t)142, (uint8_t)143, (uint8_t)144, (uint8_t)145, (uint8_t)146, (uint8_t)147, (uint8_t)148, (uint8_t)149, (uint8_t)150, (uint8_t)151, (uint8_t)152, (uint8_t)153, (uint8_t)154, (uint8_t)155, (uint8_t)156, (uint8_t)157, (uint8_t)158 }, (uint8_t)199, "XYZABCDEFGHIJKLMNOPQRS"
+	};
+	mavlink_open_drone_id_self_id_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.description_type = packet_in.description_type;
+	mav_array_memcpy(packet1.id_or_mac, packet_in.id_or_mac, sizeof(uint8_t)*20);
+	mav_array_memcpy(packet1.description, packet_in.description, sizeof(char)*23);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_open_drone_id_self_id_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.id_or_mac , packet1.description_type , packet1.description));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_open_drone_id_self_id_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_open_drone_id_self_id_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_open_drone_id_system(Msgbench_Run &run)
+{
+	mavlink_open_drone_id_system_t packet_in = {
+		(int32_t)963497464, (int32_t)963497672, (float)73.0, (float)101.0, (float)129.0, (uint32_t)963498504, (uint16_t)18483, (uint16_t)18587, (uint8_t)89, (uint8_t)156, { (uint8_t)223, (uint8_t)224, (uint8_t)225, (uint8_t)226, (uint8_t)227, (uint8_t)228, (uint8_t)229, (uint8_t)230, (uint8_t)231, (uint8_t)232, (uint8_t)233, (uint8_t)234, (uint8_t)235, (uint8_t)236, (uint8_t)237, (uint8_t)238, (uint8_t)239, (uint8_t)240, (uint8_t)241, (uint8_t)242 }, (uint8_t)27, (uint8_t)94, (uint8_t)161, (uint8_t)228
+	};
+	mavlink_open_drone_id_system_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.operator_latitude = packet_in.operator_latitude;
+	packet1.operator_longitude = packet_in.operator_longitude;
+	packet1.area_ceiling = packet_in.area_ceiling;
+	packet1.area_floor = packet_in.area_floor;
+	packet1.operator_altitude_geo = packet_in.operator_altitude_geo;
+	packet1.timestamp = packet_in.timestamp;
+	packet1.area_count = packet_in.area_count;
+	packet1.area_radius = packet_in.area_radius;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.operator_location_type = packet_in.operator_location_type;
+	packet1.classification_type = packet_in.classification_type;
+	packet1.category_eu = packet_in.category_eu;
+	packet1.class_eu = packet_in.class_eu;
+	mav_array_memcpy(packet1.id_or_mac, packet_in.id_or_mac, sizeof(uint8_t)*20);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_open_drone_id_system_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.id_or_mac , packet1.operator_location_type , packet1.classification_type , packet1.operator_latitude , packet1.operator_longitude , packet1.area_count , packet1.area_radius , packet1.area_ceiling , packet1.area_floor , packet1.category_eu , packet1.class_eu , packet1.operator_altitude_geo , packet1.timestamp));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_open_drone_id_system_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_open_drone_id_system_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_open_drone_id_operator_id(Msgbench_Run &run)
+{
+	mavlink_open_drone_id_operator_id_t packet_in = {
+		(uint8_t)5, (uint8_t)72, { (uint8_t)139, (uint8_t)140, (uint8_t)141, (uint8_t)142, (uint8_t)143, (uint8_t)144, (uint8_t)145, (uint8_t)146, (uint8_t)147, (uint8_t)148, (uint8_t)149, (uint8_t)150, (uint8_t)151, (uint8_t)152, (uint8_t)153, (uint8_t)154, (uint8_t)155, (uint8_t)156, (uint8_t)157, (uint8_t)158 }, (uint8_t)199, "XYZABCDEFGHIJKLMNOP"
+	};
+	mavlink_open_drone_id_operator_id_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.operator_id_type = packet_in.operator_id_type;
+	mav_array_memcpy(packet1.id_or_mac, packet_in.id_or_mac, sizeof(uint8_t)*20);
+	mav_array_memcpy(packet1.operator_id, packet_in.operator_id, sizeof(char)*20);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_open_drone_id_operator_id_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.id_or_mac , packet1.operator_id_type , packet1.operator_id));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_open_drone_id_operator_id_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_open_drone_id_operator_id_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_open_drone_id_message_pack(Msgbench_Run &run)
+{
+	mavlink_open_drone_id_message_pack_t packet_in = {
+		(uint8_t)5, (uint8_t)72, { (uint8_t)139, (uint8_t)140, (uint8_t)141, (uint8_t)142, (uint8_t)143, (uint8_t)144, (uint8_t)145, (uint8_t)146, (uint8_t)147, (uint8_t)148, (uint8_t)149, (uint8_t)150, (uint8_t)151, (uint8_t)152, (uint8_t)153, (uint8_t)154, (uint8_t)155, (uint8_t)156, (uint8_t)157, (uint8_t)158 }, (uint8_t)199, (uint8_t)10, { (uint8_t)77, (uint8_t)78, (uint8_t)79, (uint8_t)80, (uint8_t)81, (uint8_t)82, (uint8_t)83, (uint8_t)84, (uint8_t)85, (uint8_t)86, (uint8_t)87, (uint8_t)88, (uint8_t)89, (uint8_t)90, (uint8_t)91, (uint8_t)92, (uint8_t)93, (uint8_t)94, (uint8_t)95, (uint8_t)96, (uint8_t)97, (uint8_t)98, (uint8_t)99, (uint8_t)100, (uint8_t)101, (uint8_t)102, (uint8_t)103, (uint8_t)104, (uint8_t)105, (uint8_t)106, (uint8_t)107, (uint8_t)108, (uint8_t)109, (uint8_t)110, (uint8_t)111, (uint8_t)112, (uint8_t)113, (uint8_t)114, (uint8_t)115, (uint8_t)116, (uint8_t)117, (uint8_t)118, (uint8_t)119, (uint8_t)120, (uint8_t)121, (uint8_t)122, (uint8_t)123, (uint8_t)124, (uint8_t)125, (uint8_t)126, (uint8_t)127, (uint8_t)128, (uint8_t)129, (uint8_t)130, (uint8_t)131, (uint8_t)132, (uint8_t)133, (uint8_t)134, (uint8_t)135, (uint8_t)136, (uint8_t)137, (uint8_t)138, (uint8_t)139, (uint8_t)140, (uint8_t)141, (uint8_t)142, (uint8_t)143, (uint8_t)144, (uint8_t)145, (uint8_t)146, (uint8_t)147, (uint8_t)148, (uint8_t)149, (uint8_t)150, (uint8_t)151, (uint8_t)152, (uint8_t)153, (uint8_t)154, (uint8_t)155, (uint8_t)156, (uint8_t)157, (uint8_t)158, (uint8_t)159, (uint8_t)160, (uint8_t)161, (uint8_t)162, (uint8_t)163, (uint8_t)164, (uint8_t)165, (uint8_t)166, (uint8_t)167, (uint8_t)168, (uint8_t)169, (uint8_t)170, (uint8_t)171, (uint8_t)172, (uint8_t)173, (uint8_t)174, (uint8_t)175, (uint8_t)176, (uint8_t)177, (uint8_t)178, (uint8_t)179, (uint8_t)180, (uint8_t)181, (uint8_t)182, (uint8_t)183, (uint8_t)184, (uint8_t)185, (uint8_t)186, (uint8_t)187, (uint8_t)188, (uint8_t)189, (uint8_t)190, (uint8_t)191, (uint8_t)192, (uint8_t)193, (uint8_t)194, (uint8_t)195, (uint8_t)196, (uint8_t)197, (uint8_t)198, (uint8_t)199, (uint8_t)200, (uint8_t)201, (uint8_t)202, (uint8_t)203, (uint8_t)204, (uint8_t)205, (uint8_t)206, (uint8_t)207, (uint8_t)208, (uint8_t)209, (uint8_t)210, (uint8_t)211, (uint8_t)212, (uint8_t)213, (uint8_t)214, (uint8_t)215, (uint8_t)216, (uint8_t)217, (uint8_t)218, (uint8_t)219, (uint8_t)220, (uint8_t)221, (uint8_t)222, (uint8_t)223, (uint8_t)224, (uint8_t)225, (uint8_t)226, (uint8_t)227, (uint8_t)228, (uint8_t)229, (uint8_t)230, (uint8_t)231, (uint8_t)232, (uint8_t)233, (uint8_t)234, (uint8_t)235, (uint8_t)236, (uint8_t)237, (uint8_t)238, (uint8_t)239, (uint8_t)240, (uint8_t)241, (uint8_t)242, (uint8_t)243, (uint8_t)244, (uint8_t)245, (uint8_t)246, (uint8_t)247, (uint8_t)248, (uint8_t)249, (uint8_t)250, (uint8_t)251, (uint8_t)252, (uint8_t)253, (uint8_t)254, (uint8_t)255, (uint8_t)0, (uint8_t)1, (uint8_t)2, (uint8_t)3, (uint8_t)4, (uint8_t)5, (uint8_t)6, (uint8_t)7, (uint8_t)8, (uint8_t)9, (uint8_t)10, (uint8_t)11, (uint8_t)12, (uint8_t)13, (uint8_t)14, (uint8_t)15, (uint8_t)16, (uint8_t)17, (uint8_t)18, (uint8_t)19, (uint8_t)20, (uint8_t)21, (uint8_t)22, (uint8_t)23, (uint8_t)24, (uint8_t)25, (uint8_t)26, (uint8_t)27, (uint8_t)28, (uint8_t)29, (uint8_t)30, (uint8_t)31, (uint8_t)32, (uint8_t)33, (uint8_t)34, (uint8_t)35, (uint8_t)36, (uint8_t)37, (uint8_t)38, (uint8_t)39, (uint8_t)40, (uint8_t)41, (uint8_t)42, (uint8_t)43, (uint8_t)44, (uint8_t)45 }
+	};
+	mavlink_open_drone_id_message_pack_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	packet1.single_message_size = packet_in.single_message_size;
+	packet1.msg_pack_size = packet_in.msg_pack_size;
+	mav_array_memcpy(packet1.id_or_mac, packet_in.id_or_mac, sizeof(uint8_t)*20);
+	mav_array_memcpy(packet1.messages, packet_in.messages, sizeof(uint8_t)*225);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_open_drone_id_message_pack_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.id_or_mac , packet1.single_message_size , packet1.msg_pack_size , packet1.messages));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_open_drone_id_message_pack_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_open_drone_id_message_pack_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_open_drone_id_arm_status(Msgbench_Run &run)
+{
+	mavlink_open_drone_id_arm_status_t packet_in = {
+		(uint8_t)5, "BCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWX"
+	};
+	mavlink_open_drone_id_arm_status_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.status = packet_in.status;
+	mav_array_memcpy(packet1.error, packet_in.error, sizeof(char)*50);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_open_drone_id_arm_status_pack(run.system_id, run.component_id, &run.message, packet1.status , packet1.error));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_open_drone_id_arm_status_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_open_drone_id_arm_status_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_open_drone_id_system_update(Msgbench_Run &run)
+{
+	mavlink_open_drone_id_system_update_t packet_in = {
+		(int32_t)963497464, (int32_t)963497672, (float)73.0, (uint32_t)963498088, (uint8_t)53, (uint8_t)120
+	};
+	mavlink_open_drone_id_system_update_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.operator_latitude = packet_in.operator_latitude;
+	packet1.operator_longitude = packet_in.operator_longitude;
+	packet1.operator_altitude_geo = packet_in.operator_altitude_geo;
+	packet1.timestamp = packet_in.timestamp;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_open_drone_id_system_update_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.operator_latitude , packet1.operator_longitude , packet1.operator_altitude_geo , packet1.timestamp));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_open_drone_id_system_update_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_open_drone_id_system_update_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_hygrometer_sensor(Msgbench_Run &run)
+{
+	mavlink_hygrometer_sensor_t packet_in = {
+		(int16_t)17235, (uint16_t)17339, (uint8_t)17
+	};
+	mavlink_hygrometer_sensor_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.temperature = packet_in.temperature;
+	packet1.humidity = packet_in.humidity;
+	packet1.id = packet_in.id;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_hygrometer_sensor_pack(run.system_id, run.component_id, &run.message, packet1.id , packet1.temperature , packet1.humidity));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_hygrometer_sensor_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_hygrometer_sensor_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_icarous_heartbeat(Msgbench_Run &run)
+{
+	mavlink_icarous_heartbeat_t packet_in = {
+		(uint8_t)5
+	};
+	mavlink_icarous_heartbeat_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.status = packet_in.status;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_icarous_heartbeat_pack(run.system_id, run.component_id, &run.message, packet1.status));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_icarous_heartbeat_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_icarous_heartbeat_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_icarous_kinematic_bands(Msgbench_Run &run)
+{
+	mavlink_icarous_kinematic_bands_t packet_in = {
+		(float)17.0, (float)45.0, (float)73.0, (float)101.0, (float)129.0, (float)157.0, (float)185.0, (float)213.0, (float)241.0, (float)269.0, (int8_t)125, (uint8_t)192, (uint8_t)3, (uint8_t)70, (uint8_t)137, (uint8_t)204
+	};
+	mavlink_icarous_kinematic_bands_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.min1 = packet_in.min1;
+	packet1.max1 = packet_in.max1;
+	packet1.min2 = packet_in.min2;
+	packet1.max2 = packet_in.max2;
+	packet1.min3 = packet_in.min3;
+	packet1.max3 = packet_in.max3;
+	packet1.min4 = packet_in.min4;
+	packet1.max4 = packet_in.max4;
+	packet1.min5 = packet_in.min5;
+	packet1.max5 = packet_in.max5;
+	packet1.numBands = packet_in.numBands;
+	packet1.type1 = packet_in.type1;
+	packet1.type2 = packet_in.type2;
+	packet1.type3 = packet_in.type3;
+	packet1.type4 = packet_in.type4;
+	packet1.type5 = packet_in.type5;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_icarous_kinematic_bands_pack(run.system_id, run.component_id, &run.message, packet1.numBands , packet1.type1 , packet1.min1 , packet1.max1 , packet1.type2 , packet1.min2 , packet1.max2 , packet1.type3 , packet1.min3 , packet1.max3 , packet1.type4 , packet1.min4 , packet1.max4 , packet1.type5 , packet1.min5 , packet1.max5));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_icarous_kinematic_bands_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_icarous_kinematic_bands_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_cubepilot_raw_rc(Msgbench_Run &run)
+{
+	mavlink_cubepilot_raw_rc_t packet_in = {
+		{ (uint8_t)5, (uint8_t)6, (uint8_t)7, (uint8_t)8, (uint8_t)9, (uint8_t)10, (uint8_t)11, (uint8_t)12, (uint8_t)13, (uint8_t)14, (uint8_t)15, (uint8_t)16, (uint8_t)17, (uint8_t)18, (uint8_t)19, (uint8_t)20, (uint8_t)21, (uint8_t)22, (uint8_t)23, (uint8_t)24, (uint8_t)25, (uint8_t)26, (uint8_t)27, (uint8_t)28, (uint8_t)29, (uint8_t)30, (uint8_t)31, (uint8_t)32, (uint8_t)33, (uint8_t)34, (uint8_t)35, (uint8_t)36 }
+	};
+	mavlink_cubepilot_raw_rc_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	mav_array_memcpy(packet1.rc_raw, packet_in.rc_raw, sizeof(uint8_t)*32);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_cubepilot_raw_rc_pack(run.system_id, run.component_id, &run.message, packet1.rc_raw));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_cubepilot_raw_rc_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_cubepilot_raw_rc_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_herelink_video_stream_information(Msgbench_Run &run)
+{
+	mavlink_herelink_video_stream_information_t packet_in = {
+		(float)17.0, (uint32_t)963497672, (uint16_t)17651, (uint16_t)17755, (uint16_t)17859, (uint8_t)175, (uint8_t)242, "QRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJK"
+	};
+	mavlink_herelink_video_stream_information_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.framerate = packet_in.framerate;
+	packet1.bitrate = packet_in.bitrate;
+	packet1.resolution_h = packet_in.resolution_h;
+	packet1.resolution_v = packet_in.resolution_v;
+	packet1.rotation = packet_in.rotation;
+	packet1.camera_id = packet_in.camera_id;
+	packet1.status = packet_in.status;
+	mav_array_memcpy(packet1.uri, packet_in.uri, sizeof(char)*230);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_herelink_video_stream_information_pack(run.system_id, run.component_id, &run.message, packet1.camera_id , packet1.status , packet1.framerate , packet1.resolution_h , packet1.resolution_v , packet1.bitrate , packet1.rotation , packet1.uri));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_herelink_video_stream_information_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_herelink_video_stream_information_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_herelink_telem(Msgbench_Run &run)
+{
+	mavlink_herelink_telem_t packet_in = {
+		(uint32_t)963497464, (uint32_t)963497672, (uint32_t)963497880, (int16_t)17859, (int16_t)17963, (int16_t)18067, (uint8_t)187
+	};
+	mavlink_herelink_telem_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.rf_freq = packet_in.rf_freq;
+	packet1.link_bw = packet_in.link_bw;
+	packet1.link_rate = packet_in.link_rate;
+	packet1.snr = packet_in.snr;
+	packet1.cpu_temp = packet_in.cpu_temp;
+	packet1.board_temp = packet_in.board_temp;
+	packet1.rssi = packet_in.rssi;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_herelink_telem_pack(run.system_id, run.component_id, &run.message, packet1.rssi , packet1.snr , packet1.rf_freq , packet1.link_bw , packet1.link_rate , packet1.cpu_temp , packet1.board_temp));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_herelink_telem_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_herelink_telem_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_cubepilot_firmware_update_start(Msgbench_Run &run)
+{
+	mavlink_cubepilot_firmware_update_start_t packet_in = {
+		(uint32_t)963497464, (uint32_t)963497672, (uint8_t)29, (uint8_t)96
+	};
+	mavlink_cubepilot_firmware_update_start_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.size = packet_in.size;
+	packet1.crc = packet_in.crc;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_cubepilot_firmware_update_start_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.size , packet1.crc));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_cubepilot_firmware_update_start_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_cubepilot_firmware_update_start_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_cubepilot_firmware_update_resp(Msgbench_Run &run)
+{
+	mavlink_cubepilot_firmware_update_resp_t packet_in = {
+		(uint32_t)963497464, (uint8_t)17, (uint8_t)84
+	};
+	mavlink_cubepilot_firmware_update_resp_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.offset = packet_in.offset;
+	packet1.target_system = packet_in.target_system;
+	packet1.target_component = packet_in.target_component;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_cubepilot_firmware_update_resp_pack(run.system_id, run.component_id, &run.message, packet1.target_system , packet1.target_component , packet1.offset));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_cubepilot_firmware_update_resp_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_cubepilot_firmware_update_resp_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_airlink_auth(Msgbench_Run &run)
+{
+	mavlink_airlink_auth_t packet_in = {
+		"ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVW", "YZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTU"
+	};
+	mavlink_airlink_auth_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	mav_array_memcpy(packet1.login, packet_in.login, sizeof(char)*50);
+	mav_array_memcpy(packet1.password, packet_in.password, sizeof(char)*50);
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_airlink_auth_pack(run.system_id, run.component_id, &run.message, packet1.login , packet1.password));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_airlink_auth_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_airlink_auth_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+static void
+msgbench_airlink_auth_response(Msgbench_Run &run)
+{
+	mavlink_airlink_auth_response_t packet_in = {
+		(uint8_t)5
+	};
+	mavlink_airlink_auth_response_t packet1, packet2;
+	memset(&packet1, 0, sizeof(packet1));
+	packet1.resp_type = packet_in.resp_type;
+	memset(&packet2, 0, sizeof(packet2));
+
+	MSGBENCH_LOOP(run, MSGBENCH_PACK, &run.message, mavlink_msg_airlink_auth_response_pack(run.system_id, run.component_id, &run.message, packet1.resp_type));
+	MSGBENCH_LOOP(run, MSGBENCH_ENCODE, &run.message, mavlink_msg_airlink_auth_response_encode(run.system_id, run.component_id, &run.message, &packet1));
+	MSGBENCH_LOOP(run, MSGBENCH_DECODE, &packet2, mavlink_msg_airlink_auth_response_decode(&run.message, &packet2));
+	run.decoded = memcmp(&packet1, &packet2, sizeof(packet1)) == 0;
+}
+
+// by msgid, MSGBENCH_DIALECT where the message is compiled into spresense
+static const Msgbench_Entry msgbench_entries[] = {
+	{ MAVLINK_MSG_ID_HEARTBEAT, "HEARTBEAT", MSGBENCH_DIALECT, msgbench_heartbeat },
+	{ MAVLINK_MSG_ID_SYS_STATUS, "SYS_STATUS", MSGBENCH_DIALECT, msgbench_sys_status },
+	{ MAVLINK_MSG_ID_SYSTEM_TIME, "SYSTEM_TIME", MSGBENCH_DIALECT, msgbench_system_time },
+	{ MAVLINK_MSG_ID_PING, "PING", 0, msgbench_ping },
+	{ MAVLINK_MSG_ID_CHANGE_OPERATOR_CONTROL, "CHANGE_OPERATOR_CONTROL", 0, msgbench_change_operator_control },
+	{ MAVLINK_MSG_ID_CHANGE_OPERATOR_CONTROL_ACK, "CHANGE_OPERATOR_CONTROL_ACK", 0, msgbench_change_operator_control_ack },
+	{ MAVLINK_MSG_ID_AUTH_KEY, "AUTH_KEY", 0, msgbench_auth_key },
+	{ MAVLINK_MSG_ID_LINK_NODE_STATUS, "LINK_NODE_STATUS", 0, msgbench_link_node_status },
+	{ MAVLINK_MSG_ID_SET_MODE, "SET_MODE", MSGBENCH_DIALECT, msgbench_set_mode },
+	{ MAVLINK_MSG_ID_PARAM_REQUEST_READ, "PARAM_REQUEST_READ", MSGBENCH_DIALECT, msgbench_param_request_read },
+	{ MAVLINK_MSG_ID_PARAM_REQUEST_LIST, "PARAM_REQUEST_LIST", MSGBENCH_DIALECT, msgbench_param_request_list },
+	{ MAVLINK_MSG_ID_PARAM_VALUE, "PARAM_VALUE", MSGBENCH_DIALECT, msgbench_param_value },
+	{ MAVLINK_MSG_ID_PARAM_SET, "PARAM_SET", MSGBENCH_DIALECT, msgbench_param_set },
+	{ MAVLINK_MSG_ID_GPS_RAW_INT, "GPS_RAW_INT", MSGBENCH_DIALECT, msgbench_gps_raw_int },
+	{ MAVLINK_MSG_ID_GPS_STATUS, "GPS_STATUS", 0, msgbench_gps_status },
+	{ MAVLINK_MSG_ID_SCALED_IMU, "SCALED_IMU", 0, msgbench_scaled_imu },
+	{ MAVLINK_MSG_ID_RAW_IMU, "RAW_IMU", 0, msgbench_raw_imu },
+	{ MAVLINK_MSG_ID_RAW_PRESSURE, "RAW_PRESSURE", 0, msgbench_raw_pressure },
+	{ MAVLINK_MSG_ID_SCALED_PRESSURE, "SCALED_PRESSURE", 0, msgbench_scaled_pressure },
+	{ MAVLINK_MSG_ID_ATTITUDE, "ATTITUDE", MSGBENCH_DIALECT, msgbench_attitude },
+	{ MAVLINK_MSG_ID_ATTITUDE_QUATERNION, "ATTITUDE_QUATERNION", 0, msgbench_attitude_quaternion },
+	{ MAVLINK_MSG_ID_LOCAL_POSITION_NED, "LOCAL_POSITION_NED", MSGBENCH_DIALECT, msgbench_local_position_ned },
+	{ MAVLINK_MSG_ID_GLOBAL_POSITION_INT, "GLOBAL_POSITION_INT", MSGBENCH_DIALECT, msgbench_global_position_int },
+	{ MAVLINK_MSG_ID_RC_CHANNELS_SCALED, "RC_CHANNELS_SCALED", 0, msgbench_rc_channels_scaled },
+	{ MAVLINK_MSG_ID_RC_CHANNELS_RAW, "RC_CHANNELS_RAW", 0, msgbench_rc_channels_raw },
+	{ MAVLINK_MSG_ID_SERVO_OUTPUT_RAW, "SERVO_OUTPUT_RAW", 0, msgbench_servo_output_raw },
+	{ MAVLINK_MSG_ID_MISSION_REQUEST_PARTIAL_LIST, "MISSION_REQUEST_PARTIAL_LIST", 0, msgbench_mission_request_partial_list },
+	{ MAVLINK_MSG_ID_MISSION_WRITE_PARTIAL_LIST, "MISSION_WRITE_PARTIAL_LIST", 0, msgbench_mission_write_partial_list },
+	{ MAVLINK_MSG_ID_MISSION_ITEM, "MISSION_ITEM", 0, msgbench_mission_item },
+	{ MAVLINK_MSG_ID_MISSION_REQUEST, "MISSION_REQUEST", MSGBENCH_DIALECT, msgbench_mission_request },
+	{ MAVLINK_MSG_ID_MISSION_SET_CURRENT, "MISSION_SET_CURRENT", 0, msgbench_mission_set_current },
+	{ MAVLINK_MSG_ID_MISSION_CURRENT, "MISSION_CURRENT", 0, msgbench_mission_current },
+	{ MAVLINK_MSG_ID_MISSION_REQUEST_LIST, "MISSION_REQUEST_LIST", 0, msgbench_mission_request_list },
+	{ MAVLINK_MSG_ID_MISSION_COUNT, "MISSION_COUNT", MSGBENCH_DIALECT, msgbench_mission_count },
+	{ MAVLINK_MSG_ID_MISSION_CLEAR_ALL, "MISSION_CLEAR_ALL", 0, msgbench_mission_clear_all },
+	{ MAVLINK_MSG_ID_MISSION_ITEM_REACHED, "MISSION_ITEM_REACHED", 0, msgbench_mission_item_reached },
+	{ MAVLINK_MSG_ID_MISSION_ACK, "MISSION_ACK", MSGBENCH_DIALECT, msgbench_mission_ack },
+	{ MAVLINK_MSG_ID_SET_GPS_GLOBAL_ORIGIN, "SET_GPS_GLOBAL_ORIGIN", 0, msgbench_set_gps_global_origin },
+	{ MAVLINK_MSG_ID_GPS_GLOBAL_ORIGIN, "GPS_GLOBAL_ORIGIN", 0, msgbench_gps_global_origin },
+	{ MAVLINK_MSG_ID_PARAM_MAP_RC, "PARAM_MAP_RC", 0, msgbench_param_map_rc },
+	{ MAVLINK_MSG_ID_MISSION_REQUEST_INT, "MISSION_REQUEST_INT", MSGBENCH_DIALECT, msgbench_mission_request_int },
+	{ MAVLINK_MSG_ID_SAFETY_SET_ALLOWED_AREA, "SAFETY_SET_ALLOWED_AREA", 0, msgbench_safety_set_allowed_area },
+	{ MAVLINK_MSG_ID_SAFETY_ALLOWED_AREA, "SAFETY_ALLOWED_AREA", 0, msgbench_safety_allowed_area },
+	{ MAVLINK_MSG_ID_ATTITUDE_QUATERNION_COV, "ATTITUDE_QUATERNION_COV", 0, msgbench_attitude_quaternion_cov },
+	{ MAVLINK_MSG_ID_NAV_CONTROLLER_OUTPUT, "NAV_CONTROLLER_OUTPUT", 0, msgbench_nav_controller_output },
+	{ MAVLINK_MSG_ID_GLOBAL_POSITION_INT_COV, "GLOBAL_POSITION_INT_COV", 0, msgbench_global_position_int_cov },
+	{ MAVLINK_MSG_ID_LOCAL_POSITION_NED_COV, "LOCAL_POSITION_NED_COV", 0, msgbench_local_position_ned_cov },
+	{ MAVLINK_MSG_ID_RC_CHANNELS, "RC_CHANNELS", 0, msgbench_rc_channels },
+	{ MAVLINK_MSG_ID_REQUEST_DATA_STREAM, "REQUEST_DATA_STREAM", 0, msgbench_request_data_stream },
+	{ MAVLINK_MSG_ID_DATA_STREAM, "DATA_STREAM", 0, msgbench_data_stream },
+	{ MAVLINK_MSG_ID_MANUAL_CONTROL, "MANUAL_CONTROL", 0, msgbench_manual_control },
+	{ MAVLINK_MSG_ID_RC_CHANNELS_OVERRIDE, "RC_CHANNELS_OVERRIDE", 0, msgbench_rc_channels_override },
+	{ MAVLINK_MSG_ID_MISSION_ITEM_INT, "MISSION_ITEM_INT", MSGBENCH_DIALECT, msgbench_mission_item_int },
+	{ MAVLINK_MSG_ID_VFR_HUD, "VFR_HUD", 0, msgbench_vfr_hud },
+	{ MAVLINK_MSG_ID_COMMAND_INT, "COMMAND_INT", MSGBENCH_DIALECT, msgbench_command_int },
+	{ MAVLINK_MSG_ID_COMMAND_LONG, "COMMAND_LONG", MSGBENCH_DIALECT, msgbench_command_long },
+	{ MAVLINK_MSG_ID_COMMAND_ACK, "COMMAND_ACK", MSGBENCH_DIALECT, msgbench_command_ack },
+	{ MAVLINK_MSG_ID_COMMAND_CANCEL, "COMMAND_CANCEL", 0, msgbench_command_cancel },
+	{ MAVLINK_MSG_ID_MANUAL_SETPOINT, "MANUAL_SETPOINT", 0, msgbench_manual_setpoint },
+	{ MAVLINK_MSG_ID_SET_ATTITUDE_TARGET, "SET_ATTITUDE_TARGET", MSGBENCH_DIALECT, msgbench_set_attitude_target },
+	{ MAVLINK_MSG_ID_ATTITUDE_TARGET, "ATTITUDE_TARGET", 0, msgbench_attitude_target },
+	{ MAVLINK_MSG_ID_SET_POSITION_TARGET_LOCAL_NED, "SET_POSITION_TARGET_LOCAL_NED", MSGBENCH_DIALECT, msgbench_set_position_target_local_ned },
+	{ MAVLINK_MSG_ID_POSITION_TARGET_LOCAL_NED, "POSITION_TARGET_LOCAL_NED", MSGBENCH_DIALECT, msgbench_position_target_local_ned },
+	{ MAVLINK_MSG_ID_SET_POSITION_TARGET_GLOBAL_INT, "SET_POSITION_TARGET_GLOBAL_INT", MSGBENCH_DIALECT, msgbench_set_position_target_global_int },
+	{ MAVLINK_MSG_ID_POSITION_TARGET_GLOBAL_INT, "POSITION_TARGET_GLOBAL_INT", MSGBENCH_DIALECT, msgbench_position_target_global_int },
+	{ MAVLINK_MSG_ID_LOCAL_POSITION_NED_SYSTEM_GLOBAL_OFFSET, "LOCAL_POSITION_NED_SYSTEM_GLOBAL_OFFSET", 0, msgbench_local_position_ned_system_global_offset },
+	{ MAVLINK_MSG_ID_HIL_STATE, "HIL_STATE", 0, msgbench_hil_state },
+	{ MAVLINK_MSG_ID_HIL_CONTROLS, "HIL_CONTROLS", 0, msgbench_hil_controls },
+	{ MAVLINK_MSG_ID_HIL_RC_INPUTS_RAW, "HIL_RC_INPUTS_RAW", 0, msgbench_hil_rc_inputs_raw },
+	{ MAVLINK_MSG_ID_HIL_ACTUATOR_CONTROLS, "HIL_ACTUATOR_CONTROLS", 0, msgbench_hil_actuator_controls },
+	{ MAVLINK_MSG_ID_OPTICAL_FLOW, "OPTICAL_FLOW", 0, msgbench_optical_flow },
+	{ MAVLINK_MSG_ID_GLOBAL_VISION_POSITION_ESTIMATE, "GLOBAL_VISION_POSITION_ESTIMATE", 0, msgbench_global_vision_position_estimate },
+	{ MAVLINK_MSG_ID_VISION_POSITION_ESTIMATE, "VISION_POSITION_ESTIMATE", MSGBENCH_DIALECT, msgbench_vision_position_estimate },
+	{ MAVLINK_MSG_ID_VISION_SPEED_ESTIMATE, "VISION_SPEED_ESTIMATE", 0, msgbench_vision_speed_estimate },
+	{ MAVLINK_MSG_ID_VICON_POSITION_ESTIMATE, "VICON_POSITION_ESTIMATE", 0, msgbench_vicon_position_estimate },
+	{ MAVLINK_MSG_ID_HIGHRES_IMU, "HIGHRES_IMU", MSGBENCH_DIALECT, msgbench_highres_imu },
+	{ MAVLINK_MSG_ID_OPTICAL_FLOW_RAD, "OPTICAL_FLOW_RAD", 0, msgbench_optical_flow_rad },
+	{ MAVLINK_MSG_ID_HIL_SENSOR, "HIL_SENSOR", 0, msgbench_hil_sensor },
+	{ MAVLINK_MSG_ID_SIM_STATE, "SIM_STATE", 0, msgbench_sim_state },
+	{ MAVLINK_MSG_ID_RADIO_STATUS, "RADIO_STATUS", MSGBENCH_DIALECT, msgbench_radio_status },
+	{ MAVLINK_MSG_ID_FILE_TRANSFER_PROTOCOL, "FILE_TRANSFER_PROTOCOL", MSGBENCH_DIALECT, msgbench_file_transfer_protocol },
+	{ MAVLINK_MSG_ID_TIMESYNC, "TIMESYNC", MSGBENCH_DIALECT, msgbench_timesync },
+	{ MAVLINK_MSG_ID_CAMERA_TRIGGER, "CAMERA_TRIGGER", 0, msgbench_camera_trigger },
+	{ MAVLINK_MSG_ID_HIL_GPS, "HIL_GPS", MSGBENCH_DIALECT, msgbench_hil_gps },
+	{ MAVLINK_MSG_ID_HIL_OPTICAL_FLOW, "HIL_OPTICAL_FLOW", 0, msgbench_hil_optical_flow },
+	{ MAVLINK_MSG_ID_HIL_STATE_QUATERNION, "HIL_STATE_QUATERNION", 0, msgbench_hil_state_quaternion },
+	{ MAVLINK_MSG_ID_SCALED_IMU2, "SCALED_IMU2", 0, msgbench_scaled_imu2 },
+	{ MAVLINK_MSG_ID_LOG_REQUEST_LIST, "LOG_REQUEST_LIST", MSGBENCH_DIALECT, msgbench_log_request_list },
+	{ MAVLINK_MSG_ID_LOG_ENTRY, "LOG_ENTRY", 0, msgbench_log_entry },
+	{ MAVLINK_MSG_ID_LOG_REQUEST_DATA, "LOG_REQUEST_DATA", MSGBENCH_DIALECT, msgbench_log_request_data },
+	{ MAVLINK_MSG_ID_LOG_DATA, "LOG_DATA", 0, msgbench_log_data },
+	{ MAVLINK_MSG_ID_LOG_ERASE, "LOG_ERASE", 0, msgbench_log_erase },
+	{ MAVLINK_MSG_ID_LOG_REQUEST_END, "LOG_REQUEST_END", 0, msgbench_log_request_end },
+	{ MAVLINK_MSG_ID_GPS_INJECT_DATA, "GPS_INJECT_DATA", 0, msgbench_gps_inject_data },
+	{ MAVLINK_MSG_ID_GPS2_RAW, "GPS2_RAW", 0, msgbench_gps2_raw },
+	{ MAVLINK_MSG_ID_POWER_STATUS, "POWER_STATUS", 0, msgbench_power_status },
+	{ MAVLINK_MSG_ID_SERIAL_CONTROL, "SERIAL_CONTROL", 0, msgbench_serial_control },
+	{ MAVLINK_MSG_ID_GPS_RTK, "GPS_RTK", 0, msgbench_gps_rtk },
+	{ MAVLINK_MSG_ID_GPS2_RTK, "GPS2_RTK", 0, msgbench_gps2_rtk },
+	{ MAVLINK_MSG_ID_SCALED_IMU3, "SCALED_IMU3", 0, msgbench_scaled_imu3 },
+	{ MAVLINK_MSG_ID_DATA_TRANSMISSION_HANDSHAKE, "DATA_TRANSMISSION_HANDSHAKE", 0, msgbench_data_transmission_handshake },
+	{ MAVLINK_MSG_ID_ENCAPSULATED_DATA, "ENCAPSULATED_DATA", 0, msgbench_encapsulated_data },
+	{ MAVLINK_MSG_ID_DISTANCE_SENSOR, "DISTANCE_SENSOR", 0, msgbench_distance_sensor },
+	{ MAVLINK_MSG_ID_TERRAIN_REQUEST, "TERRAIN_REQUEST", 0, msgbench_terrain_request },
+	{ MAVLINK_MSG_ID_TERRAIN_DATA, "TERRAIN_DATA", 0, msgbench_terrain_data },
+	{ MAVLINK_MSG_ID_TERRAIN_CHECK, "TERRAIN_CHECK", 0, msgbench_terrain_check },
+	{ MAVLINK_MSG_ID_TERRAIN_REPORT, "TERRAIN_REPORT", 0, msgbench_terrain_report },
+	{ MAVLINK_MSG_ID_SCALED_PRESSURE2, "SCALED_PRESSURE2", 0, msgbench_scaled_pressure2 },
+	{ MAVLINK_MSG_ID_ATT_POS_MOCAP, "ATT_POS_MOCAP", 0, msgbench_att_pos_mocap },
+	{ MAVLINK_MSG_ID_SET_ACTUATOR_CONTROL_TARGET, "SET_ACTUATOR_CONTROL_TARGET", 0, msgbench_set_actuator_control_target },
+	{ MAVLINK_MSG_ID_ACTUATOR_CONTROL_TARGET, "ACTUATOR_CONTROL_TARGET", 0, msgbench_actuator_control_target },
+	{ MAVLINK_MSG_ID_ALTITUDE, "ALTITUDE", 0, msgbench_altitude },
+	{ MAVLINK_MSG_ID_RESOURCE_REQUEST, "RESOURCE_REQUEST", 0, msgbench_resource_request },
+	{ MAVLINK_MSG_ID_SCALED_PRESSURE3, "SCALED_PRESSURE3", 0, msgbench_scaled_pressure3 },
+	{ MAVLINK_MSG_ID_FOLLOW_TARGET, "FOLLOW_TARGET", 0, msgbench_follow_target },
+	{ MAVLINK_MSG_ID_CONTROL_SYSTEM_STATE, "CONTROL_SYSTEM_STATE", 0, msgbench_control_system_state },
+	{ MAVLINK_MSG_ID_BATTERY_STATUS, "BATTERY_STATUS", MSGBENCH_DIALECT, msgbench_battery_status },
+	{ MAVLINK_MSG_ID_AUTOPILOT_VERSION, "AUTOPILOT_VERSION", MSGBENCH_DIALECT, msgbench_autopilot_version },
+	{ MAVLINK_MSG_ID_LANDING_TARGET, "LANDING_TARGET", 0, msgbench_landing_target },
+	{ MAVLINK_MSG_ID_SENSOR_OFFSETS, "SENSOR_OFFSETS", 0, msgbench_sensor_offsets },
+	{ MAVLINK_MSG_ID_SET_MAG_OFFSETS, "SET_MAG_OFFSETS", 0, msgbench_set_mag_offsets },
+	{ MAVLINK_MSG_ID_MEMINFO, "MEMINFO", 0, msgbench_meminfo },
+	{ MAVLINK_MSG_ID_AP_ADC, "AP_ADC", 0, msgbench_ap_adc },
+	{ MAVLINK_MSG_ID_DIGICAM_CONFIGURE, "DIGICAM_CONFIGURE", 0, msgbench_digicam_configure },
+	{ MAVLINK_MSG_ID_DIGICAM_CONTROL, "DIGICAM_CONTROL", 0, msgbench_digicam_control },
+	{ MAVLINK_MSG_ID_MOUNT_CONFIGURE, "MOUNT_CONFIGURE", 0, msgbench_mount_configure },
+	{ MAVLINK_MSG_ID_MOUNT_CONTROL, "MOUNT_CONTROL", 0, msgbench_mount_control },
+	{ MAVLINK_MSG_ID_MOUNT_STATUS, "MOUNT_STATUS", 0, msgbench_mount_status },
+	{ MAVLINK_MSG_ID_FENCE_POINT, "FENCE_POINT", 0, msgbench_fence_point },
+	{ MAVLINK_MSG_ID_FENCE_FETCH_POINT, "FENCE_FETCH_POINT", 0, msgbench_fence_fetch_point },
+	{ MAVLINK_MSG_ID_FENCE_STATUS, "FENCE_STATUS", 0, msgbench_fence_status },
+	{ MAVLINK_MSG_ID_AHRS, "AHRS", 0, msgbench_ahrs },
+	{ MAVLINK_MSG_ID_SIMSTATE, "SIMSTATE", 0, msgbench_simstate },
+	{ MAVLINK_MSG_ID_HWSTATUS, "HWSTATUS", 0, msgbench_hwstatus },
+	{ MAVLINK_MSG_ID_RADIO, "RADIO", 0, msgbench_radio },
+	{ MAVLINK_MSG_ID_LIMITS_STATUS, "LIMITS_STATUS", 0, msgbench_limits_status },
+	{ MAVLINK_MSG_ID_WIND, "WIND", 0, msgbench_wind },
+	{ MAVLINK_MSG_ID_DATA16, "DATA16", 0, msgbench_data16 },
+	{ MAVLINK_MSG_ID_DATA32, "DATA32", 0, msgbench_data32 },
+	{ MAVLINK_MSG_ID_DATA64, "DATA64", 0, msgbench_data64 },
+	{ MAVLINK_MSG_ID_DATA96, "DATA96", 0, msgbench_data96 },
+	{ MAVLINK_MSG_ID_RANGEFINDER, "RANGEFINDER", 0, msgbench_rangefinder },
+	{ MAVLINK_MSG_ID_AIRSPEED_AUTOCAL, "AIRSPEED_AUTOCAL", 0, msgbench_airspeed_autocal },
+	{ MAVLINK_MSG_ID_RALLY_POINT, "RALLY_POINT", 0, msgbench_rally_point },
+	{ MAVLINK_MSG_ID_RALLY_FETCH_POINT, "RALLY_FETCH_POINT", 0, msgbench_rally_fetch_point },
+	{ MAVLINK_MSG_ID_COMPASSMOT_STATUS, "COMPASSMOT_STATUS", 0, msgbench_compassmot_status },
+	{ MAVLINK_MSG_ID_AHRS2, "AHRS2", 0, msgbench_ahrs2 },
+	{ MAVLINK_MSG_ID_CAMERA_STATUS, "CAMERA_STATUS", 0, msgbench_camera_status },
+	{ MAVLINK_MSG_ID_CAMERA_FEEDBACK, "CAMERA_FEEDBACK", 0, msgbench_camera_feedback },
+	{ MAVLINK_MSG_ID_BATTERY2, "BATTERY2", 0, msgbench_battery2 },
+	{ MAVLINK_MSG_ID_AHRS3, "AHRS3", 0, msgbench_ahrs3 },
+	{ MAVLINK_MSG_ID_AUTOPILOT_VERSION_REQUEST, "AUTOPILOT_VERSION_REQUEST", 0, msgbench_autopilot_version_request },
+	{ MAVLINK_MSG_ID_REMOTE_LOG_DATA_BLOCK, "REMOTE_LOG_DATA_BLOCK", MSGBENCH_DIALECT, msgbench_remote_log_data_block },
+	{ MAVLINK_MSG_ID_REMOTE_LOG_BLOCK_STATUS, "REMOTE_LOG_BLOCK_STATUS", MSGBENCH_DIALECT, msgbench_remote_log_block_status },
+	{ MAVLINK_MSG_ID_LED_CONTROL, "LED_CONTROL", 0, msgbench_led_control },
+	{ MAVLINK_MSG_ID_MAG_CAL_PROGRESS, "MAG_CAL_PROGRESS", 0, msgbench_mag_cal_progress },
+	{ MAVLINK_MSG_ID_MAG_CAL_REPORT, "MAG_CAL_REPORT", 0, msgbench_mag_cal_report },
+	{ MAVLINK_MSG_ID_EKF_STATUS_REPORT, "EKF_STATUS_REPORT", 0, msgbench_ekf_status_report },
+	{ MAVLINK_MSG_ID_PID_TUNING, "PID_TUNING", 0, msgbench_pid_tuning },
+	{ MAVLINK_MSG_ID_DEEPSTALL, "DEEPSTALL", 0, msgbench_deepstall },
+	{ MAVLINK_MSG_ID_GIMBAL_REPORT, "GIMBAL_REPORT", 0, msgbench_gimbal_report },
+	{ MAVLINK_MSG_ID_GIMBAL_CONTROL, "GIMBAL_CONTROL", 0, msgbench_gimbal_control },
+	{ MAVLINK_MSG_ID_GIMBAL_TORQUE_CMD_REPORT, "GIMBAL_TORQUE_CMD_REPORT", 0, msgbench_gimbal_torque_cmd_report },
+	{ MAVLINK_MSG_ID_GOPRO_HEARTBEAT, "GOPRO_HEARTBEAT", 0, msgbench_gopro_heartbeat },
+	{ MAVLINK_MSG_ID_GOPRO_GET_REQUEST, "GOPRO_GET_REQUEST", 0, msgbench_gopro_get_request },
+	{ MAVLINK_MSG_ID_GOPRO_GET_RESPONSE, "GOPRO_GET_RESPONSE", 0, msgbench_gopro_get_response },
+	{ MAVLINK_MSG_ID_GOPRO_SET_REQUEST, "GOPRO_SET_REQUEST", 0, msgbench_gopro_set_request },
+	{ MAVLINK_MSG_ID_GOPRO_SET_RESPONSE, "GOPRO_SET_RESPONSE", 0, msgbench_gopro_set_response },
+	{ MAVLINK_MSG_ID_EFI_STATUS, "EFI_STATUS", 0, msgbench_efi_status },
+	{ MAVLINK_MSG_ID_RPM, "RPM", 0, msgbench_rpm },
+	{ MAVLINK_MSG_ID_ESTIMATOR_STATUS, "ESTIMATOR_STATUS", 0, msgbench_estimator_status },
+	{ MAVLINK_MSG_ID_WIND_COV, "WIND_COV", 0, msgbench_wind_cov },
+	{ MAVLINK_MSG_ID_GPS_INPUT, "GPS_INPUT", MSGBENCH_DIALECT, msgbench_gps_input },
+	{ MAVLINK_MSG_ID_GPS_RTCM_DATA, "GPS_RTCM_DATA", 0, msgbench_gps_rtcm_data },
+	{ MAVLINK_MSG_ID_HIGH_LATENCY, "HIGH_LATENCY", 0, msgbench_high_latency },
+	{ MAVLINK_MSG_ID_HIGH_LATENCY2, "HIGH_LATENCY2", 0, msgbench_high_latency2 },
+	{ MAVLINK_MSG_ID_VIBRATION, "VIBRATION", 0, msgbench_vibration },
+	{ MAVLINK_MSG_ID_HOME_POSITION, "HOME_POSITION", 0, msgbench_home_position },
+	{ MAVLINK_MSG_ID_SET_HOME_POSITION, "SET_HOME_POSITION", 0, msgbench_set_home_position },
+	{ MAVLINK_MSG_ID_MESSAGE_INTERVAL, "MESSAGE_INTERVAL", MSGBENCH_DIALECT, msgbench_message_interval },
+	{ MAVLINK_MSG_ID_EXTENDED_SYS_STATE, "EXTENDED_SYS_STATE", MSGBENCH_DIALECT, msgbench_extended_sys_state },
+	{ MAVLINK_MSG_ID_ADSB_VEHICLE, "ADSB_VEHICLE", 0, msgbench_adsb_vehicle },
+	{ MAVLINK_MSG_ID_COLLISION, "COLLISION", 0, msgbench_collision },
+	{ MAVLINK_MSG_ID_V2_EXTENSION, "V2_EXTENSION", 0, msgbench_v2_extension },
+	{ MAVLINK_MSG_ID_MEMORY_VECT, "MEMORY_VECT", 0, msgbench_memory_vect },
+	{ MAVLINK_MSG_ID_DEBUG_VECT, "DEBUG_VECT", 0, msgbench_debug_vect },
+	{ MAVLINK_MSG_ID_NAMED_VALUE_FLOAT, "NAMED_VALUE_FLOAT", 0, msgbench_named_value_float },
+	{ MAVLINK_MSG_ID_NAMED_VALUE_INT, "NAMED_VALUE_INT", 0, msgbench_named_value_int },
+	{ MAVLINK_MSG_ID_STATUSTEXT, "STATUSTEXT", MSGBENCH_DIALECT, msgbench_statustext },
+	{ MAVLINK_MSG_ID_DEBUG, "DEBUG", 0, msgbench_debug },
+	{ MAVLINK_MSG_ID_SETUP_SIGNING, "SETUP_SIGNING", MSGBENCH_DIALECT, msgbench_setup_signing },
+	{ MAVLINK_MSG_ID_BUTTON_CHANGE, "BUTTON_CHANGE", 0, msgbench_button_change },
+	{ MAVLINK_MSG_ID_PLAY_TUNE, "PLAY_TUNE", 0, msgbench_play_tune },
+	{ MAVLINK_MSG_ID_CAMERA_INFORMATION, "CAMERA_INFORMATION", 0, msgbench_camera_information },
+	{ MAVLINK_MSG_ID_CAMERA_SETTINGS, "CAMERA_SETTINGS", 0, msgbench_camera_settings },
+	{ MAVLINK_MSG_ID_STORAGE_INFORMATION, "STORAGE_INFORMATION", 0, msgbench_storage_information },
+	{ MAVLINK_MSG_ID_CAMERA_CAPTURE_STATUS, "CAMERA_CAPTURE_STATUS", 0, msgbench_camera_capture_status },
+	{ MAVLINK_MSG_ID_CAMERA_IMAGE_CAPTURED, "CAMERA_IMAGE_CAPTURED", 0, msgbench_camera_image_captured },
+	{ MAVLINK_MSG_ID_FLIGHT_INFORMATION, "FLIGHT_INFORMATION", 0, msgbench_flight_information },
+	{ MAVLINK_MSG_ID_MOUNT_ORIENTATION, "MOUNT_ORIENTATION", 0, msgbench_mount_orientation },
+	{ MAVLINK_MSG_ID_LOGGING_DATA, "LOGGING_DATA", MSGBENCH_DIALECT, msgbench_logging_data },
+	{ MAVLINK_MSG_ID_LOGGING_DATA_ACKED, "LOGGING_DATA_ACKED", MSGBENCH_DIALECT, msgbench_logging_data_acked },
+	{ MAVLINK_MSG_ID_LOGGING_ACK, "LOGGING_ACK", MSGBENCH_DIALECT, msgbench_logging_ack },
+	{ MAVLINK_MSG_ID_VIDEO_STREAM_INFORMATION, "VIDEO_STREAM_INFORMATION", 0, msgbench_video_stream_information },
+	{ MAVLINK_MSG_ID_VIDEO_STREAM_STATUS, "VIDEO_STREAM_STATUS", 0, msgbench_video_stream_status },
+	{ MAVLINK_MSG_ID_CAMERA_FOV_STATUS, "CAMERA_FOV_STATUS", 0, msgbench_camera_fov_status },
+	{ MAVLINK_MSG_ID_CAMERA_TRACKING_IMAGE_STATUS, "CAMERA_TRACKING_IMAGE_STATUS", 0, msgbench_camera_tracking_image_status },
+	{ MAVLINK_MSG_ID_CAMERA_TRACKING_GEO_STATUS, "CAMERA_TRACKING_GEO_STATUS", 0, msgbench_camera_tracking_geo_status },
+	{ MAVLINK_MSG_ID_GIMBAL_MANAGER_INFORMATION, "GIMBAL_MANAGER_INFORMATION", 0, msgbench_gimbal_manager_information },
+	{ MAVLINK_MSG_ID_GIMBAL_MANAGER_STATUS, "GIMBAL_MANAGER_STATUS", 0, msgbench_gimbal_manager_status },
+	{ MAVLINK_MSG_ID_GIMBAL_MANAGER_SET_ATTITUDE, "GIMBAL_MANAGER_SET_ATTITUDE", 0, msgbench_gimbal_manager_set_attitude },
+	{ MAVLINK_MSG_ID_GIMBAL_DEVICE_INFORMATION, "GIMBAL_DEVICE_INFORMATION", 0, msgbench_gimbal_device_information },
+	{ MAVLINK_MSG_ID_GIMBAL_DEVICE_SET_ATTITUDE, "GIMBAL_DEVICE_SET_ATTITUDE", 0, msgbench_gimbal_device_set_attitude },
+	{ MAVLINK_MSG_ID_GIMBAL_DEVICE_ATTITUDE_STATUS, "GIMBAL_DEVICE_ATTITUDE_STATUS", 0, msgbench_gimbal_device_attitude_status },
+	{ MAVLINK_MSG_ID_AUTOPILOT_STATE_FOR_GIMBAL_DEVICE, "AUTOPILOT_STATE_FOR_GIMBAL_DEVICE", 0, msgbench_autopilot_state_for_gimbal_device },
+	{ MAVLINK_MSG_ID_GIMBAL_MANAGER_SET_PITCHYAW, "GIMBAL_MANAGER_SET_PITCHYAW", 0, msgbench_gimbal_manager_set_pitchyaw },
+	{ MAVLINK_MSG_ID_GIMBAL_MANAGER_SET_MANUAL_CONTROL, "GIMBAL_MANAGER_SET_MANUAL_CONTROL", 0, msgbench_gimbal_manager_set_manual_control },
+	{ MAVLINK_MSG_ID_ESC_INFO, "ESC_INFO", 0, msgbench_esc_info },
+	{ MAVLINK_MSG_ID_ESC_STATUS, "ESC_STATUS", 0, msgbench_esc_status },
+	{ MAVLINK_MSG_ID_WIFI_CONFIG_AP, "WIFI_CONFIG_AP", 0, msgbench_wifi_config_ap },
+	{ MAVLINK_MSG_ID_PROTOCOL_VERSION, "PROTOCOL_VERSION", 0, msgbench_protocol_version },
+	{ MAVLINK_MSG_ID_AIS_VESSEL, "AIS_VESSEL", 0, msgbench_ais_vessel },
+	{ MAVLINK_MSG_ID_UAVCAN_NODE_STATUS, "UAVCAN_NODE_STATUS", 0, msgbench_uavcan_node_status },
+	{ MAVLINK_MSG_ID_UAVCAN_NODE_INFO, "UAVCAN_NODE_INFO", 0, msgbench_uavcan_node_info },
+	{ MAVLINK_MSG_ID_PARAM_EXT_REQUEST_READ, "PARAM_EXT_REQUEST_READ", 0, msgbench_param_ext_request_read },
+	{ MAVLINK_MSG_ID_PARAM_EXT_REQUEST_LIST, "PARAM_EXT_REQUEST_LIST", 0, msgbench_param_ext_request_list },
+	{ MAVLINK_MSG_ID_PARAM_EXT_VALUE, "PARAM_EXT_VALUE", 0, msgbench_param_ext_value },
+	{ MAVLINK_MSG_ID_PARAM_EXT_SET, "PARAM_EXT_SET", 0, msgbench_param_ext_set },
+	{ MAVLINK_MSG_ID_PARAM_EXT_ACK, "PARAM_EXT_ACK", 0, msgbench_param_ext_ack },
+	{ MAVLINK_MSG_ID_OBSTACLE_DISTANCE, "OBSTACLE_DISTANCE", 0, msgbench_obstacle_distance },
+	{ MAVLINK_MSG_ID_ODOMETRY, "ODOMETRY", MSGBENCH_DIALECT, msgbench_odometry },
+	{ MAVLINK_MSG_ID_TRAJECTORY_REPRESENTATION_WAYPOINTS, "TRAJECTORY_REPRESENTATION_WAYPOINTS", 0, msgbench_trajectory_representation_waypoints },
+	{ MAVLINK_MSG_ID_TRAJECTORY_REPRESENTATION_BEZIER, "TRAJECTORY_REPRESENTATION_BEZIER", 0, msgbench_trajectory_representation_bezier },
+	{ MAVLINK_MSG_ID_CELLULAR_STATUS, "CELLULAR_STATUS", 0, msgbench_cellular_status },
+	{ MAVLINK_MSG_ID_ISBD_LINK_STATUS, "ISBD_LINK_STATUS", 0, msgbench_isbd_link_status },
+	{ MAVLINK_MSG_ID_CELLULAR_CONFIG, "CELLULAR_CONFIG", 0, msgbench_cellular_config },
+	{ MAVLINK_MSG_ID_RAW_RPM, "RAW_RPM", 0, msgbench_raw_rpm },
+	{ MAVLINK_MSG_ID_UTM_GLOBAL_POSITION, "UTM_GLOBAL_POSITION", 0, msgbench_utm_global_position },
+	{ MAVLINK_MSG_ID_DEBUG_FLOAT_ARRAY, "DEBUG_FLOAT_ARRAY", 0, msgbench_debug_float_array },
+	{ MAVLINK_MSG_ID_ORBIT_EXECUTION_STATUS, "ORBIT_EXECUTION_STATUS", 0, msgbench_orbit_execution_status },
+	{ MAVLINK_MSG_ID_SMART_BATTERY_INFO, "SMART_BATTERY_INFO", 0, msgbench_smart_battery_info },
+	{ MAVLINK_MSG_ID_GENERATOR_STATUS, "GENERATOR_STATUS", 0, msgbench_generator_status },
+	{ MAVLINK_MSG_ID_ACTUATOR_OUTPUT_STATUS, "ACTUATOR_OUTPUT_STATUS", 0, msgbench_actuator_output_status },
+	{ MAVLINK_MSG_ID_TIME_ESTIMATE_TO_TARGET, "TIME_ESTIMATE_TO_TARGET", 0, msgbench_time_estimate_to_target },
+	{ MAVLINK_MSG_ID_TUNNEL, "TUNNEL", 0, msgbench_tunnel },
+	{ MAVLINK_MSG_ID_CAN_FRAME, "CAN_FRAME", 0, msgbench_can_frame },
+	{ MAVLINK_MSG_ID_CANFD_FRAME, "CANFD_FRAME", 0, msgbench_canfd_frame },
+	{ MAVLINK_MSG_ID_CAN_FILTER_MODIFY, "CAN_FILTER_MODIFY", 0, msgbench_can_filter_modify },
+	{ MAVLINK_MSG_ID_ONBOARD_COMPUTER_STATUS, "ONBOARD_COMPUTER_STATUS", 0, msgbench_onboard_computer_status },
+	{ MAVLINK_MSG_ID_COMPONENT_INFORMATION, "COMPONENT_INFORMATION", 0, msgbench_component_information },
+	{ MAVLINK_MSG_ID_COMPONENT_METADATA, "COMPONENT_METADATA", 0, msgbench_component_metadata },
+	{ MAVLINK_MSG_ID_PLAY_TUNE_V2, "PLAY_TUNE_V2", 0, msgbench_play_tune_v2 },
+	{ MAVLINK_MSG_ID_SUPPORTED_TUNES, "SUPPORTED_TUNES", 0, msgbench_supported_tunes },
+	{ MAVLINK_MSG_ID_EVENT, "EVENT", 0, msgbench_event },
+	{ MAVLINK_MSG_ID_CURRENT_EVENT_SEQUENCE, "CURRENT_EVENT_SEQUENCE", 0, msgbench_current_event_sequence },
+	{ MAVLINK_MSG_ID_REQUEST_EVENT, "REQUEST_EVENT", 0, msgbench_request_event },
+	{ MAVLINK_MSG_ID_RESPONSE_EVENT_ERROR, "RESPONSE_EVENT_ERROR", 0, msgbench_response_event_error },
+	{ MAVLINK_MSG_ID_WHEEL_DISTANCE, "WHEEL_DISTANCE", 0, msgbench_wheel_distance },
+	{ MAVLINK_MSG_ID_WINCH_STATUS, "WINCH_STATUS", 0, msgbench_winch_status },
+	{ MAVLINK_MSG_ID_UAVIONIX_ADSB_OUT_CFG, "UAVIONIX_ADSB_OUT_CFG", 0, msgbench_uavionix_adsb_out_cfg },
+	{ MAVLINK_MSG_ID_UAVIONIX_ADSB_OUT_DYNAMIC, "UAVIONIX_ADSB_OUT_DYNAMIC", 0, msgbench_uavionix_adsb_out_dynamic },
+	{ MAVLINK_MSG_ID_UAVIONIX_ADSB_TRANSCEIVER_HEALTH_REPORT, "UAVIONIX_ADSB_TRANSCEIVER_HEALTH_REPORT", 0, msgbench_uavionix_adsb_transceiver_health_report },
+	{ MAVLINK_MSG_ID_DEVICE_OP_READ, "DEVICE_OP_READ", 0, msgbench_device_op_read },
+	{ MAVLINK_MSG_ID_DEVICE_OP_READ_REPLY, "DEVICE_OP_READ_REPLY", 0, msgbench_device_op_read_reply },
+	{ MAVLINK_MSG_ID_DEVICE_OP_WRITE, "DEVICE_OP_WRITE", 0, msgbench_device_op_write },
+	{ MAVLINK_MSG_ID_DEVICE_OP_WRITE_REPLY, "DEVICE_OP_WRITE_REPLY", 0, msgbench_device_op_write_reply },
+	{ MAVLINK_MSG_ID_ADAP_TUNING, "ADAP_TUNING", 0, msgbench_adap_tuning },
+	{ MAVLINK_MSG_ID_VISION_POSITION_DELTA, "VISION_POSITION_DELTA", 0, msgbench_vision_position_delta },
+	{ MAVLINK_MSG_ID_AOA_SSA, "AOA_SSA", 0, msgbench_aoa_ssa },
+	{ MAVLINK_MSG_ID_ESC_TELEMETRY_1_TO_4, "ESC_TELEMETRY_1_TO_4", 0, msgbench_esc_telemetry_1_to_4 },
+	{ MAVLINK_MSG_ID_ESC_TELEMETRY_5_TO_8, "ESC_TELEMETRY_5_TO_8", 0, msgbench_esc_telemetry_5_to_8 },
+	{ MAVLINK_MSG_ID_ESC_TELEMETRY_9_TO_12, "ESC_TELEMETRY_9_TO_12", 0, msgbench_esc_telemetry_9_to_12 },
+	{ MAVLINK_MSG_ID_OSD_PARAM_CONFIG, "OSD_PARAM_CONFIG", 0, msgbench_osd_param_config },
+	{ MAVLINK_MSG_ID_OSD_PARAM_CONFIG_REPLY, "OSD_PARAM_CONFIG_REPLY", 0, msgbench_osd_param_config_reply },
+	{ MAVLINK_MSG_ID_OSD_PARAM_SHOW_CONFIG, "OSD_PARAM_SHOW_CONFIG", 0, msgbench_osd_param_show_config },
+	{ MAVLINK_MSG_ID_OSD_PARAM_SHOW_CONFIG_REPLY, "OSD_PARAM_SHOW_CONFIG_REPLY", 0, msgbench_osd_param_show_config_reply },
+	{ MAVLINK_MSG_ID_OBSTACLE_DISTANCE_3D, "OBSTACLE_DISTANCE_3D", 0, msgbench_obstacle_distance_3d },
+	{ MAVLINK_MSG_ID_WATER_DEPTH, "WATER_DEPTH", 0, msgbench_water_depth },
+	{ MAVLINK_MSG_ID_MCU_STATUS, "MCU_STATUS", 0, msgbench_mcu_status },
+	{ MAVLINK_MSG_ID_OPEN_DRONE_ID_BASIC_ID, "OPEN_DRONE_ID_BASIC_ID", 0, msgbench_open_drone_id_basic_id },
+	{ MAVLINK_MSG_ID_OPEN_DRONE_ID_LOCATION, "OPEN_DRONE_ID_LOCATION", 0, msgbench_open_drone_id_location },
+	{ MAVLINK_MSG_ID_OPEN_DRONE_ID_AUTHENTICATION, "OPEN_DRONE_ID_AUTHENTICATION", 0, msgbench_open_drone_id_authentication },
+	{ MAVLINK_MSG_ID_OPEN_DRONE_ID_SELF_ID, "OPEN_DRONE_ID_SELF_ID", 0, msgbench_open_drone_id_self_id },
+	{ MAVLINK_MSG_ID_OPEN_DRONE_ID_SYSTEM, "OPEN_DRONE_ID_SYSTEM", 0, msgbench_open_drone_id_system },
+	{ MAVLINK_MSG_ID_OPEN_DRONE_ID_OPERATOR_ID, "OPEN_DRONE_ID_OPERATOR_ID", 0, msgbench_open_drone_id_operator_id },
+	{ MAVLINK_MSG_ID_OPEN_DRONE_ID_MESSAGE_PACK, "OPEN_DRONE_ID_MESSAGE_PACK", 0, msgbench_open_drone_id_message_pack },
+	{ MAVLINK_MSG_ID_OPEN_DRONE_ID_ARM_STATUS, "OPEN_DRONE_ID_ARM_STATUS", 0, msgbench_open_drone_id_arm_status },
+	{ MAVLINK_MSG_ID_OPEN_DRONE_ID_SYSTEM_UPDATE, "OPEN_DRONE_ID_SYSTEM_UPDATE", 0, msgbench_open_drone_id_system_update },
+	{ MAVLINK_MSG_ID_HYGROMETER_SENSOR, "HYGROMETER_SENSOR", 0, msgbench_hygrometer_sensor },
+	{ MAVLINK_MSG_ID_ICAROUS_HEARTBEAT, "ICAROUS_HEARTBEAT", 0, msgbench_icarous_heartbeat },
+	{ MAVLINK_MSG_ID_ICAROUS_KINEMATIC_BANDS, "ICAROUS_KINEMATIC_BANDS", 0, msgbench_icarous_kinematic_bands },
+	{ MAVLINK_MSG_ID_CUBEPILOT_RAW_RC, "CUBEPILOT_RAW_RC", 0, msgbench_cubepilot_raw_rc },
+	{ MAVLINK_MSG_ID_HERELINK_VIDEO_STREAM_INFORMATION, "HERELINK_VIDEO_STREAM_INFORMATION", 0, msgbench_herelink_video_stream_information },
+	{ MAVLINK_MSG_ID_HERELINK_TELEM, "HERELINK_TELEM", 0, msgbench_herelink_telem },
+	{ MAVLINK_MSG_ID_CUBEPILOT_FIRMWARE_UPDATE_START, "CUBEPILOT_FIRMWARE_UPDATE_START", 0, msgbench_cubepilot_firmware_update_start },
+	{ MAVLINK_MSG_ID_CUBEPILOT_FIRMWARE_UPDATE_RESP, "CUBEPILOT_FIRMWARE_UPDATE_RESP", 0, msgbench_cubepilot_firmware_update_resp },
+	{ MAVLINK_MSG_ID_AIRLINK_AUTH, "AIRLINK_AUTH", 0, msgbench_airlink_auth },
+	{ MAVLINK_MSG_ID_AIRLINK_AUTH_RESPONSE, "AIRLINK_AUTH_RESPONSE", 0, msgbench_airlink_auth_response },
+};
+
+#endif // MAVLINK_MSGBENCH_TABLE_H